@@ -37,6 +37,19 @@
 
  // Change how much data is read from a file at a time.
  #define LISP_FILE_CHUNK_SIZE 8192
+
+ // Read regular files in chunks instead of memory mapping them (on POSIX systems).
+ #define LISP_NO_MMAP
+
+ // Run parallel-map and futures in the calling thread,
+ // instead of a pool of threads with their own contexts (on POSIX systems),
+ // and collect on the calling thread (see lisp_set_gc_threads).
+ #define LISP_NO_THREADS
+
+ // Pack values into a single 64 bit word (NaN-boxing) instead of a value and type pair.
+ // Halves the size of values on the stack and in vectors.
+ // Integers are limited to 48 bits and pointers must fit in 48 bits.
+ #define LISP_TAGGED
  */
 
 
@@ -67,8 +80,17 @@ typedef enum
     LISP_PROMISE, // lazy value
     LISP_JUMP,    // jump point/non-escaping continuation
     LISP_PTR,     // pointer to arbitary C object.
+    LISP_LOCAL,   // resolved local variable reference (internal to eval).
+    LISP_CODE,    // compiled bytecode
+    LISP_FUNC_N,  // C function taking an argument vector
+    LISP_PORT,    // string output port
+    LISP_GLOBAL,  // resolved global variable reference (internal to eval).
+    LISP_F64VECTOR, // unboxed array of reals
+    LISP_S64VECTOR, // unboxed array of 64 bit ints
 } LispType;
 
+#define LISP_TYPE_COUNT (LISP_S64VECTOR + 1)
+
 typedef double LispReal;
 typedef long long LispInt;
 
@@ -79,13 +101,21 @@ typedef union
     LispInt int_val;  
     void* ptr_val;
     void(*func_val)(void);
+    uint64_t bits;
 } LispVal;
 
+#ifdef LISP_TAGGED
+typedef struct
+{
+    LispVal val;
+} Lisp; 
+#else
 typedef struct
 {
     LispVal val;
     LispType type;
 } Lisp; 
+#endif
 
 typedef enum
 {
@@ -100,6 +130,7 @@ typedef enum
     LISP_ERROR_TOO_MANY_ARGS,
     LISP_ERROR_TOO_FEW_ARGS,
     LISP_ERROR_RUNTIME,
+    LISP_ERROR_OUT_OF_MEMORY,
 } LispError;
 
 typedef struct
@@ -108,18 +139,118 @@ typedef struct
 } LispContext;
 
 typedef Lisp(*LispCFunc)(Lisp, LispError*, LispContext);
+typedef Lisp(*LispCFuncN)(int argc, Lisp* argv, LispError*, LispContext);
 
 // -----------------------------------------
 // CONTEXT
 // -----------------------------------------
 
+// Contexts share no mutable state, so each one can run on its own thread.
+// A single context must only be used by one thread at a time.
 LispContext lisp_init(void);
 void lisp_shutdown(LispContext ctx);
 
+// Copies x and everything it references into dst, preserving sharing and cycles.
+// Interned symbols are interned in dst, and references to src's global environment
+// become references to dst's, so procedures can be sent too.
+// Continuations can't be copied (LISP_ERROR_ARG_TYPE).
+// The copy only reads from src, so several threads may copy out of the same src at once,
+// as long as src is neither running nor collecting. dst must not be used by another thread.
+Lisp lisp_copy_to(Lisp x, LispContext src, LispContext dst, LispError* out_error);
+// Like lisp_copy_to, but also copies the globals in src's user environment
+// which the copied code refers to (transitively), defining them in dst's,
+// so a procedure can be called in dst.
+// src may be shared between threads in the same way as for lisp_copy_to.
+Lisp lisp_copy_closure_to(Lisp x, LispContext src, LispContext dst, LispError* out_error);
+
 // garbage collection. 
-// this will free all objects which are not reachable from root_to_save or the global env
+// this will free all objects which are not reachable from root_to_save or the global env.
+// Objects which survive a collection are promoted to an old generation
+// and ordinarily only the young generation is collected.
+// The old generation is collected too once it doubles in size (see lisp_set_heap_policy).
 Lisp lisp_collect(Lisp root_to_save, LispContext ctx);
+// Collects both generations.
+Lisp lisp_collect_full(Lisp root_to_save, LispContext ctx);
+// Optional automatic collection (off by default).
+// Once more than young_size bytes have been allocated since the last collection,
+// eval collects at the next safe point. Pass 0 to turn it off.
+// Only values reachable from eval are saved, so C functions which call eval or apply
+// must not hold on to Lisp values across the call.
+void lisp_set_auto_collect(size_t young_size, LispContext ctx);
+// Or they keep them on the lisp stack, where collections find and move them.
+// The slot holds x until it is popped. Errors and continuations pop it as well.
+Lisp* lisp_push_root(Lisp x, LispContext ctx);
+void lisp_pop_roots(int n, LispContext ctx);
+// Collects if automatic collection is due. Everything live must be in a root.
+void lisp_safe_point(LispContext ctx);
+
+// How the heap grows. The defaults are in brackets.
+typedef struct
+{
+    // pages made ready for allocation, and the smallest old generation
+    // which is fully collected (4 pages).
+    size_t initial_size;
+    // the old generation is fully collected when it grows by this factor
+    // since the last full collection (2.0).
+    double growth_factor;
+    // same as lisp_set_auto_collect (0, off).
+    size_t collect_size;
+    // once the young and old generations hold more than this many bytes,
+    // after automatic collection if it is on, eval fails with LISP_ERROR_OUT_OF_MEMORY
+    // at the next safe point. lisp_collect can bring it back under. (0, no limit)
+    size_t max_size;
+} LispHeapPolicy;
+LispHeapPolicy lisp_heap_policy(LispContext ctx);
+void lisp_set_heap_policy(LispHeapPolicy policy, LispContext ctx);
+// Handles hold values for the host between calls, such as cached procedures or loaded data.
+// Each one is a root until it is freed, and collections update it when the value moves,
+// so get the value again after anything which may collect.
+// 0 is never a handle.
+typedef int LispHandle;
+LispHandle lisp_handle_new(Lisp x, LispContext ctx);
+Lisp lisp_handle_get(LispHandle h, LispContext ctx);
+void lisp_handle_set(LispHandle h, Lisp x, LispContext ctx);
+void lisp_handle_free(LispHandle h, LispContext ctx);
+// Interned symbols live in their own space which is never moved or copied.
+// They are kept forever unless sweeping is enabled (off by default),
+// in which case full collections also free symbols nothing references.
+void lisp_set_symbol_sweep(int enabled, LispContext ctx);
+// Collections of more than LISP_GC_PARALLEL_SIZE bytes copy with this many threads.
+// The default, 1, collects on the calling thread.
+// Builds with LISP_NO_THREADS always do.
+void lisp_set_gc_threads(int threads, LispContext ctx);
 void lisp_print_collect_stats(LispContext ctx);
+
+#define LISP_GC_PAUSE_BUCKETS 20
+
+// Cumulative counters since the context was created.
+typedef struct
+{
+    size_t collections;
+    size_t full_collections;
+    // pause_histogram[0] counts pauses under 1us, [i] those from 2^(i-1) to 2^i us,
+    // and the last bucket everything longer.
+    size_t pause_histogram[LISP_GC_PAUSE_BUCKETS];
+    uint64_t pause_total_us;
+    uint64_t pause_max_us;
+    // copied by collections (surviving data)
+    size_t bytes_copied;
+    // allocations and requested bytes by type
+    size_t allocations[LISP_TYPE_COUNT];
+    size_t bytes_allocated[LISP_TYPE_COUNT];
+    // blocks in the old generation and symbol heap by type, as of the last collection.
+    // Dead old blocks are only discovered by full collections.
+    size_t live_count[LISP_TYPE_COUNT];
+    size_t live_bytes[LISP_TYPE_COUNT];
+    // pages taken from the free page pool instead of being allocated,
+    // and pages in the pool now.
+    size_t pages_reused;
+    size_t pages_pooled;
+} LispGCStats;
+
+LispGCStats lisp_gc_stats(LispContext ctx);
+// name of a type, in upper case like symbols ("PAIR", "VECTOR", ...)
+const char* lisp_type_name(LispType type);
 const char *lisp_error_string(LispError error);
 
 void lisp_set_env(Lisp env, LispContext ctx);
@@ -133,6 +264,27 @@ FILE *lisp_stdin(LispContext ctx);
 FILE *lisp_stderr(LispContext ctx);
 FILE *lisp_stdout(LispContext ctx);
 
+// Pseudo random numbers. Each context has its own generator.
+void lisp_seed_random(uint64_t seed, LispContext ctx);
+uint64_t lisp_random(LispContext ctx);
+
+// Profiling. Between begin and end, eval counts the calls, time and bytes allocated
+// of each lambda (by the name it was defined as) and C function.
+// Inclusive time counts callees, exclusive only the procedure itself.
+// With sampling, time is measured in ticks of a 1ms cpu time timer (SIGPROF),
+// which is cheaper than reading the clock, but coarser and only one context can use it at a time.
+// end writes a flat profile (most exclusive time first) to flat_file
+// and collapsed stacks ("a;b;c microseconds" lines, for flame graphs) to stacks_file.
+// Either may be NULL. Neither may be called during eval.
+void lisp_profile_begin(int sampling, LispContext ctx);
+void lisp_profile_end(FILE* flat_file, FILE* stacks_file, LispContext ctx);
+
+// The port which display, write, etc in the library write to.
+// lisp_null() (the default) means lisp_stdout.
+// If an error escapes lisp_eval, the port it started with is restored.
+void lisp_set_output_port(Lisp port, LispContext ctx);
+Lisp lisp_output_port(LispContext ctx);
+
 // Macros
 Lisp lisp_macro_table(LispContext ctx);
 // the macro table keeps strong references to its members. 
@@ -148,18 +300,58 @@ Lisp lisp_read(const char *text, LispError* out_error, LispContext ctx);
 Lisp lisp_read_file(FILE *file, LispError* out_error, LispContext ctx);
 Lisp lisp_read_path(const char* path, LispError* out_error, LispContext ctx);
 
+// Like lisp_read, but equal strings, lists and vectors in the text
+// are read as one object, so repetitive data takes less memory.
+// The result must be treated as read-only since mutating one part changes every copy.
+Lisp lisp_read_shared(const char *text, LispError* out_error, LispContext ctx);
+Lisp lisp_read_file_shared(FILE *file, LispError* out_error, LispContext ctx);
+
+// Reads a file one top level datum at a time, instead of all at once.
+// The reader holds no lisp values, so it is safe to collect between calls.
+typedef struct LispReader LispReader;
+LispReader* lisp_reader_open(FILE* file);
+// Returns lisp_eof() at the end of the file.
+// After an error the reader can only be closed.
+Lisp lisp_reader_next(LispReader* reader, LispError* out_error, LispContext ctx);
+void lisp_reader_close(LispReader* reader);
+
+// Compact binary encoding of data (lists, vectors, numeric vectors, strings, symbols, numbers, chars, bools and tables).
+// Much faster to load than text. Each call writes or reads one self contained record,
+// so several can be stored in one file.
+// Writing values with no external representation (procedures, etc) fails with LISP_ERROR_ARG_TYPE.
+void lisp_write_binary(FILE* file, Lisp x, LispError* out_error, LispContext ctx);
+// Returns lisp_eof() at the end of the file.
+Lisp lisp_read_binary(FILE* file, LispError* out_error, LispContext ctx);
+
 // evaluate a lisp expression
 Lisp lisp_eval(Lisp expr, LispError* out_error, LispContext ctx);
 Lisp lisp_eval2(Lisp expr, Lisp env, LispError* out_error, LispContext ctx);
 Lisp lisp_apply(Lisp operator, Lisp args, LispError* out_error, LispContext ctx);
+// Like lisp_apply, with argc arguments from argv instead of a list.
+// Resolved lambdas and C functions taking a vector don't allocate for them.
+Lisp lisp_apply_argv(Lisp operator, int argc, Lisp* argv, LispError* out_error, LispContext ctx);
+// Like lisp_eval2, but remembers the expanded code for expr (by identity),
+// so evaluating the same form again skips expansion.
+// A copy of the form is kept with it, so a form which has been modified is expanded again.
+// The cache is dropped by full collections and when a macro is defined.
+Lisp lisp_eval_cached(Lisp expr, Lisp env, LispError* out_error, LispContext ctx);
 // Expands special Lisp forms and checks syntax (called by eval).
 Lisp lisp_macroexpand(Lisp lisp, LispError* out_error, LispContext ctx);
+// Optional. Expands and compiles an expression to bytecode, which can be passed to eval.
+// Lambdas created by compiled code have compiled bodies.
+Lisp lisp_compile(Lisp expr, LispError* out_error, LispContext ctx);
 
 // print out a lisp structure in 
 void lisp_print(Lisp l);
 void lisp_printf(FILE *file, Lisp l);
+void lisp_port_print(Lisp port, Lisp l, LispContext ctx);
 
 void lisp_displayf(FILE *file, Lisp l);
+void lisp_port_display(Lisp port, Lisp l, LispContext ctx);
+
+// Prints to a malloc'd, null terminated buffer, which the caller frees.
+// The length (without the terminator) is stored in out_length unless it is NULL.
+char* lisp_print_to_buffer(Lisp l, size_t* out_length);
 
 // Calls proc with an argument containing the current continuation.
 Lisp lisp_call_cc(Lisp proc, LispError* out_error, LispContext ctx);
@@ -167,13 +359,20 @@ Lisp lisp_call_cc(Lisp proc, LispError* out_error, LispContext ctx);
 // -----------------------------------------
 // PRIMITIVES
 // -----------------------------------------
+#ifdef LISP_TAGGED
+LispType lisp_tagged_type(Lisp x);
+#define lisp_type(x) lisp_tagged_type(x)
+#define lisp_eq(a, b) ((a).val.bits == (b).val.bits)
+#define lisp_null() ((Lisp) { .val = { .bits = 0 } })
+#define lisp_is_null(x) ((x).val.bits == 0)
+#else
 #define lisp_type(x) ((x).type)
 #define lisp_eq(a, b) ((a).val.ptr_val == (b).val.ptr_val)
-int lisp_equal(Lisp a, Lisp b);
-int lisp_equal_r(Lisp a, Lisp b);
 #define lisp_null() ((Lisp) { .val = { .ptr_val = NULL }, .type = LISP_NULL })
-
 #define lisp_is_null(x) ((x).type == LISP_NULL)
+#endif
+int lisp_equal(Lisp a, Lisp b);
+int lisp_equal_r(Lisp a, Lisp b);
 
 // Pairs
 Lisp lisp_car(Lisp p);
@@ -181,7 +380,7 @@ Lisp lisp_cdr(Lisp p);
 void lisp_set_car(Lisp p, Lisp x);
 void lisp_set_cdr(Lisp p, Lisp x);
 Lisp lisp_cons(Lisp car, Lisp cdr, LispContext ctx);
-#define lisp_is_pair(p) ((p).type == LISP_PAIR)
+#define lisp_is_pair(p) (lisp_type(p) == LISP_PAIR)
 
 // Numbers
 Lisp lisp_make_int(LispInt n);
@@ -219,11 +418,20 @@ int lisp_string_length(Lisp s);
 const char *lisp_string(Lisp s);
 
 // Low level string storage
-Lisp lisp_make_buffer(int cap, LispContext ctx);
+Lisp lisp_make_buffer(int cap, LispContext ctx); // empty string with room for cap bytes.
 Lisp lisp_buffer_copy(Lisp s, LispContext ctx);
 void lisp_buffer_fill(Lisp s, int start, int end, int x);
 char *lisp_buffer(Lisp s);
 int lisp_buffer_capacity(Lisp s);
+// Strings store their length. After writing a string in to a buffer,
+// set its length (less than the capacity). The terminator is written too.
+void lisp_buffer_set_length(Lisp s, int length);
+
+// String ports. A growable string, for building output without repeated copies.
+Lisp lisp_make_string_port(LispContext ctx);
+void lisp_port_write(Lisp port, const char* bytes, int n, LispContext ctx);
+// a copy of everything written so far.
+Lisp lisp_port_string(Lisp port, LispContext ctx);
 
 // Symbols (interned strings)
 Lisp lisp_make_symbol(const char *string, LispContext ctx);
@@ -271,8 +479,22 @@ Lisp lisp_subvector(Lisp old, int start, int end, LispContext ctx);
 // association vector like "alist"
 Lisp lisp_avector_ref(Lisp l, Lisp key); // O(n)
 
+// Numeric vectors. Contiguous arrays of doubles or 64 bit ints, which the collector doesn't scan.
+// Contents are uninitialized. The data pointer is valid until the next collection.
+// LISP_TAGGED builds truncate ints outside their range when they are made with lisp_make_int,
+// so the library's s64vector procedures report LISP_ERROR_OUT_OF_BOUNDS for them instead.
+Lisp lisp_make_f64vector(int n, LispContext ctx);
+int lisp_f64vector_length(Lisp v);
+LispReal* lisp_f64vector(Lisp v);
+
+Lisp lisp_make_s64vector(int n, LispContext ctx);
+int lisp_s64vector_length(Lisp v);
+LispInt* lisp_s64vector(Lisp v);
+
 // Hash tables
 Lisp lisp_make_table(LispContext ctx);
+// keys are compared by value (lisp_equal_r), for example strings.
+Lisp lisp_make_equal_table(LispContext ctx);
 void lisp_table_set(Lisp t, Lisp key, Lisp x, LispContext ctx);
 Lisp lisp_table_get(Lisp t, Lisp key, int* present);
 int lisp_table_size(Lisp t);
@@ -283,6 +505,7 @@ Lisp lisp_table_to_alist(Lisp t, LispContext ctx);
 // -----------------------------------------
 
 // Lambdas (compound procedures)
+// body is expanded once here, instead of on every call.
 Lisp lisp_make_lambda(Lisp args, Lisp body, Lisp env, LispContext ctx);
 Lisp lisp_lambda_body(Lisp l);
 Lisp lisp_lambda_env(Lisp l);
@@ -291,14 +514,36 @@ Lisp lisp_lambda_env(Lisp l);
 Lisp lisp_make_func(LispCFunc func_ptr);
 LispCFunc lisp_func(Lisp l);
 
+// C functions which receive their arguments in an array instead of a list.
+// Calls are checked against min_args and max_args (-1 for no limit),
+// so the function doesn't need to.
+// argv is only valid until the function returns.
+Lisp lisp_make_func_n(LispCFuncN func_ptr, int min_args, int max_args, LispContext ctx);
+LispCFuncN lisp_func_n(Lisp l);
+
 // Convenience for defining many C functions at a time. 
+// Either func_ptr, or func_n_ptr and its arity.
 typedef struct
 {
     const char* name;
     LispCFunc func_ptr;
+    LispCFuncN func_n_ptr;
+    int min_args;
+    int max_args;
 } LispFuncDef;
 void lisp_table_define_funcs(Lisp t, const LispFuncDef* defs, LispContext ctx);
 
+// Images are snapshots of a context's heap, symbols, environment and macros,
+// so a new context can start without loading and evaluating code again.
+// C functions are saved as their index in funcs, a table terminated like lisp_table_define_funcs,
+// so the image can be loaded by another program which defines the same table.
+// Saving does a full collection. Returns a malloc'd buffer, or NULL if something
+// can't be saved (a function not in funcs, a pointer, or a continuation).
+void* lisp_image_save(const LispFuncDef* funcs, size_t* out_size, LispContext ctx);
+// Images only load in builds with the same options (LISP_TAGGED, LISP_PAGE_SIZE, etc).
+// Returns a context with a NULL p otherwise.
+LispContext lisp_init_image(const void* image, size_t size, const LispFuncDef* funcs);
+
 // Evaluation environments
 Lisp lisp_env_extend(Lisp l, Lisp table, LispContext ctx);
 Lisp lisp_env_lookup(Lisp l, Lisp key, int *present);
@@ -318,7 +563,11 @@ void lisp_promise_store(Lisp p, Lisp x);
 #endif
 
 #ifndef LISP_PAGE_SIZE
-#define LISP_PAGE_SIZE 512 * 1024
+#define LISP_PAGE_SIZE (512 * 1024)
+#endif
+
+#ifndef LISP_GC_PARALLEL_SIZE
+#define LISP_GC_PARALLEL_SIZE 8 * LISP_PAGE_SIZE
 #endif
 
 #ifndef LISP_STACK_DEPTH
@@ -346,6 +595,26 @@ void lisp_promise_store(Lisp p, Lisp x);
 #include <stdint.h>
 #include <time.h>
 #include <assert.h>
+#include <stdarg.h>
+
+#if !defined(LISP_NO_MMAP) && (defined(__unix__) || defined(__APPLE__))
+#define LISP_MMAP_
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if !defined(LISP_NO_THREADS) && (defined(__unix__) || defined(__APPLE__)) && defined(__GNUC__)
+#define LISP_GC_THREADS_
+#include <pthread.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LISP_POSIX_TIME_
+#define LISP_POSIX_MEMALIGN_
+#include <signal.h>
+#include <sys/time.h>
+#endif
 
 #define IS_POW2(x) (((x) != 0) && ((x) & ((x)-1)) == 0)
 
@@ -354,6 +623,17 @@ enum
     GC_CLEAR = 0,
     GC_GONE = 1, 
     GC_NEED_VISIT = 2, 
+    GC_MARKED = 3, // fixed block reached in a full collection, or large block reached
+    GC_FREE = 4, // fixed block on a free list
+    GC_COPYING = 5, // being copied by another thread in a parallel collection
+};
+
+enum
+{
+    GEN_OLD = 1,
+    GEN_REMEMBERED = 2, // old block which may point to young ones
+    GEN_FIXED = 4, // old block which never moves (interned symbols)
+    GEN_LARGE = 8, // block with a page of its own, which is marked instead of moved
 };
 
 typedef struct Page
@@ -361,26 +641,166 @@ typedef struct Page
     struct Page* next;
     size_t size;
     size_t capacity;
+    void* memory;
+    // large pages reached in a collection which haven't been scanned.
+    struct Page* pending;
+    // contains remembered blocks. (size_t keeps the buffer aligned)
+    size_t dirty;
     char buffer[];
 } Page;
 
+// Pages are aligned to LISP_PAGE_SIZE so a block can find its page (see page_of_).
+// Large pages are bigger, but only hold one block at the start of the buffer.
+#define PAGE_CAPACITY_ (LISP_PAGE_SIZE - sizeof(Page))
+
 static Page* page_create(size_t capacity)
 {
-    Page* page = malloc(sizeof(Page) + capacity);
+    assert(IS_POW2(LISP_PAGE_SIZE));
+#ifdef LISP_POSIX_MEMALIGN_
+    // a normal page is exactly LISP_PAGE_SIZE, so nothing is wasted on alignment
+    void* memory = NULL;
+    if (posix_memalign(&memory, LISP_PAGE_SIZE, sizeof(Page) + capacity) != 0) memory = NULL;
+    Page* page = memory;
+#else
+    char* memory = malloc(sizeof(Page) + capacity + (LISP_PAGE_SIZE));
+    Page* page = (Page*)(((uintptr_t)memory + (LISP_PAGE_SIZE) - 1) & ~((uintptr_t)(LISP_PAGE_SIZE) - 1));
+#endif
+    assert((uintptr_t)page->buffer % sizeof(LispVal) == 0);
+    page->memory = memory;
     page->capacity = capacity;
     page->size = 0;
+    page->dirty = 0;
+    page->next = NULL;
+    page->pending = NULL;
+    return page;
+}
+
+void page_destroy(Page* page) { free(page->memory); }
+
+// Pages of the normal size which heaps have given up, kept to reuse instead of freeing.
+// The warm list is a stack, so pages near its bottom are the ones not being reused.
+// Those which stay unused from one full collection to the next have their memory
+// returned to the system with madvise, and move to the cold list.
+typedef struct PagePool
+{
+    Page* warm;
+    Page* cold;
+    size_t warm_count;
+    // lowest warm_count since the last full collection.
+    size_t warm_low;
+    size_t count;
+    size_t reused;
+} PagePool;
+
+static Page* pool_take_(PagePool* pool)
+{
+    if (!pool || (!pool->warm && !pool->cold)) return page_create(PAGE_CAPACITY_);
+
+    Page* page;
+    if (pool->warm)
+    {
+        page = pool->warm;
+        pool->warm = page->next;
+        if (--pool->warm_count < pool->warm_low) pool->warm_low = pool->warm_count;
+    }
+    else
+    {
+        page = pool->cold;
+        pool->cold = page->next;
+    }
+    --pool->count;
+    ++pool->reused;
+
+    page->size = 0;
+    page->dirty = 0;
     page->next = NULL;
+    page->pending = NULL;
     return page;
 }
 
-void page_destroy(Page* page) { free(page); }
+static void pool_give_(PagePool* pool, Page* page)
+{
+    if (!pool || page->capacity != PAGE_CAPACITY_)
+    {
+        page_destroy(page);
+        return;
+    }
+    page->next = pool->warm;
+    pool->warm = page;
+    ++pool->warm_count;
+    ++pool->count;
+}
+
+// the link to the warm pages after the first n.
+static Page** pool_warm_after_(PagePool* pool, size_t n)
+{
+    Page** link = &pool->warm;
+    for (size_t i = 0; i < n && *link; ++i) link = &(*link)->next;
+    return link;
+}
+
+// frees all but keep pages, cold ones first.
+static void pool_trim_(PagePool* pool, size_t keep)
+{
+    while (pool->count > keep && pool->cold)
+    {
+        Page* page = pool->cold;
+        pool->cold = page->next;
+        page_destroy(page);
+        --pool->count;
+    }
+    if (pool->count <= keep) return;
+
+    Page** link = pool_warm_after_(pool, pool->warm_count - (pool->count - keep));
+    while (*link)
+    {
+        Page* page = *link;
+        *link = page->next;
+        page_destroy(page);
+        --pool->warm_count;
+        --pool->count;
+    }
+    if (pool->warm_low > pool->warm_count) pool->warm_low = pool->warm_count;
+}
+
+// Called after each full collection. Releases the memory of the warm pages
+// which weren't taken since the last one.
+static void pool_cool_(PagePool* pool)
+{
+#ifdef LISP_MMAP_
+    uintptr_t os_page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    Page** link = pool_warm_after_(pool, pool->warm_count - pool->warm_low);
+    while (*link)
+    {
+        Page* page = *link;
+        *link = page->next;
+        // the header must stay, so only whole system pages of the buffer.
+        uintptr_t start = ((uintptr_t)page->buffer + os_page - 1) & ~(os_page - 1);
+        uintptr_t end = ((uintptr_t)page->buffer + page->capacity) & ~(os_page - 1);
+        if (end > start) madvise((void*)start, end - start, MADV_DONTNEED);
+        page->next = pool->cold;
+        pool->cold = page;
+        --pool->warm_count;
+    }
+#endif
+    pool->warm_low = pool->warm_count;
+}
 
 typedef struct
 {
     Page* bottom;
+    // allocations are made from the top page.
+    // It is normally the last, but a loaded symbol heap may end with large pages.
     Page* top;
+    Page* last;
+    // blocks too big for a page, each on its own page (see Large objects).
+    Page* large;
     size_t size;
     size_t page_count;
+    // for blocks allocated here.
+    uint8_t gen;
+    // where pages come from and go back to. NULL to use malloc.
+    PagePool* pool;
 } Heap;
 
 typedef struct Block
@@ -422,39 +842,148 @@ typedef struct Block
         {
             uint8_t body_type;
             uint8_t args_type;
+            // nothing in the body can capture its frame (see Frame pool).
+            uint8_t reuse_frame;
         } lambda;
 
         struct
         {
-            int capacity;
+            // keys are compared with lisp_equal_r instead of lisp_eq.
+            uint8_t equal;
+            // is a frame of an environment (see global references).
+            uint8_t env;
+        } table;
+
+        struct
+        {
+            // characters before the terminator.
+            // The capacity is the rest of the block.
+            int length;
         } string;
     } d;
 
     // 32
     uint8_t gc_state;
     uint8_t type;
+    uint8_t gen;
 } Block;
 
-static void heap_init(Heap* heap)
+// Value representation.
+// VAL_(v, t) makes a value from a LispVal and its type.
+// VAL_TYPE_(x) is the type to store beside a LispVal in a block.
+#ifdef LISP_TAGGED
+
+// Doubles are stored offset by 2^49 so that the top 16 bits of a heap pointer are 0
+// and immediates can use top 16 bits which no offset double has (NaNs are canonical).
+// The remaining 48 bits are the payload.
+#define TAG_SHIFT_ 48
+#define TAG_PAYLOAD_MASK_ ((UINT64_C(1) << TAG_SHIFT_) - 1)
+#define TAG_REAL_OFFSET_ (UINT64_C(1) << 49)
+
+enum
+{
+    TAG_HEAP_ = 0x0000,
+    TAG_LOCAL_ = 0xFFFA,
+    TAG_PTR_,
+    TAG_FUNC_,
+    TAG_BOOL_,
+    TAG_CHAR_,
+    TAG_INT_,
+};
+
+#define VAL_(v, t) ((Lisp) { (v) })
+#define VAL_TYPE_(x) 0
+
+static Lisp tag_make_(uint64_t tag, uint64_t payload)
+{
+    Lisp x;
+    x.val.bits = (tag << TAG_SHIFT_) | (payload & TAG_PAYLOAD_MASK_);
+    return x;
+}
+
+static uint64_t tag_payload_(Lisp x) { return x.val.bits & TAG_PAYLOAD_MASK_; }
+
+static Lisp tag_make_ptr_(uint64_t tag, const void* ptr)
+{
+    assert(((uintptr_t)ptr >> TAG_SHIFT_) == 0);
+    return tag_make_(tag, (uint64_t)(uintptr_t)ptr);
+}
+
+LispType lisp_tagged_type(Lisp x)
+{
+    switch (x.val.bits >> TAG_SHIFT_)
+    {
+        case TAG_HEAP_:
+            return x.val.bits == 0 ? LISP_NULL : (LispType)((const Block*)x.val.ptr_val)->type;
+        case TAG_INT_: return LISP_INT;
+        case TAG_CHAR_: return LISP_CHAR;
+        case TAG_BOOL_: return LISP_BOOL;
+        case TAG_FUNC_: return LISP_FUNC;
+        case TAG_PTR_: return LISP_PTR;
+        case TAG_LOCAL_: return LISP_LOCAL;
+        default: return LISP_REAL;
+    }
+}
+
+#else
+
+#define VAL_(v, t) ((Lisp) { (v), (LispType)(t) })
+#define VAL_TYPE_(x) ((x).type)
+
+#endif
+
+#define VAL_BLOCK_(p, t) VAL_(((LispVal) { .ptr_val = (p) }), t)
+
+static void heap_init(Heap* heap, uint8_t gen, PagePool* pool)
 {
-    heap->bottom = page_create(LISP_PAGE_SIZE);
+    heap->pool = pool;
+    heap->bottom = pool_take_(pool);
     heap->top = heap->bottom;
+    heap->last = heap->bottom;
+    heap->large = NULL;
     
     heap->size = 0;
     heap->page_count = 1;
+    heap->gen = gen;
 }
 
 static void heap_shutdown(Heap* heap)
 {
     Page* page = heap->bottom;
     while (page)
+    {
+        Page* next = page->next;
+        pool_give_(heap->pool, page);
+        page = next;
+    }
+    page = heap->large;
+    while (page)
     {
         Page* next = page->next;
         page_destroy(page);
         page = next;
     }
+    heap->large = NULL;
     heap->bottom = NULL;
     heap->top = NULL;
+    heap->last = NULL;
+}
+
+// empty the heap, but keep its first page to allocate from.
+static void heap_reset_(Heap* heap)
+{
+    Page* bottom = heap->bottom;
+    heap->bottom = bottom->next;
+    heap_shutdown(heap);
+
+    bottom->next = NULL;
+    bottom->size = 0;
+    bottom->dirty = 0;
+    heap->bottom = bottom;
+    heap->top = bottom;
+    heap->last = bottom;
+    heap->size = 0;
+    heap->page_count = 1;
 }
 
 static size_t align_to_bytes(size_t n, size_t k)
@@ -473,23 +1002,35 @@ static void* heap_alloc(size_t alloc_size, LispType type, Heap* heap)
     assert(alloc_size % sizeof(LispVal) == 0);
 
     Page* to_use;
-    if (alloc_size >= LISP_PAGE_SIZE)
+    if (alloc_size > PAGE_CAPACITY_ && !(heap->gen & GEN_FIXED))
+    {
+        // large objects aren't in the list of pages, so they are never copied.
+        to_use = page_create(alloc_size);
+        to_use->next = heap->large;
+        heap->large = to_use;
+        ++heap->page_count;
+    }
+    else if (alloc_size > PAGE_CAPACITY_)
     {
-        /* add to bottom of stack.
+        /* add to end of the list.
          As soon as this page is made it it is full and can't be used.
-         However, our current page may still have room.
+         Our current page may still have room, but it is retired too.
+         Pages stay in allocation order so the collector can scan them in one pass,
+         and blocks added to an earlier page would be missed.
          */
         to_use = page_create(alloc_size);
-        to_use->next = heap->bottom;
-        heap->bottom = to_use;
+        heap->last->next = to_use;
+        heap->last = to_use;
+        heap->top = to_use;
         ++heap->page_count;
     }
     else if (alloc_size + heap->top->size > heap->top->capacity)
     {
-        /* add to top of the stack.
+        /* add to end of the list.
          need a new page because ours is full */
-        to_use = page_create(LISP_PAGE_SIZE);
-        heap->top->next = to_use;
+        to_use = pool_take_(heap->pool);
+        heap->last->next = to_use;
+        heap->last = to_use;
         heap->top = to_use; 
         ++heap->page_count;
     }
@@ -507,9 +1048,65 @@ static void* heap_alloc(size_t alloc_size, LispType type, Heap* heap)
     block->gc_state = GC_CLEAR;
     block->info.size = alloc_size;
     block->type = type;
+    block->gen = to_use == heap->large ? heap->gen | GEN_LARGE : heap->gen;
     return address;
 }
 
+static Page* page_of_(const Block* block)
+{
+    return (Page*)((uintptr_t)block & ~((uintptr_t)(LISP_PAGE_SIZE) - 1));
+}
+
+// visits the list of pages and then the large pages.
+static Page* heap_next_page_(const Heap* heap, const Page* page)
+{
+    return page == heap->last ? heap->large : page->next;
+}
+
+static int gc_is_young_(Lisp x)
+{
+#ifdef LISP_TAGGED
+    if (x.val.bits == 0 || (x.val.bits >> TAG_SHIFT_) != TAG_HEAP_) return 0;
+    return !(((const Block*)x.val.ptr_val)->gen & GEN_OLD);
+#endif
+    switch (lisp_type(x))
+    {
+        case LISP_PAIR:
+        case LISP_STRING:
+        case LISP_LAMBDA:
+        case LISP_VECTOR:
+        case LISP_PROMISE:
+        case LISP_TABLE:
+        case LISP_SYMBOL:
+        case LISP_CODE:
+        case LISP_JUMP:
+        case LISP_FUNC_N:
+        case LISP_PORT:
+        case LISP_GLOBAL:
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
+            return !(((const Block*)x.val.ptr_val)->gen & GEN_OLD);
+        default:
+            return 0;
+    }
+}
+
+// Write barrier. must be called when x is stored in an existing block.
+// An old block which points to a young one is remembered for the next minor collection.
+static void gc_barrier_(Block* block, Lisp x)
+{
+    if ((block->gen & ~GEN_LARGE) == GEN_OLD && gc_is_young_(x))
+    {
+        block->gen |= GEN_REMEMBERED;
+        page_of_(block)->dirty = 1;
+    }
+}
+
+#define SYMBOL_FREE_CLASSES_ 32
+// pooled frames by vector length, and how many of each are kept.
+#define FRAME_POOL_SIZES_ 16
+#define FRAME_POOL_DEPTH_ 32
+
 enum {
     SYM_IF = 0,
     SYM_BEGIN,
@@ -527,19 +1124,63 @@ enum {
 
 struct LispImpl
 {
+    // young generation. new objects are allocated here.
     Heap heap;
+    Heap old_heap;
+    // interned symbols. Never moved.
+    Heap symbol_heap;
+    // freed symbol blocks by size in LispVals, chained through Symbol.next.
+    LispVal symbol_free[SYMBOL_FREE_CLASSES_];
+    int gc_sweep_symbols;
+    size_t gc_full_threshold;
+    size_t gc_auto_threshold;
+    // see lisp_set_heap_policy
+    size_t gc_initial_size;
+    double gc_growth_factor;
+    size_t gc_max_size;
+    // young heap size at which a safe point has work to do (see gc_set_safepoint_size_).
+    size_t gc_safepoint_size;
+    PagePool page_pool;
+    // auto collect is not safe during expansion.
+    int gc_disabled;
+    int gc_minor;
+    // large blocks marked in this collection which haven't been scanned, chained through Page.pending.
+    struct Page* gc_large_pending;
+    int gc_threads;
+    // the parallel collection in progress, or NULL.
+    struct GCParallel* gc_parallel;
 
     Lisp* stack;
     size_t stack_ptr;
     size_t stack_depth;
 
+    // values held by lisp_handle_new. Slot h - 1 belongs to handle h.
+    // free slots are null and chained through handle_next, from handle_free (0 when full).
+    Lisp* handles;
+    LispHandle* handle_next;
+    LispHandle handle_free;
+    int handle_capacity;
+
+    // env pairs of frames released by reusable lambdas (see frame_acquire_).
+    // emptied by each collection.
+    Lisp frame_pool[FRAME_POOL_SIZES_][FRAME_POOL_DEPTH_];
+    int frame_pool_count[FRAME_POOL_SIZES_];
+
     FILE* out_port;
     FILE* err_port;
     FILE* in_port;
+    // string port which replaces out_port, or null.
+    Lisp output_port;
+
+    // interned symbols by hash (a power of 2 buckets), chained through Symbol.next.
+    struct Symbol** symbol_buckets;
+    size_t symbol_bucket_count;
+    size_t symbol_count;
 
-    Lisp symbols;
     Lisp env;
     Lisp macros;
+    // source form -> resolved expansion, for lisp_eval_cached. null when empty.
+    Lisp expand_cache;
 
     int symbol_counter;
 
@@ -547,12 +1188,37 @@ struct LispImpl
 
     size_t gc_stat_freed;
     size_t gc_stat_time;
+
+    uint64_t random_state;
+
+    // changes when a name is added to an environment table,
+    // invalidating the slots cached by global references.
+    uint32_t global_epoch;
+
+    // symbols are added by lisp_gc_stats.
+    LispGCStats gc_stats;
+    // NULL unless profiling.
+    struct Profile* profile;
 };
 
 static Lisp get_sym(int sym, LispContext ctx) { return ctx.p->symbol_cache[sym]; }
 
+// monotonic, in nanoseconds.
+static uint64_t clock_ns_(void)
+{
+#ifdef LISP_POSIX_TIME_
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000 + (uint64_t)t.tv_nsec;
+#else
+    return (uint64_t)clock() * (1000000000 / CLOCKS_PER_SEC);
+#endif
+}
+
 static void* gc_alloc(size_t size, LispType type, LispContext ctx)
 {
+    ++ctx.p->gc_stats.allocations[type];
+    ctx.p->gc_stats.bytes_allocated[type] += size;
     return heap_alloc(size, type, &ctx.p->heap);
 }
 
@@ -575,40 +1241,55 @@ typedef struct
     LispVal entries[];
 } Vector;
 
+// f64vector and s64vector. The length is in block.d.vector.
+typedef struct
+{
+    Block block;
+    LispReal data[];
+} F64Vector;
+
+typedef struct
+{
+    Block block;
+    LispInt data[];
+} S64Vector;
+
 static Lisp val_to_list_(LispVal x)
 {
-    return (Lisp) { x, x.ptr_val == NULL ? LISP_NULL : LISP_PAIR };
+    return VAL_(x, x.ptr_val == NULL ? LISP_NULL : LISP_PAIR);
 }
 
 int lisp_equal(Lisp a, Lisp b)
 {
-    switch (a.type)
+    LispType a_type = lisp_type(a);
+    LispType b_type = lisp_type(b);
+    switch (a_type)
     {
         case LISP_NULL:
-            return a.type == b.type;
+            return a_type == b_type;
         case LISP_BOOL:
-            return lisp_bool(a) == lisp_bool(b) && a.type == b.type;
+            return lisp_bool(a) == lisp_bool(b) && a_type == b_type;
         case LISP_CHAR:
-            return lisp_char(a) == lisp_char(b) && a.type == b.type;
+            return lisp_char(a) == lisp_char(b) && a_type == b_type;
         case LISP_FUNC:
-            return lisp_func(a) == lisp_func(b) && a.type == b.type;
+            return lisp_func(a) == lisp_func(b) && a_type == b_type;
         case LISP_INT:
-            if (b.type == LISP_INT) return lisp_int(a) == lisp_int(b);
+            if (b_type == LISP_INT) return lisp_int(a) == lisp_int(b);
             else return lisp_number_to_real(a) == lisp_number_to_real(b);
         case LISP_REAL:
             return lisp_real(a) == lisp_number_to_real(b);
         default:
-            return a.val.ptr_val == b.val.ptr_val && a.type == b.type;
+            return a.val.ptr_val == b.val.ptr_val && a_type == b_type;
     }
 }
 
 int lisp_equal_r(Lisp a, Lisp b)
 {
-    switch (a.type)
+    switch (lisp_type(a))
     {
         case LISP_VECTOR:
         {
-            if (a.type != b.type) return 0;
+            if (lisp_type(b) != LISP_VECTOR) return 0;
             int n = lisp_vector_length(a);
             int m = lisp_vector_length(b);
             if (n != m) return 0;
@@ -623,7 +1304,7 @@ int lisp_equal_r(Lisp a, Lisp b)
         }
         case LISP_PAIR:
         {
-            if (a.type != b.type) return 0;
+            if (lisp_type(b) != LISP_PAIR) return 0;
             while (lisp_is_pair(a) && lisp_is_pair(b))
             {
                 if (!lisp_equal_r(lisp_car(a), lisp_car(b))) return 0;
@@ -635,13 +1316,37 @@ int lisp_equal_r(Lisp a, Lisp b)
         }
         case LISP_STRING:
         {
-            return a.type == b.type && strcmp(lisp_string(a), lisp_string(b)) == 0;
+            return lisp_type(b) == LISP_STRING &&
+                lisp_string_length(a) == lisp_string_length(b) &&
+                memcmp(lisp_string(a), lisp_string(b), lisp_string_length(a)) == 0;
+        }
+        case LISP_F64VECTOR:
+        {
+            if (lisp_type(b) != LISP_F64VECTOR) return 0;
+            int n = lisp_f64vector_length(a);
+            if (n != lisp_f64vector_length(b)) return 0;
+            const LispReal* x = lisp_f64vector(a);
+            const LispReal* y = lisp_f64vector(b);
+            for (int i = 0; i < n; ++i)
+                if (x[i] != y[i]) return 0;
+            return 1;
+        }
+        case LISP_S64VECTOR:
+        {
+            return lisp_type(b) == LISP_S64VECTOR &&
+                lisp_s64vector_length(a) == lisp_s64vector_length(b) &&
+                memcmp(lisp_s64vector(a), lisp_s64vector(b), sizeof(LispInt) * lisp_s64vector_length(a)) == 0;
         }
         default:
             return lisp_equal(a, b);
     }
 }
 
+#ifdef LISP_TAGGED
+Lisp lisp_make_int(LispInt n) { return tag_make_(TAG_INT_, (uint64_t)n); }
+// sign extend the payload
+LispInt lisp_int(Lisp x) { return (LispInt)(x.val.bits << (64 - TAG_SHIFT_)) >> (64 - TAG_SHIFT_); }
+#else
 Lisp lisp_make_int(LispInt n)
 {
     Lisp l;
@@ -651,20 +1356,28 @@ Lisp lisp_make_int(LispInt n)
 }
 
 LispInt lisp_int(Lisp x) { return x.val.int_val; }
+#endif
 
 Lisp lisp_parse_int(const char* string)
 {
     return lisp_make_int((LispInt)strtol(string, NULL, 10));
 }
 
+#ifdef LISP_TAGGED
+Lisp lisp_make_bool(int t) { return tag_make_(TAG_BOOL_, t != 0); }
+int lisp_bool(Lisp x) { return (int)tag_payload_(x); }
+#else
 Lisp lisp_make_bool(int t)
 {
+    // the rest of the value is zero, so it compares and saves cleanly.
     LispVal val;
+    val.bits = 0;
     val.char_val = t;
     return (Lisp) { val, LISP_BOOL };
 }
 
 int lisp_bool(Lisp x) { return x.val.char_val; }
+#endif
 
 int lisp_is_true(Lisp x)
 {
@@ -672,58 +1385,77 @@ int lisp_is_true(Lisp x)
      return (lisp_type(x) == LISP_BOOL && !lisp_bool(x)) ? 0 : 1;
 }
 
+#ifdef LISP_TAGGED
+Lisp lisp_make_real(LispReal x)
+{
+    Lisp l;
+    l.val.real_val = x;
+    if (x != x) l.val.bits = UINT64_C(0x7FF8000000000000);
+    l.val.bits += TAG_REAL_OFFSET_;
+    return l;
+}
+
+LispReal lisp_real(Lisp x)
+{
+    x.val.bits -= TAG_REAL_OFFSET_;
+    return x.val.real_val;
+}
+#else
 Lisp lisp_make_real(LispReal x)
 {
     return (Lisp) { .val.real_val = x, .type = LISP_REAL };
 }
 
+LispReal lisp_real(Lisp x) { return x.val.real_val; }
+#endif
+
 Lisp lisp_parse_real(const char* string)
 {
     return lisp_make_real(strtod(string, NULL));
 }
 
-LispReal lisp_real(Lisp x) { return x.val.real_val; }
-
 LispReal lisp_number_to_real(Lisp x)
 {
-    return lisp_type(x) == LISP_REAL ? x.val.real_val : (LispReal)lisp_int(x);
+    return lisp_type(x) == LISP_REAL ? lisp_real(x) : (LispReal)lisp_int(x);
 }
 
 LispInt lisp_number_to_int(Lisp x)
 {
-    return lisp_type(x) == LISP_INT ? x.val.int_val : (LispInt)lisp_real(x);
+    return lisp_type(x) == LISP_INT ? lisp_int(x) : (LispInt)lisp_real(x);
 }
 
 static Pair* pair_get_(Lisp p)
 {
-    assert(p.type == LISP_PAIR);
+    assert(lisp_type(p) == LISP_PAIR);
     return p.val.ptr_val;
 }
 
 Lisp lisp_car(Lisp p)
 {
     const Pair* pair = pair_get_(p); 
-    return (Lisp) { pair->car, (LispType)pair->block.d.pair.car_type };
+    return VAL_(pair->car, pair->block.d.pair.car_type);
 }
 
 Lisp lisp_cdr(Lisp p)
 {
     const Pair* pair = pair_get_(p); 
-    return (Lisp) { pair->cdr, (LispType)pair->block.d.pair.cdr_type };
+    return VAL_(pair->cdr, pair->block.d.pair.cdr_type);
 }
 
 void lisp_set_car(Lisp p, Lisp x)
 {
     Pair* pair = pair_get_(p); 
     pair->car = x.val;
-    pair->block.d.pair.car_type = x.type;
+    pair->block.d.pair.car_type = VAL_TYPE_(x);
+    gc_barrier_(&pair->block, x);
 }
 
 void lisp_set_cdr(Lisp p, Lisp x)
 {
     Pair* pair = pair_get_(p); 
     pair->cdr = x.val;
-    pair->block.d.pair.cdr_type = x.type;
+    pair->block.d.pair.cdr_type = VAL_TYPE_(x);
+    gc_barrier_(&pair->block, x);
 }
 
 Lisp lisp_cons(Lisp car, Lisp cdr, LispContext ctx)
@@ -731,12 +1463,9 @@ Lisp lisp_cons(Lisp car, Lisp cdr, LispContext ctx)
     Pair* pair = gc_alloc(sizeof(Pair), LISP_PAIR, ctx);
     pair->car = car.val;
     pair->cdr = cdr.val;
-    pair->block.d.pair.car_type = car.type;
-    pair->block.d.pair.cdr_type = cdr.type;
-    Lisp p;
-    p.type = pair->block.type;
-    p.val.ptr_val = pair;
-    return p;
+    pair->block.d.pair.car_type = VAL_TYPE_(car);
+    pair->block.d.pair.cdr_type = VAL_TYPE_(cdr);
+    return VAL_BLOCK_(pair, LISP_PAIR);
 }
 
 Lisp lisp_list_copy(Lisp l, LispContext ctx)
@@ -844,7 +1573,14 @@ Lisp lisp_alist_ref(Lisp l, Lisp key)
 
 static int vector_len_(const Vector* v) { return v->block.d.vector.length; }
 
+#ifdef LISP_TAGGED
+// types are part of the values
+#define VECTOR_TYPE_SIZE_ 0
+#else
 // types are stored in an array of bytes at the end of the data.
+#define VECTOR_TYPE_SIZE_ sizeof(char)
+#endif
+
 static char* vector_types_(Vector* v)
 {
     // should be safe with aliasing.
@@ -861,13 +1597,10 @@ static Vector* vector_get_(Lisp v)
 
 Lisp lisp_make_vector(int n, LispContext ctx)
 {
-    size_t size = sizeof(Vector) + sizeof(LispVal) * n + sizeof(char) * n;
+    size_t size = sizeof(Vector) + (sizeof(LispVal) + VECTOR_TYPE_SIZE_) * n;
     Vector* vector = gc_alloc(size, LISP_VECTOR, ctx);
     vector->block.d.vector.length = n;
-
-    LispVal val;
-    val.ptr_val = vector;
-    return (Lisp) { val, LISP_VECTOR };
+    return VAL_BLOCK_(vector, LISP_VECTOR);
 }
 
 Lisp lisp_make_vector2(Lisp *x, int n, LispContext ctx)
@@ -884,16 +1617,24 @@ Lisp lisp_vector_ref(Lisp v, int i)
 {
     Vector* vector = vector_get_(v);
     assert(i < vector_len_(vector));
-    Lisp x = { vector->entries[i], (LispType)(vector_types_(vector)[i]) };
-    return x;
+    return VAL_(vector->entries[i], vector_types_(vector)[i]);
 }
 
-void lisp_vector_set(Lisp v, int i, Lisp x)
+// store without a write barrier
+static void vector_set_(Vector* vector, int i, Lisp x)
 {
-    Vector* vector = vector_get_(v);
     assert(i < vector_len_(vector));
     vector->entries[i] = x.val;
+#ifndef LISP_TAGGED
     vector_types_(vector)[i] = (char)x.type;
+#endif
+}
+
+void lisp_vector_set(Lisp v, int i, Lisp x)
+{
+    Vector* vector = vector_get_(v);
+    vector_set_(vector, i, x);
+    gc_barrier_(&vector->block, x);
 }
 
 Lisp lisp_vector_swap(Lisp v, int i, int j)
@@ -908,13 +1649,12 @@ void lisp_vector_fill(Lisp v, Lisp x)
 {
     int n = lisp_vector_length(v);
     Vector* vector = vector_get_(v);
-    char* entry_types = vector_types_(vector);
-
     for (int i = 0; i < n; ++i)
-    {
         vector->entries[i] = x.val;
-        entry_types[i] = (char)x.type;
-    }
+#ifndef LISP_TAGGED
+    memset(vector_types_(vector), (char)x.type, n);
+#endif
+    gc_barrier_(&vector->block, x);
 }
 
 Lisp lisp_subvector(Lisp old, int start, int end, LispContext ctx)
@@ -929,7 +1669,7 @@ Lisp lisp_subvector(Lisp old, int start, int end, LispContext ctx)
     Lisp new_v = lisp_make_vector(n, ctx);
     Vector* dst = vector_get_(new_v);
     memcpy(dst->entries, src->entries + start, sizeof(LispVal) * n);
-    memcpy(vector_types_(dst), vector_types_(src) + start, sizeof(char) * n);
+    memcpy(vector_types_(dst), vector_types_(src) + start, VECTOR_TYPE_SIZE_ * n);
     return new_v;
 }
 
@@ -948,7 +1688,7 @@ Lisp lisp_vector_grow(Lisp v, int n, LispContext ctx)
         Lisp new_v = lisp_make_vector(n, ctx);
         Vector* dst = vector_get_(new_v);
         memcpy(dst->entries, src->entries, sizeof(LispVal) * m);
-        memcpy(vector_types_(dst), vector_types_(src), sizeof(char) * m);
+        memcpy(vector_types_(dst), vector_types_(src), VECTOR_TYPE_SIZE_ * m);
         return new_v;
     }
 }
@@ -964,6 +1704,44 @@ Lisp lisp_avector_ref(Lisp v, Lisp key)
     return lisp_false();
 }
 
+Lisp lisp_make_f64vector(int n, LispContext ctx)
+{
+    F64Vector* v = gc_alloc(sizeof(F64Vector) + sizeof(LispReal) * n, LISP_F64VECTOR, ctx);
+    v->block.d.vector.length = n;
+    return VAL_BLOCK_(v, LISP_F64VECTOR);
+}
+
+int lisp_f64vector_length(Lisp v)
+{
+    assert(lisp_type(v) == LISP_F64VECTOR);
+    return ((const Block*)v.val.ptr_val)->d.vector.length;
+}
+
+LispReal* lisp_f64vector(Lisp v)
+{
+    assert(lisp_type(v) == LISP_F64VECTOR);
+    return ((F64Vector*)v.val.ptr_val)->data;
+}
+
+Lisp lisp_make_s64vector(int n, LispContext ctx)
+{
+    S64Vector* v = gc_alloc(sizeof(S64Vector) + sizeof(LispInt) * n, LISP_S64VECTOR, ctx);
+    v->block.d.vector.length = n;
+    return VAL_BLOCK_(v, LISP_S64VECTOR);
+}
+
+int lisp_s64vector_length(Lisp v)
+{
+    assert(lisp_type(v) == LISP_S64VECTOR);
+    return ((const Block*)v.val.ptr_val)->d.vector.length;
+}
+
+LispInt* lisp_s64vector(Lisp v)
+{
+    assert(lisp_type(v) == LISP_S64VECTOR);
+    return ((S64Vector*)v.val.ptr_val)->data;
+}
+
 static uint64_t hash_uint64(uint64_t x)
 {
     x *= 0xff51afd7ed558ccd;
@@ -973,6 +1751,20 @@ static uint64_t hash_uint64(uint64_t x)
 
 static uint64_t hash_val(LispVal x) { return hash_uint64((uint64_t)x.int_val); }
 
+static uint64_t hash_bytes(const char *buffer, size_t n)
+{
+    uint64_t x = 0xcbf29ce484222325;
+    for (size_t i = 0; i < n; i++)
+    {
+        x ^= buffer[i];
+        x *= 0x100000001b3;
+        x ^= x >> 32;
+    }
+    return x;
+}
+
+static uint64_t symbol_hash_(Lisp x);
+
 // hash table
 // linked list chaining
 typedef struct
@@ -980,9 +1772,10 @@ typedef struct
     Block block;
     int size;
     int capacity;
+    // keys hashed by their address, which must be rehashed when they move.
+    int moving_keys;
 
     // vectors. uninitialized if capacity == 0.
-    // entries of vals may be unitialized if the correspding key entry is.
     LispVal keys;
     LispVal vals;
 } Table;
@@ -993,35 +1786,142 @@ static Table *table_get_(Lisp t)
     return t.val.ptr_val;
 }
 
-Lisp lisp_make_table(LispContext ctx)
+static Lisp table_make_(int equal, LispContext ctx)
 {
     Table *table = gc_alloc(sizeof(Table), LISP_TABLE, ctx);
     table->size = 0;
     table->capacity = 0;
+    table->moving_keys = 0;
+    table->block.d.table.equal = (uint8_t)equal;
+    table->block.d.table.env = 0;
 
-    LispVal x;
-    x.ptr_val = table;
-    return (Lisp) { x, LISP_TABLE };
+    return VAL_BLOCK_(table, LISP_TABLE);
 }
 
-static void table_grow_(Lisp t, size_t new_capacity, LispContext ctx)
-{
-    Table *table = table_get_(t);
-    if (new_capacity < 16) new_capacity = 16;
-    assert(IS_POW2(new_capacity));
-
-    int old_capacity = table->capacity;
-    Lisp old_keys = { table->keys, LISP_VECTOR };
-    Lisp old_vals = { table->vals, LISP_VECTOR };
-
-    table->capacity = new_capacity;
-    int n = table->size;
-    table->size = 0;
+Lisp lisp_make_table(LispContext ctx) { return table_make_(0, ctx); }
+Lisp lisp_make_equal_table(LispContext ctx) { return table_make_(1, ctx); }
 
-    // table vals are uninitialized.
-    Lisp new_vals = lisp_make_vector(new_capacity, ctx);
+// Hashes agree with lisp_equal_r. Lists and vectors hash their first few elements,
+// and nested heap values only contribute their type, so they never hash an address.
+static uint64_t hash_equal_(Lisp x, int depth)
+{
+    switch (lisp_type(x))
+    {
+        case LISP_NULL: return 0;
+        case LISP_INT: return hash_uint64((uint64_t)lisp_int(x));
+        case LISP_REAL:
+        {
+            // reals which equal an int must hash like it
+            LispReal r = lisp_real(x);
+            if (r > -9.0e18 && r < 9.0e18 && r == (LispReal)(LispInt)r)
+                return hash_uint64((uint64_t)(LispInt)r);
+            uint64_t bits;
+            memcpy(&bits, &r, sizeof(bits));
+            return hash_uint64(bits);
+        }
+        case LISP_CHAR: return hash_uint64((uint64_t)lisp_char(x) ^ 0xC4);
+        case LISP_BOOL: return hash_uint64((uint64_t)lisp_bool(x) ^ 0xB0);
+        case LISP_STRING: return hash_bytes(lisp_string(x), lisp_string_length(x));
+        case LISP_SYMBOL: return symbol_hash_(x);
+        case LISP_PAIR:
+        {
+            uint64_t h = LISP_PAIR;
+            for (int i = 0; i < 8 && depth < 4 && lisp_is_pair(x); ++i)
+            {
+                h = hash_uint64(h ^ hash_equal_(lisp_car(x), depth + 1));
+                x = lisp_cdr(x);
+            }
+            return h;
+        }
+        case LISP_VECTOR:
+        {
+            int n = lisp_vector_length(x);
+            uint64_t h = hash_uint64((uint64_t)n ^ LISP_VECTOR);
+            for (int i = 0; i < n && i < 8 && depth < 4; ++i)
+                h = hash_uint64(h ^ hash_equal_(lisp_vector_ref(x, i), depth + 1));
+            return h;
+        }
+        case LISP_F64VECTOR:
+        {
+            // like reals, so 0.0 and -0.0 agree.
+            int n = lisp_f64vector_length(x);
+            uint64_t h = hash_uint64((uint64_t)n ^ LISP_F64VECTOR);
+            for (int i = 0; i < n && i < 8; ++i)
+                h = hash_uint64(h ^ hash_equal_(lisp_make_real(lisp_f64vector(x)[i]), depth + 1));
+            return h;
+        }
+        case LISP_S64VECTOR:
+        {
+            int n = lisp_s64vector_length(x);
+            uint64_t h = hash_uint64((uint64_t)n ^ LISP_S64VECTOR);
+            for (int i = 0; i < n && i < 8; ++i)
+                h = hash_uint64(h ^ (uint64_t)lisp_s64vector(x)[i]);
+            return h;
+        }
+        default:
+            // procedures and the like are only equal to themselves.
+            return depth == 0 ? hash_val(x.val) : (uint64_t)lisp_type(x);
+    }
+}
+
+// Symbols hash their text and equal tables hash contents,
+// so most keys hash the same after a collection moves them.
+static uint64_t table_hash_(const Table* table, Lisp key)
+{
+    if (table->block.d.table.equal) return hash_equal_(key, 0);
+    if (lisp_type(key) == LISP_SYMBOL) return symbol_hash_(key);
+    return hash_val(key.val);
+}
+
+static int table_key_moves_(const Table* table, Lisp key)
+{
+    switch (lisp_type(key))
+    {
+        case LISP_PAIR:
+        case LISP_STRING:
+        case LISP_VECTOR:
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
+            return !table->block.d.table.equal;
+        case LISP_LAMBDA:
+        case LISP_PROMISE:
+        case LISP_TABLE:
+        case LISP_CODE:
+        case LISP_JUMP:
+        case LISP_FUNC_N:
+        case LISP_PORT:
+        case LISP_GLOBAL:
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+static int table_key_equal_(const Table* table, Lisp a, Lisp b)
+{
+    return table->block.d.table.equal ? lisp_equal_r(a, b) : lisp_eq(a, b);
+}
+
+static void table_grow_(Lisp t, size_t new_capacity, LispContext ctx)
+{
+    Table *table = table_get_(t);
+    if (new_capacity < 16) new_capacity = 16;
+    assert(IS_POW2(new_capacity));
+
+    int old_capacity = table->capacity;
+    Lisp old_keys = VAL_(table->keys, LISP_VECTOR);
+    Lisp old_vals = VAL_(table->vals, LISP_VECTOR);
+
+    table->capacity = new_capacity;
+    int n = table->size;
+    table->size = 0;
+    table->moving_keys = 0;
+
+    // vals are initialized too, since the gc may scan them as a vector.
+    Lisp new_vals = lisp_make_vector(new_capacity, ctx);
     Lisp new_keys = lisp_make_vector(new_capacity, ctx);
     lisp_vector_fill(new_keys, lisp_null());
+    lisp_vector_fill(new_vals, lisp_null());
     table->vals = new_vals.val;
     table->keys = new_keys.val;
 
@@ -1043,10 +1943,16 @@ void lisp_table_set(Lisp t, Lisp key, Lisp x, LispContext ctx)
     }
     assert(2 * table->size < table->capacity);
 
-    Lisp keys = { table->keys, LISP_VECTOR };
-    Lisp vals = { table->vals, LISP_VECTOR };
+    Lisp keys = VAL_(table->keys, LISP_VECTOR);
+    Lisp vals = VAL_(table->vals, LISP_VECTOR);
+
+    // The table is remembered instead of its vectors,
+    // since it must be rehashed if a key moves.
+    gc_barrier_(&table->block, key);
+    gc_barrier_(&table->block, x);
+    gc_barrier_(&table->block, keys);
 
-    uint32_t i = hash_val(key.val);
+    uint32_t i = (uint32_t)table_hash_(table, key);
     while (1)
     {
         i &= (table->capacity - 1);
@@ -1055,33 +1961,31 @@ void lisp_table_set(Lisp t, Lisp key, Lisp x, LispContext ctx)
         if (lisp_is_null(saved_key))
         {
             ++table->size;
-            lisp_vector_set(keys, i, key);
-            lisp_vector_set(vals, i, x);
+            if (table_key_moves_(table, key)) ++table->moving_keys;
+            // a new name may shadow one cached by a reference.
+            if (table->block.d.table.env && ++ctx.p->global_epoch == 0) ctx.p->global_epoch = 1;
+            vector_set_(vector_get_(keys), i, key);
+            vector_set_(vector_get_(vals), i, x);
             return;
         }
-        else if (lisp_eq(saved_key, key))
+        else if (table_key_equal_(table, saved_key, key))
         {
-            lisp_vector_set(vals, i, x);
+            vector_set_(vector_get_(vals), i, x);
             return;
         }
         ++i;
     }
 }
 
-Lisp lisp_table_get(Lisp t, Lisp key, int* present)
+// slot of key, or -1.
+static int table_find_(const Table* table, Lisp key)
 {
-    Table *table = table_get_(t);
     int capacity = table->capacity;
-    if (capacity == 0)
-    {
-       *present = 0;
-       return lisp_null();
-    }
+    if (capacity == 0) return -1;
 
-    Lisp keys = { table->keys, LISP_VECTOR };
-    Lisp vals = { table->vals, LISP_VECTOR };
+    Lisp keys = VAL_(table->keys, LISP_VECTOR);
 
-    uint32_t i = hash_val(key.val);
+    uint32_t i = (uint32_t)table_hash_(table, key);
     while (1)
     {
         i &= (capacity - 1);
@@ -1090,25 +1994,31 @@ Lisp lisp_table_get(Lisp t, Lisp key, int* present)
 
         if (lisp_is_null(saved_key))
         {
-            *present = 0;
-            return lisp_null();
+            return -1;
         }
-        else if (lisp_eq(saved_key, key))
+        else if (table_key_equal_(table, saved_key, key))
         {
-            *present = 1;
-            return lisp_vector_ref(vals, i);
+            return (int)i;
         }
         ++i;
     }
 }
 
+Lisp lisp_table_get(Lisp t, Lisp key, int* present)
+{
+    const Table *table = table_get_(t);
+    int i = table_find_(table, key);
+    *present = i != -1;
+    return *present ? lisp_vector_ref(VAL_(table->vals, LISP_VECTOR), i) : lisp_null();
+}
+
 Lisp lisp_table_to_alist(Lisp t, LispContext ctx)
 {
     const Table *table = table_get_(t);
     Lisp result = lisp_null();
 
-    Lisp keys = { table->keys, LISP_VECTOR };
-    Lisp vals = { table->vals, LISP_VECTOR };
+    Lisp keys = VAL_(table->keys, LISP_VECTOR);
+    Lisp vals = VAL_(table->vals, LISP_VECTOR);
     
     for (int i = 0; i < table->capacity; ++i)
     {
@@ -1127,7 +2037,10 @@ void lisp_table_define_funcs(Lisp t, const LispFuncDef* defs, LispContext ctx)
 {
     while (defs->name)
     {
-        lisp_table_set(t, lisp_make_symbol(defs->name, ctx), lisp_make_func(defs->func_ptr), ctx);
+        Lisp f = defs->func_ptr
+            ? lisp_make_func(defs->func_ptr)
+            : lisp_make_func_n(defs->func_n_ptr, defs->min_args, defs->max_args, ctx);
+        lisp_table_set(t, lisp_make_symbol(defs->name, ctx), f, ctx);
         ++defs;
     }
 }
@@ -1142,11 +2055,10 @@ Lisp lisp_make_buffer(int cap, LispContext ctx)
 {
     assert(cap >= 0);
     String* string = gc_alloc(sizeof(String) + cap, LISP_STRING, ctx);
-    string->block.d.string.capacity = cap;
+    string->block.d.string.length = 0;
+    if (cap > 0) string->string[0] = '\0';
     
-    LispVal val;
-    val.ptr_val = string;
-    return (Lisp){ val, string->block.type };
+    return VAL_BLOCK_(string, LISP_STRING);
 }
 
 Lisp lisp_buffer_copy(Lisp s, LispContext ctx)
@@ -1154,12 +2066,22 @@ Lisp lisp_buffer_copy(Lisp s, LispContext ctx)
     int cap = lisp_buffer_capacity(s);
     Lisp b = lisp_make_buffer(cap, ctx);
     memcpy(lisp_buffer(b), lisp_buffer(s), cap);
+    string_get_(b)->block.d.string.length = lisp_string_length(s);
     return b;
 }
 
+// blocks are padded, so this can be a little more than was asked for.
 int lisp_buffer_capacity(Lisp s)
 {
-    return string_get_(s)->block.d.string.capacity;
+    return (int)(string_get_(s)->block.info.size - sizeof(String));
+}
+
+void lisp_buffer_set_length(Lisp s, int length)
+{
+    String* string = string_get_(s);
+    assert(length >= 0 && length < lisp_buffer_capacity(s));
+    string->block.d.string.length = length;
+    string->string[length] = '\0';
 }
 
 void lisp_buffer_fill(Lisp s, int start, int end, int x)
@@ -1176,7 +2098,7 @@ const char *lisp_string(Lisp s) { return lisp_buffer(s); }
 Lisp lisp_make_string(int n, LispContext ctx)
 {
     Lisp s = lisp_make_buffer(n + 1, ctx);
-    lisp_buffer(s)[n] = '\0';
+    lisp_buffer_set_length(s, n);
     return s;
 }
 
@@ -1188,18 +2110,18 @@ Lisp lisp_make_string2(const char* c_string, LispContext ctx)
     return s; 
 }
 
-int lisp_string_length(Lisp s) { return strlen(lisp_string(s)); }
+int lisp_string_length(Lisp s) { return string_get_(s)->block.d.string.length; }
 
 int lisp_string_ref(Lisp s, int i) {
     const String* str = string_get_(s);
-    assert(i >= 0 && i < lisp_buffer_capacity(s));
+    assert(i >= 0 && i < lisp_string_length(s));
     return (int)str->string[i]; 
 }
 
 void lisp_string_set(Lisp s, int i, int c)
 {
     assert(c >= 0 && c <= 127);
-    assert(i >= 0 && i < lisp_buffer_capacity(s));
+    assert(i >= 0 && i < lisp_string_length(s));
     string_get_(s)->string[i] = (char)c;
 }
 
@@ -1207,53 +2129,92 @@ Lisp lisp_substring(Lisp s, int start, int end, LispContext ctx)
 {
     assert(start <= end);
 
-    int count = start;
-    const char *first = lisp_string(s);
-    while (*first && count) {
-        --count;
-        ++first;
-    }
+    // clamp to the string
+    int n = lisp_string_length(s);
+    if (start < 0) start = 0;
+    if (end > n) end = n;
+    if (start > end) start = end;
+
+    Lisp result = lisp_make_string(end - start, ctx);
+    memcpy(lisp_buffer(result), lisp_string(s) + start, end - start);
+    return result;
+}
+
+typedef struct
+{
+    Block block;
+    // a string with room to grow. Its length is what has been written.
+    LispVal buffer;
+} Port;
+
+static Port* port_get_(Lisp p)
+{
+    assert(lisp_type(p) == LISP_PORT);
+    return p.val.ptr_val;
+}
+
+Lisp lisp_make_string_port(LispContext ctx)
+{
+    Lisp buffer = lisp_make_buffer(64, ctx);
+    Port* port = gc_alloc(sizeof(Port), LISP_PORT, ctx);
+    port->buffer = buffer.val;
+    return VAL_BLOCK_(port, LISP_PORT);
+}
 
-    count = (end - start);
-    const char *last = first;
-    while (*last && count)
+void lisp_port_write(Lisp p, const char* bytes, int n, LispContext ctx)
+{
+    Port* port = port_get_(p);
+    Lisp buffer = VAL_(port->buffer, LISP_STRING);
+    int length = lisp_string_length(buffer);
+
+    if (length + n >= lisp_buffer_capacity(buffer))
     {
-        --count;
-        ++last;
+        // double, so writing is linear overall
+        int cap = 2 * lisp_buffer_capacity(buffer);
+        if (cap <= length + n) cap = length + n + 1;
+
+        Lisp bigger = lisp_make_buffer(cap, ctx);
+        memcpy(lisp_buffer(bigger), lisp_string(buffer), length);
+        port->buffer = bigger.val;
+        gc_barrier_(&port->block, bigger);
+        buffer = bigger;
     }
-    Lisp result = lisp_make_string(last - first, ctx);
-    memcpy(lisp_buffer(result), first, last - first);
-    return result;
+    memcpy(lisp_buffer(buffer) + length, bytes, n);
+    lisp_buffer_set_length(buffer, length + n);
+}
+
+Lisp lisp_port_string(Lisp p, LispContext ctx)
+{
+    Lisp buffer = VAL_(port_get_(p)->buffer, LISP_STRING);
+    int length = lisp_string_length(buffer);
+    Lisp s = lisp_make_string(length, ctx);
+    memcpy(lisp_buffer(s), lisp_string(buffer), length);
+    return s;
 }
 
+#ifdef LISP_TAGGED
+Lisp lisp_make_char(int c) { return tag_make_(TAG_CHAR_, (uint32_t)c); }
+int lisp_char(Lisp l) { return (int)(int32_t)(uint32_t)tag_payload_(l); }
+#else
 Lisp lisp_make_char(int c)
 {
     Lisp l;
     l.type = LISP_CHAR;
+    l.val.bits = 0;
     l.val.char_val = c;
     return l;
 }
 
 int lisp_char(Lisp l) { return l.val.char_val; }
+#endif
 Lisp lisp_eof(void) { return lisp_make_char(-1); }
 
-static uint64_t hash_bytes(const char *buffer, size_t n)
-{
-    uint64_t x = 0xcbf29ce484222325;
-    for (size_t i = 0; i < n; i++)
-    {
-        x ^= buffer[i];
-        x *= 0x100000001b3;
-        x ^= x >> 32;
-    }
-    return x;
-}
-
-typedef struct
+typedef struct Symbol
 {
     Block block;
     // built in linked list
     LispVal next;
+    uint64_t hash;
     char text[];
 } Symbol;
 
@@ -1263,51 +2224,101 @@ static Symbol* symbol_get_(Lisp x)
     return x.val.ptr_val;
 }
 int  lisp_symbol_length(Lisp l) { return symbol_get_(l)->block.d.symbol.length; }
+static uint64_t symbol_hash_(Lisp x) { return symbol_get_(x)->hash; }
 const char* lisp_symbol_string(Lisp l) { return symbol_get_(l)->text; }
 
-static Lisp symbol_make_(const char* string, int length, LispContext ctx)
+// interned symbols are allocated in the symbol heap, reusing swept blocks.
+static void* symbol_alloc_(size_t size, LispContext ctx)
+{
+    ++ctx.p->gc_stats.allocations[LISP_SYMBOL];
+    ctx.p->gc_stats.bytes_allocated[LISP_SYMBOL] += size;
+
+    size_t k = align_to_bytes(size, sizeof(LispVal)) / sizeof(LispVal);
+    if (k < SYMBOL_FREE_CLASSES_ && ctx.p->symbol_free[k].ptr_val)
+    {
+        Symbol* symbol = ctx.p->symbol_free[k].ptr_val;
+        ctx.p->symbol_free[k] = symbol->next;
+        symbol->block.gc_state = GC_CLEAR;
+        ctx.p->symbol_heap.size += symbol->block.info.size;
+        return symbol;
+    }
+    return heap_alloc(size, LISP_SYMBOL, &ctx.p->symbol_heap);
+}
+
+static void symbol_free_(Symbol* symbol, LispContext ctx)
 {
-    Symbol* symbol = gc_alloc(sizeof(Symbol) + (length + 1), LISP_SYMBOL, ctx);
+    size_t k = symbol->block.info.size / sizeof(LispVal);
+    ctx.p->symbol_heap.size -= symbol->block.info.size;
+    symbol->block.gc_state = GC_FREE;
+    // too big to reuse. The block is left as garbage.
+    if (k >= SYMBOL_FREE_CLASSES_) return;
+    symbol->next = ctx.p->symbol_free[k];
+    ctx.p->symbol_free[k].ptr_val = symbol;
+}
+
+static Lisp symbol_make_(const char* string, int length, int interned, LispContext ctx)
+{
+    size_t size = sizeof(Symbol) + (length + 1);
+    Symbol* symbol = interned ? symbol_alloc_(size, ctx) : gc_alloc(size, LISP_SYMBOL, ctx);
     memcpy(symbol->text, string, length);
     symbol->text[length] = '\0';
     symbol->next.ptr_val = NULL; 
+    symbol->hash = hash_bytes(string, length);
     symbol->block.d.symbol.length = length;
 
-    LispVal x;
-    x.ptr_val = symbol;
-    return (Lisp) { x, LISP_SYMBOL };
+    return VAL_BLOCK_(symbol, LISP_SYMBOL);
 }
 
-static Lisp symbol_intern_(Lisp table, const char* string, size_t length, LispContext ctx)
+static void symbol_link_(Symbol* symbol, LispContext ctx)
 {
-    uint64_t hash = hash_bytes(string, length);
+    Symbol** bucket = ctx.p->symbol_buckets + (symbol->hash & (ctx.p->symbol_bucket_count - 1));
+    symbol->next.ptr_val = *bucket;
+    *bucket = symbol;
+    ++ctx.p->symbol_count;
+}
 
-    // the key in the hash table is the string hash
-    Lisp key;
-    key.type = LISP_INT;
-    key.val.int_val = (LispInt)hash;
+static void symbol_buckets_resize_(size_t count, LispContext ctx)
+{
+    assert(IS_POW2(count));
+    Symbol** old = ctx.p->symbol_buckets;
+    size_t old_count = ctx.p->symbol_bucket_count;
 
-    // linked list chaining in the resulting value.
-    int present;
-    Lisp first_symbol = lisp_table_get(table, key, &present);
+    ctx.p->symbol_buckets = calloc(count, sizeof(Symbol*));
+    ctx.p->symbol_bucket_count = count;
+    ctx.p->symbol_count = 0;
 
-    // symbol found in linked list chain
-    if (present)
+    for (size_t i = 0; i < old_count; ++i)
     {
-        Lisp it = first_symbol;
-        while (it.val.ptr_val != NULL)
+        Symbol* it = old[i];
+        while (it)
         {
-            if (lisp_symbol_length(it) == length &&
-                strncmp(lisp_symbol_string(it), string, length) == 0) return it;
-            it.val = symbol_get_(it)->next;
+            Symbol* next = it->next.ptr_val;
+            symbol_link_(it, ctx);
+            it = next;
         }
     }
+    free(old);
+}
+
+static Lisp symbol_intern_(const char* string, size_t length, LispContext ctx)
+{
+    uint64_t hash = hash_bytes(string, length);
+
+    // symbol found in linked list chain
+    Symbol* it = ctx.p->symbol_buckets[hash & (ctx.p->symbol_bucket_count - 1)];
+    while (it)
+    {
+        if (it->hash == hash && it->block.d.symbol.length == length &&
+            memcmp(it->text, string, length) == 0) return VAL_BLOCK_(it, LISP_SYMBOL);
+        it = it->next.ptr_val;
+    }
 
     // new symbol
-    Lisp symbol = symbol_make_(string, length, ctx);
+    if (ctx.p->symbol_count >= ctx.p->symbol_bucket_count)
+        symbol_buckets_resize_(2 * ctx.p->symbol_bucket_count, ctx);
 
-    symbol_get_(symbol)->next = first_symbol.val;
-    lisp_table_set(table, key, symbol, ctx);
+    Lisp symbol = symbol_make_(string, length, 1, ctx);
+    symbol_link_(symbol_get_(symbol), ctx);
     return symbol;
 }
 
@@ -1315,16 +2326,42 @@ Lisp lisp_make_symbol(const char* string, LispContext ctx)
 {
     assert(string);
     int length = strnlen(string, LISP_IDENTIFIER_MAX);
-    return symbol_intern_(ctx.p->symbols, string, length, ctx);
+    return symbol_intern_(string, length, ctx);
 }
 
 Lisp lisp_gen_symbol(LispContext ctx)
 {
     char text[64];
     int bytes = snprintf(text, 64, ":G%d", ctx.p->symbol_counter++);
-    return symbol_make_(text, bytes, ctx);
+    return symbol_make_(text, bytes, 0, ctx);
+}
+
+#ifdef LISP_TAGGED
+Lisp lisp_make_ptr(void *ptr) { return tag_make_ptr_(TAG_PTR_, ptr); }
+
+void *lisp_ptr(Lisp l)
+{
+    assert(lisp_type(l) == LISP_PTR);
+    return (void*)(uintptr_t)tag_payload_(l);
+}
+
+Lisp lisp_make_func(LispCFunc func)
+{
+    Lisp l;
+    l.val.bits = 0;
+    l.val.func_val = (void(*)(void))func;
+    assert((l.val.bits >> TAG_SHIFT_) == 0);
+    l.val.bits |= (uint64_t)TAG_FUNC_ << TAG_SHIFT_;
+    return l;
 }
 
+LispCFunc lisp_func(Lisp l)
+{
+    assert(lisp_type(l) == LISP_FUNC);
+    l.val.bits = tag_payload_(l);
+    return (LispCFunc)l.val.func_val;
+}
+#else
 Lisp lisp_make_ptr(void *ptr)
 {
     return (Lisp) { .val = { .ptr_val = ptr }, .type = LISP_PTR };
@@ -1349,6 +2386,48 @@ LispCFunc lisp_func(Lisp l)
     assert(lisp_type(l) == LISP_FUNC);
     return (LispCFunc)l.val.func_val;
 }
+#endif
+
+typedef struct
+{
+    Block block;
+    LispCFuncN func;
+    int min_args;
+    int max_args;
+} FuncN;
+
+Lisp lisp_make_func_n(LispCFuncN func, int min_args, int max_args, LispContext ctx)
+{
+    FuncN* f = gc_alloc(sizeof(FuncN), LISP_FUNC_N, ctx);
+    f->func = func;
+    f->min_args = min_args;
+    f->max_args = max_args;
+    return VAL_BLOCK_(f, LISP_FUNC_N);
+}
+
+static const FuncN* func_n_get_(Lisp l)
+{
+    assert(lisp_type(l) == LISP_FUNC_N);
+    return l.val.ptr_val;
+}
+
+LispCFuncN lisp_func_n(Lisp l) { return func_n_get_(l)->func; }
+
+static Lisp func_n_call_(Lisp l, int argc, Lisp* argv, LispError* error, LispContext ctx)
+{
+    const FuncN* f = func_n_get_(l);
+    if (argc < f->min_args)
+    {
+        *error = LISP_ERROR_TOO_FEW_ARGS;
+        return lisp_null();
+    }
+    else if (f->max_args >= 0 && argc > f->max_args)
+    {
+        *error = LISP_ERROR_TOO_MANY_ARGS;
+        return lisp_null();
+    }
+    return f->func(argc, argv, error, ctx);
+}
 
 typedef struct
 {
@@ -1356,41 +2435,48 @@ typedef struct
     LispVal body;
     LispVal args;
     LispVal env;
+    // vector of slot names if the body has been resolved.
+    // otherwise NULL and calls bind arguments in a table.
+    LispVal names;
+    // symbol it was first defined as, or NULL.
+    LispVal name;
 } Lambda;
 
-Lisp lisp_make_lambda(Lisp args, Lisp body, Lisp env, LispContext ctx)
+static Lisp lambda_make_(Lisp args, Lisp body, Lisp env, Lisp names, int reuse_frame, LispContext ctx)
 {
     Lambda* lambda = gc_alloc(sizeof(Lambda), LISP_LAMBDA, ctx);
     lambda->block.d.lambda.body_type = (uint8_t)lisp_type(body);
     lambda->block.d.lambda.args_type = (uint8_t)lisp_type(args);
+    lambda->block.d.lambda.reuse_frame = (uint8_t)reuse_frame;
 
     assert(lisp_is_env(env));
+    assert(lisp_is_null(names) || lisp_type(names) == LISP_VECTOR);
 
     lambda->args = args.val;
     lambda->body = body.val;
     lambda->env = env.val;
+    lambda->names = names.val;
+    lambda->name.ptr_val = NULL;
     
-    LispVal val;
-    val.ptr_val = lambda;
-    return (Lisp) { val, LISP_LAMBDA };
+    return VAL_BLOCK_(lambda, LISP_LAMBDA);
 }
 
 static Lambda* lambda_get_(Lisp l)
 {
-    assert(l.type == LISP_LAMBDA);
+    assert(lisp_type(l) == LISP_LAMBDA);
     return l.val.ptr_val;
 }
 
 Lisp lisp_lambda_body(Lisp l)
 {
      const Lambda* lambda = lambda_get_(l);
-     return (Lisp) { lambda->body, (LispType)lambda->block.d.lambda.body_type };
+     return VAL_(lambda->body, lambda->block.d.lambda.body_type);
 }
 
 Lisp lambda_args_(Lisp l)
 {
      const Lambda* lambda = lambda_get_(l);
-     return (Lisp) { lambda->args, (LispType)lambda->block.d.lambda.args_type };
+     return VAL_(lambda->args, lambda->block.d.lambda.args_type);
 }
 
 Lisp lisp_lambda_env(Lisp l)
@@ -1399,6 +2485,39 @@ Lisp lisp_lambda_env(Lisp l)
     return val_to_list_(lambda->env);
 }
 
+static Lisp lambda_names_(Lisp l)
+{
+    const Lambda* lambda = lambda_get_(l);
+    return VAL_(lambda->names, lambda->names.ptr_val == NULL ? LISP_NULL : LISP_VECTOR);
+}
+
+static int lambda_reuses_frame_(Lisp l)
+{
+    return lisp_type(l) == LISP_LAMBDA && lambda_get_(l)->block.d.lambda.reuse_frame;
+}
+
+// the reuse term of a resolved lambda form. missing is false.
+static int reuse_flag_(Lisp x)
+{
+    return lisp_type(x) == LISP_BOOL && lisp_bool(x);
+}
+
+static Lisp lambda_name_(Lisp l)
+{
+    const Lambda* lambda = lambda_get_(l);
+    return VAL_(lambda->name, lambda->name.ptr_val == NULL ? LISP_NULL : LISP_SYMBOL);
+}
+
+// names a lambda after the first variable it is defined as (for the profiler).
+static void lambda_define_name_(Lisp x, Lisp symbol)
+{
+    if (lisp_type(x) != LISP_LAMBDA || lisp_type(symbol) != LISP_SYMBOL) return;
+    Lambda* lambda = lambda_get_(x);
+    if (lambda->name.ptr_val != NULL) return;
+    lambda->name = symbol.val;
+    gc_barrier_(&lambda->block, symbol);
+}
+
 typedef struct
 {
     Block block;
@@ -1407,20 +2526,17 @@ typedef struct
 
 Lisp lisp_make_promise(Lisp proc, LispContext ctx)
 {
-    assert(lisp_type(proc) == LISP_LAMBDA || lisp_type(proc) == LISP_FUNC);
+    assert(lisp_type(proc) == LISP_LAMBDA || lisp_type(proc) == LISP_FUNC || lisp_type(proc) == LISP_FUNC_N);
     Promise* promise = gc_alloc(sizeof(Promise), LISP_PROMISE, ctx);
     promise->block.d.promise.cached = 0;
-    promise->block.d.promise.type = lisp_type(proc);
+    promise->block.d.promise.type = VAL_TYPE_(proc);
     promise->val_or_proc = proc.val;
-
-    LispVal val;
-    val.ptr_val = promise;
-    return (Lisp) { val, LISP_PROMISE };
+    return VAL_BLOCK_(promise, LISP_PROMISE);
 }
 
 static Promise* promise_get_(Lisp p)
 {
-    assert(p.type == LISP_PROMISE);
+    assert(lisp_type(p) == LISP_PROMISE);
     return p.val.ptr_val;
 }
 
@@ -1429,8 +2545,9 @@ void lisp_promise_store(Lisp p, Lisp x)
     Promise* promise = promise_get_(p); 
     assert(!promise->block.d.promise.cached);
     promise->block.d.promise.cached = 1;
-    promise->block.d.promise.type = lisp_type(x);
+    promise->block.d.promise.type = VAL_TYPE_(x);
     promise->val_or_proc = x.val;
+    gc_barrier_(&promise->block, x);
 }
 
 int lisp_promise_forced(Lisp p)
@@ -1442,8 +2559,7 @@ int lisp_promise_forced(Lisp p)
 static Lisp promise_body_or_val_(Lisp p)
 {
     const Promise* promise = promise_get_(p); 
-    LispType type = (LispType)promise->block.d.promise.type;
-    return (Lisp) { promise->val_or_proc, type }; 
+    return VAL_(promise->val_or_proc, promise->block.d.promise.type);
 }
 
 Lisp lisp_promise_proc(Lisp p)
@@ -1466,10 +2582,11 @@ typedef struct
     Lisp result;
     jmp_buf jmp;
     int stack_ptr;
+    int profile_depth;
 } Jump;
 
 static Jump* jump_get_(Lisp x) {
-    assert(x.type == LISP_JUMP);
+    assert(lisp_type(x) == LISP_JUMP);
     return x.val.ptr_val;
 }
 
@@ -1477,7 +2594,7 @@ static Lisp make_jump_(LispContext ctx)
 {
     Jump* j = gc_alloc(sizeof(Jump), LISP_JUMP, ctx);
     j->result = lisp_false();
-    return (Lisp) { .val = { .ptr_val = j }, .type = LISP_JUMP };
+    return VAL_BLOCK_(j, LISP_JUMP);
 }
 
 // READER
@@ -1498,6 +2615,8 @@ typedef enum
     TOKEN_CHAR,
     TOKEN_BOOL,
     TOKEN_HASH_L_PAREN,
+    TOKEN_F64_L_PAREN,
+    TOKEN_S64_L_PAREN,
 } TokenType;
 
 /* for debug
@@ -1522,6 +2641,14 @@ typedef struct
     size_t buff_size;
 
     size_t position;
+
+    // buffers can be read a word at a time past the terminator (see string_span_).
+    int padded;
+    void* map;
+    size_t map_size;
+
+    // set by the shared readers (see share_)
+    struct ShareSet* share;
 } Lexer;
 
 static void lexer_shutdown(Lexer* lex)
@@ -1531,11 +2658,15 @@ static void lexer_shutdown(Lexer* lex)
         free(lex->buffs[0]);
         free(lex->buffs[1]);
     }
+#ifdef LISP_MMAP_
+    if (lex->map) munmap(lex->map, lex->map_size);
+#endif
 }
 
 static void lexer_init(Lexer* lex, const char* program)
 {
     lex->file = NULL;
+    lex->share = NULL;
     lex->sc_buff_index = 0;
     lex->c_buff_index = 0; 
     lex->buffs[0] = (char*)program;
@@ -1545,11 +2676,53 @@ static void lexer_init(Lexer* lex, const char* program)
     lex->sc = lex->c = lex->buffs[0];
     lex->scan_length = 0;
     lex->position = 0;
+    lex->padded = 0;
+    lex->map = NULL;
+    lex->map_size = 0;
+}
+
+// Regular files are mapped and lexed like a string.
+static int lexer_map_file_(Lexer* lex, FILE* file)
+{
+#ifdef LISP_MMAP_
+    struct stat info;
+    int fd = fileno(file);
+    long offset = ftell(file);
+    long page_size = sysconf(_SC_PAGESIZE);
+    if (fd < 0 || offset < 0 || page_size <= 0) return 0;
+    if (fstat(fd, &info) != 0 || !S_ISREG(info.st_mode)) return 0;
+
+    // The end of the last page is filled with zeros, which terminate the text.
+    // If the file fills it exactly there isn't one.
+    size_t size = (size_t)info.st_size;
+    if (size <= (size_t)offset || size % (size_t)page_size == 0) return 0;
+
+    void* map = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) return 0;
+
+    // like reading in chunks, the lexer consumes the rest of the file.
+    fseek(file, 0, SEEK_END);
+
+    lexer_init(lex, (const char*)map + offset);
+    lex->map = map;
+    lex->map_size = size;
+    // words never cross page boundaries
+    lex->padded = 1;
+    return 1;
+#else
+    return 0;
+#endif
 }
 
 static void lexer_init_file(Lexer* lex, FILE* file)
 {
+    if (lexer_map_file_(lex, file)) return;
+
     lex->file = file;
+    lex->share = NULL;
+    lex->padded = 1;
+    lex->map = NULL;
+    lex->map_size = 0;
 
     lex->buff_size = LISP_FILE_CHUNK_SIZE;
 
@@ -1557,8 +2730,9 @@ static void lexer_init_file(Lexer* lex, FILE* file)
     lex->sc_buff_index = 0;
     lex->c_buff_index = 0;
 
-    lex->buffs[0] = malloc(lex->buff_size + 1);
-    lex->buffs[1] = malloc(lex->buff_size + 1);
+    // padded so a word containing the terminator can be read
+    lex->buffs[0] = malloc(lex->buff_size + sizeof(uint64_t));
+    lex->buffs[1] = malloc(lex->buff_size + sizeof(uint64_t));
     lex->buffs[0][lex->buff_size] = '\0';
     lex->buffs[1][lex->buff_size] = '\0';
 
@@ -1636,16 +2810,44 @@ static int lexer_step(Lexer* lex)
     return 1;
 }
 
+// step over n characters in the current buffer.
+// Like lexer_step, reaching the end flips the buffer.
+static int lexer_skip_(Lexer* lex, size_t n)
+{
+    if (n == 0) return 1;
+    lex->c += n - 1;
+    lex->scan_length += n - 1;
+    lex->position += n - 1;
+    return lexer_step(lex);
+}
+
+// step over characters while pred is true.
+// Runs are found with a plain loop, rather than stepping one at a time.
+static void lexer_skip_while_(Lexer* lex, int (*pred)(int))
+{
+    while (1)
+    {
+        const char* c = lex->c;
+        while (pred((unsigned char)*c)) ++c;
+        size_t n = (size_t)(c - lex->c);
+        if (n == 0 || !lexer_skip_(lex, n)) return;
+    }
+}
+
+static int is_space_(int c) { return isspace(c); }
+static int is_digit_(int c) { return isdigit(c); }
+static int is_not_line_end_(int c) { return c != '\0' && c != '\n'; }
+
 static void lexer_skip_empty(Lexer* lex)
 {
     while (lex->c)
     {
         // skip whitespace
-        while (isspace(*lex->c)) lexer_step(lex);
+        lexer_skip_while_(lex, is_space_);
         // skip comments to end of line
         if (*lex->c == ';')
         {
-            while (*lex->c && *lex->c != '\n') lexer_step(lex);
+            lexer_skip_while_(lex, is_not_line_end_);
         }
         else
         {
@@ -1694,31 +2896,28 @@ static int lexer_match_hash_paren(Lexer* lex)
     return 1;
 }
 
-static int lexer_match_int(Lexer* lex)
+// #f64( or #s64(
+static TokenType lexer_match_numvector(Lexer* lex)
 {
     lexer_restart_scan(lex);
-    
-    // need at least one digit or -
-    if (!isdigit(*lex->c))
-    {
-        if (*lex->c == '-' || *lex->c == '+')
-        {
-            lexer_step(lex);
-            if (!isdigit(*lex->c)) return 0;
-        }
-        else
-        {
-            return 0;
-        }
-    }
-
+    if (*lex->c != '#') return TOKEN_NONE;
     lexer_step(lex);
-    // + any other digits
-    while (isdigit(*lex->c)) lexer_step(lex);
-    return 1;
+    TokenType token;
+    if (*lex->c == 'f') token = TOKEN_F64_L_PAREN;
+    else if (*lex->c == 's') token = TOKEN_S64_L_PAREN;
+    else return TOKEN_NONE;
+    lexer_step(lex);
+    if (*lex->c != '6') return TOKEN_NONE;
+    lexer_step(lex);
+    if (*lex->c != '4') return TOKEN_NONE;
+    lexer_step(lex);
+    if (*lex->c != '(') return TOKEN_NONE;
+    lexer_step(lex);
+    return token;
 }
 
-static int lexer_match_float(Lexer* lex)
+// matches an int or float in one pass. returns the token type.
+static TokenType lexer_match_number(Lexer* lex)
 {
     lexer_restart_scan(lex);
     
@@ -1728,36 +2927,38 @@ static int lexer_match_float(Lexer* lex)
         if (*lex->c == '-' || *lex->c == '+')
         {
             lexer_step(lex);
-            if (!isdigit(*lex->c)) return 0;
+            if (!isdigit(*lex->c)) return TOKEN_NONE;
         }
         else
         {
-            return 0;
+            return TOKEN_NONE;
         }
     }
     lexer_step(lex);
+    lexer_skip_while_(lex, is_digit_);
+
+    // must have a decimal or exponent to be a float
+    if (*lex->c != '.' && *lex->c != 'e' && *lex->c != 'E') return TOKEN_INT;
 
-    int found_decimal = 0;
     while (isdigit(*lex->c) || *lex->c == '.')
     {
-        if (*lex->c == '.') found_decimal = 1;
         lexer_step(lex);
+        lexer_skip_while_(lex, is_digit_);
     }
 
-    // must have a decimal to be a float
-    return found_decimal;
+    if (*lex->c == 'e' || *lex->c == 'E')
+    {
+        lexer_step(lex);
+        if (*lex->c == '-' || *lex->c == '+') lexer_step(lex);
+        lexer_skip_while_(lex, is_digit_);
+    }
+    return TOKEN_FLOAT;
 }
 
-static int is_symbol(char c)
+static int is_symbol(int c)
 {
     if (c < '!' || c > 'z') return 0;
-    const char* illegal= "()#;";
-    do
-    {
-        if (c == *illegal) return 0;
-        ++illegal;
-    } while (*illegal);
-    return 1;
+    return c != '(' && c != ')' && c != '#' && c != ';';
 }
 
 static int lexer_match_symbol(Lexer* lex)
@@ -1765,11 +2966,46 @@ static int lexer_match_symbol(Lexer* lex)
     lexer_restart_scan(lex);
     // need at least one valid symbol character
     if (!is_symbol(*lex->c)) return 0;
-    lexer_step(lex);
-    while (is_symbol(*lex->c)) lexer_step(lex);
+    lexer_skip_while_(lex, is_symbol);
     return 1;
 }
 
+static int is_string_special_(char c) { return c == '"' || c == '\\' || c == '\n' || c == '\0'; }
+
+// counts the characters before a quote, escape, newline or terminator.
+static size_t string_span_(const char* c, int padded)
+{
+    const char* start = c;
+    if (padded)
+    {
+        // test a word at a time for any of the bytes.
+        // Aligned words can be read without crossing into another page.
+        // https://graphics.stanford.edu/~seander/bithacks.html#ZeroInWord
+        while ((uintptr_t)c % sizeof(uint64_t) != 0)
+        {
+            if (is_string_special_(*c)) return (size_t)(c - start);
+            ++c;
+        }
+
+        const uint64_t ones = UINT64_C(0x0101010101010101);
+        const uint64_t highs = UINT64_C(0x8080808080808080);
+        while (1)
+        {
+            uint64_t w;
+            memcpy(&w, c, sizeof(w));
+            uint64_t q = w ^ (ones * '"');
+            uint64_t e = w ^ (ones * '\\');
+            uint64_t n = w ^ (ones * '\n');
+            uint64_t zeros = ((w - ones) & ~w) | ((q - ones) & ~q) | ((e - ones) & ~e) | ((n - ones) & ~n);
+            if (zeros & highs) break;
+            c += sizeof(uint64_t);
+        }
+    }
+
+    while (!is_string_special_(*c)) ++c;
+    return (size_t)(c - start);
+}
+
 static int lexer_match_string(Lexer* lex)
 {
     lexer_restart_scan(lex);
@@ -1792,7 +3028,7 @@ static int lexer_match_string(Lexer* lex)
             case '\n':
                 return 0;
             default:
-                lexer_step(lex);
+                if (!lexer_skip_(lex, string_span_(lex->c, lex->padded))) return 0;
         }
     }
 }
@@ -1864,11 +3100,12 @@ static void lexer_next_token(Lexer* lex)
     }
     else
     {
+        TokenType number;
         if (lexer_match_string(lex)) lex->token = TOKEN_STRING;
-        else if (lexer_match_float(lex)) lex->token = TOKEN_FLOAT;
-        else if (lexer_match_int(lex)) lex->token = TOKEN_INT;
+        else if ((number = lexer_match_number(lex)) != TOKEN_NONE) lex->token = number;
         else if (lexer_match_symbol(lex)) lex->token = TOKEN_SYMBOL;
         else if (lexer_match_char(lex)) lex->token = TOKEN_CHAR;
+        else if ((number = lexer_match_numvector(lex)) != TOKEN_NONE) lex->token = number;
         else if (lexer_match_bool(lex)) lex->token = TOKEN_BOOL;
         else if (lexer_match_hash_paren(lex)) lex->token = TOKEN_HASH_L_PAREN;
     }
@@ -1903,31 +3140,387 @@ static char* string_unescape_(const char* first, const char* last, char* out)
     return out;
 }
 
-static void print_escaped_(const char* c, FILE* file)
+#define PRINT_BUFFER_SIZE_ 4096
+
+// where the printer writes: a FILE, a string port when port is not null,
+// or a growing malloc'd buffer when neither is set (lisp_print_to_buffer).
+// Output is collected in data and written in chunks, instead of a call per atom.
+typedef struct
 {
-    while (*c)
-    {
-        switch (*c)
-        {
+    FILE* file;
+    Lisp port;
+    LispContext ctx;
+    char* data;
+    size_t size;
+    size_t capacity;
+    char local[PRINT_BUFFER_SIZE_];
+} PrintOut;
+
+static void out_init_(PrintOut* out, FILE* file, Lisp port, LispContext ctx)
+{
+    out->file = file;
+    out->port = port;
+    out->ctx = ctx;
+    out->data = out->local;
+    out->size = 0;
+    out->capacity = PRINT_BUFFER_SIZE_;
+}
+
+static int out_is_buffer_(const PrintOut* out) { return !out->file && lisp_is_null(out->port); }
+
+static void out_flush_(PrintOut* out)
+{
+    if (out->size == 0 || out_is_buffer_(out)) return;
+    if (out->file)
+        fwrite(out->data, 1, out->size, out->file);
+    else
+        lisp_port_write(out->port, out->data, (int)out->size, out->ctx);
+    out->size = 0;
+}
+
+// returns space for n more bytes.
+static char* out_reserve_(PrintOut* out, size_t n)
+{
+    if (out->size + n > out->capacity) out_flush_(out);
+    if (out->size + n > out->capacity)
+    {
+        size_t capacity = out->capacity * 2;
+        while (capacity < out->size + n) capacity *= 2;
+        if (out->data == out->local)
+        {
+            out->data = malloc(capacity);
+            memcpy(out->data, out->local, out->size);
+        }
+        else
+        {
+            out->data = realloc(out->data, capacity);
+        }
+        out->capacity = capacity;
+    }
+    return out->data + out->size;
+}
+
+static void out_write_(PrintOut* out, const char* bytes, int n)
+{
+    if (n > PRINT_BUFFER_SIZE_ / 2 && !out_is_buffer_(out))
+    {
+        // long strings go straight through
+        out_flush_(out);
+        if (out->file)
+            fwrite(bytes, 1, n, out->file);
+        else
+            lisp_port_write(out->port, bytes, n, out->ctx);
+        return;
+    }
+    memcpy(out_reserve_(out, n), bytes, n);
+    out->size += n;
+}
+
+static void out_putc_(PrintOut* out, char c)
+{
+    *out_reserve_(out, 1) = c;
+    ++out->size;
+}
+
+static void out_puts_(PrintOut* out, const char* s) { out_write_(out, s, (int)strlen(s)); }
+
+static void out_printf_(PrintOut* out, const char* format, ...)
+{
+    // only used for pointers and names, which are short
+    const int max = 128;
+    char* scratch = out_reserve_(out, max);
+    va_list args;
+    va_start(args, format);
+    int n = vsnprintf(scratch, max, format, args);
+    va_end(args);
+    if (n >= max) n = max - 1;
+    if (n > 0) out->size += n;
+}
+
+// writes the digits of x backwards, ending at end. returns the first.
+static char* format_uint_(uint64_t x, char* end)
+{
+    do
+    {
+        *--end = (char)('0' + x % 10);
+        x /= 10;
+    } while (x);
+    return end;
+}
+
+static void out_int_(PrintOut* out, LispInt x)
+{
+    char scratch[24];
+    char* end = scratch + sizeof(scratch);
+    char* c = format_uint_(x < 0 ? -(uint64_t)x : (uint64_t)x, end);
+    if (x < 0) *--c = '-';
+    out_write_(out, c, (int)(end - c));
+}
+
+// Grisu2 (Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers").
+// Generates digits within the interval of reals which round to x, using 64 bit integers.
+// The result always reads back as x and is almost always the shortest.
+typedef struct
+{
+    uint64_t f;
+    int e;
+} DiyFp;
+
+static DiyFp diy_fp_mul_(DiyFp x, DiyFp y)
+{
+    const uint64_t mask = 0xFFFFFFFF;
+    uint64_t a = x.f >> 32, b = x.f & mask;
+    uint64_t c = y.f >> 32, d = y.f & mask;
+    uint64_t ac = a * c, bc = b * c, ad = a * d, bd = b * d;
+    uint64_t mid = (bd >> 32) + (ad & mask) + (bc & mask) + (UINT64_C(1) << 31);
+    DiyFp r = { ac + (ad >> 32) + (bc >> 32) + (mid >> 32), x.e + y.e + 64 };
+    return r;
+}
+
+static DiyFp diy_fp_normalize_(DiyFp x)
+{
+    while (!(x.f & (UINT64_C(1) << 63)))
+    {
+        x.f <<= 1;
+        --x.e;
+    }
+    return x;
+}
+
+// 10^k for k = -348, -340, ... 340, with 64 bit significands.
+static const DiyFp grisu_powers_[] = {
+        { UINT64_C(0xfa8fd5a0081c0288), -1220 }, { UINT64_C(0xbaaee17fa23ebf76), -1193 }, { UINT64_C(0x8b16fb203055ac76), -1166 }, { UINT64_C(0xcf42894a5dce35ea), -1140 },
+        { UINT64_C(0x9a6bb0aa55653b2d), -1113 }, { UINT64_C(0xe61acf033d1a45df), -1087 }, { UINT64_C(0xab70fe17c79ac6ca), -1060 }, { UINT64_C(0xff77b1fcbebcdc4f), -1034 },
+        { UINT64_C(0xbe5691ef416bd60c), -1007 }, { UINT64_C(0x8dd01fad907ffc3c), -980 }, { UINT64_C(0xd3515c2831559a83), -954 }, { UINT64_C(0x9d71ac8fada6c9b5), -927 },
+        { UINT64_C(0xea9c227723ee8bcb), -901 }, { UINT64_C(0xaecc49914078536d), -874 }, { UINT64_C(0x823c12795db6ce57), -847 }, { UINT64_C(0xc21094364dfb5637), -821 },
+        { UINT64_C(0x9096ea6f3848984f), -794 }, { UINT64_C(0xd77485cb25823ac7), -768 }, { UINT64_C(0xa086cfcd97bf97f4), -741 }, { UINT64_C(0xef340a98172aace5), -715 },
+        { UINT64_C(0xb23867fb2a35b28e), -688 }, { UINT64_C(0x84c8d4dfd2c63f3b), -661 }, { UINT64_C(0xc5dd44271ad3cdba), -635 }, { UINT64_C(0x936b9fcebb25c996), -608 },
+        { UINT64_C(0xdbac6c247d62a584), -582 }, { UINT64_C(0xa3ab66580d5fdaf6), -555 }, { UINT64_C(0xf3e2f893dec3f126), -529 }, { UINT64_C(0xb5b5ada8aaff80b8), -502 },
+        { UINT64_C(0x87625f056c7c4a8b), -475 }, { UINT64_C(0xc9bcff6034c13053), -449 }, { UINT64_C(0x964e858c91ba2655), -422 }, { UINT64_C(0xdff9772470297ebd), -396 },
+        { UINT64_C(0xa6dfbd9fb8e5b88f), -369 }, { UINT64_C(0xf8a95fcf88747d94), -343 }, { UINT64_C(0xb94470938fa89bcf), -316 }, { UINT64_C(0x8a08f0f8bf0f156b), -289 },
+        { UINT64_C(0xcdb02555653131b6), -263 }, { UINT64_C(0x993fe2c6d07b7fac), -236 }, { UINT64_C(0xe45c10c42a2b3b06), -210 }, { UINT64_C(0xaa242499697392d3), -183 },
+        { UINT64_C(0xfd87b5f28300ca0e), -157 }, { UINT64_C(0xbce5086492111aeb), -130 }, { UINT64_C(0x8cbccc096f5088cc), -103 }, { UINT64_C(0xd1b71758e219652c), -77 },
+        { UINT64_C(0x9c40000000000000), -50 }, { UINT64_C(0xe8d4a51000000000), -24 }, { UINT64_C(0xad78ebc5ac620000), 3 }, { UINT64_C(0x813f3978f8940984), 30 },
+        { UINT64_C(0xc097ce7bc90715b3), 56 }, { UINT64_C(0x8f7e32ce7bea5c70), 83 }, { UINT64_C(0xd5d238a4abe98068), 109 }, { UINT64_C(0x9f4f2726179a2245), 136 },
+        { UINT64_C(0xed63a231d4c4fb27), 162 }, { UINT64_C(0xb0de65388cc8ada8), 189 }, { UINT64_C(0x83c7088e1aab65db), 216 }, { UINT64_C(0xc45d1df942711d9a), 242 },
+        { UINT64_C(0x924d692ca61be758), 269 }, { UINT64_C(0xda01ee641a708dea), 295 }, { UINT64_C(0xa26da3999aef774a), 322 }, { UINT64_C(0xf209787bb47d6b85), 348 },
+        { UINT64_C(0xb454e4a179dd1877), 375 }, { UINT64_C(0x865b86925b9bc5c2), 402 }, { UINT64_C(0xc83553c5c8965d3d), 428 }, { UINT64_C(0x952ab45cfa97a0b3), 455 },
+        { UINT64_C(0xde469fbd99a05fe3), 481 }, { UINT64_C(0xa59bc234db398c25), 508 }, { UINT64_C(0xf6c69a72a3989f5c), 534 }, { UINT64_C(0xb7dcbf5354e9bece), 561 },
+        { UINT64_C(0x88fcf317f22241e2), 588 }, { UINT64_C(0xcc20ce9bd35c78a5), 614 }, { UINT64_C(0x98165af37b2153df), 641 }, { UINT64_C(0xe2a0b5dc971f303a), 667 },
+        { UINT64_C(0xa8d9d1535ce3b396), 694 }, { UINT64_C(0xfb9b7cd9a4a7443c), 720 }, { UINT64_C(0xbb764c4ca7a44410), 747 }, { UINT64_C(0x8bab8eefb6409c1a), 774 },
+        { UINT64_C(0xd01fef10a657842c), 800 }, { UINT64_C(0x9b10a4e5e9913129), 827 }, { UINT64_C(0xe7109bfba19c0c9d), 853 }, { UINT64_C(0xac2820d9623bf429), 880 },
+        { UINT64_C(0x80444b5e7aa7cf85), 907 }, { UINT64_C(0xbf21e44003acdd2d), 933 }, { UINT64_C(0x8e679c2f5e44ff8f), 960 }, { UINT64_C(0xd433179d9c8cb841), 986 },
+        { UINT64_C(0x9e19db92b4e31ba9), 1013 }, { UINT64_C(0xeb96bf6ebadf77d9), 1039 }, { UINT64_C(0xaf87023b9bf0ee6b), 1066 },
+};
+
+// the cached power c with alpha <= c.e + e + 64 <= gamma. k is its decimal exponent.
+static DiyFp grisu_cached_power_(int e, int* k)
+{
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int ik = (int)dk;
+    if (dk - ik > 0.0) ++ik;
+    int index = (ik >> 3) + 1;
+    *k = -(-348 + index * 8);
+    return grisu_powers_[index];
+}
+
+static void grisu_round_(char* buffer, int length, uint64_t delta, uint64_t rest, uint64_t ten_kappa, uint64_t wp_w)
+{
+    while (rest < wp_w && delta - rest >= ten_kappa &&
+           (rest + ten_kappa < wp_w || wp_w - rest > rest + ten_kappa - wp_w))
+    {
+        --buffer[length - 1];
+        rest += ten_kappa;
+    }
+}
+
+static int grisu_digits_(DiyFp w, DiyFp mp, uint64_t delta, char* buffer, int* k)
+{
+    static const uint64_t pow10[] = {
+        1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+        UINT64_C(10000000000), UINT64_C(100000000000), UINT64_C(1000000000000),
+        UINT64_C(10000000000000), UINT64_C(100000000000000), UINT64_C(1000000000000000),
+        UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000),
+    };
+    DiyFp one = { UINT64_C(1) << -mp.e, mp.e };
+    uint64_t wp_w = mp.f - w.f;
+    uint32_t p1 = (uint32_t)(mp.f >> -one.e);
+    uint64_t p2 = mp.f & (one.f - 1);
+
+    int kappa = 1;
+    while (kappa < 10 && p1 >= pow10[kappa]) ++kappa;
+
+    int length = 0;
+    while (kappa > 0)
+    {
+        uint32_t d = (uint32_t)(p1 / pow10[kappa - 1]);
+        p1 %= (uint32_t)pow10[kappa - 1];
+        if (d || length) buffer[length++] = (char)('0' + d);
+        --kappa;
+        uint64_t rest = ((uint64_t)p1 << -one.e) + p2;
+        if (rest <= delta)
+        {
+            *k += kappa;
+            grisu_round_(buffer, length, delta, rest, pow10[kappa] << -one.e, wp_w);
+            return length;
+        }
+    }
+
+    while (1)
+    {
+        p2 *= 10;
+        delta *= 10;
+        char d = (char)(p2 >> -one.e);
+        if (d || length) buffer[length++] = (char)('0' + d);
+        p2 &= one.f - 1;
+        --kappa;
+        if (p2 < delta)
+        {
+            *k += kappa;
+            grisu_round_(buffer, length, delta, p2, one.f, wp_w * pow10[-kappa]);
+            return length;
+        }
+    }
+}
+
+// digits of positive, finite x in buffer (at most 17), so x = digits * 10^k.
+static int grisu2_(double x, char* buffer, int* k)
+{
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    const uint64_t hidden = UINT64_C(1) << 52;
+    int biased = (int)((bits >> 52) & 0x7FF);
+    DiyFp v = { bits & (hidden - 1), biased ? biased - 1075 : -1074 };
+    if (biased) v.f += hidden;
+
+    // boundaries halfway to the neighbouring doubles
+    DiyFp mp = { (v.f << 1) + 1, v.e - 1 };
+    mp = diy_fp_normalize_(mp);
+    DiyFp mm = v.f == hidden ? (DiyFp) { (v.f << 2) - 1, v.e - 2 } : (DiyFp) { (v.f << 1) - 1, v.e - 1 };
+    mm.f <<= mm.e - mp.e;
+    mm.e = mp.e;
+
+    int mk;
+    DiyFp c = grisu_cached_power_(mp.e, &mk);
+    DiyFp w = diy_fp_mul_(diy_fp_normalize_(v), c);
+    DiyFp wp = diy_fp_mul_(mp, c);
+    DiyFp wm = diy_fp_mul_(mm, c);
+    ++wm.f;
+    --wp.f;
+    *k = mk;
+    return grisu_digits_(w, wp, wp.f - wm.f, buffer, k);
+}
+
+// digits * 10^k, as positional notation for moderate exponents, like 0.00125 or 1500.0,
+// or scientific otherwise, like 1.5e+300. Either has a point or exponent, so it reads as a real.
+static int format_digits_(int negative, const char* digits, int n, int k, char* buffer)
+{
+    char* c = buffer;
+    if (negative) *c++ = '-';
+
+    // digits before the point
+    int point = n + k;
+    if (point > -6 && point <= 21)
+    {
+        if (point <= 0)
+        {
+            *c++ = '0';
+            *c++ = '.';
+            for (int i = point; i < 0; ++i) *c++ = '0';
+            memcpy(c, digits, n);
+            c += n;
+        }
+        else if (point < n)
+        {
+            memcpy(c, digits, point);
+            c += point;
+            *c++ = '.';
+            memcpy(c, digits + point, n - point);
+            c += n - point;
+        }
+        else
+        {
+            memcpy(c, digits, n);
+            c += n;
+            for (int i = n; i < point; ++i) *c++ = '0';
+            *c++ = '.';
+            *c++ = '0';
+        }
+    }
+    else
+    {
+        *c++ = digits[0];
+        if (n > 1)
+        {
+            *c++ = '.';
+            memcpy(c, digits + 1, n - 1);
+            c += n - 1;
+        }
+        int e = point - 1;
+        *c++ = 'e';
+        *c++ = e < 0 ? '-' : '+';
+        char scratch[8];
+        char* end = scratch + sizeof(scratch);
+        char* first = format_uint_((uint64_t)(e < 0 ? -e : e), end);
+        memcpy(c, first, end - first);
+        c += end - first;
+    }
+    *c = '\0';
+    return (int)(c - buffer);
+}
+
+// The shortest decimal which reads back as x, in buffer (at least 32 bytes).
+static int format_real_(LispReal x, char* buffer)
+{
+    if (x != x) return (int)(strcpy(buffer, "nan"), 3);
+
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    int negative = (int)(bits >> 63);
+    LispReal a = negative ? -x : x;
+
+    if (a > 1.7976931348623157e308) return negative ? (strcpy(buffer, "-inf"), 4) : (strcpy(buffer, "inf"), 3);
+    if (a == 0.0) return format_digits_(negative, "0", 1, 0, buffer);
+
+    char digits[20];
+    int k;
+    int n = grisu2_(a, digits, &k);
+    return format_digits_(negative, digits, n, k, buffer);
+}
+
+static void out_real_(PrintOut* out, LispReal x)
+{
+    char* c = out_reserve_(out, 32);
+    out->size += format_real_(x, c);
+}
+
+static void print_escaped_(const char* c, int n, PrintOut* out)
+{
+    const char* end = c + n;
+    while (c != end)
+    {
+        switch (*c)
+        {
             case '\n':
-                fputc('\\', file);
-                fputc('n', file);
+                out_puts_(out, "\\n");
                 break;
             case '\t':
-                fputc('\\', file);
-                fputc('t', file);
+                out_puts_(out, "\\t");
                 break;
             case '\f':
-                fputc('\\', file);
-                fputc('f', file);
+                out_puts_(out, "\\f");
                 break;
             case '\"':
-                fputc('\\', file);
-                fputc('"', file);
+                out_puts_(out, "\\\"");
                 break;
             default:
-                fputc(*c, file);
-                break;
+            {
+                // copy the run up to the next escape at once
+                const char* start = c;
+                while (c != end && *c != '\n' && *c != '\t' && *c != '\f' && *c != '"') ++c;
+                out_write_(out, start, (int)(c - start));
+                continue;
+            }
         }
         ++c;
     }
@@ -1953,9 +3546,18 @@ static Lisp parse_string_(Lexer* lex, LispContext ctx)
     size_t size = lex->scan_length - 2;
     Lisp l = lisp_make_buffer(size + 1, ctx);
     char* str = lisp_buffer(l);
-    lexer_copy_token(lex, 1, size, str);
-    char* out = string_unescape_(str, str + size, str);
-    *out = '\0';
+    char* out;
+    if (lex->c_buff_index == lex->sc_buff_index)
+    {
+        // unescape straight out of the buffer
+        out = string_unescape_(lex->sc + 1, lex->sc + 1 + size, str);
+    }
+    else
+    {
+        lexer_copy_token(lex, 1, size, str);
+        out = string_unescape_(str, str + size, str);
+    }
+    lisp_buffer_set_length(l, (int)(out - str));
     return l;
 }
 
@@ -1966,7 +3568,7 @@ static Lisp parse_symbol_(Lexer* lex, LispContext ctx)
     // always convert symbols to uppercase
     for (int i = 0; i < length; ++i)
         scratch[i] = toupper(scratch[i]);
-    return symbol_intern_(ctx.p->symbols, scratch, length, ctx);
+    return symbol_intern_(scratch, length, ctx);
 }
 
 static const char* ascii_char_name_table_[] =
@@ -2006,6 +3608,139 @@ static int parse_char_(Lexer* lex)
     }
 }
 
+// The shared readers hash-cons strings, pairs and vectors as they are built.
+// Children are shared before their parents, so comparing them by identity
+// one level deep is enough to find structurally equal data.
+// Nothing is collected during a read, so the set holds plain values.
+typedef struct ShareSet
+{
+    Lisp* slots;
+    size_t capacity;
+    size_t count;
+} ShareSet;
+
+// the identity of an object, or its immediate bits (so 0.0 and -0.0 stay apart)
+static uint64_t share_bits_(Lisp x)
+{
+#ifndef LISP_TAGGED
+    // only the low bits of these are set
+    if (lisp_type(x) == LISP_CHAR || lisp_type(x) == LISP_BOOL) return (uint64_t)x.val.char_val;
+#endif
+    return x.val.bits;
+}
+
+static int share_same_(Lisp a, Lisp b) { return lisp_type(a) == lisp_type(b) && share_bits_(a) == share_bits_(b); }
+
+static uint64_t share_hash_(Lisp x)
+{
+    switch (lisp_type(x))
+    {
+        case LISP_PAIR:
+            return hash_uint64(hash_uint64(share_bits_(lisp_car(x))) + 31 * share_bits_(lisp_cdr(x)));
+        case LISP_STRING:
+            return hash_bytes(lisp_string(x), lisp_string_length(x));
+        case LISP_VECTOR:
+        {
+            uint64_t h = LISP_VECTOR;
+            int n = lisp_vector_length(x);
+            for (int i = 0; i < n; ++i) h = hash_uint64(h + share_bits_(lisp_vector_ref(x, i)));
+            return h;
+        }
+        case LISP_F64VECTOR:
+            return hash_bytes((const char*)lisp_f64vector(x), sizeof(LispReal) * lisp_f64vector_length(x));
+        case LISP_S64VECTOR:
+            return hash_bytes((const char*)lisp_s64vector(x), sizeof(LispInt) * lisp_s64vector_length(x));
+        default:
+            assert(0);
+            return 0;
+    }
+}
+
+
+static int share_equal_(Lisp a, Lisp b)
+{
+    if (lisp_type(a) != lisp_type(b)) return 0;
+    switch (lisp_type(a))
+    {
+        case LISP_PAIR:
+            return share_same_(lisp_car(a), lisp_car(b)) && share_same_(lisp_cdr(a), lisp_cdr(b));
+        case LISP_STRING:
+            return lisp_string_length(a) == lisp_string_length(b) &&
+                memcmp(lisp_string(a), lisp_string(b), lisp_string_length(a)) == 0;
+        case LISP_VECTOR:
+        {
+            int n = lisp_vector_length(a);
+            if (n != lisp_vector_length(b)) return 0;
+            for (int i = 0; i < n; ++i)
+                if (!share_same_(lisp_vector_ref(a, i), lisp_vector_ref(b, i))) return 0;
+            return 1;
+        }
+        case LISP_F64VECTOR:
+            return lisp_f64vector_length(a) == lisp_f64vector_length(b) &&
+                memcmp(lisp_f64vector(a), lisp_f64vector(b), sizeof(LispReal) * lisp_f64vector_length(a)) == 0;
+        case LISP_S64VECTOR:
+            return lisp_s64vector_length(a) == lisp_s64vector_length(b) &&
+                memcmp(lisp_s64vector(a), lisp_s64vector(b), sizeof(LispInt) * lisp_s64vector_length(a)) == 0;
+        default:
+            return 0;
+    }
+}
+
+static void share_insert_(ShareSet* set, Lisp x, uint64_t hash)
+{
+    size_t i = hash & (set->capacity - 1);
+    while (!lisp_is_null(set->slots[i])) i = (i + 1) & (set->capacity - 1);
+    set->slots[i] = x;
+    ++set->count;
+}
+
+// returns the first equal value read, or x if it is new.
+static Lisp share_(Lexer* lex, Lisp x)
+{
+    ShareSet* set = lex->share;
+    if (!set) return x;
+
+    uint64_t hash = share_hash_(x);
+    if (set->capacity)
+    {
+        size_t i = hash & (set->capacity - 1);
+        while (!lisp_is_null(set->slots[i]))
+        {
+            if (share_equal_(set->slots[i], x)) return set->slots[i];
+            i = (i + 1) & (set->capacity - 1);
+        }
+    }
+
+    if ((set->count + 1) * 2 > set->capacity)
+    {
+        ShareSet old = *set;
+        set->capacity = old.capacity ? old.capacity * 2 : 1024;
+        set->count = 0;
+        set->slots = malloc(sizeof(Lisp) * set->capacity);
+        for (size_t i = 0; i < set->capacity; ++i) set->slots[i] = lisp_null();
+        for (size_t i = 0; i < old.capacity; ++i)
+            if (!lisp_is_null(old.slots[i])) share_insert_(set, old.slots[i], share_hash_(old.slots[i]));
+        free(old.slots);
+    }
+    share_insert_(set, x, hash);
+    return x;
+}
+
+// reverses the items read onto the end of the list,
+// sharing each pair from the back so its cdr is already shared.
+static Lisp share_list_(Lexer* lex, Lisp reversed, Lisp end)
+{
+    Lisp result = end;
+    while (lisp_is_pair(reversed))
+    {
+        Lisp next = lisp_cdr(reversed);
+        lisp_set_cdr(reversed, result);
+        result = share_(lex, reversed);
+        reversed = next;
+    }
+    return result;
+}
+
 // read tokens and construct S-expresions
 static Lisp parse_list_r(Lexer* lex, jmp_buf error_jmp, LispContext ctx)
 {  
@@ -2043,13 +3778,13 @@ static Lisp parse_list_r(Lexer* lex, jmp_buf error_jmp, LispContext ctx)
                 if (lex->token != TOKEN_R_PAREN)
                 {
                     Lisp x = parse_list_r(lex, error_jmp, ctx);
-                    tail = lisp_list_reverse2(tail, x);
+                    tail = lex->share ? share_list_(lex, tail, x) : lisp_list_reverse2(tail, x);
                     lexer_next_token(lex);
                 }
             }
             else
             {
-                tail = lisp_list_reverse(tail);
+                tail = lex->share ? share_list_(lex, tail, lisp_null()) : lisp_list_reverse(tail);
             }
 
             if (lex->token != TOKEN_R_PAREN)
@@ -2096,13 +3831,63 @@ static Lisp parse_list_r(Lexer* lex, jmp_buf error_jmp, LispContext ctx)
             
             Lisp v =  lisp_make_vector2(buffer, n, ctx);
             if (buffer) free(buffer);
-            return v;
+            return share_(lex, v);
+        }
+        case TOKEN_F64_L_PAREN:
+        case TOKEN_S64_L_PAREN:
+        {
+            // #f64( or #s64( numbers
+            int f64 = lex->token == TOKEN_F64_L_PAREN;
+            lexer_next_token(lex);
+
+            LispVal* buffer = NULL;
+            size_t buffer_cap = 0;
+
+            int n = 0;
+            while (lex->token != TOKEN_R_PAREN)
+            {
+                if (lex->token != TOKEN_INT && (lex->token != TOKEN_FLOAT || !f64))
+                {
+                    free(buffer);
+                    fprintf(ctx.p->err_port, "%lu. expected %s in numeric vector\n", lex->position, f64 ? "number" : "integer");
+                    longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
+                }
+                Lisp x = parse_list_r(lex, error_jmp, ctx);
+                lexer_next_token(lex);
+
+                if (buffer_cap <= n + 1)
+                {
+                    buffer_cap *= 2;
+                    if (buffer_cap < 16) buffer_cap = 16;
+                    buffer = realloc(buffer, buffer_cap * sizeof(LispVal));
+                }
+                if (f64)
+                    buffer[n].real_val = lisp_number_to_real(x);
+                else
+                    buffer[n].int_val = lisp_int(x);
+                ++n;
+            }
+            // )
+
+            Lisp v;
+            if (f64)
+            {
+                v = lisp_make_f64vector(n, ctx);
+                for (int i = 0; i < n; ++i) lisp_f64vector(v)[i] = buffer[i].real_val;
+            }
+            else
+            {
+                v = lisp_make_s64vector(n, ctx);
+                for (int i = 0; i < n; ++i) lisp_s64vector(v)[i] = buffer[i].int_val;
+            }
+            free(buffer);
+            return share_(lex, v);
         }
         case TOKEN_FLOAT:
         case TOKEN_INT:
             return parse_number_(lex, ctx);
         case TOKEN_STRING:
-            return parse_string_(lex, ctx);
+            return share_(lex, parse_string_(lex, ctx));
         case TOKEN_SYMBOL:
             return parse_symbol_(lex, ctx);
         case TOKEN_CHAR:
@@ -2138,9 +3923,9 @@ static Lisp parse_list_r(Lexer* lex, jmp_buf error_jmp, LispContext ctx)
         quote:
         {
              // '
-             Lisp l = lisp_cons(parse_list_r(lex, error_jmp, ctx), lisp_null(), ctx);
+             Lisp l = share_(lex, lisp_cons(parse_list_r(lex, error_jmp, ctx), lisp_null(), ctx));
              //lexer_next_token(lex);
-             return lisp_cons(get_sym(quote_type, ctx), l, ctx);
+             return share_(lex, lisp_cons(get_sym(quote_type, ctx), l, ctx));
         }
         default:
             assert(0);
@@ -2200,6 +3985,33 @@ Lisp lisp_read_file(FILE *file, LispError* out_error, LispContext ctx)
     return l;
 }
 
+static Lisp parse_shared_(Lexer* lex, LispError* out_error, LispContext ctx)
+{
+    ShareSet set = { NULL, 0, 0 };
+    lex->share = &set;
+    Lisp l = parse(lex, out_error, ctx);
+    free(set.slots);
+    return l;
+}
+
+Lisp lisp_read_shared(const char *program, LispError* out_error, LispContext ctx)
+{
+    Lexer lex;
+    lexer_init(&lex, program);
+    Lisp l = parse_shared_(&lex, out_error, ctx);
+    lexer_shutdown(&lex);
+    return l;
+}
+
+Lisp lisp_read_file_shared(FILE *file, LispError* out_error, LispContext ctx)
+{
+    Lexer lex;
+    lexer_init_file(&lex, file);
+    Lisp l = parse_shared_(&lex, out_error, ctx);
+    lexer_shutdown(&lex);
+    return l;
+}
+
 Lisp lisp_read_path(const char *path, LispError* out_error, LispContext ctx)
 {
     FILE *file = fopen(path, "r");
@@ -2213,1025 +4025,4947 @@ Lisp lisp_read_path(const char *path, LispError* out_error, LispContext ctx)
     return l;
 }
 
-Lisp lisp_env_extend(Lisp l, Lisp table, LispContext ctx) { return lisp_cons(table, l, ctx); }
+struct LispReader
+{
+    Lexer lex;
+};
 
-Lisp lisp_env_lookup(Lisp l, Lisp key, int *present)
+LispReader* lisp_reader_open(FILE* file)
 {
-    while (lisp_is_pair(l))
+    LispReader* reader = malloc(sizeof(LispReader));
+    lexer_init_file(&reader->lex, file);
+    return reader;
+}
+
+Lisp lisp_reader_next(LispReader* reader, LispError* out_error, LispContext ctx)
+{
+    jmp_buf error_jmp;
+    LispError error = setjmp(error_jmp);
+
+    if (error != LISP_ERROR_NONE)
     {
-        Lisp x = lisp_table_get(lisp_car(l), key, present);
-        if (*present) return x;
-        l = lisp_cdr(l);
+        if (out_error) *out_error = error;
+        return lisp_eof();
     }
-    
-    return lisp_null();
+
+    // parse_list_r leaves the lexer on the last token of the datum.
+    Lexer* lex = &reader->lex;
+    lexer_next_token(lex);
+    Lisp result = lex->token == TOKEN_NONE ? lisp_eof() : parse_list_r(lex, error_jmp, ctx);
+    if (out_error) *out_error = error;
+    return result;
 }
 
-void lisp_env_define(Lisp l, Lisp key, Lisp x, LispContext ctx)
+void lisp_reader_close(LispReader* reader)
 {
-    lisp_table_set(lisp_car(l), key, x, ctx);
+    lexer_shutdown(&reader->lex);
+    free(reader);
 }
 
-int lisp_env_set(Lisp l, Lisp key, Lisp x, LispContext ctx)
+// -----------------------------------------
+// BINARY
+// -----------------------------------------
+
+/* Each record is a 16 byte header, "LISPBIN", a version byte
+ and the size of the rest of the record (8 bytes, little endian).
+ Then the number of symbols, each symbol's length and name,
+ and one value. Values are a tag byte followed by their contents.
+ Counts, lengths, symbol numbers, characters and ints are LEB128 varints.
+ Ints and characters are zigzag encoded so small negatives stay small. */
+enum
 {
-    int present;
-    while (lisp_is_pair(l))
+    BIN_NULL_ = 0,
+    BIN_FALSE_,
+    BIN_TRUE_,
+    BIN_INT_,    // varint
+    BIN_REAL_,   // 8 byte IEEE double, little endian
+    BIN_CHAR_,   // varint
+    BIN_STRING_, // length, bytes
+    BIN_SYMBOL_, // index into the symbol table
+    BIN_LIST_,   // n, n values, then the tail
+    BIN_VECTOR_, // n, n values
+    BIN_TABLE_,  // n, n keys and values
+    BIN_EQUAL_TABLE_, // same as a table
+    BIN_F64VECTOR_, // n, n 8 byte doubles
+    BIN_S64VECTOR_, // n, n 8 byte ints, little endian
+};
+
+#define BIN_MAGIC_ "LISPBIN"
+#define BIN_VERSION_ 1
+#define BIN_HEADER_SIZE_ 16
+
+typedef struct
+{
+    unsigned char* data;
+    size_t size;
+    size_t capacity;
+} BinBuffer;
+
+static void bin_reserve_(BinBuffer* b, size_t n)
+{
+    if (b->size + n <= b->capacity) return;
+    while (b->size + n > b->capacity)
+        b->capacity = b->capacity ? b->capacity * 2 : 4096;
+    b->data = realloc(b->data, b->capacity);
+}
+
+static void bin_put_byte_(BinBuffer* b, int x)
+{
+    bin_reserve_(b, 1);
+    b->data[b->size++] = (unsigned char)x;
+}
+
+static void bin_put_bytes_(BinBuffer* b, const void* x, size_t n)
+{
+    bin_reserve_(b, n);
+    memcpy(b->data + b->size, x, n);
+    b->size += n;
+}
+
+static void bin_put_varint_(BinBuffer* b, uint64_t x)
+{
+    bin_reserve_(b, 10);
+    while (x >= 0x80)
     {
-        lisp_table_get(lisp_car(l), key, &present);
-        if (present)
-        {
-            lisp_table_set(lisp_car(l), key, x, ctx);
-            return 1;
-        }  
-        l = lisp_cdr(l);
+        b->data[b->size++] = (unsigned char)(x | 0x80);
+        x >>= 7;
     }
+    b->data[b->size++] = (unsigned char)x;
+}
 
-    return 0; 
+static void bin_put_u64_(unsigned char* out, uint64_t x)
+{
+    for (int i = 0; i < 8; ++i)
+        out[i] = (unsigned char)(x >> (8 * i));
 }
 
-int lisp_is_env(Lisp l) { return lisp_is_list(l); }
+static uint64_t zigzag_encode_(LispInt x) { return ((uint64_t)x << 1) ^ (uint64_t)(x >> 63); }
+static LispInt zigzag_decode_(uint64_t x) { return (LispInt)(x >> 1) ^ -(LispInt)(x & 1); }
+
+typedef struct
+{
+    BinBuffer body;
+    BinBuffer symbols;
+    int symbol_count;
+    // symbol -> index in the record
+    Lisp symbol_table;
+    LispError error;
+} BinWriter;
 
-static void lisp_print_r(FILE* file, Lisp l, int human_readable, int is_cdr)
+static void bin_write_r_(BinWriter* w, Lisp x, LispContext ctx)
 {
-    switch (lisp_type(l))
+    BinBuffer* b = &w->body;
+    switch (lisp_type(x))
     {
-        case LISP_INT: fprintf(file, "%lli", lisp_int(l)); break;
-        case LISP_REAL: fprintf(file, "%f", lisp_real(l)); break;
-        case LISP_NULL: fputs("NIL", file); break;
-        case LISP_SYMBOL: fputs(lisp_symbol_string(l), file); break;
+        case LISP_NULL:
+            bin_put_byte_(b, BIN_NULL_);
+            break;
         case LISP_BOOL:
-            fprintf(file, "#%c", lisp_bool(l) == 0 ? 'f' : 't');
+            bin_put_byte_(b, lisp_bool(x) ? BIN_TRUE_ : BIN_FALSE_);
+            break;
+        case LISP_INT:
+            bin_put_byte_(b, BIN_INT_);
+            bin_put_varint_(b, zigzag_encode_(lisp_int(x)));
+            break;
+        case LISP_REAL:
+        {
+            LispReal r = lisp_real(x);
+            uint64_t bits;
+            memcpy(&bits, &r, sizeof(bits));
+            bin_put_byte_(b, BIN_REAL_);
+            bin_reserve_(b, 8);
+            bin_put_u64_(b->data + b->size, bits);
+            b->size += 8;
+            break;
+        }
+        case LISP_CHAR:
+            bin_put_byte_(b, BIN_CHAR_);
+            bin_put_varint_(b, zigzag_encode_(lisp_char(x)));
             break;
         case LISP_STRING:
-            if (human_readable)
-            {
-                fputs(lisp_string(l), file);
-            }
-            else
+        {
+            size_t length = lisp_string_length(x);
+            bin_put_byte_(b, BIN_STRING_);
+            bin_put_varint_(b, length);
+            bin_put_bytes_(b, lisp_string(x), length);
+            break;
+        }
+        case LISP_SYMBOL:
+        {
+            int present;
+            Lisp index = lisp_table_get(w->symbol_table, x, &present);
+            if (!present)
             {
-                fputc('"', file);
-                print_escaped_(lisp_string(l), file);
-                fputc('"', file);
+                index = lisp_make_int(w->symbol_count++);
+                lisp_table_set(w->symbol_table, x, index, ctx);
+                bin_put_varint_(&w->symbols, lisp_symbol_length(x));
+                bin_put_bytes_(&w->symbols, lisp_symbol_string(x), lisp_symbol_length(x));
             }
+            bin_put_byte_(b, BIN_SYMBOL_);
+            bin_put_varint_(b, lisp_int(index));
             break;
-        case LISP_CHAR:
+        }
+        case LISP_PAIR:
         {
-            int c = lisp_int(l);
-
-            if (human_readable)
+            int n = 0;
+            Lisp it = x;
+            while (lisp_is_pair(it))
             {
-                if (c >= 0) fputc(c, file);
+                ++n;
+                it = lisp_cdr(it);
             }
-            else
+            bin_put_byte_(b, BIN_LIST_);
+            bin_put_varint_(b, n);
+            while (lisp_is_pair(x))
             {
-                if (c >= -1 && c < 33)
-                {
-                    fprintf(file, "#\\%s", ascii_char_name_table_[c + 1]);
-                }
-                else if (isprint(c))
-                {
-                    fprintf(file, "#\\%c", (char)c);
-                }
-                else
-                {
-                    fprintf(file, "#\\+%d", c);
-                }
+                bin_write_r_(w, lisp_car(x), ctx);
+                x = lisp_cdr(x);
             }
+            bin_write_r_(w, x, ctx);
             break;
         }
-        case LISP_JUMP: fputs("<jump>", file); break;
-        case LISP_LAMBDA: fputs("<lambda>", file); break;
-        case LISP_PROMISE: fputs("<promise>", file); break;
-        case LISP_PTR: fputs("<ptr-%p>", l.val.ptr_val); break;
-        case LISP_FUNC: fprintf(file, "<c-func-%p>", l.val.ptr_val); break;
-        case LISP_TABLE:
+        case LISP_VECTOR:
         {
-            const Table* table = table_get_(l);
-            fprintf(file, "{");
-
-            Lisp keys = { table->keys, LISP_VECTOR };
-            Lisp vals = { table->vals, LISP_VECTOR };
-            for (int i = 0; i < table->capacity; ++i)
-            {
-                Lisp key = lisp_vector_ref(keys, i);
-                if (!lisp_is_null(key))
-                {
-                    Lisp val = lisp_vector_ref(vals, i);
-
-                    lisp_print_r(file, key, human_readable, 0);
-                    fprintf(file, ": ");
-                    lisp_print_r(file, val, human_readable, 0);
-                    fprintf(file, " ");
-                }
-            }
-            fprintf(file, "}");
+            int n = lisp_vector_length(x);
+            bin_put_byte_(b, BIN_VECTOR_);
+            bin_put_varint_(b, n);
+            for (int i = 0; i < n; ++i)
+                bin_write_r_(w, lisp_vector_ref(x, i), ctx);
             break;
         }
-        case LISP_VECTOR:
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
         {
-            fprintf(file, "#(");
-            int N = lisp_vector_length(l);
-            for (int i = 0; i < N; ++i)
+            int f64 = lisp_type(x) == LISP_F64VECTOR;
+            int n = f64 ? lisp_f64vector_length(x) : lisp_s64vector_length(x);
+            // both are 8 bytes
+            const uint64_t* data = f64 ? (const void*)lisp_f64vector(x) : (const void*)lisp_s64vector(x);
+            bin_put_byte_(b, f64 ? BIN_F64VECTOR_ : BIN_S64VECTOR_);
+            bin_put_varint_(b, n);
+            bin_reserve_(b, 8 * (size_t)n);
+            for (int i = 0; i < n; ++i)
             {
-                lisp_print_r(file, lisp_vector_ref(l, i), human_readable, 0);
-                if (i + 1 < N)
-                {
-                    fprintf(file, " ");
-                }
+                uint64_t bits;
+                memcpy(&bits, data + i, sizeof(bits));
+                bin_put_u64_(b->data + b->size, bits);
+                b->size += 8;
             }
-            fprintf(file, ")");
             break;
         }
-        case LISP_PAIR:
+        case LISP_TABLE:
         {
-            if (!is_cdr) fprintf(file, "(");
-            lisp_print_r(file, lisp_car(l), human_readable, 0);
-
-            if (lisp_type(lisp_cdr(l)) != LISP_PAIR)
+            const Table* table = table_get_(x);
+            Lisp keys = VAL_(table->keys, LISP_VECTOR);
+            Lisp vals = VAL_(table->vals, LISP_VECTOR);
+            bin_put_byte_(b, table->block.d.table.equal ? BIN_EQUAL_TABLE_ : BIN_TABLE_);
+            bin_put_varint_(b, table->size);
+            for (int i = 0; i < table->capacity; ++i)
             {
-                if (!lisp_is_null(lisp_cdr(l)))
-                { 
-                    fprintf(file, " . ");
-                    lisp_print_r(file, lisp_cdr(l), human_readable, 0);
-                }
-
-                fprintf(file, ")");
+                Lisp key = lisp_vector_ref(keys, i);
+                if (lisp_is_null(key)) continue;
+                bin_write_r_(w, key, ctx);
+                bin_write_r_(w, lisp_vector_ref(vals, i), ctx);
             }
-            else
-            {
-                fprintf(file, " ");
-                lisp_print_r(file, lisp_cdr(l), human_readable, 1);
-            } 
             break;
         }
         default:
-            // TODO
-            fprintf(stderr, "printing unknown lisp type: %d\n", lisp_type(l));
+            // procedures, promises, pointers, etc have no external representation.
+            w->error = LISP_ERROR_ARG_TYPE;
+            bin_put_byte_(b, BIN_NULL_);
             break;
     }
 }
 
-void lisp_printf(FILE* file, Lisp l) { lisp_print_r(file, l, 0, 0);  }
-void lisp_print(Lisp l) {  lisp_printf(stdout, l); }
-
-void lisp_displayf(FILE* file, Lisp l) { lisp_print_r(file, l, 1, 0); }
+void lisp_write_binary(FILE* file, Lisp x, LispError* out_error, LispContext ctx)
+{
+    BinWriter w;
+    memset(&w, 0, sizeof(BinWriter));
+    w.symbol_table = lisp_make_table(ctx);
+    w.error = LISP_ERROR_NONE;
+    bin_write_r_(&w, x, ctx);
 
-void lisp_set_stdout(FILE* file, LispContext ctx) { ctx.p->out_port = file; }
-void lisp_set_stdin(FILE* file, LispContext ctx) { ctx.p->in_port = file; }
-void lisp_set_stderr(FILE* file, LispContext ctx) { ctx.p->err_port = file; }
+    if (w.error == LISP_ERROR_NONE)
+    {
+        BinBuffer count;
+        memset(&count, 0, sizeof(BinBuffer));
+        bin_put_varint_(&count, w.symbol_count);
+
+        unsigned char header[BIN_HEADER_SIZE_];
+        memcpy(header, BIN_MAGIC_, 7);
+        header[7] = BIN_VERSION_;
+        bin_put_u64_(header + 8, count.size + w.symbols.size + w.body.size);
+
+        if (fwrite(header, 1, BIN_HEADER_SIZE_, file) != BIN_HEADER_SIZE_ ||
+            fwrite(count.data, 1, count.size, file) != count.size ||
+            fwrite(w.symbols.data, 1, w.symbols.size, file) != w.symbols.size ||
+            fwrite(w.body.data, 1, w.body.size, file) != w.body.size)
+        {
+            w.error = LISP_ERROR_FILE_OPEN;
+        }
+        free(count.data);
+    }
 
-FILE *lisp_stdin(LispContext ctx) { return ctx.p->in_port; }
-FILE *lisp_stderr(LispContext ctx) { return ctx.p->err_port; }
-FILE *lisp_stdout(LispContext ctx) { return ctx.p->out_port; }
+    free(w.symbols.data);
+    free(w.body.data);
+    if (out_error) *out_error = w.error;
+}
 
-static void lisp_stack_push(Lisp x, LispContext ctx)
+typedef struct
 {
-#ifdef LISP_DEBUG
-    if (ctx.p->stack_ptr + 1 >= ctx.p->stack_depth)
-    {
-        fprintf(ctx.p->err_port, "stack overflow\n");
-    }
-#endif 
+    const unsigned char* c;
+    const unsigned char* end;
+    Lisp* symbols;
+    uint64_t symbol_count;
+} BinReader;
 
-    ctx.p->stack[ctx.p->stack_ptr] = x;
-    ++ctx.p->stack_ptr;
+static int bin_get_byte_(BinReader* r, jmp_buf error_jmp)
+{
+    if (r->c >= r->end) longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
+    return *r->c++;
 }
 
-static Lisp lisp_stack_pop(LispContext ctx)
+static uint64_t bin_get_varint_(BinReader* r, jmp_buf error_jmp)
 {
-    ctx.p->stack_ptr--;
-    
-#ifdef LISP_DEBUG
-    if (ctx.p->stack_ptr < 0)
+    uint64_t x = 0;
+    int shift = 0;
+    while (1)
     {
-        fprintf(ctx.p->err_port, "stack underflow\n");
+        int byte = bin_get_byte_(r, error_jmp);
+        if (shift > 63) longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
+        x |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return x;
+        shift += 7;
     }
-#endif
-    return ctx.p->stack[ctx.p->stack_ptr];
 }
 
-static Lisp* lisp_stack_peek(size_t i, LispContext ctx)
+// counts which are too big for what is left can't be valid.
+static int bin_get_count_(BinReader* r, jmp_buf error_jmp)
 {
-    return ctx.p->stack + (ctx.p->stack_ptr - i);
+    uint64_t n = bin_get_varint_(r, error_jmp);
+    if (n > (uint64_t)(r->end - r->c) || n >= INT32_MAX) longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
+    return (int)n;
 }
 
-Lisp lisp_call_cc(Lisp proc, LispError* out_error, LispContext ctx)
+static uint64_t bin_get_u64_(const unsigned char* c)
 {
-    Lisp j = make_jump_(ctx);
-    Jump* jump = jump_get_(j);
-    jump->stack_ptr = ctx.p->stack_ptr;
-
-    int has_result = setjmp(jump->jmp);
-    if (has_result)
-    {
-        // restore jump from the stack
-        jump = jump_get_(lisp_stack_pop(ctx));
-        ctx.p->stack_ptr = jump->stack_ptr;
-        return jump->result;
-    }
-    else
-    {
-        return lisp_apply(proc, lisp_cons(j, lisp_null(), ctx), out_error, ctx);
-    }
+    uint64_t x = 0;
+    for (int i = 0; i < 8; ++i)
+        x |= (uint64_t)c[i] << (8 * i);
+    return x;
 }
 
-// returns whether the result is final, or needs to be eval'd.
-static int apply(Lisp operator, Lisp args, Lisp* out_result, Lisp* out_env, LispError* error, LispContext ctx)
+// Allocates a list of n pairs in runs which fill each page, instead of one at a time.
+// The cars are left null.
+static Lisp list_alloc_(int n, LispContext ctx)
 {
-    switch (lisp_type(operator))
+    Heap* heap = &ctx.p->heap;
+    const size_t pair_size = align_to_bytes(sizeof(Pair), sizeof(LispVal));
+
+    Lisp head = lisp_null();
+    Pair* last = NULL;
+    while (n > 0)
     {
-        case LISP_LAMBDA: // lambda call (compound procedure)
+        Page* page = heap->top;
+        size_t count = (page->capacity - page->size) / pair_size;
+        Pair* pairs;
+        if (count == 0)
         {
-            Lisp slot_names = lambda_args_(operator);
-            *out_env = lisp_lambda_env(operator);
-
-            // make a new environment
-            Lisp new_table = lisp_make_table(ctx);
-            
-            // bind parameters to arguments
-            // to pass into function call
-            while (lisp_is_pair(slot_names) && lisp_is_pair(args))
-            {
-                lisp_table_set(new_table, lisp_car(slot_names), lisp_car(args), ctx);
-                slot_names = lisp_cdr(slot_names);
-                args = lisp_cdr(args);
-            }
+            // let heap_alloc start a new page.
+            pairs = heap_alloc(pair_size, LISP_PAIR, heap);
+            count = 1;
+        }
+        else
+        {
+            if (count > (size_t)n) count = (size_t)n;
+            pairs = (Pair*)(page->buffer + page->size);
+            page->size += count * pair_size;
+            heap->size += count * pair_size;
+        }
+        ctx.p->gc_stats.allocations[LISP_PAIR] += count;
+        ctx.p->gc_stats.bytes_allocated[LISP_PAIR] += count * pair_size;
 
-            if (lisp_type(slot_names) == LISP_SYMBOL)
+        for (size_t i = 0; i < count; ++i)
+        {
+            Pair* pair = (Pair*)((char*)pairs + i * pair_size);
+            pair->block.gc_state = GC_CLEAR;
+            pair->block.info.size = pair_size;
+            pair->block.type = LISP_PAIR;
+            pair->block.gen = heap->gen;
+            pair->car = lisp_null().val;
+            pair->cdr = lisp_null().val;
+            pair->block.d.pair.car_type = LISP_NULL;
+            pair->block.d.pair.cdr_type = LISP_NULL;
+
+            Lisp l = VAL_BLOCK_(pair, LISP_PAIR);
+            if (last)
             {
-                // variable length arguments
-                lisp_table_set(new_table, slot_names, args, ctx);
+                last->cdr = l.val;
+                last->block.d.pair.cdr_type = VAL_TYPE_(l);
             }
-            else if (!lisp_is_null(slot_names))
+            else
             {
-                *error = LISP_ERROR_TOO_FEW_ARGS;
-                return 0;
+                head = l;
             }
-            else if (!lisp_is_null(args))
+            last = pair;
+        }
+        n -= (int)count;
+    }
+    return head;
+}
+
+static Lisp bin_read_r_(BinReader* r, jmp_buf error_jmp, LispContext ctx)
+{
+    int tag = bin_get_byte_(r, error_jmp);
+    switch (tag)
+    {
+        case BIN_NULL_: return lisp_null();
+        case BIN_FALSE_: return lisp_false();
+        case BIN_TRUE_: return lisp_true();
+        case BIN_INT_: return lisp_make_int(zigzag_decode_(bin_get_varint_(r, error_jmp)));
+        case BIN_REAL_:
+        {
+            if (r->end - r->c < 8) longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
+            uint64_t bits = bin_get_u64_(r->c);
+            r->c += 8;
+            LispReal x;
+            memcpy(&x, &bits, sizeof(x));
+            return lisp_make_real(x);
+        }
+        case BIN_CHAR_: return lisp_make_char((int)zigzag_decode_(bin_get_varint_(r, error_jmp)));
+        case BIN_STRING_:
+        {
+            int length = bin_get_count_(r, error_jmp);
+            Lisp s = lisp_make_buffer(length + 1, ctx);
+            char* str = lisp_buffer(s);
+            memcpy(str, r->c, length);
+            lisp_buffer_set_length(s, length);
+            r->c += length;
+            return s;
+        }
+        case BIN_SYMBOL_:
+        {
+            uint64_t i = bin_get_varint_(r, error_jmp);
+            if (i >= r->symbol_count) longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
+            return r->symbols[i];
+        }
+        case BIN_LIST_:
+        {
+            int n = bin_get_count_(r, error_jmp);
+            Lisp list = list_alloc_(n, ctx);
+            Pair* last = NULL;
+            Lisp it = list;
+            while (lisp_is_pair(it))
             {
-                *error = LISP_ERROR_TOO_MANY_ARGS;
-                return 0;
+                // the pairs are the newest objects so no write barrier is needed.
+                Pair* pair = it.val.ptr_val;
+                Lisp x = bin_read_r_(r, error_jmp, ctx);
+                pair->car = x.val;
+                pair->block.d.pair.car_type = VAL_TYPE_(x);
+                last = pair;
+                it = lisp_cdr(it);
             }
-
-            // extend the environment
-            *out_env = lisp_env_extend(*out_env, new_table, ctx);
-
-            // normally we would eval the body here
-            // but while will eval
-            *out_result = lisp_lambda_body(operator);
-            return 1;
+            Lisp tail = bin_read_r_(r, error_jmp, ctx);
+            if (!last) return tail;
+            last->cdr = tail.val;
+            last->block.d.pair.cdr_type = VAL_TYPE_(tail);
+            return list;
         }
-        case LISP_FUNC: // call into C functions
+        case BIN_VECTOR_:
         {
-            // no environment required
-            LispCFunc f = lisp_func(operator);
-            *out_result = f(args, error, ctx);
-            return 0;
+            int n = bin_get_count_(r, error_jmp);
+            Lisp v = lisp_make_vector(n, ctx);
+            for (int i = 0; i < n; ++i)
+                vector_set_(vector_get_(v), i, bin_read_r_(r, error_jmp, ctx));
+            return v;
         }
-        case LISP_JUMP:
+        case BIN_F64VECTOR_:
+        case BIN_S64VECTOR_:
         {
-            Jump* jump = jump_get_(operator);
-            jump->result = lisp_car(args);
-            // put jump on the stack
-            lisp_stack_push(operator, ctx);
-            longjmp(jump->jmp, 1);
+            int n = bin_get_count_(r, error_jmp);
+            if ((size_t)(r->end - r->c) / 8 < (size_t)n) longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
+            Lisp v = tag == BIN_F64VECTOR_ ? lisp_make_f64vector(n, ctx) : lisp_make_s64vector(n, ctx);
+            char* data = tag == BIN_F64VECTOR_ ? (char*)lisp_f64vector(v) : (char*)lisp_s64vector(v);
+            for (int i = 0; i < n; ++i)
+            {
+                uint64_t bits = bin_get_u64_(r->c);
+                memcpy(data + 8 * i, &bits, sizeof(bits));
+                r->c += 8;
+            }
+            return v;
         }
-        default:
+        case BIN_TABLE_:
+        case BIN_EQUAL_TABLE_:
         {
-            lisp_printf(ctx.p->err_port, operator);
-            fprintf(ctx.p->err_port, " is not an operator.\n");
-
-            *error = LISP_ERROR_BAD_OP;
-            return 0;
+            Lisp t = table_make_(tag == BIN_EQUAL_TABLE_, ctx);
+            int n = bin_get_count_(r, error_jmp);
+            for (int i = 0; i < n; ++i)
+            {
+                Lisp key = bin_read_r_(r, error_jmp, ctx);
+                lisp_table_set(t, key, bin_read_r_(r, error_jmp, ctx), ctx);
+            }
+            return t;
         }
+        default:
+            longjmp(error_jmp, LISP_ERROR_READ_SYNTAX);
     }
 }
 
-static Lisp eval_r(jmp_buf error_jmp, LispContext ctx)
+Lisp lisp_read_binary(FILE* file, LispError* out_error, LispContext ctx)
 {
-    Lisp* env = lisp_stack_peek(2, ctx);
-    Lisp* x = lisp_stack_peek(1, ctx);
-    
-    while (1)
+    if (out_error) *out_error = LISP_ERROR_NONE;
+
+    unsigned char header[BIN_HEADER_SIZE_];
+    size_t read = fread(header, 1, BIN_HEADER_SIZE_, file);
+    if (read == 0) return lisp_eof();
+
+    if (read != BIN_HEADER_SIZE_ || memcmp(header, BIN_MAGIC_, 7) != 0 || header[7] != BIN_VERSION_)
     {
-        switch (lisp_type(*x))
-        {
-            case LISP_SYMBOL: // variable reference
-            {
-                int present;
-                Lisp val = lisp_env_lookup(*env, *x, &present);
-                if (!present)
-                {
-                    fprintf(ctx.p->err_port, "%s is not defined.\n", lisp_symbol_string(*x));
-                    longjmp(error_jmp, LISP_ERROR_UNDEFINED_VAR); 
-                    return lisp_null();
-                }
-                return val;
-            }
-            case LISP_PAIR:
-            {
-                Lisp op_sym = lisp_car(*x);
-                int op_valid = lisp_type(op_sym) == LISP_SYMBOL;
+        if (out_error) *out_error = LISP_ERROR_READ_SYNTAX;
+        return lisp_eof();
+    }
 
-                if (lisp_eq(op_sym, get_sym(SYM_IF, ctx)) && op_valid) 
-                {
-                    // if conditional statemetns
-                    Lisp predicate = lisp_list_ref(*x, 1);
-                    
-                    lisp_stack_push(*env, ctx);
-                    lisp_stack_push(predicate, ctx);
- 
-                    if (lisp_is_true(eval_r(error_jmp, ctx)))
+    uint64_t size = bin_get_u64_(header + 8);
+    unsigned char* data = size > SIZE_MAX ? NULL : malloc((size_t)size);
+    if (!data || fread(data, 1, (size_t)size, file) != size)
+    {
+        free(data);
+        if (out_error) *out_error = LISP_ERROR_READ_SYNTAX;
+        return lisp_eof();
+    }
+
+    // not a local, so it is still valid after longjmp.
+    BinReader* r = malloc(sizeof(BinReader));
+    r->c = data;
+    r->end = data + size;
+    r->symbols = NULL;
+    r->symbol_count = 0;
+
+    jmp_buf error_jmp;
+    LispError error = setjmp(error_jmp);
+    Lisp result = lisp_eof();
+
+    if (error == LISP_ERROR_NONE)
+    {
+        uint64_t symbol_count = bin_get_count_(r, error_jmp);
+        r->symbols = malloc(sizeof(Lisp) * (symbol_count + 1));
+        for (; r->symbol_count < symbol_count; ++r->symbol_count)
+        {
+            int length = bin_get_count_(r, error_jmp);
+            r->symbols[r->symbol_count] = symbol_intern_((const char*)r->c, length, ctx);
+            r->c += length;
+        }
+        result = bin_read_r_(r, error_jmp, ctx);
+    }
+
+    free(r->symbols);
+    free(r);
+    free(data);
+    if (out_error) *out_error = error;
+    return result;
+}
+
+static void env_mark_frame_(Lisp frame)
+{
+    if (lisp_type(frame) == LISP_TABLE) table_get_(frame)->block.d.table.env = 1;
+}
+
+Lisp lisp_env_extend(Lisp l, Lisp table, LispContext ctx)
+{
+    env_mark_frame_(table);
+    return lisp_cons(table, l, ctx);
+}
+
+// A local variable reference resolved to a frame depth and slot.
+#ifdef LISP_TAGGED
+static Lisp make_local_(int depth, int slot)
+{
+    assert(depth < (1 << 16));
+    return tag_make_(TAG_LOCAL_, ((uint64_t)depth << 32) | (uint32_t)slot);
+}
+
+static int local_depth_(Lisp l) { return (int)(tag_payload_(l) >> 32); }
+static int local_slot_(Lisp l) { return (int)(tag_payload_(l) & 0xFFFFFFFF); }
+#else
+static Lisp make_local_(int depth, int slot)
+{
+    Lisp l;
+    l.type = LISP_LOCAL;
+    l.val.int_val = ((LispInt)depth << 32) | (LispInt)slot;
+    return l;
+}
+
+static int local_depth_(Lisp l) { return (int)(l.val.int_val >> 32); }
+static int local_slot_(Lisp l) { return (int)(l.val.int_val & 0xFFFFFFFF); }
+#endif
+
+static Lisp env_frame_(Lisp env, int depth)
+{
+    while (depth > 0)
+    {
+        env = lisp_cdr(env);
+        --depth;
+    }
+    return lisp_car(env);
+}
+
+// the frame which contains the local
+static Lisp local_frame_(Lisp env, Lisp l) { return env_frame_(env, local_depth_(l)); }
+
+// Environments are lists of frames.
+// A frame is either a table (globals, or lambdas which have not been resolved)
+// or a vector whose first entry is a vector of slot names, followed by slot values.
+// Resolved code indexes vector frames directly, but they
+// can still be searched by name. 
+static int frame_find_(Lisp frame, Lisp key)
+{
+    Lisp names = lisp_vector_ref(frame, 0);
+    int n = lisp_vector_length(names);
+    for (int i = 0; i < n; ++i)
+    {
+        if (lisp_eq(lisp_vector_ref(names, i), key)) return i + 1;
+    }
+    return -1;
+}
+
+static Lisp frame_get_(Lisp frame, Lisp key, int* present)
+{
+    if (lisp_type(frame) == LISP_TABLE) return lisp_table_get(frame, key, present);
+
+    int i = frame_find_(frame, key);
+    *present = i != -1;
+    return *present ? lisp_vector_ref(frame, i) : lisp_null();
+}
+
+Lisp lisp_env_lookup(Lisp l, Lisp key, int *present)
+{
+    while (lisp_is_pair(l))
+    {
+        Lisp x = frame_get_(lisp_car(l), key, present);
+        if (*present) return x;
+        l = lisp_cdr(l);
+    }
+    
+    *present = 0;
+    return lisp_null();
+}
+
+void lisp_env_define(Lisp l, Lisp key, Lisp x, LispContext ctx)
+{
+    // frames have a fixed set of slots,
+    // so new names go in the nearest table.
+    while (lisp_type(lisp_car(l)) == LISP_VECTOR)
+    {
+        int i = frame_find_(lisp_car(l), key);
+        if (i != -1)
+        {
+            lisp_vector_set(lisp_car(l), i, x);
+            return;
+        }
+        l = lisp_cdr(l);
+    }
+    lisp_table_set(lisp_car(l), key, x, ctx);
+}
+
+int lisp_env_set(Lisp l, Lisp key, Lisp x, LispContext ctx)
+{
+    int present;
+    while (lisp_is_pair(l))
+    {
+        Lisp frame = lisp_car(l);
+        if (lisp_type(frame) == LISP_TABLE)
+        {
+            lisp_table_get(frame, key, &present);
+            if (present)
+            {
+                lisp_table_set(frame, key, x, ctx);
+                return 1;
+            }  
+        }
+        else
+        {
+            int i = frame_find_(frame, key);
+            if (i != -1)
+            {
+                lisp_vector_set(frame, i, x);
+                return 1;
+            }
+        }
+        l = lisp_cdr(l);
+    }
+
+    return 0; 
+}
+
+int lisp_is_env(Lisp l) { return lisp_is_list(l); }
+
+// GLOBAL REFERENCES
+// Resolved code refers to a global through a block which caches where it was last found,
+// a slot in one of the environment's tables. The slots are the variables' cells:
+// define and set! update them in place, so the cache stays valid until
+//  - the reference runs in another environment (below the frames of its enclosing lambdas),
+//  - a name is added to an environment table (which could shadow it, see global_epoch),
+//  - or the table is rehashed (the key in the slot changes).
+// Otherwise the environment is searched again, as for a symbol.
+typedef struct
+{
+    Block block;
+    LispVal symbol;
+    // environment after skipping depth frames, which the cache is for.
+    LispVal tail;
+    LispVal table;
+    int depth;
+    int index;
+    uint32_t epoch;
+} GlobalRef;
+
+static GlobalRef* global_ref_get_(Lisp x)
+{
+    assert(lisp_type(x) == LISP_GLOBAL);
+    return x.val.ptr_val;
+}
+
+static void global_ref_clear_(GlobalRef* g)
+{
+    g->tail.ptr_val = NULL;
+    g->table.ptr_val = NULL;
+    g->index = -1;
+    g->epoch = 0;
+}
+
+// depth is the number of frames from enclosing lambdas, none of which bind the symbol.
+static Lisp make_global_ref_(Lisp symbol, int depth, LispContext ctx)
+{
+    GlobalRef* g = gc_alloc(sizeof(GlobalRef), LISP_GLOBAL, ctx);
+    g->symbol = symbol.val;
+    g->depth = depth;
+    global_ref_clear_(g);
+    return VAL_BLOCK_(g, LISP_GLOBAL);
+}
+
+static Lisp global_ref_symbol_(Lisp x) { return VAL_(global_ref_get_(x)->symbol, LISP_SYMBOL); }
+
+static Lisp global_ref_lookup_(Lisp x, Lisp env, int* present, LispContext ctx)
+{
+    GlobalRef* g = global_ref_get_(x);
+    Lisp symbol = VAL_(g->symbol, LISP_SYMBOL);
+
+    Lisp tail = env;
+    for (int i = 0; i < g->depth && lisp_is_pair(tail); ++i) tail = lisp_cdr(tail);
+
+    if (g->epoch == ctx.p->global_epoch && g->tail.ptr_val == tail.val.ptr_val)
+    {
+        const Table* table = g->table.ptr_val;
+        if (g->index < table->capacity && lisp_eq(lisp_vector_ref(VAL_(table->keys, LISP_VECTOR), g->index), symbol))
+        {
+            *present = 1;
+            return lisp_vector_ref(VAL_(table->vals, LISP_VECTOR), g->index);
+        }
+    }
+
+    for (Lisp l = tail; lisp_is_pair(l); l = lisp_cdr(l))
+    {
+        Lisp frame = lisp_car(l);
+        if (lisp_type(frame) == LISP_TABLE)
+        {
+            const Table* table = table_get_(frame);
+            int i = table_find_(table, symbol);
+            if (i == -1) continue;
+
+            g->tail = tail.val;
+            g->table = frame.val;
+            g->index = i;
+            g->epoch = ctx.p->global_epoch;
+            gc_barrier_(&g->block, tail);
+            gc_barrier_(&g->block, frame);
+
+            *present = 1;
+            return lisp_vector_ref(VAL_(table->vals, LISP_VECTOR), i);
+        }
+        else
+        {
+            // not cached. vector frames are only found here when code is evaluated inside one.
+            int i = frame_find_(frame, symbol);
+            if (i == -1) continue;
+            *present = 1;
+            return lisp_vector_ref(frame, i);
+        }
+    }
+
+    *present = 0;
+    return lisp_null();
+}
+
+// everything but pairs, vectors and tables.
+static void print_atom_(PrintOut* out, Lisp l, int human_readable)
+{
+    switch (lisp_type(l))
+    {
+        case LISP_INT: out_int_(out, lisp_int(l)); break;
+        case LISP_REAL: out_real_(out, lisp_real(l)); break;
+        case LISP_NULL: out_write_(out, "NIL", 3); break;
+        case LISP_SYMBOL: out_write_(out, lisp_symbol_string(l), lisp_symbol_length(l)); break;
+        case LISP_BOOL:
+            out_write_(out, lisp_bool(l) == 0 ? "#f" : "#t", 2);
+            break;
+        case LISP_STRING:
+            if (human_readable)
+            {
+                out_write_(out, lisp_string(l), lisp_string_length(l));
+            }
+            else
+            {
+                out_putc_(out, '"');
+                print_escaped_(lisp_string(l), lisp_string_length(l), out);
+                out_putc_(out, '"');
+            }
+            break;
+        case LISP_CHAR:
+        {
+            int c = lisp_int(l);
+
+            if (human_readable)
+            {
+                if (c >= 0) out_putc_(out, (char)c);
+            }
+            else
+            {
+                if (c >= -1 && c < 33)
+                {
+                    out_printf_(out, "#\\%s", ascii_char_name_table_[c + 1]);
+                }
+                else if (isprint(c))
+                {
+                    out_printf_(out, "#\\%c", (char)c);
+                }
+                else
+                {
+                    out_printf_(out, "#\\+%d", c);
+                }
+            }
+            break;
+        }
+        case LISP_JUMP: out_puts_(out, "<jump>"); break;
+        case LISP_LAMBDA: out_puts_(out, "<lambda>"); break;
+        case LISP_PROMISE: out_puts_(out, "<promise>"); break;
+        case LISP_PTR: out_printf_(out, "<ptr-%p>", lisp_ptr(l)); break;
+        case LISP_LOCAL: out_printf_(out, "<local-%d-%d>", local_depth_(l), local_slot_(l)); break;
+        case LISP_GLOBAL: out_puts_(out, lisp_symbol_string(global_ref_symbol_(l))); break;
+        case LISP_CODE: out_puts_(out, "<code>"); break;
+        case LISP_FUNC: out_printf_(out, "<c-func-%p>", (void*)(uintptr_t)lisp_func(l)); break;
+        case LISP_PORT: out_puts_(out, "<port>"); break;
+        case LISP_FUNC_N: out_printf_(out, "<c-func-%p>", (void*)(uintptr_t)func_n_get_(l)->func); break;
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
+        {
+            int f64 = lisp_type(l) == LISP_F64VECTOR;
+            out_write_(out, f64 ? "#f64(" : "#s64(", 5);
+            int N = f64 ? lisp_f64vector_length(l) : lisp_s64vector_length(l);
+            for (int i = 0; i < N; ++i)
+            {
+                if (f64)
+                    out_real_(out, lisp_f64vector(l)[i]);
+                else
+                    out_int_(out, lisp_s64vector(l)[i]);
+                if (i + 1 < N) out_putc_(out, ' ');
+            }
+            out_putc_(out, ')');
+            break;
+        }
+        default:
+            // TODO
+            fprintf(stderr, "printing unknown lisp type: %d\n", lisp_type(l));
+            break;
+    }
+}
+
+// Containers being printed. Nesting is kept on this stack instead of the C stack,
+// so deep data can't overflow it.
+enum
+{
+    PRINT_LIST_,      // x is the pair whose car was printed last
+    PRINT_LIST_CLOSE_, // after the tail of an improper list
+    PRINT_VECTOR_,    // index is the next entry
+    PRINT_TABLE_KEY_, // index is the next slot to search for a key
+    PRINT_TABLE_VAL_, // the key in slot index was printed
+    PRINT_TABLE_NEXT_, // the value in slot index was printed
+};
+
+typedef struct
+{
+    Lisp x;
+    int kind;
+    int index;
+} PrintFrame;
+
+static void lisp_print_(PrintOut* out, Lisp l, int human_readable)
+{
+    PrintFrame local[64];
+    PrintFrame* stack = local;
+    size_t depth = 0;
+    size_t capacity = 64;
+
+    // l is waiting to be printed
+    int pending = 1;
+    while (1)
+    {
+        if (pending)
+        {
+            pending = 0;
+            int kind = -1;
+            switch (lisp_type(l))
+            {
+                case LISP_PAIR:
+                    out_putc_(out, '(');
+                    kind = PRINT_LIST_;
+                    break;
+                case LISP_VECTOR:
+                    out_write_(out, "#(", 2);
+                    kind = PRINT_VECTOR_;
+                    break;
+                case LISP_TABLE:
+                    out_putc_(out, '{');
+                    kind = PRINT_TABLE_KEY_;
+                    break;
+                default:
+                    print_atom_(out, l, human_readable);
+                    break;
+            }
+
+            if (kind != -1)
+            {
+                if (depth == capacity)
+                {
+                    capacity *= 2;
+                    if (stack == local)
                     {
-                        // consequence
-                        *x = lisp_list_ref(*x, 2);
-                        // while will eval
+                        stack = malloc(sizeof(PrintFrame) * capacity);
+                        memcpy(stack, local, sizeof(local));
                     }
                     else
                     {
-                        // alternative
-                        *x = lisp_list_ref(*x, 3);
-                        // while will eval
+                        stack = realloc(stack, sizeof(PrintFrame) * capacity);
                     }
-                    
-                    lisp_stack_pop(ctx);
-                    lisp_stack_pop(ctx);
                 }
-                else if (lisp_eq(op_sym, get_sym(SYM_BEGIN, ctx)) && op_valid)
+                PrintFrame frame = { l, kind, 0 };
+                stack[depth++] = frame;
+                if (kind == PRINT_LIST_)
                 {
-                    Lisp it = lisp_cdr(*x);
-                    if (lisp_is_null(it)) return it;
-                    
-                    // eval all but last
-                    while (lisp_is_pair(lisp_cdr(it)))
-                    {
-                        // save next thing
-                        lisp_stack_push(lisp_cdr(it), ctx);
-                        
-                        lisp_stack_push(*env, ctx);
-                        lisp_stack_push(lisp_car(it), ctx);
-                        
-                        eval_r(error_jmp, ctx);
-        
-                        lisp_stack_pop(ctx);
-                        lisp_stack_pop(ctx);
-                        
-                        it = lisp_stack_pop(ctx);
-                        //it = lisp_cdr(it);
-                    }
-                    
-                    *x = lisp_car(it);
-                    // while will eval last
+                    l = lisp_car(l);
+                    pending = 1;
+                    continue;
                 }
-                else if (lisp_eq(op_sym, get_sym(SYM_QUOTE, ctx)) && op_valid)
+            }
+        }
+
+        if (depth == 0) break;
+
+        PrintFrame* top = stack + depth - 1;
+        switch (top->kind)
+        {
+            case PRINT_LIST_:
+            {
+                Lisp rest = lisp_cdr(top->x);
+                if (lisp_is_pair(rest))
                 {
-                    return lisp_list_ref(*x, 1);
+                    out_putc_(out, ' ');
+                    top->x = rest;
+                    l = lisp_car(rest);
+                    pending = 1;
                 }
-                else if (lisp_eq(op_sym, get_sym(SYM_DEFINE, ctx))) 
+                else if (lisp_is_null(rest))
                 {
-                    // variable definitions
-                    lisp_stack_push(*env, ctx);
-                    lisp_stack_push(lisp_list_ref(*x, 2), ctx);
-                    
-                    Lisp value = eval_r(error_jmp, ctx);
-                    
-                    lisp_stack_pop(ctx);
-                    lisp_stack_pop(ctx);
-                    
-                    Lisp symbol = lisp_list_ref(*x, 1);
-                    lisp_env_define(*env, symbol, value, ctx);
-                    return lisp_null();
+                    out_putc_(out, ')');
+                    --depth;
                 }
-                else if (lisp_eq(op_sym, get_sym(SYM_SET, ctx)) && op_valid)
+                else
                 {
-                    assert(!lisp_is_null(*env));
-                    // mutablity
-                    // like def, but requires existence
-                    // and will search up the environment chain
-                    
-                    lisp_stack_push(*env, ctx);
-                    lisp_stack_push(lisp_list_ref(*x, 2), ctx);
-                    
-                    Lisp value = eval_r(error_jmp, ctx);
-                    
-                    lisp_stack_pop(ctx);
-                    lisp_stack_pop(ctx);
-                    
-                    Lisp symbol = lisp_list_ref(*x, 1);
-                    if (!lisp_env_set(*env, symbol, value, ctx))
-                    { 
-                        fprintf(ctx.p->err_port, "error: unknown variable: %s\n", lisp_symbol_string(symbol));
-                    }
-                    return lisp_null();
+                    out_write_(out, " . ", 3);
+                    top->kind = PRINT_LIST_CLOSE_;
+                    l = rest;
+                    pending = 1;
                 }
-                else if (lisp_eq(op_sym, get_sym(SYM_LAMBDA, ctx)) && op_valid) 
+                break;
+            }
+            case PRINT_LIST_CLOSE_:
+                out_putc_(out, ')');
+                --depth;
+                break;
+            case PRINT_VECTOR_:
+                if (top->index < lisp_vector_length(top->x))
                 {
-                    // lambda defintions (compound procedures)
-                    Lisp args = lisp_list_ref(*x, 1);
-                    Lisp body = lisp_list_ref(*x, 2);
-                    return lisp_make_lambda(args, body, *env, ctx);
+                    if (top->index > 0) out_putc_(out, ' ');
+                    l = lisp_vector_ref(top->x, top->index++);
+                    pending = 1;
                 }
-                else 
+                else
                 {
-                    // operator application
-                    lisp_stack_push(*env, ctx);
-                    lisp_stack_push(lisp_car(*x), ctx);
-                    
-                    Lisp operator = eval_r(error_jmp, ctx);
-                    
-                    Lisp operator_expr = lisp_stack_pop(ctx);
-                    lisp_stack_pop(ctx);
-                    
-                    lisp_stack_push(operator, ctx);
-                    lisp_stack_push(operator_expr, ctx);
-                    
-                    Lisp arg_expr = lisp_cdr(*x);
-                    
-                    Lisp args = lisp_null();
-                    
-                    while (lisp_is_pair(arg_expr))
-                    {
-                        // save next
-                        lisp_stack_push(lisp_cdr(arg_expr), ctx);
-                        lisp_stack_push(args, ctx);
+                    out_putc_(out, ')');
+                    --depth;
+                }
+                break;
+            case PRINT_TABLE_KEY_:
+            {
+                const Table* table = table_get_(top->x);
+                Lisp keys = VAL_(table->keys, LISP_VECTOR);
+                while (top->index < table->capacity && lisp_is_null(lisp_vector_ref(keys, top->index)))
+                    ++top->index;
+
+                if (top->index < table->capacity)
+                {
+                    l = lisp_vector_ref(keys, top->index);
+                    top->kind = PRINT_TABLE_VAL_;
+                    pending = 1;
+                }
+                else
+                {
+                    out_putc_(out, '}');
+                    --depth;
+                }
+                break;
+            }
+            case PRINT_TABLE_VAL_:
+                out_write_(out, ": ", 2);
+                l = lisp_vector_ref(VAL_(table_get_(top->x)->vals, LISP_VECTOR), top->index);
+                top->kind = PRINT_TABLE_NEXT_;
+                pending = 1;
+                break;
+            case PRINT_TABLE_NEXT_:
+                out_putc_(out, ' ');
+                ++top->index;
+                top->kind = PRINT_TABLE_KEY_;
+                break;
+        }
+    }
+
+    if (stack != local) free(stack);
+}
+
+static void print_to_(FILE* file, Lisp port, Lisp l, int human_readable, LispContext ctx)
+{
+    PrintOut out;
+    out_init_(&out, file, port, ctx);
+    lisp_print_(&out, l, human_readable);
+    out_flush_(&out);
+}
+
+void lisp_printf(FILE* file, Lisp l) { print_to_(file, lisp_null(), l, 0, (LispContext) { NULL }); }
+
+void lisp_print(Lisp l) {  lisp_printf(stdout, l); }
+
+void lisp_displayf(FILE* file, Lisp l) { print_to_(file, lisp_null(), l, 1, (LispContext) { NULL }); }
+
+void lisp_port_print(Lisp port, Lisp l, LispContext ctx) { print_to_(NULL, port, l, 0, ctx); }
+
+void lisp_port_display(Lisp port, Lisp l, LispContext ctx) { print_to_(NULL, port, l, 1, ctx); }
+
+char* lisp_print_to_buffer(Lisp l, size_t* out_length)
+{
+    PrintOut out;
+    out_init_(&out, NULL, lisp_null(), (LispContext) { NULL });
+    lisp_print_(&out, l, 0);
+    *out_reserve_(&out, 1) = '\0';
+
+    char* data = out.data;
+    if (data == out.local)
+    {
+        data = malloc(out.size + 1);
+        memcpy(data, out.local, out.size + 1);
+    }
+    if (out_length) *out_length = out.size;
+    return data;
+}
+
+void lisp_set_stdout(FILE* file, LispContext ctx) { ctx.p->out_port = file; }
+
+void lisp_set_output_port(Lisp port, LispContext ctx)
+{
+    assert(lisp_is_null(port) || lisp_type(port) == LISP_PORT);
+    ctx.p->output_port = port;
+}
+
+Lisp lisp_output_port(LispContext ctx) { return ctx.p->output_port; }
+void lisp_set_stdin(FILE* file, LispContext ctx) { ctx.p->in_port = file; }
+void lisp_set_stderr(FILE* file, LispContext ctx) { ctx.p->err_port = file; }
+
+FILE *lisp_stdin(LispContext ctx) { return ctx.p->in_port; }
+FILE *lisp_stderr(LispContext ctx) { return ctx.p->err_port; }
+FILE *lisp_stdout(LispContext ctx) { return ctx.p->out_port; }
+
+void lisp_seed_random(uint64_t seed, LispContext ctx) { ctx.p->random_state = seed; }
+
+// splitmix64
+uint64_t lisp_random(LispContext ctx)
+{
+    uint64_t z = (ctx.p->random_state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static void lisp_stack_push(Lisp x, LispContext ctx)
+{
+#ifdef LISP_DEBUG
+    if (ctx.p->stack_ptr + 1 >= ctx.p->stack_depth)
+    {
+        fprintf(ctx.p->err_port, "stack overflow\n");
+    }
+#endif 
+
+    ctx.p->stack[ctx.p->stack_ptr] = x;
+    ++ctx.p->stack_ptr;
+}
+
+static Lisp lisp_stack_pop(LispContext ctx)
+{
+    ctx.p->stack_ptr--;
+    
+#ifdef LISP_DEBUG
+    if (ctx.p->stack_ptr < 0)
+    {
+        fprintf(ctx.p->err_port, "stack underflow\n");
+    }
+#endif
+    return ctx.p->stack[ctx.p->stack_ptr];
+}
+
+static Lisp* lisp_stack_peek(size_t i, LispContext ctx)
+{
+    return ctx.p->stack + (ctx.p->stack_ptr - i);
+}
+
+// PROFILER
+// Off unless ctx.p->profile is set, in which case eval keeps a stack of
+// frames for the lambdas and C functions it is running.
+// Lambdas are counted under the name they were defined as.
+// A tail call replaces the caller's frame, like it replaces the caller.
+// Frames are popped when eval_r returns, or by escapes (errors and continuations)
+// unwinding to the depth they saved.
+
+#ifdef LISP_POSIX_TIME_
+static volatile sig_atomic_t profile_ticks_ = 0;
+static void profile_tick_(int signal) { (void)signal; ++profile_ticks_; }
+#endif
+
+typedef struct
+{
+    LispType type;
+    // name symbol of a lambda (0 if anonymous), or the C function.
+    uintptr_t key;
+    char* name;
+    size_t calls;
+    uint64_t inclusive;
+    uint64_t exclusive;
+    size_t bytes;
+    // frames on the stack. recursive calls count inclusive time once.
+    int active;
+} ProfileEntry;
+
+// a node in the call tree (for collapsed stacks).
+typedef struct
+{
+    int parent;
+    int entry;
+    uint64_t self;
+} ProfileNode;
+
+typedef struct
+{
+    int entry;
+    int node;
+    uint64_t start;
+    uint64_t child_time;
+    size_t start_bytes;
+    size_t child_bytes;
+} ProfileFrame;
+
+struct Profile
+{
+    int sampling;
+
+    ProfileEntry* entries;
+    int entry_count;
+    // open addressing tables of indices (-1 is empty). power of 2 sizes.
+    int* entry_index;
+    size_t entry_index_size;
+
+    ProfileNode* nodes;
+    int node_count;
+    int* node_index;
+    size_t node_index_size;
+
+    ProfileFrame* frames;
+    int depth;
+    int frame_capacity;
+
+    // entry a lambda call will push on the next eval_r, or -1.
+    int pending;
+};
+
+// nanoseconds. with sampling, counts ticks of a 1ms cpu time timer instead.
+static uint64_t profile_now_(const struct Profile* profile)
+{
+#ifdef LISP_POSIX_TIME_
+    if (profile->sampling) return (uint64_t)profile_ticks_ * 1000000;
+#endif
+    return clock_ns_();
+}
+
+static char* profile_copy_string_(const char* s)
+{
+    char* copy = malloc(strlen(s) + 1);
+    strcpy(copy, s);
+    return copy;
+}
+
+static uint64_t profile_hash_(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// grows an index table to twice count, and reinserts with hash_of.
+static int* profile_rehash_(int* index, size_t* size, int count, uint64_t (*hash_of)(const struct Profile*, int), const struct Profile* profile)
+{
+    if (2 * (size_t)count < *size) return index;
+
+    free(index);
+    *size = *size ? *size * 2 : 256;
+    index = malloc(sizeof(int) * *size);
+    for (size_t i = 0; i < *size; ++i) index[i] = -1;
+
+    for (int j = 0; j < count; ++j)
+    {
+        uint64_t i = hash_of(profile, j);
+        while (index[i &= (*size - 1)] != -1) ++i;
+        index[i] = j;
+    }
+    return index;
+}
+
+static uint64_t profile_entry_hash_(const struct Profile* profile, int j)
+{
+    const ProfileEntry* e = profile->entries + j;
+    return profile_hash_(e->key * 31 + e->type);
+}
+
+static uint64_t profile_node_hash_(const struct Profile* profile, int j)
+{
+    const ProfileNode* n = profile->nodes + j;
+    return profile_hash_((uint64_t)(n->parent + 1) * 0x100000001ULL + n->entry);
+}
+
+static int profile_entry_(Lisp operator, struct Profile* profile)
+{
+    LispType type = lisp_type(operator);
+    uintptr_t key;
+    const char* name = NULL;
+    switch (type)
+    {
+        case LISP_LAMBDA:
+        {
+            Lisp symbol = lambda_name_(operator);
+            // interned symbols don't move, but may be swept and reused, so names are compared too.
+            key = lisp_is_null(symbol) ? 0 : (uintptr_t)symbol.val.ptr_val;
+            name = lisp_is_null(symbol) ? "(lambda)" : lisp_symbol_string(symbol);
+            break;
+        }
+        case LISP_FUNC_N:
+            key = (uintptr_t)func_n_get_(operator)->func;
+            break;
+        default:
+            key = (uintptr_t)lisp_func(operator);
+            break;
+    }
+
+    uint64_t i = profile_hash_(key * 31 + type);
+    size_t mask = profile->entry_index_size - 1;
+    int j;
+    while ((j = profile->entry_index[i &= mask]) != -1)
+    {
+        const ProfileEntry* e = profile->entries + j;
+        if (e->type == type && e->key == key && (!name || strcmp(e->name, name) == 0)) return j;
+        ++i;
+    }
+
+    j = profile->entry_count++;
+    profile->entries = realloc(profile->entries, sizeof(ProfileEntry) * profile->entry_count);
+    ProfileEntry* e = profile->entries + j;
+    memset(e, 0, sizeof(ProfileEntry));
+    e->type = type;
+    e->key = key;
+    e->name = name ? profile_copy_string_(name) : NULL;
+
+    profile->entry_index[i] = j;
+    profile->entry_index = profile_rehash_(profile->entry_index, &profile->entry_index_size, profile->entry_count, profile_entry_hash_, profile);
+    return j;
+}
+
+static int profile_node_(int parent, int entry, struct Profile* profile)
+{
+    uint64_t i = profile_hash_((uint64_t)(parent + 1) * 0x100000001ULL + entry);
+    size_t mask = profile->node_index_size - 1;
+    int j;
+    while ((j = profile->node_index[i &= mask]) != -1)
+    {
+        const ProfileNode* n = profile->nodes + j;
+        if (n->parent == parent && n->entry == entry) return j;
+        ++i;
+    }
+
+    j = profile->node_count++;
+    profile->nodes = realloc(profile->nodes, sizeof(ProfileNode) * profile->node_count);
+    ProfileNode* n = profile->nodes + j;
+    n->parent = parent;
+    n->entry = entry;
+    n->self = 0;
+
+    profile->node_index[i] = j;
+    profile->node_index = profile_rehash_(profile->node_index, &profile->node_index_size, profile->node_count, profile_node_hash_, profile);
+    return j;
+}
+
+static size_t profile_bytes_(LispContext ctx)
+{
+    size_t n = 0;
+    for (int i = 0; i < LISP_TYPE_COUNT; ++i) n += ctx.p->gc_stats.bytes_allocated[i];
+    return n;
+}
+
+static void profile_push_(int entry, LispContext ctx)
+{
+    struct Profile* profile = ctx.p->profile;
+    if (profile->depth == profile->frame_capacity)
+    {
+        profile->frame_capacity = profile->frame_capacity ? profile->frame_capacity * 2 : 64;
+        profile->frames = realloc(profile->frames, sizeof(ProfileFrame) * profile->frame_capacity);
+    }
+
+    int parent = profile->depth > 0 ? profile->frames[profile->depth - 1].node : -1;
+    ProfileFrame* f = profile->frames + profile->depth++;
+    f->entry = entry;
+    f->node = profile_node_(parent, entry, profile);
+    f->child_time = 0;
+    f->child_bytes = 0;
+    f->start_bytes = profile_bytes_(ctx);
+    f->start = profile_now_(profile);
+
+    ProfileEntry* e = profile->entries + entry;
+    ++e->calls;
+    ++e->active;
+}
+
+static void profile_pop_(LispContext ctx)
+{
+    struct Profile* profile = ctx.p->profile;
+    assert(profile->depth > 0);
+    const ProfileFrame* f = profile->frames + --profile->depth;
+    uint64_t time = profile_now_(profile) - f->start;
+    size_t bytes = profile_bytes_(ctx) - f->start_bytes;
+
+    ProfileEntry* e = profile->entries + f->entry;
+    e->exclusive += time - f->child_time;
+    e->bytes += bytes - f->child_bytes;
+    if (--e->active == 0) e->inclusive += time;
+    profile->nodes[f->node].self += time - f->child_time;
+
+    if (profile->depth > 0)
+    {
+        ProfileFrame* parent = profile->frames + profile->depth - 1;
+        parent->child_time += time;
+        parent->child_bytes += bytes;
+    }
+}
+
+static void profile_unwind_(int depth, LispContext ctx)
+{
+    while (ctx.p->profile->depth > depth) profile_pop_(ctx);
+}
+
+static void profile_enter_(Lisp operator, LispContext ctx)
+{
+    profile_push_(profile_entry_(operator, ctx.p->profile), ctx);
+}
+
+// a lambda call which eval continues in the same eval_r (tail position).
+// frames above base belong to this eval_r, so it replaces the top one.
+static void profile_tail_(Lisp operator, int base, LispContext ctx)
+{
+    int entry = profile_entry_(operator, ctx.p->profile);
+    if (ctx.p->profile->depth > base) profile_pop_(ctx);
+    profile_push_(entry, ctx);
+}
+
+static int profile_depth_(LispContext ctx) { return ctx.p->profile ? ctx.p->profile->depth : 0; }
+
+void lisp_profile_begin(int sampling, LispContext ctx)
+{
+    assert(!ctx.p->profile);
+    struct Profile* profile = calloc(1, sizeof(struct Profile));
+    profile->pending = -1;
+    profile->entry_index = profile_rehash_(NULL, &profile->entry_index_size, 0, profile_entry_hash_, profile);
+    profile->node_index = profile_rehash_(NULL, &profile->node_index_size, 0, profile_node_hash_, profile);
+    ctx.p->profile = profile;
+
+#ifdef LISP_POSIX_TIME_
+    if (sampling)
+    {
+        profile->sampling = 1;
+        signal(SIGPROF, profile_tick_);
+        struct itimerval timer;
+        timer.it_interval.tv_sec = 0;
+        timer.it_interval.tv_usec = 1000;
+        timer.it_value = timer.it_interval;
+        setitimer(ITIMER_PROF, &timer, NULL);
+    }
+#else
+    (void)sampling;
+#endif
+}
+
+// names C functions by looking for them in the environment.
+static void profile_name_funcs_(struct Profile* profile, LispContext ctx)
+{
+    for (Lisp env = lisp_env(ctx); lisp_is_pair(env); env = lisp_cdr(env))
+    {
+        Lisp frame = lisp_car(env);
+        if (lisp_type(frame) != LISP_TABLE) continue;
+        const Table* table = table_get_(frame);
+        if (table->capacity == 0) continue;
+
+        Lisp keys = VAL_(table->keys, LISP_VECTOR);
+        Lisp vals = VAL_(table->vals, LISP_VECTOR);
+        for (int i = 0; i < table->capacity; ++i)
+        {
+            Lisp key = lisp_vector_ref(keys, i);
+            Lisp val = lisp_vector_ref(vals, i);
+            if (lisp_type(key) != LISP_SYMBOL) continue;
+            if (lisp_type(val) != LISP_FUNC && lisp_type(val) != LISP_FUNC_N) continue;
+
+            uintptr_t k = lisp_type(val) == LISP_FUNC_N ? (uintptr_t)func_n_get_(val)->func : (uintptr_t)lisp_func(val);
+            for (int j = 0; j < profile->entry_count; ++j)
+            {
+                ProfileEntry* e = profile->entries + j;
+                if (e->type == lisp_type(val) && e->key == k && !e->name)
+                {
+                    e->name = profile_copy_string_(lisp_symbol_string(key));
+                }
+            }
+        }
+    }
+
+    for (int j = 0; j < profile->entry_count; ++j)
+    {
+        if (!profile->entries[j].name) profile->entries[j].name = profile_copy_string_("(c function)");
+    }
+}
+
+static int profile_compare_(const void* a, const void* b)
+{
+    const ProfileEntry* x = a;
+    const ProfileEntry* y = b;
+    if (x->exclusive != y->exclusive) return x->exclusive < y->exclusive ? 1 : -1;
+    return y->calls < x->calls ? -1 : y->calls > x->calls;
+}
+
+static void profile_print_stack_(FILE* file, const struct Profile* profile, int node)
+{
+    const ProfileNode* n = profile->nodes + node;
+    if (n->parent != -1)
+    {
+        profile_print_stack_(file, profile, n->parent);
+        fputc(';', file);
+    }
+    fputs(profile->entries[n->entry].name, file);
+}
+
+void lisp_profile_end(FILE* flat_file, FILE* stacks_file, LispContext ctx)
+{
+    struct Profile* profile = ctx.p->profile;
+    assert(profile);
+    ctx.p->profile = NULL;
+
+#ifdef LISP_POSIX_TIME_
+    if (profile->sampling)
+    {
+        struct itimerval timer;
+        memset(&timer, 0, sizeof(timer));
+        setitimer(ITIMER_PROF, &timer, NULL);
+        signal(SIGPROF, SIG_DFL);
+    }
+#endif
+
+    profile_name_funcs_(profile, ctx);
+
+    if (stacks_file)
+    {
+        // before sorting, as nodes refer to entries by index.
+        for (int i = 0; i < profile->node_count; ++i)
+        {
+            if (profile->nodes[i].self / 1000 == 0) continue;
+            profile_print_stack_(stacks_file, profile, i);
+            fprintf(stacks_file, " %llu\n", (unsigned long long)(profile->nodes[i].self / 1000));
+        }
+    }
+
+    if (flat_file)
+    {
+        qsort(profile->entries, profile->entry_count, sizeof(ProfileEntry), profile_compare_);
+        fprintf(flat_file, "%12s %12s %12s %14s  %s\n", "calls", "incl (us)", "excl (us)", "alloc (bytes)", "name");
+        for (int i = 0; i < profile->entry_count; ++i)
+        {
+            const ProfileEntry* e = profile->entries + i;
+            fprintf(flat_file, "%12lu %12llu %12llu %14lu  %s\n",
+                    (unsigned long)e->calls,
+                    (unsigned long long)(e->inclusive / 1000),
+                    (unsigned long long)(e->exclusive / 1000),
+                    (unsigned long)e->bytes,
+                    e->name);
+        }
+    }
+
+    for (int i = 0; i < profile->entry_count; ++i) free(profile->entries[i].name);
+    free(profile->entries);
+    free(profile->entry_index);
+    free(profile->nodes);
+    free(profile->node_index);
+    free(profile->frames);
+    free(profile);
+}
+
+Lisp lisp_call_cc(Lisp proc, LispError* out_error, LispContext ctx)
+{
+    Lisp j = make_jump_(ctx);
+    Jump* jump = jump_get_(j);
+    jump->stack_ptr = ctx.p->stack_ptr;
+    jump->profile_depth = profile_depth_(ctx);
+
+    int has_result = setjmp(jump->jmp);
+    if (has_result)
+    {
+        // restore jump from the stack
+        jump = jump_get_(lisp_stack_pop(ctx));
+        ctx.p->stack_ptr = jump->stack_ptr;
+        if (ctx.p->profile) profile_unwind_(jump->profile_depth, ctx);
+        return jump->result;
+    }
+    else
+    {
+        return lisp_apply(proc, lisp_cons(j, lisp_null(), ctx), out_error, ctx);
+    }
+}
+
+// Calls to lambdas which nothing in their body can capture (see resolve_r)
+// take their frame and env pair from a pool, and the eval_r running the body
+// gives them back when it returns or tail calls.
+// Self tail calls get the same frame back.
+static Lisp frame_acquire_(Lisp frame_names, Lisp parent, LispContext ctx)
+{
+    int n = lisp_vector_length(frame_names) + 1;
+    if (n < FRAME_POOL_SIZES_ && ctx.p->frame_pool_count[n] > 0)
+    {
+        Lisp env = ctx.p->frame_pool[n][--ctx.p->frame_pool_count[n]];
+        Lisp frame = lisp_car(env);
+        lisp_vector_fill(frame, lisp_null());
+        lisp_vector_set(frame, 0, frame_names);
+        lisp_set_cdr(env, parent);
+        return env;
+    }
+
+    Lisp frame = lisp_make_vector(n, ctx);
+    lisp_vector_fill(frame, lisp_null());
+    lisp_vector_set(frame, 0, frame_names);
+    return lisp_env_extend(parent, frame, ctx);
+}
+
+static void frame_release_(Lisp env, LispContext ctx)
+{
+    int n = lisp_vector_length(lisp_car(env));
+    if (n < FRAME_POOL_SIZES_ && ctx.p->frame_pool_count[n] < FRAME_POOL_DEPTH_)
+    {
+        ctx.p->frame_pool[n][ctx.p->frame_pool_count[n]++] = env;
+    }
+}
+
+// returns whether the result is final, or needs to be eval'd.
+static int apply(Lisp operator, Lisp args, Lisp* out_result, Lisp* out_env, LispError* error, LispContext ctx)
+{
+    switch (lisp_type(operator))
+    {
+        case LISP_LAMBDA: // lambda call (compound procedure)
+        {
+            Lisp slot_names = lambda_args_(operator);
+            Lisp frame_names = lambda_names_(operator);
+            *out_env = lisp_lambda_env(operator);
+
+            // make a new environment
+            Lisp new_frame;
+            if (lisp_is_null(frame_names))
+            {
+                new_frame = lisp_make_table(ctx);
+
+                // bind parameters to arguments
+                // to pass into function call
+                while (lisp_is_pair(slot_names) && lisp_is_pair(args))
+                {
+                    lisp_table_set(new_frame, lisp_car(slot_names), lisp_car(args), ctx);
+                    slot_names = lisp_cdr(slot_names);
+                    args = lisp_cdr(args);
+                }
+
+                if (lisp_type(slot_names) == LISP_SYMBOL)
+                {
+                    // variable length arguments
+                    lisp_table_set(new_frame, slot_names, args, ctx);
+                }
+            }
+            else
+            {
+                // resolved body. parameters are the first slots,
+                // followed by internal definitions.
+                if (lambda_reuses_frame_(operator))
+                {
+                    *out_env = frame_acquire_(frame_names, *out_env, ctx);
+                    new_frame = lisp_car(*out_env);
+                }
+                else
+                {
+                    new_frame = lisp_make_vector(lisp_vector_length(frame_names) + 1, ctx);
+                    lisp_vector_fill(new_frame, lisp_null());
+                    lisp_vector_set(new_frame, 0, frame_names);
+                }
+
+                int i = 1;
+                while (lisp_is_pair(slot_names) && lisp_is_pair(args))
+                {
+                    lisp_vector_set(new_frame, i, lisp_car(args));
+                    slot_names = lisp_cdr(slot_names);
+                    args = lisp_cdr(args);
+                    ++i;
+                }
+
+                if (lisp_type(slot_names) == LISP_SYMBOL)
+                {
+                    // variable length arguments
+                    lisp_vector_set(new_frame, i, args);
+                }
+            }
+
+            if (lisp_is_pair(slot_names))
+            {
+                *error = LISP_ERROR_TOO_FEW_ARGS;
+                return 0;
+            }
+            else if (lisp_is_null(slot_names) && !lisp_is_null(args))
+            {
+                *error = LISP_ERROR_TOO_MANY_ARGS;
+                return 0;
+            }
+
+            // extend the environment
+            if (!lambda_reuses_frame_(operator)) *out_env = lisp_env_extend(*out_env, new_frame, ctx);
+
+            // normally we would eval the body here
+            // but while will eval
+            *out_result = lisp_lambda_body(operator);
+            return 1;
+        }
+        case LISP_FUNC: // call into C functions
+        {
+            // no environment required
+            LispCFunc f = lisp_func(operator);
+            if (ctx.p->profile) profile_enter_(operator, ctx);
+            *out_result = f(args, error, ctx);
+            if (ctx.p->profile) profile_pop_(ctx);
+            return 0;
+        }
+        case LISP_FUNC_N:
+        {
+            // copy the arguments to the stack
+            size_t save_stack = ctx.p->stack_ptr;
+            int argc = 0;
+            while (lisp_is_pair(args))
+            {
+                lisp_stack_push(lisp_car(args), ctx);
+                args = lisp_cdr(args);
+                ++argc;
+            }
+            if (ctx.p->profile) profile_enter_(operator, ctx);
+            *out_result = func_n_call_(operator, argc, lisp_stack_peek(argc, ctx), error, ctx);
+            if (ctx.p->profile) profile_pop_(ctx);
+            ctx.p->stack_ptr = save_stack;
+            return 0;
+        }
+        case LISP_JUMP:
+        {
+            Jump* jump = jump_get_(operator);
+            jump->result = lisp_car(args);
+            // put jump on the stack
+            lisp_stack_push(operator, ctx);
+            longjmp(jump->jmp, 1);
+        }
+        default:
+        {
+            lisp_printf(ctx.p->err_port, operator);
+            fprintf(ctx.p->err_port, " is not an operator.\n");
+
+            *error = LISP_ERROR_BAD_OP;
+            return 0;
+        }
+    }
+}
+
+// like apply, but takes arguments from the stack.
+// C functions taking a vector and resolved lambdas use them directly instead of consing a list.
+static int apply_argv_(Lisp operator, Lisp* argv, int argc, Lisp* out_result, Lisp* out_env, LispError* error, LispContext ctx)
+{
+    if (lisp_type(operator) == LISP_FUNC_N)
+    {
+        if (ctx.p->profile) profile_enter_(operator, ctx);
+        *out_result = func_n_call_(operator, argc, argv, error, ctx);
+        if (ctx.p->profile) profile_pop_(ctx);
+        return 0;
+    }
+    else if (lisp_type(operator) != LISP_LAMBDA || lisp_is_null(lambda_names_(operator)))
+    {
+        return apply(operator, lisp_make_list2(argv, argc, ctx), out_result, out_env, error, ctx);
+    }
+
+    Lisp slot_names = lambda_args_(operator);
+    Lisp frame_names = lambda_names_(operator);
+    int reuse = lambda_reuses_frame_(operator);
+    Lisp new_frame;
+    if (reuse)
+    {
+        *out_env = frame_acquire_(frame_names, lisp_lambda_env(operator), ctx);
+        new_frame = lisp_car(*out_env);
+    }
+    else
+    {
+        new_frame = lisp_make_vector(lisp_vector_length(frame_names) + 1, ctx);
+        lisp_vector_fill(new_frame, lisp_null());
+        lisp_vector_set(new_frame, 0, frame_names);
+    }
+
+    int i = 0;
+    while (lisp_is_pair(slot_names) && i < argc)
+    {
+        lisp_vector_set(new_frame, i + 1, argv[i]);
+        slot_names = lisp_cdr(slot_names);
+        ++i;
+    }
+
+    if (lisp_type(slot_names) == LISP_SYMBOL)
+    {
+        // variable length arguments
+        lisp_vector_set(new_frame, i + 1, lisp_make_list2(argv + i, argc - i, ctx));
+        i = argc;
+    }
+
+    if (lisp_is_pair(slot_names))
+    {
+        *error = LISP_ERROR_TOO_FEW_ARGS;
+        return 0;
+    }
+    else if (i < argc)
+    {
+        *error = LISP_ERROR_TOO_MANY_ARGS;
+        return 0;
+    }
+
+    if (!reuse) *out_env = lisp_env_extend(lisp_lambda_env(operator), new_frame, ctx);
+    *out_result = lisp_lambda_body(operator);
+    return 1;
+}
+
+// BYTECODE
+// An optional alternative to walking the expanded tree (see lisp_compile).
+// Resolved code is flattened into instructions for a stack machine.
+// Operands live on the lisp stack, so the gc moves them
+// and call/cc unwinds them like anything else eval_r pushes.
+// Compiled code is just another value, so compiled and
+// interpreted lambdas can call each other.
+enum
+{
+    OP_CONST = 0,     // k: push constant k
+    OP_LOCAL,         // depth slot: push local
+    OP_GLOBAL,        // k: push the value of symbol or global reference constant k
+    OP_SET_LOCAL,     // depth slot: pop into local
+    OP_DEF_GLOBAL,    // k: pop into a new definition
+    OP_SET_GLOBAL,    // k: pop into an existing variable
+    OP_POP,
+    OP_JUMP,          // pc
+    OP_JUMP_IF_FALSE, // pc: pop and jump if false
+    OP_LAMBDA,        // k: make a lambda from constants k (args), k + 1 (body), k + 2 (names), k + 3 (reuse frame)
+    OP_CALL,          // n: call the operator below n arguments
+    OP_TAIL_CALL,     // n: call, replacing the current code
+    OP_RETURN,
+};
+
+typedef struct
+{
+    Block block;
+    LispVal consts;
+    int length;
+    int32_t ops[];
+} Code;
+
+static const Code* code_get_(Lisp x)
+{
+    assert(lisp_type(x) == LISP_CODE);
+    return x.val.ptr_val;
+}
+
+static Lisp code_consts_(const Code* code) { return VAL_(code->consts, LISP_VECTOR); }
+
+static Lisp eval_r(jmp_buf error_jmp, LispContext ctx);
+static Lisp eval_owned_r_(jmp_buf error_jmp, int owned, LispContext ctx);
+
+static int gc_over_limit_(LispContext ctx)
+{
+    return ctx.p->gc_max_size > 0 && ctx.p->heap.size + ctx.p->old_heap.size > ctx.p->gc_max_size;
+}
+
+static int gc_safepoint_slow_(LispContext ctx)
+{
+    if (ctx.p->gc_auto_threshold > 0 && ctx.p->gc_disabled == 0)
+    {
+        // everything is collected before giving up
+        if (gc_over_limit_(ctx)) lisp_collect_full(lisp_null(), ctx);
+        else if (ctx.p->heap.size >= ctx.p->gc_auto_threshold) lisp_collect(lisp_null(), ctx);
+    }
+    return gc_over_limit_(ctx);
+}
+
+// Called where every live value is on the lisp stack.
+// Returns whether the heap is over its limit, which is an error.
+static int gc_safepoint_(LispContext ctx)
+{
+    if (ctx.p->heap.size < ctx.p->gc_safepoint_size) return 0;
+    return gc_safepoint_slow_(ctx);
+}
+
+void lisp_safe_point(LispContext ctx) { (void)gc_safepoint_(ctx); }
+
+Lisp* lisp_push_root(Lisp x, LispContext ctx)
+{
+    lisp_stack_push(x, ctx);
+    return lisp_stack_peek(1, ctx);
+}
+
+void lisp_pop_roots(int n, LispContext ctx)
+{
+    assert(ctx.p->stack_ptr >= (size_t)n);
+    ctx.p->stack_ptr -= (size_t)n;
+}
+
+LispHandle lisp_handle_new(Lisp x, LispContext ctx)
+{
+    if (ctx.p->handle_free == 0)
+    {
+        int old = ctx.p->handle_capacity;
+        int n = old ? old * 2 : 64;
+        ctx.p->handles = realloc(ctx.p->handles, sizeof(Lisp) * n);
+        ctx.p->handle_next = realloc(ctx.p->handle_next, sizeof(LispHandle) * n);
+        // chain the new slots in order
+        for (int i = old; i < n; ++i)
+        {
+            ctx.p->handles[i] = lisp_null();
+            ctx.p->handle_next[i] = i + 1 < n ? i + 2 : 0;
+        }
+        ctx.p->handle_free = old + 1;
+        ctx.p->handle_capacity = n;
+    }
+
+    LispHandle h = ctx.p->handle_free;
+    ctx.p->handle_free = ctx.p->handle_next[h - 1];
+    ctx.p->handle_next[h - 1] = -1;
+    ctx.p->handles[h - 1] = x;
+    return h;
+}
+
+Lisp lisp_handle_get(LispHandle h, LispContext ctx)
+{
+    assert(h > 0 && h <= ctx.p->handle_capacity && ctx.p->handle_next[h - 1] == -1);
+    return ctx.p->handles[h - 1];
+}
+
+void lisp_handle_set(LispHandle h, Lisp x, LispContext ctx)
+{
+    assert(h > 0 && h <= ctx.p->handle_capacity && ctx.p->handle_next[h - 1] == -1);
+    ctx.p->handles[h - 1] = x;
+}
+
+void lisp_handle_free(LispHandle h, LispContext ctx)
+{
+    assert(h > 0 && h <= ctx.p->handle_capacity && ctx.p->handle_next[h - 1] == -1);
+    ctx.p->handles[h - 1] = lisp_null();
+    ctx.p->handle_next[h - 1] = ctx.p->handle_free;
+    ctx.p->handle_free = h;
+}
+
+// runs the code in *x. returns whether the result needs to be eval'd.
+// That happens on a tail call to an interpreted lambda, in which case
+// *x and *env are replaced for eval_r to continue.
+// profile_base is the profiler depth of the eval_r running it.
+// *owned is whether *env is a pooled frame to give back (see frame_acquire_).
+static int vm_run_(Lisp* x, Lisp* env, Lisp* out_result, int profile_base, int* owned, jmp_buf error_jmp, LispContext ctx)
+{
+    size_t base = ctx.p->stack_ptr;
+    int pc = 0;
+
+    while (1)
+    {
+        // reload every step. the gc may move the code.
+        const Code* code = code_get_(*x);
+        const int32_t* op = code->ops + pc;
+        assert(pc < code->length);
+
+        switch (op[0])
+        {
+            case OP_CONST:
+                lisp_stack_push(lisp_vector_ref(code_consts_(code), op[1]), ctx);
+                pc += 2;
+                break;
+            case OP_LOCAL:
+                lisp_stack_push(lisp_vector_ref(env_frame_(*env, op[1]), op[2]), ctx);
+                pc += 3;
+                break;
+            case OP_GLOBAL:
+            {
+                Lisp symbol = lisp_vector_ref(code_consts_(code), op[1]);
+                int present;
+                Lisp val;
+                if (lisp_type(symbol) == LISP_GLOBAL)
+                {
+                    val = global_ref_lookup_(symbol, *env, &present, ctx);
+                    symbol = global_ref_symbol_(symbol);
+                }
+                else
+                {
+                    val = lisp_env_lookup(*env, symbol, &present);
+                }
+                if (!present)
+                {
+                    fprintf(ctx.p->err_port, "%s is not defined.\n", lisp_symbol_string(symbol));
+                    longjmp(error_jmp, LISP_ERROR_UNDEFINED_VAR); 
+                }
+                lisp_stack_push(val, ctx);
+                pc += 2;
+                break;
+            }
+            case OP_SET_LOCAL:
+            {
+                Lisp frame = env_frame_(*env, op[1]);
+                Lisp x = lisp_stack_pop(ctx);
+                lambda_define_name_(x, lisp_vector_ref(lisp_vector_ref(frame, 0), op[2] - 1));
+                lisp_vector_set(frame, op[2], x);
+                lisp_stack_push(lisp_null(), ctx);
+                pc += 3;
+                break;
+            }
+            case OP_DEF_GLOBAL:
+            {
+                Lisp symbol = lisp_vector_ref(code_consts_(code), op[1]);
+                Lisp x = lisp_stack_pop(ctx);
+                lambda_define_name_(x, symbol);
+                lisp_env_define(*env, symbol, x, ctx);
+                lisp_stack_push(lisp_null(), ctx);
+                pc += 2;
+                break;
+            }
+            case OP_SET_GLOBAL:
+            {
+                Lisp symbol = lisp_vector_ref(code_consts_(code), op[1]);
+                if (!lisp_env_set(*env, symbol, lisp_stack_pop(ctx), ctx))
+                { 
+                    fprintf(ctx.p->err_port, "error: unknown variable: %s\n", lisp_symbol_string(symbol));
+                }
+                lisp_stack_push(lisp_null(), ctx);
+                pc += 2;
+                break;
+            }
+            case OP_POP:
+                lisp_stack_pop(ctx);
+                pc += 1;
+                break;
+            case OP_JUMP:
+                pc = op[1];
+                break;
+            case OP_JUMP_IF_FALSE:
+                pc = lisp_is_true(lisp_stack_pop(ctx)) ? pc + 2 : op[1];
+                break;
+            case OP_LAMBDA:
+            {
+                Lisp consts = code_consts_(code);
+                Lisp l = lambda_make_(
+                        lisp_vector_ref(consts, op[1]),
+                        lisp_vector_ref(consts, op[1] + 1),
+                        *env,
+                        lisp_vector_ref(consts, op[1] + 2),
+                        reuse_flag_(lisp_vector_ref(consts, op[1] + 3)),
+                        ctx
+                );
+                lisp_stack_push(l, ctx);
+                pc += 2;
+                break;
+            }
+            case OP_CALL:
+            case OP_TAIL_CALL:
+            {
+                int argc = op[1];
+                int tail = op[0] == OP_TAIL_CALL;
+                pc += 2;
+
+                // code may move
+                if (gc_safepoint_(ctx)) longjmp(error_jmp, LISP_ERROR_OUT_OF_MEMORY);
+
+                Lisp* argv = lisp_stack_peek(argc, ctx);
+                if (tail && *owned)
+                {
+                    // the arguments are on the stack. this frame is done.
+                    frame_release_(*env, ctx);
+                    *owned = 0;
+                }
+
+                Lisp result;
+                Lisp new_env;
+                LispError error = LISP_ERROR_NONE;
+                int needs_to_eval = apply_argv_(argv[-1], argv, argc, &result, &new_env, &error, ctx);
+                if (error != LISP_ERROR_NONE) longjmp(error_jmp, error);
+                Lisp operator = argv[-1];
+                ctx.p->stack_ptr -= argc + 1;
+
+                if (!needs_to_eval)
+                {
+                    if (tail)
+                    {
+                        *out_result = result;
+                        assert(ctx.p->stack_ptr == base);
+                        return 0;
+                    }
+                    lisp_stack_push(result, ctx);
+                }
+                else if (tail)
+                {
+                    if (ctx.p->profile) profile_tail_(operator, profile_base, ctx);
+                    ctx.p->stack_ptr = base;
+                    *x = result;
+                    *env = new_env;
+                    *owned = lambda_reuses_frame_(operator);
+                    if (lisp_type(*x) != LISP_CODE) return 1;
+                    pc = 0;
+                }
+                else
+                {
+                    if (ctx.p->profile) ctx.p->profile->pending = profile_entry_(operator, ctx.p->profile);
+                    lisp_stack_push(new_env, ctx);
+                    lisp_stack_push(result, ctx);
+                    result = eval_owned_r_(error_jmp, lambda_reuses_frame_(operator), ctx);
+                    lisp_stack_pop(ctx);
+                    lisp_stack_pop(ctx);
+                    lisp_stack_push(result, ctx);
+                }
+                break;
+            }
+            case OP_RETURN:
+                *out_result = lisp_stack_pop(ctx);
+                assert(ctx.p->stack_ptr == base);
+                return 0;
+            default:
+                assert(0);
+                return 0;
+        }
+    }
+}
+
+static Lisp eval_loop_(jmp_buf error_jmp, int profile_base, int* owned, LispContext ctx)
+{
+    Lisp* env = lisp_stack_peek(2, ctx);
+    Lisp* x = lisp_stack_peek(1, ctx);
+    
+    while (1)
+    {
+        if (gc_safepoint_(ctx)) longjmp(error_jmp, LISP_ERROR_OUT_OF_MEMORY);
+
+        switch (lisp_type(*x))
+        {
+            case LISP_SYMBOL: // variable reference
+            {
+                int present;
+                Lisp val = lisp_env_lookup(*env, *x, &present);
+                if (!present)
+                {
+                    fprintf(ctx.p->err_port, "%s is not defined.\n", lisp_symbol_string(*x));
+                    longjmp(error_jmp, LISP_ERROR_UNDEFINED_VAR); 
+                    return lisp_null();
+                }
+                return val;
+            }
+            case LISP_LOCAL: // resolved variable reference
+            {
+                return lisp_vector_ref(local_frame_(*env, *x), local_slot_(*x));
+            }
+            case LISP_GLOBAL: // resolved global reference
+            {
+                int present;
+                Lisp val = global_ref_lookup_(*x, *env, &present, ctx);
+                if (!present)
+                {
+                    fprintf(ctx.p->err_port, "%s is not defined.\n", lisp_symbol_string(global_ref_symbol_(*x)));
+                    longjmp(error_jmp, LISP_ERROR_UNDEFINED_VAR); 
+                }
+                return val;
+            }
+            case LISP_CODE:
+            {
+                Lisp result;
+                if (!vm_run_(x, env, &result, profile_base, owned, error_jmp, ctx)) return result;
+                // tail call to an interpreted lambda. while will eval
+                break;
+            }
+            case LISP_PAIR:
+            {
+                Lisp op_sym = lisp_car(*x);
+                int op_valid = lisp_type(op_sym) == LISP_SYMBOL;
+
+                if (lisp_eq(op_sym, get_sym(SYM_IF, ctx)) && op_valid) 
+                {
+                    // if conditional statemetns
+                    Lisp predicate = lisp_list_ref(*x, 1);
+                    
+                    lisp_stack_push(*env, ctx);
+                    lisp_stack_push(predicate, ctx);
+ 
+                    if (lisp_is_true(eval_r(error_jmp, ctx)))
+                    {
+                        // consequence
+                        *x = lisp_list_ref(*x, 2);
+                        // while will eval
+                    }
+                    else
+                    {
+                        // alternative
+                        *x = lisp_list_ref(*x, 3);
+                        // while will eval
+                    }
+                    
+                    lisp_stack_pop(ctx);
+                    lisp_stack_pop(ctx);
+                }
+                else if (lisp_eq(op_sym, get_sym(SYM_BEGIN, ctx)) && op_valid)
+                {
+                    Lisp it = lisp_cdr(*x);
+                    if (lisp_is_null(it)) return it;
+                    
+                    // eval all but last
+                    while (lisp_is_pair(lisp_cdr(it)))
+                    {
+                        // save next thing
+                        lisp_stack_push(lisp_cdr(it), ctx);
+                        
+                        lisp_stack_push(*env, ctx);
+                        lisp_stack_push(lisp_car(it), ctx);
+                        
+                        eval_r(error_jmp, ctx);
+        
+                        lisp_stack_pop(ctx);
+                        lisp_stack_pop(ctx);
+                        
+                        it = lisp_stack_pop(ctx);
+                        //it = lisp_cdr(it);
+                    }
+                    
+                    *x = lisp_car(it);
+                    // while will eval last
+                }
+                else if (lisp_eq(op_sym, get_sym(SYM_QUOTE, ctx)) && op_valid)
+                {
+                    return lisp_list_ref(*x, 1);
+                }
+                else if (lisp_eq(op_sym, get_sym(SYM_DEFINE, ctx))) 
+                {
+                    // variable definitions
+                    lisp_stack_push(*env, ctx);
+                    lisp_stack_push(lisp_list_ref(*x, 2), ctx);
+                    
+                    Lisp value = eval_r(error_jmp, ctx);
+                    
+                    lisp_stack_pop(ctx);
+                    lisp_stack_pop(ctx);
+                    
+                    Lisp symbol = lisp_list_ref(*x, 1);
+                    if (lisp_type(symbol) == LISP_LOCAL)
+                    {
+                        Lisp frame = local_frame_(*env, symbol);
+                        lambda_define_name_(value, lisp_vector_ref(lisp_vector_ref(frame, 0), local_slot_(symbol) - 1));
+                        lisp_vector_set(frame, local_slot_(symbol), value);
+                    }
+                    else
+                    {
+                        lambda_define_name_(value, symbol);
+                        lisp_env_define(*env, symbol, value, ctx);
+                    }
+                    return lisp_null();
+                }
+                else if (lisp_eq(op_sym, get_sym(SYM_SET, ctx)) && op_valid)
+                {
+                    assert(!lisp_is_null(*env));
+                    // mutablity
+                    // like def, but requires existence
+                    // and will search up the environment chain
+                    
+                    lisp_stack_push(*env, ctx);
+                    lisp_stack_push(lisp_list_ref(*x, 2), ctx);
+                    
+                    Lisp value = eval_r(error_jmp, ctx);
+                    
+                    lisp_stack_pop(ctx);
+                    lisp_stack_pop(ctx);
+                    
+                    Lisp symbol = lisp_list_ref(*x, 1);
+                    if (lisp_type(symbol) == LISP_LOCAL)
+                    {
+                        lisp_vector_set(local_frame_(*env, symbol), local_slot_(symbol), value);
+                    }
+                    else if (!lisp_env_set(*env, symbol, value, ctx))
+                    { 
+                        fprintf(ctx.p->err_port, "error: unknown variable: %s\n", lisp_symbol_string(symbol));
+                    }
+                    return lisp_null();
+                }
+                else if (lisp_eq(op_sym, get_sym(SYM_LAMBDA, ctx)) && op_valid) 
+                {
+                    // lambda defintions (compound procedures)
+                    Lisp args = lisp_list_ref(*x, 1);
+                    Lisp body = lisp_list_ref(*x, 2);
+                    Lisp names = lisp_list_ref(*x, 3);
+                    return lambda_make_(args, body, *env, names, reuse_flag_(lisp_list_ref(*x, 4)), ctx);
+                }
+                else 
+                {
+                    // operator application
+                    lisp_stack_push(*env, ctx);
+                    lisp_stack_push(lisp_car(*x), ctx);
+                    
+                    Lisp operator = eval_r(error_jmp, ctx);
+                    
+                    Lisp operator_expr = lisp_stack_pop(ctx);
+                    lisp_stack_pop(ctx);
+                    
+                    lisp_stack_push(operator, ctx);
+                    lisp_stack_push(operator_expr, ctx);
+                    
+                    // arguments are evaluated on to the stack
+                    size_t argv_start = ctx.p->stack_ptr;
+                    int argc = 0;
+                    Lisp arg_expr = lisp_cdr(*x);
+                    
+                    while (lisp_is_pair(arg_expr))
+                    {
+                        // save next
+                        lisp_stack_push(lisp_cdr(arg_expr), ctx);
+
+                        lisp_stack_push(*env, ctx);
+                        lisp_stack_push(lisp_car(arg_expr), ctx);
+                        Lisp new_arg = eval_r(error_jmp, ctx);
+                        lisp_stack_pop(ctx);
+                        lisp_stack_pop(ctx);
+
+                        arg_expr = lisp_stack_pop(ctx);
+                        lisp_stack_push(new_arg, ctx);
+                        ++argc;
+                    }
+                    
+                    operator = *lisp_stack_peek(argc + 2, ctx);
+
+                    if (*owned)
+                    {
+                        // the arguments are on the stack. this frame is done.
+                        frame_release_(*env, ctx);
+                        *owned = 0;
+                    }
+                    
+                    LispError error = LISP_ERROR_NONE;
+                    int needs_to_eval = apply_argv_(operator, ctx.p->stack + argv_start, argc, x, env, &error, ctx);
+                    ctx.p->stack_ptr = argv_start;
+
+                    // the operator expression stays on the stack for the error message.
+                    // apply may collect.
+                    operator_expr = lisp_stack_pop(ctx);
+                    operator = lisp_stack_pop(ctx);
+
+                    if (error != LISP_ERROR_NONE)
+                    {
+                        if (lisp_type(operator_expr) == LISP_GLOBAL) operator_expr = global_ref_symbol_(operator_expr);
+                        if (lisp_type(operator_expr) == LISP_SYMBOL)
+                        {
+                            fprintf(ctx.p->err_port, "operator: %s\n", lisp_symbol_string(operator_expr));
+                        }
+
+                        longjmp(error_jmp, error);
+                    }
+
+                    if (!needs_to_eval)
+                    {
+                        return *x;
+                    }
+                    // Otherwise while will eval
+                    *owned = lambda_reuses_frame_(operator);
+                    if (ctx.p->profile) profile_tail_(operator, profile_base, ctx);
+                }
+                break;
+            }
+            default:
+               return *x; // atom
+        }
+    }
+}
+
+// like eval_r. owned is whether the environment is a pooled frame
+// to give back when the evaluation is done with it.
+static Lisp eval_owned_r_(jmp_buf error_jmp, int owned, LispContext ctx)
+{
+    struct Profile* profile = ctx.p->profile;
+    int base = 0;
+    if (profile)
+    {
+        base = profile->depth;
+        if (profile->pending != -1)
+        {
+            profile_push_(profile->pending, ctx);
+            profile->pending = -1;
+        }
+    }
+
+    Lisp result = eval_loop_(error_jmp, base, &owned, ctx);
+    // the gc may have moved it. read it from the stack.
+    if (owned) frame_release_(*lisp_stack_peek(2, ctx), ctx);
+    if (profile) profile_unwind_(base, ctx);
+    return result;
+}
+
+// evaluates the expression on top of the stack, in the environment below it.
+static Lisp eval_r(jmp_buf error_jmp, LispContext ctx)
+{
+    return eval_owned_r_(error_jmp, 0, ctx);
+}
+
+static Lisp expand_quasi_r(Lisp l, jmp_buf error_jmp, LispContext ctx)
+{
+    if (lisp_type(l) != LISP_PAIR)
+    {
+        Lisp terms[] = { get_sym(SYM_QUOTE, ctx), l };
+        return lisp_make_list2(terms, 2, ctx);
+    }
+
+    Lisp op = lisp_car(l);
+    int op_valid = lisp_type(op) == LISP_SYMBOL;
+
+    if (lisp_eq(op, get_sym(SYM_UNQUOTE, ctx)) && op_valid)
+    {
+        return lisp_car(lisp_cdr(l));
+    }
+    else if (lisp_eq(op, get_sym(SYM_UNQUOTE_SPLICE, ctx)) && op_valid)
+    {
+        fprintf(ctx.p->err_port, "slicing ,@ must be in a backquoted list.\n");
+        longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
+    }
+    else
+    {
+        Lisp terms[] = {
+            get_sym(SYM_CONS, ctx),
+            expand_quasi_r(lisp_car(l), error_jmp, ctx),
+            expand_quasi_r(lisp_cdr(l), error_jmp, ctx),
+        };
+        return lisp_make_list2(terms, 3, ctx);
+    }
+}
+
+static Lisp eval_expanded_(Lisp expanded, Lisp env, int owns_env, LispError* out_error, LispContext ctx);
+
+static Lisp expand_r(Lisp l, jmp_buf error_jmp, LispContext ctx)
+{
+    if (lisp_type(l) != LISP_PAIR) return l;
+
+    // 1. expand extended syntax into primitive syntax
+    // 2. perform optimizations
+    // 3. check syntax    
+
+    Lisp op = lisp_car(l);
+    if (lisp_type(op) == LISP_SYMBOL)
+    {
+        if (lisp_eq(op, get_sym(SYM_QUOTE, ctx)))
+        {
+            // don't expand quotes
+            if (lisp_list_length(l) != 2)
+            {
+                fprintf(ctx.p->err_port, "(quote x)\n");
+                longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
+            }
+            return l;
+        }
+        else if (lisp_eq(op, get_sym(SYM_QUASI_QUOTE, ctx)))
+        {
+            // unquoted terms may contain macros too
+            return expand_r(expand_quasi_r(lisp_car(lisp_cdr(l)), error_jmp, ctx), error_jmp, ctx);
+        }
+        else if (lisp_eq(op, get_sym(SYM_DEFINE_MACRO, ctx)))
+        {
+            if (lisp_list_length(l) != 3)
+            {
+                fprintf(ctx.p->err_port, "(define-macro name proc)\n");
+                longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
+            } 
+
+            Lisp symbol = lisp_list_ref(l, 1);
+            Lisp body = lisp_list_ref(l, 2);
+
+            LispError e;
+            Lisp lambda = lisp_eval(body, &e, ctx);
+
+            if (e != LISP_ERROR_NONE)
+            {
+                longjmp(error_jmp, e);
+            }
+            if (lisp_type(lambda) != LISP_LAMBDA)
+            {
+                fprintf(ctx.p->err_port, "(define-macro name proc) not a procedure\n");
+                longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
+            } 
+
+            lisp_table_set(ctx.p->macros, symbol, lambda, ctx);
+            // cached expansions may use the old definition.
+            ctx.p->expand_cache = lisp_null();
+            return lisp_null();
+        }
+        else 
+        {
+            int present;
+            Lisp proc = lisp_table_get(ctx.p->macros, op, &present);
+
+            if (present)
+            {
+                // EXPAND MACRO
+
+                // collection is disabled while evaling a macro
+                // (see lisp_macroexpand).
+                Lisp result;
+                Lisp calling_env;
+                LispError error = LISP_ERROR_NONE;
+                if (apply(proc, lisp_cdr(l), &result, &calling_env, &error, ctx) == 1)
+                {
+                    result = eval_expanded_(result, calling_env, 0, &error, ctx);
+                }
+
+                if (error != LISP_ERROR_NONE)
+                {
+                    fprintf(ctx.p->out_port, "macroexpand failed: %s\n", lisp_symbol_string(op));
+                    longjmp(error_jmp, error);
+                }
+                return expand_r(result, error_jmp, ctx);
+            }
+        }
+    }
+
+    // list
+    Lisp it = l;
+    while (lisp_is_pair(it))
+    {
+        lisp_set_car(it, expand_r(lisp_car(it), error_jmp, ctx));
+        it = lisp_cdr(it);
+    }
+    return l;
+
+}
+
+Lisp lisp_macroexpand(Lisp lisp, LispError* out_error, LispContext ctx)
+{
+    jmp_buf error_jmp;
+    // expand_r holds values in C while macros are evaluated.
+    ++ctx.p->gc_disabled;
+    LispError error = setjmp(error_jmp);
+
+    if (error == LISP_ERROR_NONE)
+    {
+        Lisp result = expand_r(lisp, error_jmp, ctx);
+        --ctx.p->gc_disabled;
+        *out_error = error;
+        return result;
+    }
+    else
+    {
+        --ctx.p->gc_disabled;
+        *out_error = error;
+        return lisp_null();
+    }
+}
+
+// LEXICAL ADDRESSING
+// After expansion, references to lambda parameters and internal definitions
+// are replaced with their frame depth and slot, so eval doesn't need to search tables.
+// Resolved lambdas get a 4th term, the vector of slot names for their frame,
+// and a 5th, whether calls can reuse frames (nothing in the body makes a lambda).
+// Anything not bound by an enclosing lambda is global and is still looked up by name.
+typedef struct Scope
+{
+    Lisp names;
+    struct Scope* parent;
+    // a lambda inside may keep the frame.
+    int captured;
+} Scope;
+
+static int is_same_(Lisp a, Lisp b) { return lisp_type(a) == lisp_type(b) && a.val.int_val == b.val.int_val; }
+
+static int list_contains_(Lisp l, Lisp x)
+{
+    while (lisp_is_pair(l))
+    {
+        if (lisp_eq(lisp_car(l), x)) return 1;
+        l = lisp_cdr(l);
+    }
+    return 0;
+}
+
+// find every name defined in a lambda body, excluding nested lambdas.
+static Lisp collect_defines_r(Lisp x, Lisp names, LispContext ctx)
+{
+    if (!lisp_is_pair(x)) return names;
+
+    Lisp op = lisp_car(x);
+    if (lisp_type(op) == LISP_SYMBOL)
+    {
+        if (lisp_eq(op, get_sym(SYM_QUOTE, ctx)) || lisp_eq(op, get_sym(SYM_LAMBDA, ctx))) return names;
+
+        if (lisp_eq(op, get_sym(SYM_DEFINE, ctx)))
+        {
+            Lisp symbol = lisp_list_ref(x, 1);
+            if (lisp_type(symbol) == LISP_SYMBOL && !list_contains_(names, symbol))
+                names = lisp_cons(symbol, names, ctx);
+        }
+    }
+
+    while (lisp_is_pair(x))
+    {
+        names = collect_defines_r(lisp_car(x), names, ctx);
+        x = lisp_cdr(x);
+    }
+    return names;
+}
+
+static Lisp frame_names_(Lisp args, Lisp body, LispContext ctx)
+{
+    Lisp names = lisp_null();
+    while (lisp_is_pair(args))
+    {
+        names = lisp_cons(lisp_car(args), names, ctx);
+        args = lisp_cdr(args);
+    }
+    // variable length arguments
+    if (lisp_type(args) == LISP_SYMBOL) names = lisp_cons(args, names, ctx);
+
+    names = lisp_list_reverse(collect_defines_r(body, names, ctx));
+
+    int n = lisp_list_length(names);
+    Lisp v = lisp_make_vector(n, ctx);
+    for (int i = 0; i < n; ++i)
+    {
+        lisp_vector_set(v, i, lisp_car(names));
+        names = lisp_cdr(names);
+    }
+    return v;
+}
+
+static Lisp resolve_r(Lisp x, Scope* scope, LispContext ctx);
+
+// copies only if something changes, so resolving code twice is free.
+static Lisp resolve_list_(Lisp l, Scope* scope, LispContext ctx)
+{
+    Lisp copy = lisp_null();
+    int changed = 0;
+
+    Lisp it = l;
+    while (lisp_is_pair(it))
+    {
+        Lisp y = resolve_r(lisp_car(it), scope, ctx);
+        if (!changed && !is_same_(y, lisp_car(it)))
+        {
+            for (Lisp jt = l; !is_same_(jt, it); jt = lisp_cdr(jt))
+                copy = lisp_cons(lisp_car(jt), copy, ctx);
+            changed = 1;
+        }
+        if (changed) copy = lisp_cons(y, copy, ctx);
+        it = lisp_cdr(it);
+    }
+    return changed ? lisp_list_reverse2(copy, it) : l;
+}
+
+static Lisp resolve_r(Lisp x, Scope* scope, LispContext ctx)
+{
+    switch (lisp_type(x))
+    {
+        case LISP_SYMBOL:
+        {
+            int depth = 0;
+            while (scope)
+            {
+                Lisp names = scope->names;
+                int n = lisp_vector_length(names);
+                for (int i = 0; i < n; ++i)
+                {
+                    if (lisp_eq(lisp_vector_ref(names, i), x)) return make_local_(depth, i + 1);
+                }
+                scope = scope->parent;
+                ++depth;
+            }
+            return make_global_ref_(x, depth, ctx);
+        }
+        case LISP_PAIR:
+        {
+            Lisp op = lisp_car(x);
+            if (lisp_type(op) == LISP_SYMBOL)
+            {
+                if (lisp_eq(op, get_sym(SYM_QUOTE, ctx)))
+                {
+                    return x;
+                }
+                else if (lisp_eq(op, get_sym(SYM_LAMBDA, ctx)))
+                {
+                    // the lambda's closure keeps every enclosing frame
+                    for (Scope* s = scope; s; s = s->parent) s->captured = 1;
+                    // already resolved
+                    if (lisp_list_length(x) != 3) return x;
+
+                    Lisp args = lisp_list_ref(x, 1);
+                    Lisp body = lisp_list_ref(x, 2);
+
+                    Scope inner = { frame_names_(args, body, ctx), scope, 0 };
+                    body = resolve_r(body, &inner, ctx);
+
+                    Lisp terms[] = { op, args, body, inner.names, lisp_make_bool(!inner.captured) };
+                    return lisp_make_list2(terms, 5, ctx);
+                }
+                else if (lisp_eq(op, get_sym(SYM_IF, ctx)) ||
+                         lisp_eq(op, get_sym(SYM_BEGIN, ctx)))
+                {
+                    // keep the special form symbol
+                    Lisp rest = resolve_list_(lisp_cdr(x), scope, ctx);
+                    return is_same_(rest, lisp_cdr(x)) ? x : lisp_cons(op, rest, ctx);
+                }
+                else if (lisp_eq(op, get_sym(SYM_DEFINE, ctx)) ||
+                         lisp_eq(op, get_sym(SYM_SET, ctx)))
+                {
+                    // a global being assigned stays a symbol
+                    Lisp target = lisp_list_ref(x, 1);
+                    Lisp resolved = resolve_r(target, scope, ctx);
+                    if (lisp_type(resolved) == LISP_GLOBAL) resolved = target;
+
+                    Lisp rest = resolve_list_(lisp_cdr(lisp_cdr(x)), scope, ctx);
+                    if (is_same_(resolved, target) && is_same_(rest, lisp_cdr(lisp_cdr(x)))) return x;
+                    return lisp_cons(op, lisp_cons(resolved, rest, ctx), ctx);
+                }
+            }
+            return resolve_list_(x, scope, ctx);
+        }
+        default:
+            return x;
+    }
+}
+
+Lisp lisp_make_lambda(Lisp args, Lisp body, Lisp env, LispContext ctx)
+{
+    // calls don't expand the body. One which fails to expand is kept, and fails when called.
+    LispError error;
+    Lisp expanded = lisp_macroexpand(body, &error, ctx);
+    if (error == LISP_ERROR_NONE) body = resolve_r(expanded, NULL, ctx);
+    return lambda_make_(args, body, env, lisp_null(), 0, ctx);
+}
+
+typedef struct
+{
+    int32_t* ops;
+    int length;
+    int capacity;
+    Lisp consts; // reversed
+    int const_count;
+} CodeBuilder;
+
+static void builder_init_(CodeBuilder* b)
+{
+    b->ops = NULL;
+    b->length = 0;
+    b->capacity = 0;
+    b->consts = lisp_null();
+    b->const_count = 0;
+}
+
+static void emit_(CodeBuilder* b, int32_t x)
+{
+    if (b->length == b->capacity)
+    {
+        b->capacity = b->capacity * 2 + 16;
+        b->ops = realloc(b->ops, sizeof(int32_t) * b->capacity);
+    }
+    b->ops[b->length++] = x;
+}
+
+static int32_t add_const_(CodeBuilder* b, Lisp x, LispContext ctx)
+{
+    b->consts = lisp_cons(x, b->consts, ctx);
+    return b->const_count++;
+}
+
+static Lisp builder_finish_(CodeBuilder* b, LispContext ctx)
+{
+    Lisp consts = lisp_make_vector(b->const_count, ctx);
+    Lisp it = b->consts;
+    for (int i = b->const_count - 1; i >= 0; --i)
+    {
+        lisp_vector_set(consts, i, lisp_car(it));
+        it = lisp_cdr(it);
+    }
+
+    Code* code = gc_alloc(sizeof(Code) + sizeof(int32_t) * b->length, LISP_CODE, ctx);
+    code->consts = consts.val;
+    code->length = b->length;
+    memcpy(code->ops, b->ops, sizeof(int32_t) * b->length);
+    free(b->ops);
+    return VAL_BLOCK_(code, LISP_CODE);
+}
+
+// compiles resolved code. code in tail position ends with a return or tail call.
+static void compile_r(CodeBuilder* b, Lisp x, int tail, LispContext ctx)
+{
+    switch (lisp_type(x))
+    {
+        case LISP_SYMBOL:
+        case LISP_GLOBAL:
+            emit_(b, OP_GLOBAL);
+            emit_(b, add_const_(b, x, ctx));
+            break;
+        case LISP_LOCAL:
+            emit_(b, OP_LOCAL);
+            emit_(b, local_depth_(x));
+            emit_(b, local_slot_(x));
+            break;
+        case LISP_PAIR:
+        {
+            Lisp op_sym = lisp_car(x);
+            int op_valid = lisp_type(op_sym) == LISP_SYMBOL;
+
+            if (lisp_eq(op_sym, get_sym(SYM_QUOTE, ctx)) && op_valid)
+            {
+                emit_(b, OP_CONST);
+                emit_(b, add_const_(b, lisp_list_ref(x, 1), ctx));
+            }
+            else if (lisp_eq(op_sym, get_sym(SYM_IF, ctx)) && op_valid)
+            {
+                compile_r(b, lisp_list_ref(x, 1), 0, ctx);
+                emit_(b, OP_JUMP_IF_FALSE);
+                int else_jump = b->length;
+                emit_(b, 0);
+
+                compile_r(b, lisp_list_ref(x, 2), tail, ctx);
+                // in tail position both branches return
+                int end_jump = -1;
+                if (!tail)
+                {
+                    emit_(b, OP_JUMP);
+                    end_jump = b->length;
+                    emit_(b, 0);
+                }
+
+                b->ops[else_jump] = b->length;
+                compile_r(b, lisp_list_ref(x, 3), tail, ctx);
+                if (!tail) b->ops[end_jump] = b->length;
+                return;
+            }
+            else if (lisp_eq(op_sym, get_sym(SYM_BEGIN, ctx)) && op_valid)
+            {
+                Lisp it = lisp_cdr(x);
+                if (lisp_is_null(it))
+                {
+                    emit_(b, OP_CONST);
+                    emit_(b, add_const_(b, lisp_null(), ctx));
+                }
+                else
+                {
+                    while (lisp_is_pair(lisp_cdr(it)))
+                    {
+                        compile_r(b, lisp_car(it), 0, ctx);
+                        emit_(b, OP_POP);
+                        it = lisp_cdr(it);
+                    }
+                    compile_r(b, lisp_car(it), tail, ctx);
+                    return;
+                }
+            }
+            else if ((lisp_eq(op_sym, get_sym(SYM_DEFINE, ctx)) || lisp_eq(op_sym, get_sym(SYM_SET, ctx))) && op_valid)
+            {
+                Lisp symbol = lisp_list_ref(x, 1);
+                compile_r(b, lisp_list_ref(x, 2), 0, ctx);
+                if (lisp_type(symbol) == LISP_LOCAL)
+                {
+                    emit_(b, OP_SET_LOCAL);
+                    emit_(b, local_depth_(symbol));
+                    emit_(b, local_slot_(symbol));
+                }
+                else
+                {
+                    emit_(b, lisp_eq(op_sym, get_sym(SYM_DEFINE, ctx)) ? OP_DEF_GLOBAL : OP_SET_GLOBAL);
+                    emit_(b, add_const_(b, symbol, ctx));
+                }
+            }
+            else if (lisp_eq(op_sym, get_sym(SYM_LAMBDA, ctx)) && op_valid)
+            {
+                CodeBuilder body;
+                builder_init_(&body);
+                compile_r(&body, lisp_list_ref(x, 2), 1, ctx);
+
+                int32_t k = add_const_(b, lisp_list_ref(x, 1), ctx);
+                add_const_(b, builder_finish_(&body, ctx), ctx);
+                add_const_(b, lisp_list_ref(x, 3), ctx);
+                add_const_(b, lisp_list_ref(x, 4), ctx);
+                emit_(b, OP_LAMBDA);
+                emit_(b, k);
+            }
+            else
+            {
+                // operator application
+                int argc = -1;
+                Lisp it = x;
+                while (lisp_is_pair(it))
+                {
+                    compile_r(b, lisp_car(it), 0, ctx);
+                    it = lisp_cdr(it);
+                    ++argc;
+                }
+                emit_(b, tail ? OP_TAIL_CALL : OP_CALL);
+                emit_(b, argc);
+                return;
+            }
+            break;
+        }
+        default:
+            // atom
+            emit_(b, OP_CONST);
+            emit_(b, add_const_(b, x, ctx));
+            break;
+    }
+
+    if (tail) emit_(b, OP_RETURN);
+}
+
+Lisp lisp_compile(Lisp expr, LispError* out_error, LispContext ctx)
+{
+    LispError error;
+    Lisp expanded = lisp_macroexpand(expr, &error, ctx);
+    if (out_error) *out_error = error;
+    if (error != LISP_ERROR_NONE) return lisp_null();
+
+    CodeBuilder b;
+    builder_init_(&b);
+    compile_r(&b, resolve_r(expanded, NULL, ctx), 1, ctx);
+    return builder_finish_(&b, ctx);
+}
+
+// evaluates code which has already been expanded and resolved,
+// such as lambda bodies.
+// owns_env is whether env is a pooled frame (see frame_acquire_).
+static Lisp eval_expanded_(Lisp expanded, Lisp env, int owns_env, LispError* out_error, LispContext ctx)
+{
+    LispError error;
+    size_t save_stack = ctx.p->stack_ptr;
+    int save_profile = profile_depth_(ctx);
+    
+    jmp_buf error_jmp;
+    error = setjmp(error_jmp);
+
+    if (error == LISP_ERROR_NONE)
+    {
+        // saved on the stack, where the collector can move it.
+        lisp_stack_push(ctx.p->output_port, ctx);
+        lisp_stack_push(env, ctx);
+        lisp_stack_push(expanded, ctx);
+        
+        Lisp result = eval_owned_r_(error_jmp, owns_env, ctx);
+        
+        lisp_stack_pop(ctx);
+        lisp_stack_pop(ctx);
+        lisp_stack_pop(ctx);
+
+        if (out_error)
+        {
+            *out_error = error;
+        }
+
+        return result; 
+    }
+    else
+    {
+        ctx.p->output_port = ctx.p->stack[save_stack];
+        if (ctx.p->profile)
+        {
+            ctx.p->profile->pending = -1;
+            profile_unwind_(save_profile, ctx);
+        }
+        if (out_error)
+        {
+            ctx.p->stack_ptr = save_stack;
+            *out_error = error;
+        }
+
+        return lisp_null();
+    }
+}
+
+Lisp lisp_eval2(Lisp l, Lisp env, LispError* out_error, LispContext ctx)
+{
+    LispError error;
+    Lisp expanded = lisp_macroexpand(l, &error, ctx);
+    
+    if (error != LISP_ERROR_NONE)
+    {
+        if (out_error) *out_error = error;
+        return lisp_null();
+    }
+
+    return eval_expanded_(resolve_r(expanded, NULL, ctx), env, 0, out_error, ctx);
+}
+
+// copies the parts of a form which can be modified.
+static Lisp form_copy_r_(Lisp x, LispContext ctx)
+{
+    switch (lisp_type(x))
+    {
+        case LISP_PAIR:
+        {
+            Lisp head = lisp_cons(form_copy_r_(lisp_car(x), ctx), lisp_null(), ctx);
+            Lisp tail = head;
+            for (x = lisp_cdr(x); lisp_is_pair(x); x = lisp_cdr(x))
+            {
+                Lisp next = lisp_cons(form_copy_r_(lisp_car(x), ctx), lisp_null(), ctx);
+                lisp_set_cdr(tail, next);
+                tail = next;
+            }
+            lisp_set_cdr(tail, form_copy_r_(x, ctx));
+            return head;
+        }
+        case LISP_VECTOR:
+        {
+            int n = lisp_vector_length(x);
+            Lisp v = lisp_make_vector(n, ctx);
+            for (int i = 0; i < n; ++i) lisp_vector_set(v, i, form_copy_r_(lisp_vector_ref(x, i), ctx));
+            return v;
+        }
+        case LISP_STRING:
+            return lisp_substring(x, 0, lisp_string_length(x), ctx);
+        case LISP_F64VECTOR:
+        {
+            int n = lisp_f64vector_length(x);
+            Lisp v = lisp_make_f64vector(n, ctx);
+            memcpy(lisp_f64vector(v), lisp_f64vector(x), sizeof(LispReal) * n);
+            return v;
+        }
+        case LISP_S64VECTOR:
+        {
+            int n = lisp_s64vector_length(x);
+            Lisp v = lisp_make_s64vector(n, ctx);
+            memcpy(lisp_s64vector(v), lisp_s64vector(x), sizeof(LispInt) * n);
+            return v;
+        }
+        default:
+            return x;
+    }
+}
+
+Lisp lisp_eval_cached(Lisp expr, Lisp env, LispError* out_error, LispContext ctx)
+{
+    // atoms are cheap to expand
+    if (!lisp_is_pair(expr)) return lisp_eval2(expr, env, out_error, ctx);
+
+    // entries are (copy of form . expansion)
+    int present = 0;
+    Lisp expanded = lisp_null();
+    if (!lisp_is_null(ctx.p->expand_cache))
+    {
+        Lisp entry = lisp_table_get(ctx.p->expand_cache, expr, &present);
+        // the form was changed since it was expanded
+        if (present && !lisp_equal_r(lisp_car(entry), expr)) present = 0;
+        if (present) expanded = lisp_cdr(entry);
+    }
+
+    if (!present)
+    {
+        LispError error;
+        expanded = lisp_macroexpand(expr, &error, ctx);
+        if (error != LISP_ERROR_NONE)
+        {
+            if (out_error) *out_error = error;
+            return lisp_null();
+        }
+        expanded = resolve_r(expanded, NULL, ctx);
+
+        // expansion may have defined a macro, which clears the cache.
+        if (lisp_is_null(ctx.p->expand_cache)) ctx.p->expand_cache = lisp_make_table(ctx);
+        lisp_table_set(ctx.p->expand_cache, expr, lisp_cons(form_copy_r_(expr, ctx), expanded, ctx), ctx);
+    }
+    return eval_expanded_(expanded, env, 0, out_error, ctx);
+}
+
+Lisp lisp_eval(Lisp expr, LispError* out_error, LispContext ctx)
+{
+    return lisp_eval2(expr, lisp_env(ctx), out_error, ctx);
+}
+
+Lisp lisp_apply(Lisp operator, Lisp args, LispError* out_error, LispContext ctx)
+{
+    // TODO: argument passing is a little more sophisitaed
+    // No environment required. procedures always bring their own enviornment
+    // to the call.
+    Lisp x;
+    Lisp env;
+    int needs_to_eval = apply(operator, args, &x, &env, out_error, ctx);
+    if (*out_error != LISP_ERROR_NONE) return lisp_false();
+    if (needs_to_eval && ctx.p->profile) ctx.p->profile->pending = profile_entry_(operator, ctx.p->profile);
+    // lambda bodies are expanded when the lambda is made.
+    return needs_to_eval ? eval_expanded_(x, env, lambda_reuses_frame_(operator), out_error, ctx) : x;
+}
+
+Lisp lisp_apply_argv(Lisp operator, int argc, Lisp* argv, LispError* out_error, LispContext ctx)
+{
+    Lisp x;
+    Lisp env;
+    *out_error = LISP_ERROR_NONE;
+    int needs_to_eval = apply_argv_(operator, argv, argc, &x, &env, out_error, ctx);
+    if (*out_error != LISP_ERROR_NONE) return lisp_false();
+    if (needs_to_eval && ctx.p->profile) ctx.p->profile->pending = profile_entry_(operator, ctx.p->profile);
+    return needs_to_eval ? eval_expanded_(x, env, lambda_reuses_frame_(operator), out_error, ctx) : x;
+}
+
+#ifdef LISP_GC_THREADS_
+
+// Parallel collection (see lisp_set_gc_threads).
+// Each thread copies into a heap of its own, and scans the copies it makes
+// from a stack of grey blocks, instead of with a Cheney scan.
+// Threads with spare grey blocks publish chunks of them for idle threads to take.
+#define GC_CHUNK_SIZE_ 256
+
+typedef struct GCChunk
+{
+    struct GCChunk* next;
+    size_t count;
+    Block* blocks[GC_CHUNK_SIZE_];
+} GCChunk;
+
+typedef struct
+{
+    struct GCParallel* parallel;
+    pthread_t thread;
+    Heap heap;
+    // copied or marked blocks which haven't been scanned
+    Block** grey;
+    size_t grey_count;
+    size_t grey_capacity;
+    // tables which need rehashing once everything has moved
+    Block** rehash;
+    size_t rehash_count;
+    size_t rehash_capacity;
+    size_t bytes_copied;
+    size_t live_count[LISP_TYPE_COUNT];
+    size_t live_bytes[LISP_TYPE_COUNT];
+} GCWorker;
+
+typedef struct GCParallel
+{
+    LispContext ctx;
+    GCWorker* workers;
+    int worker_count;
+
+    pthread_mutex_t lock;
+    pthread_cond_t wake;
+    GCChunk* chunks;
+    // threads waiting for a chunk. Read without the lock to decide whether to publish one.
+    int idle;
+    int done;
+} GCParallel;
+
+// the worker of the collection this thread is helping with.
+static __thread GCWorker* gc_worker_;
+
+static void gc_worker_push_(GCWorker* w, Block* block)
+{
+    if (w->grey_count == w->grey_capacity)
+    {
+        w->grey_capacity = w->grey_capacity * 2 + 1024;
+        w->grey = realloc(w->grey, w->grey_capacity * sizeof(Block*));
+    }
+    w->grey[w->grey_count++] = block;
+}
+
+static void gc_worker_defer_rehash_(GCWorker* w, Block* table)
+{
+    if (w->rehash_count == w->rehash_capacity)
+    {
+        w->rehash_capacity = w->rehash_capacity * 2 + 16;
+        w->rehash = realloc(w->rehash, w->rehash_capacity * sizeof(Block*));
+    }
+    w->rehash[w->rehash_count++] = table;
+}
+
+// gc_move for parallel collections.
+// A block is claimed by switching it from GC_CLEAR to GC_COPYING,
+// and the forwarding address is published by switching it to GC_GONE.
+static Lisp gc_move_parallel_(Lisp x, LispContext ctx)
+{
+    switch (lisp_type(x))
+    {
+        case LISP_PAIR:
+        case LISP_STRING:
+        case LISP_LAMBDA:
+        case LISP_VECTOR:
+        case LISP_PROMISE:
+        case LISP_TABLE:
+        case LISP_SYMBOL:
+        case LISP_CODE:
+        case LISP_JUMP:
+        case LISP_FUNC_N:
+        case LISP_PORT:
+        case LISP_GLOBAL:
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
+        {
+            GCWorker* w = gc_worker_;
+            Block* block = x.val.ptr_val;
+            if (block->gen & GEN_FIXED)
+            {
+                if (ctx.p->gc_sweep_symbols && !ctx.p->gc_minor)
+                    __atomic_store_n(&block->gc_state, GC_MARKED, __ATOMIC_RELAXED);
+                return x;
+            }
+            if (ctx.p->gc_minor && (block->gen & GEN_OLD)) return x;
+
+            uint8_t state = GC_CLEAR;
+            if (block->gen & GEN_LARGE)
+            {
+                if (__atomic_compare_exchange_n(&block->gc_state, &state, GC_MARKED, 0, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+                {
+                    ++w->live_count[block->type];
+                    w->live_bytes[block->type] += block->info.size;
+                    gc_worker_push_(w, block);
+                }
+                return x;
+            }
+
+            if (__atomic_compare_exchange_n(&block->gc_state, &state, GC_COPYING, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+            {
+                size_t size = block->info.size;
+                Block* dest = heap_alloc(size, block->type, &w->heap);
+                memcpy(dest, block, size);
+                dest->gc_state = GC_CLEAR;
+                dest->gen = w->heap.gen;
+                w->bytes_copied += size;
+                ++w->live_count[block->type];
+                w->live_bytes[block->type] += size;
+                gc_worker_push_(w, dest);
+
+                block->info.forward = dest;
+                __atomic_store_n(&block->gc_state, GC_GONE, __ATOMIC_RELEASE);
+                x.val.ptr_val = dest;
+                return x;
+            }
+
+            // another thread has it.
+            while (state != GC_GONE) state = __atomic_load_n(&block->gc_state, __ATOMIC_ACQUIRE);
+            x.val.ptr_val = block->info.forward;
+            return x;
+        }
+        default:
+            return x;
+    }
+}
+
+#endif
+
+static Lisp gc_move(Lisp x, LispContext ctx)
+{
+#ifdef LISP_GC_THREADS_
+    if (ctx.p->gc_parallel) return gc_move_parallel_(x, ctx);
+#endif
+    switch (lisp_type(x))
+    {
+        case LISP_PAIR:
+        case LISP_STRING:
+        case LISP_LAMBDA:
+        case LISP_VECTOR:
+        case LISP_PROMISE:
+        case LISP_TABLE:
+        case LISP_SYMBOL:
+        case LISP_CODE:
+        case LISP_JUMP:
+        case LISP_FUNC_N:
+        case LISP_PORT:
+        case LISP_GLOBAL:
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
+        {
+            Block* block = x.val.ptr_val;
+            if (block->gen & GEN_FIXED)
+            {
+                if (ctx.p->gc_sweep_symbols && !ctx.p->gc_minor) block->gc_state = GC_MARKED;
+                return x;
+            }
+            // minor collections leave the old generation in place
+            if (ctx.p->gc_minor && (block->gen & GEN_OLD)) return x;
+
+            if (block->gen & GEN_LARGE)
+            {
+                // left in place, and scanned by gc_scan_ once.
+                if (block->gc_state == GC_CLEAR)
+                {
+                    Page* page = page_of_(block);
+                    page->pending = ctx.p->gc_large_pending;
+                    ctx.p->gc_large_pending = page;
+                    block->gc_state = GC_MARKED;
+                    ++ctx.p->gc_stats.live_count[block->type];
+                    ctx.p->gc_stats.live_bytes[block->type] += block->info.size;
+                }
+                return x;
+            }
+
+            if (block->gc_state == GC_CLEAR)
+            {
+                // copy the data to new block
+                Block* dest = heap_alloc(block->info.size, block->type, &ctx.p->heap);
+                memcpy(dest, block, block->info.size);
+                dest->gc_state = GC_NEED_VISIT;
+                // everything copied ends up in the old generation.
+                LispGCStats* stats = &ctx.p->gc_stats;
+                stats->bytes_copied += block->info.size;
+                ++stats->live_count[block->type];
+                stats->live_bytes[block->type] += block->info.size;
+                dest->gen = ctx.p->heap.gen;
+                
+                // save forwarding address (offset in to)
+                block->info.forward = dest;
+                block->gc_state = GC_GONE;
+            }
+
+            assert(block->gc_state == GC_GONE);
+            
+            // return the moved block address
+            x.val.ptr_val = block->info.forward;
+            return x;
+        }
+        default:
+            return x;
+    }
+}
+
+static LispVal gc_move_val(LispVal val, LispType type, LispContext ctx)
+{
+    return gc_move(VAL_(val, type), ctx).val;
+}
+
+static void gc_move_v(Lisp* start, int n, LispContext ctx)
+{
+    for (int i = 0; i < n; ++i) start[i] = gc_move(start[i], ctx);
+}
+
+// Frees interned symbols which weren't marked in a full collection.
+static void gc_sweep_symbols_(LispContext ctx)
+{
+    size_t live = 0;
+    for (size_t i = 0; i < ctx.p->symbol_bucket_count; ++i)
+    {
+        Symbol** link = ctx.p->symbol_buckets + i;
+        while (*link)
+        {
+            Symbol* symbol = *link;
+            if (symbol->block.gc_state == GC_MARKED)
+            {
+                symbol->block.gc_state = GC_CLEAR;
+                link = (Symbol**)&symbol->next.ptr_val;
+                ++live;
+            }
+            else
+            {
+                *link = symbol->next.ptr_val;
+                symbol_free_(symbol, ctx);
+            }
+        }
+    }
+    ctx.p->symbol_count = live;
+}
+
+// move everything a block references
+static void gc_scan_block_(Block* block, LispContext ctx)
+{
+    switch (block->type)
+    {
+        // these add &to the buffer!
+        // so lists are handled in a single pass
+        case LISP_PAIR:
+        {
+            // move the CAR and CDR
+            Pair* p = (Pair*)block;
+            p->car = gc_move_val(p->car, p->block.d.pair.car_type, ctx);
+            p->cdr = gc_move_val(p->cdr, p->block.d.pair.cdr_type, ctx);
+            break;
+        }
+        case LISP_VECTOR:
+        {
+            Lisp vector = VAL_BLOCK_(block, LISP_VECTOR);
+
+            Vector* v = (Vector*)block;
+            int n = vector_len_(v);
+            for (int i = 0; i < n; ++i)
+                v->entries[i] = gc_move(lisp_vector_ref(vector, i), ctx).val;
+            break;
+        }
+        case LISP_LAMBDA:
+        {
+            // move the body and args
+            Lambda* l = (Lambda*)block;
+            l->args = gc_move_val(l->args, (LispType)l->block.d.lambda.args_type, ctx);
+            l->body = gc_move_val(l->body, (LispType)l->block.d.lambda.body_type, ctx);
+            l->env = gc_move_val(l->env, l->env.ptr_val == NULL ? LISP_NULL : LISP_PAIR, ctx);
+            l->names = gc_move_val(l->names, l->names.ptr_val == NULL ? LISP_NULL : LISP_VECTOR, ctx);
+            l->name = gc_move_val(l->name, l->name.ptr_val == NULL ? LISP_NULL : LISP_SYMBOL, ctx);
+            break;
+        }
+        case LISP_CODE:
+        {
+            Code* c = (Code*)block;
+            c->consts = gc_move_val(c->consts, LISP_VECTOR, ctx);
+            break;
+        }
+        case LISP_GLOBAL:
+        {
+            GlobalRef* g = (GlobalRef*)block;
+            g->symbol = gc_move_val(g->symbol, LISP_SYMBOL, ctx);
+            g->tail = gc_move_val(g->tail, g->tail.ptr_val == NULL ? LISP_NULL : LISP_PAIR, ctx);
+            g->table = gc_move_val(g->table, g->table.ptr_val == NULL ? LISP_NULL : LISP_TABLE, ctx);
+            break;
+        }
+        case LISP_PORT:
+        {
+            Port* p = (Port*)block;
+            p->buffer = gc_move_val(p->buffer, LISP_STRING, ctx);
+            break;
+        }
+        case LISP_PROMISE:
+        {
+            Promise* p = (Promise*)block;
+            p->val_or_proc = gc_move_val(p->val_or_proc, (LispType)p->block.d.promise.type, ctx);
+            break;
+        }
+        case LISP_JUMP:
+        {
+            // the jmp_buf can be copied. call/cc finds the jump on the stack.
+            Jump* j = (Jump*)block;
+            j->result = gc_move(j->result, ctx);
+            break;
+        }
+        case LISP_TABLE:
+        {
+            // During garbage collection pointers change, so if a block hashed by its address
+            // is used as a key, it is no longer in the correct place in the hash table.
+            // So we have to move it to a new place during garbage collection.
+            // Most keys hash their contents instead (see table_hash_),
+            // so the table's vectors are just copied.
+            Lisp table = VAL_BLOCK_(block, LISP_TABLE);
+
+            Table* t = (Table*)block;
+            int n = t->capacity;
+            if (n == 0) break;
+
+            Lisp keys = VAL_(t->keys, LISP_VECTOR);
+            Lisp vals = VAL_(t->vals, LISP_VECTOR);
+
+            // Only keys hashed by address need it.
+            int needs_rehash = 0;
+            for (int i = 0; i < n && t->moving_keys > 0 && !needs_rehash; ++i)
+            {
+                Lisp key = lisp_vector_ref(keys, i); 
+                if (!lisp_is_null(key) && table_key_moves_(t, key) && !lisp_eq(gc_move(key, ctx), key)) needs_rehash = 1;
+            }
+
+            if (needs_rehash || ctx.p->gc_minor)
+            {
+                // move all the values, but borrow the old table for now.
+                // (In a minor collection old vectors aren't scanned, the table is remembered instead.)
+                for (int i = 0; i < n; ++i)
+                {
+                    Lisp key = lisp_vector_ref(keys, i); 
+                    if (!lisp_is_null(key))
+                    {
+                        vector_set_(vector_get_(keys), i, gc_move(key, ctx));
+                        vector_set_(vector_get_(vals), i, gc_move(lisp_vector_ref(vals, i), ctx));
+                    }
+                }
+            }
+
+            if (needs_rehash)
+            {
+#ifdef LISP_GC_THREADS_
+                // other threads are still moving blocks.
+                if (ctx.p->gc_parallel)
+                {
+                    gc_worker_defer_rehash_(gc_worker_, block);
+                    break;
+                }
+#endif
+                // create new table and move the values in place.
+                table_grow_(table, n, ctx);
+            }
+            else
+            {
+                // in a full collection the vectors are copied, then scanned like any other.
+                t->keys = gc_move_val(t->keys, LISP_VECTOR, ctx);
+                t->vals = gc_move_val(t->vals, LISP_VECTOR, ctx);
+            }
+            break;
+         }
+        default: break;
+    }
+}
+
+// Cheney scan. Pages are in allocation order,
+// so blocks copied during the scan are visited too.
+// Marked large blocks are scanned when it catches up.
+static void gc_scan_(Page* page, size_t offset, LispContext ctx)
+{
+    while (1)
+    {
+        while (offset < page->size)
+        {
+            Block* block = (Block*)(page->buffer + offset);
+            if (block->gc_state == GC_NEED_VISIT)
+            {
+                gc_scan_block_(block, ctx);
+                block->gc_state = GC_CLEAR;
+            }
+            offset += block->info.size;
+        }
+
+        if (page->next)
+        {
+            page = page->next;
+            offset = 0;
+        }
+        else if (ctx.p->gc_large_pending)
+        {
+            Page* large = ctx.p->gc_large_pending;
+            ctx.p->gc_large_pending = large->pending;
+            large->pending = NULL;
+            gc_scan_block_((Block*)large->buffer, ctx);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+// Moves the marked large blocks of from into to, and frees the rest.
+static void gc_sweep_large_(Heap* from, Heap* to)
+{
+    Page* page = from->large;
+    while (page)
+    {
+        Page* next = page->next;
+        Block* block = (Block*)page->buffer;
+        if (block->gc_state == GC_MARKED)
+        {
+            block->gc_state = GC_CLEAR;
+            block->gen = to->gen | GEN_LARGE;
+            page->dirty = 0;
+            page->next = to->large;
+            to->large = page;
+            to->size += page->size;
+            ++to->page_count;
+        }
+        else
+        {
+            page_destroy(page);
+        }
+        page = next;
+    }
+    from->large = NULL;
+}
+
+#ifdef LISP_GC_THREADS_
+
+// moves the bottom of w's stack, the blocks waiting longest, into a chunk for idle threads.
+static void gc_worker_share_(GCWorker* w)
+{
+    GCParallel* p = w->parallel;
+    GCChunk* chunk = malloc(sizeof(GCChunk));
+    chunk->count = GC_CHUNK_SIZE_;
+    memcpy(chunk->blocks, w->grey, sizeof(chunk->blocks));
+    w->grey_count -= GC_CHUNK_SIZE_;
+    memmove(w->grey, w->grey + GC_CHUNK_SIZE_, w->grey_count * sizeof(Block*));
+
+    pthread_mutex_lock(&p->lock);
+    chunk->next = p->chunks;
+    p->chunks = chunk;
+    pthread_cond_signal(&p->wake);
+    pthread_mutex_unlock(&p->lock);
+}
+
+// waits for a chunk. Returns 0 once every thread is waiting, so nothing is left to scan.
+static int gc_worker_take_(GCWorker* w)
+{
+    GCParallel* p = w->parallel;
+    pthread_mutex_lock(&p->lock);
+    __atomic_add_fetch(&p->idle, 1, __ATOMIC_RELAXED);
+    while (!p->chunks && !p->done)
+    {
+        if (__atomic_load_n(&p->idle, __ATOMIC_RELAXED) == p->worker_count)
+        {
+            p->done = 1;
+            pthread_cond_broadcast(&p->wake);
+        }
+        else
+        {
+            pthread_cond_wait(&p->wake, &p->lock);
+        }
+    }
+
+    GCChunk* chunk = p->chunks;
+    if (chunk)
+    {
+        p->chunks = chunk->next;
+        __atomic_sub_fetch(&p->idle, 1, __ATOMIC_RELAXED);
+    }
+    pthread_mutex_unlock(&p->lock);
+    if (!chunk) return 0;
+
+    for (size_t i = 0; i < chunk->count; ++i) gc_worker_push_(w, chunk->blocks[i]);
+    free(chunk);
+    return 1;
+}
+
+static void gc_worker_run_(GCWorker* w)
+{
+    LispContext ctx = w->parallel->ctx;
+    do
+    {
+        while (w->grey_count > 0)
+        {
+            gc_scan_block_(w->grey[--w->grey_count], ctx);
+            if (w->grey_count >= 2 * GC_CHUNK_SIZE_ && __atomic_load_n(&w->parallel->idle, __ATOMIC_RELAXED) > 0)
+                gc_worker_share_(w);
+        }
+    } while (gc_worker_take_(w));
+}
+
+static void* gc_worker_main_(void* arg)
+{
+    gc_worker_ = arg;
+    gc_worker_run_(gc_worker_);
+    return NULL;
+}
+
+// Starts a parallel collection into ctx.p->heap,
+// if size bytes are being collected and that is enough to be worth the threads.
+// The calling thread is the first worker, and moves the roots.
+static int gc_parallel_begin_(size_t size, LispContext ctx)
+{
+    int n = ctx.p->gc_threads;
+    if (n < 2 || size < LISP_GC_PARALLEL_SIZE) return 0;
+
+    GCParallel* p = malloc(sizeof(GCParallel));
+    p->ctx = ctx;
+    p->workers = calloc((size_t)n, sizeof(GCWorker));
+    p->worker_count = 1;
+    p->chunks = NULL;
+    p->idle = 0;
+    p->done = 0;
+    pthread_mutex_init(&p->lock, NULL);
+    pthread_cond_init(&p->wake, NULL);
+
+    for (int i = 0; i < n; ++i)
+    {
+        GCWorker* w = p->workers + i;
+        w->parallel = p;
+        if (i == 0) w->heap = ctx.p->heap;
+        // only the calling thread uses the page pool.
+        else heap_init(&w->heap, ctx.p->heap.gen, NULL);
+    }
+    gc_worker_ = p->workers;
+    ctx.p->gc_parallel = p;
+    return 1;
+}
+
+static void gc_parallel_push_(Block* block) { gc_worker_push_(gc_worker_, block); }
+
+// Scans everything reachable from the pushed blocks,
+// then gathers the threads' heaps into ctx.p->heap.
+static void gc_parallel_trace_(LispContext ctx)
+{
+    GCParallel* p = ctx.p->gc_parallel;
+    int n = ctx.p->gc_threads;
+
+    // workers wait for the lock before counting who is idle.
+    pthread_mutex_lock(&p->lock);
+    for (int i = 1; i < n; ++i)
+    {
+        if (pthread_create(&p->workers[i].thread, NULL, gc_worker_main_, p->workers + i) != 0) break;
+        ++p->worker_count;
+    }
+    pthread_mutex_unlock(&p->lock);
+
+    gc_worker_run_(p->workers);
+    for (int i = 1; i < p->worker_count; ++i) pthread_join(p->workers[i].thread, NULL);
+    ctx.p->gc_parallel = NULL;
+    gc_worker_ = NULL;
+
+    Heap* heap = &ctx.p->heap;
+    *heap = p->workers[0].heap;
+    LispGCStats* stats = &ctx.p->gc_stats;
+    for (int i = 0; i < n; ++i)
+    {
+        GCWorker* w = p->workers + i;
+        if (i > 0 && w->heap.size == 0)
+        {
+            heap_shutdown(&w->heap);
+        }
+        else if (i > 0)
+        {
+            heap->last->next = w->heap.bottom;
+            heap->last = w->heap.last;
+            heap->top = w->heap.top;
+            heap->size += w->heap.size;
+            heap->page_count += w->heap.page_count;
+        }
+
+        stats->bytes_copied += w->bytes_copied;
+        for (int t = 0; t < LISP_TYPE_COUNT; ++t)
+        {
+            stats->live_count[t] += w->live_count[t];
+            stats->live_bytes[t] += w->live_bytes[t];
+        }
+        free(w->grey);
+    }
+
+    // now the keys have moved, and tables can allocate in the heap.
+    for (int i = 0; i < n; ++i)
+    {
+        GCWorker* w = p->workers + i;
+        for (size_t j = 0; j < w->rehash_count; ++j)
+            table_grow_(VAL_BLOCK_(w->rehash[j], LISP_TABLE), ((Table*)w->rehash[j])->capacity, ctx);
+        free(w->rehash);
+    }
+
+    pthread_mutex_destroy(&p->lock);
+    pthread_cond_destroy(&p->wake);
+    free(p->workers);
+    free(p);
+}
+
+#else
+
+static int gc_parallel_begin_(size_t size, LispContext ctx) { (void)size; (void)ctx; return 0; }
+static void gc_parallel_push_(Block* block) { (void)block; }
+static void gc_parallel_trace_(LispContext ctx) { (void)ctx; }
+
+#endif
+
+static Lisp gc_move_roots_(Lisp root_to_save, LispContext ctx)
+{
+    ctx.p->env = gc_move(ctx.p->env, ctx);
+    ctx.p->macros = gc_move(ctx.p->macros, ctx);
+    ctx.p->expand_cache = gc_move(ctx.p->expand_cache, ctx);
+    ctx.p->output_port = gc_move(ctx.p->output_port, ctx);
+
+    gc_move_v(ctx.p->symbol_cache, SYM_COUNT, ctx);
+    gc_move_v(ctx.p->stack, ctx.p->stack_ptr, ctx);
+    // free handles are null
+    gc_move_v(ctx.p->handles, ctx.p->handle_capacity, ctx);
+
+    return gc_move(root_to_save, ctx);
+}
+
+// next full collection when the old generation grows by the growth factor
+static void gc_set_full_threshold_(LispContext ctx)
+{
+    ctx.p->gc_full_threshold = (size_t)(ctx.p->gc_growth_factor * (double)ctx.p->old_heap.size);
+    if (ctx.p->gc_full_threshold < ctx.p->gc_initial_size) ctx.p->gc_full_threshold = ctx.p->gc_initial_size;
+}
+
+// Safe points only look at the young heap size.
+// Past this, automatic collection is due or the heap may be over its limit.
+static void gc_set_safepoint_size_(LispContext ctx)
+{
+    size_t size = ctx.p->gc_auto_threshold > 0 ? ctx.p->gc_auto_threshold : SIZE_MAX;
+    if (ctx.p->gc_max_size > 0)
+    {
+        size_t left = ctx.p->gc_max_size > ctx.p->old_heap.size ? ctx.p->gc_max_size - ctx.p->old_heap.size : 0;
+        if (left < size) size = left;
+    }
+    ctx.p->gc_safepoint_size = size;
+}
+
+// Copies the live young generation into the old one.
+// The roots into the young generation are the usual roots,
+// plus old blocks remembered by the write barrier. 
+static Lisp gc_collect_minor_(Lisp root_to_save, LispContext ctx)
+{
+    Heap young = ctx.p->heap;
+
+    // allocate in the old heap, starting where the scan begins.
+    ctx.p->heap = ctx.p->old_heap;
+    Page* scan_page = ctx.p->heap.top;
+    size_t scan_offset = scan_page->size;
+    ctx.p->gc_minor = 1;
+    int parallel = gc_parallel_begin_(young.size, ctx);
+
+    Lisp result = gc_move_roots_(root_to_save, ctx);
+
+    // remembered set
+    for (Page* page = ctx.p->heap.bottom; page; page = heap_next_page_(&ctx.p->heap, page))
+    {
+        if (!page->dirty) continue;
+
+        size_t offset = 0;
+        while (offset < page->size)
+        {
+            Block* block = (Block*)(page->buffer + offset);
+            if (block->gen & GEN_REMEMBERED)
+            {
+                block->gen &= ~GEN_REMEMBERED;
+                if (parallel) gc_parallel_push_(block);
+                else gc_scan_block_(block, ctx);
+            }
+            offset += block->info.size;
+        }
+        page->dirty = 0;
+    }
+
+    if (parallel) gc_parallel_trace_(ctx);
+    else gc_scan_(scan_page, scan_offset, ctx);
+    // promote the live large blocks without copying them.
+    gc_sweep_large_(&young, &ctx.p->heap);
+
+    ctx.p->gc_minor = 0;
+    ctx.p->old_heap = ctx.p->heap;
+    // everything live has been copied out
+    heap_reset_(&young);
+    ctx.p->heap = young;
+    return result;
+}
+
+static Lisp gc_collect_full_(Lisp root_to_save, LispContext ctx)
+{
+    Heap young = ctx.p->heap;
+    Heap old = ctx.p->old_heap;
+
+    // make new heap to allocate and copy to
+    heap_init(&ctx.p->heap, GEN_OLD, &ctx.p->page_pool);
+    memset(ctx.p->gc_stats.live_count, 0, sizeof(ctx.p->gc_stats.live_count));
+    memset(ctx.p->gc_stats.live_bytes, 0, sizeof(ctx.p->gc_stats.live_bytes));
+    // don't keep expansions of forms which are no longer evaluated.
+    ctx.p->expand_cache = lisp_null();
+    int parallel = gc_parallel_begin_(young.size + old.size, ctx);
+
+    Lisp result = gc_move_roots_(root_to_save, ctx);
+    if (parallel) gc_parallel_trace_(ctx);
+    else gc_scan_(ctx.p->heap.bottom, 0, ctx);
+    // large blocks allocated during the collection (rehashing tables) may have been marked too.
+    for (Page* page = ctx.p->heap.large; page; page = page->next)
+        ((Block*)page->buffer)->gc_state = GC_CLEAR;
+    gc_sweep_large_(&young, &ctx.p->heap);
+    gc_sweep_large_(&old, &ctx.p->heap);
+    // every reachable symbol has been marked.
+    if (ctx.p->gc_sweep_symbols) gc_sweep_symbols_(ctx);
+    
+#ifdef LISP_DEBUG
+     {
+          // DEBUG, check offsets
+          const Page* page = ctx.p->heap.bottom;
+          while (page)
+          {
+              size_t offset = 0;
+              while (offset < page->size)
+              {
+                  Block* block = (Block*)(page->buffer + offset);
+                  assert(block->gc_state == GC_CLEAR);
+                  assert(block->info.size <= page->size);
+                  assert(block->info.size % sizeof(LispVal) == 0);
+                  offset += block->info.size;
+              }
+              assert(offset == page->size);
+              page = page->next;
+          }
+    }
+#endif
+
+    ctx.p->old_heap = ctx.p->heap;
+    heap_shutdown(&young);
+    heap_shutdown(&old);
+    heap_init(&ctx.p->heap, young.gen, &ctx.p->page_pool);
+
+    gc_set_full_threshold_(ctx);
+    return result;
+}
+
+static Lisp gc_collect_(Lisp root_to_save, int full, LispContext ctx)
+{
+    uint64_t start_time = clock_ns_();
+    size_t start_size = ctx.p->heap.size + ctx.p->old_heap.size;
+    // pooled frames are garbage. the pool doesn't keep them.
+    memset(ctx.p->frame_pool_count, 0, sizeof(ctx.p->frame_pool_count));
+
+    Lisp result = full ? gc_collect_full_(root_to_save, ctx) : gc_collect_minor_(root_to_save, ctx);
+    
+    size_t end_size = ctx.p->old_heap.size;
+    uint64_t pause = (clock_ns_() - start_time) / 1000;
+    ctx.p->gc_stat_freed = start_size > end_size ? start_size - end_size : 0;
+    ctx.p->gc_stat_time = (size_t)pause;
+
+    LispGCStats* stats = &ctx.p->gc_stats;
+    ++stats->collections;
+    if (full) ++stats->full_collections;
+    stats->pause_total_us += pause;
+    if (pause > stats->pause_max_us) stats->pause_max_us = pause;
+    int bucket = 0;
+    while (bucket < LISP_GC_PAUSE_BUCKETS - 1 && pause >= ((uint64_t)1 << bucket)) ++bucket;
+    ++stats->pause_histogram[bucket];
+
+    // keep enough pages to copy what's live again and refill the young generation.
+    size_t keep = ctx.p->old_heap.size > ctx.p->gc_initial_size ? ctx.p->old_heap.size : ctx.p->gc_initial_size;
+    pool_trim_(&ctx.p->page_pool, (keep + ctx.p->gc_auto_threshold) / (LISP_PAGE_SIZE) + 2);
+    if (full) pool_cool_(&ctx.p->page_pool);
+    gc_set_safepoint_size_(ctx);
+    return result;
+}
+
+// counts the old generation, which was made without gc_move (by loading an image).
+static void gc_count_old_(LispContext ctx)
+{
+    LispGCStats* stats = &ctx.p->gc_stats;
+    memset(stats->live_count, 0, sizeof(stats->live_count));
+    memset(stats->live_bytes, 0, sizeof(stats->live_bytes));
+    for (const Page* page = ctx.p->old_heap.bottom; page; page = heap_next_page_(&ctx.p->old_heap, page))
+    {
+        size_t offset = 0;
+        while (offset < page->size)
+        {
+            const Block* block = (const Block*)(page->buffer + offset);
+            ++stats->live_count[block->type];
+            stats->live_bytes[block->type] += block->info.size;
+            offset += block->info.size;
+        }
+    }
+}
+
+Lisp lisp_collect(Lisp root_to_save, LispContext ctx)
+{
+    return gc_collect_(root_to_save, ctx.p->old_heap.size >= ctx.p->gc_full_threshold, ctx);
+}
+
+Lisp lisp_collect_full(Lisp root_to_save, LispContext ctx)
+{
+    return gc_collect_(root_to_save, 1, ctx);
+}
+
+void lisp_set_auto_collect(size_t young_size, LispContext ctx)
+{
+    ctx.p->gc_auto_threshold = young_size;
+    gc_set_safepoint_size_(ctx);
+}
+
+LispHeapPolicy lisp_heap_policy(LispContext ctx)
+{
+    LispHeapPolicy policy;
+    policy.initial_size = ctx.p->gc_initial_size;
+    policy.growth_factor = ctx.p->gc_growth_factor;
+    policy.collect_size = ctx.p->gc_auto_threshold;
+    policy.max_size = ctx.p->gc_max_size;
+    return policy;
+}
+
+void lisp_set_heap_policy(LispHeapPolicy policy, LispContext ctx)
+{
+    ctx.p->gc_initial_size = policy.initial_size;
+    ctx.p->gc_growth_factor = policy.growth_factor < 1.0 ? 1.0 : policy.growth_factor;
+    ctx.p->gc_auto_threshold = policy.collect_size;
+    ctx.p->gc_max_size = policy.max_size;
+
+    // have the initial pages ready
+    PagePool* pool = &ctx.p->page_pool;
+    size_t in_use = ctx.p->heap.page_count + ctx.p->old_heap.page_count;
+    while ((pool->count + in_use) * LISP_PAGE_SIZE < policy.initial_size)
+        pool_give_(pool, page_create(PAGE_CAPACITY_));
+
+    gc_set_full_threshold_(ctx);
+    gc_set_safepoint_size_(ctx);
+}
+
+void lisp_set_gc_threads(int threads, LispContext ctx)
+{
+    ctx.p->gc_threads = threads < 1 ? 1 : threads;
+}
+
+void lisp_set_symbol_sweep(int enabled, LispContext ctx)
+{
+    ctx.p->gc_sweep_symbols = enabled;
+}
+
+void lisp_print_collect_stats(LispContext ctx)
+{
+    Page* page = ctx.p->old_heap.bottom;
+    while (page)
+    {
+        printf("%lu/%lu ", page->size, page->capacity);
+        page = heap_next_page_(&ctx.p->old_heap, page);
+    }
+    fprintf(ctx.p->out_port, "\ngc collected: %lu\t time: %lu us\n", ctx.p->gc_stat_freed, ctx.p->gc_stat_time);
+    fprintf(ctx.p->out_port, "heap size: %lu\t pages: %lu\n", ctx.p->heap.size, ctx.p->heap.page_count);
+    fprintf(ctx.p->out_port, "old heap size: %lu\t pages: %lu\n", ctx.p->old_heap.size, ctx.p->old_heap.page_count);
+    fprintf(ctx.p->out_port, "symbols: %lu\t symbol heap size: %lu\n", ctx.p->symbol_count, ctx.p->symbol_heap.size);
+}
+
+LispGCStats lisp_gc_stats(LispContext ctx)
+{
+    LispGCStats stats = ctx.p->gc_stats;
+    stats.live_count[LISP_SYMBOL] += ctx.p->symbol_count;
+    stats.live_bytes[LISP_SYMBOL] += ctx.p->symbol_heap.size;
+    stats.pages_reused = ctx.p->page_pool.reused;
+    stats.pages_pooled = ctx.p->page_pool.count;
+    return stats;
+}
+
+const char* lisp_type_name(LispType type)
+{
+    static const char* names[LISP_TYPE_COUNT] = {
+        "NULL", "REAL", "INT", "CHAR", "PAIR", "SYMBOL", "STRING", "LAMBDA", "FUNC",
+        "TABLE", "BOOL", "VECTOR", "PROMISE", "JUMP", "PTR", "LOCAL", "CODE", "FUNC-N", "PORT",
+        "GLOBAL", "F64VECTOR", "S64VECTOR",
+    };
+    return (unsigned)type < LISP_TYPE_COUNT ? names[type] : "UNKNOWN";
+}
+
+Lisp lisp_env(LispContext ctx) { return ctx.p->env; }
+
+void lisp_set_env(Lisp env, LispContext ctx)
+{
+    assert(lisp_is_env(env));
+    for (Lisp l = env; lisp_is_pair(l); l = lisp_cdr(l)) env_mark_frame_(lisp_car(l));
+    ctx.p->env = env;
+}
+
+Lisp lisp_macro_table(LispContext ctx) { return ctx.p->macros; }
+
+void lisp_set_macro_table(Lisp table, LispContext ctx)
+{
+    assert(lisp_type(table) == LISP_TABLE);
+    ctx.p->macros = table;
+    ctx.p->expand_cache = lisp_null();
+}
+
+const char* lisp_error_string(LispError error)
+{
+    switch (error)
+    {
+        case LISP_ERROR_NONE:
+            return "none";
+        case LISP_ERROR_FILE_OPEN:
+            return "file error: could not open file";
+        case LISP_ERROR_READ_SYNTAX:
+            return "read/syntax error.";
+        case LISP_ERROR_FORM_SYNTAX:
+            return "expand error: bad special form";
+        case LISP_ERROR_UNDEFINED_VAR:
+            return "eval error: undefined variable";
+        case LISP_ERROR_BAD_OP:
+            return "eval error: attempt to apply something which was not an operator";
+        case LISP_ERROR_ARG_TYPE:
+            return "eval error: invalid argument type";
+        case LISP_ERROR_TOO_MANY_ARGS:
+            return "eval error: too many arguments";
+         case LISP_ERROR_TOO_FEW_ARGS:
+            return "eval error: missing arguments";
+        case LISP_ERROR_OUT_OF_BOUNDS:
+            return "eval error: index out of bounds";
+        case LISP_ERROR_RUNTIME:
+            return "evaluation called (error) and it was not handled";
+        case LISP_ERROR_OUT_OF_MEMORY:
+            return "eval error: the heap is over its size limit";
+        default:
+            return "unknown error code";
+    }
+}
+
+// a context with empty heaps and nothing else.
+static LispContext context_create_(void)
+{
+    LispContext ctx;
+    ctx.p = malloc(sizeof(struct LispImpl));
+    if (!ctx.p) return ctx;
+
+    ctx.p->out_port = stdout;
+    ctx.p->in_port = stdin;
+    ctx.p->err_port = stderr;
+
+    ctx.p->symbol_counter = 0;
+    ctx.p->random_state = 1;
+    ctx.p->global_epoch = 1;
+    memset(&ctx.p->gc_stats, 0, sizeof(LispGCStats));
+    ctx.p->profile = NULL;
+    ctx.p->stack_ptr = 0;
+    ctx.p->stack_depth = LISP_STACK_DEPTH;
+    ctx.p->stack = malloc(sizeof(Lisp) * LISP_STACK_DEPTH);
+    ctx.p->handles = NULL;
+    ctx.p->handle_next = NULL;
+    ctx.p->handle_free = 0;
+    ctx.p->handle_capacity = 0;
+    ctx.p->gc_stat_freed = 0;
+    ctx.p->gc_stat_time = 0;
+    ctx.p->gc_minor = 0;
+    memset(ctx.p->frame_pool_count, 0, sizeof(ctx.p->frame_pool_count));
+    ctx.p->gc_large_pending = NULL;
+    ctx.p->gc_threads = 1;
+    ctx.p->gc_parallel = NULL;
+    ctx.p->gc_disabled = 0;
+    ctx.p->gc_auto_threshold = 0;
+    ctx.p->gc_full_threshold = 4 * LISP_PAGE_SIZE;
+    ctx.p->gc_initial_size = 4 * LISP_PAGE_SIZE;
+    ctx.p->gc_growth_factor = 2.0;
+    ctx.p->gc_max_size = 0;
+    ctx.p->gc_safepoint_size = SIZE_MAX;
+    
+    memset(&ctx.p->page_pool, 0, sizeof(PagePool));
+    heap_init(&ctx.p->heap, 0, &ctx.p->page_pool);
+    heap_init(&ctx.p->old_heap, GEN_OLD, &ctx.p->page_pool);
+    heap_init(&ctx.p->symbol_heap, GEN_OLD | GEN_FIXED, &ctx.p->page_pool);
+    for (int i = 0; i < SYMBOL_FREE_CLASSES_; ++i) ctx.p->symbol_free[i].ptr_val = NULL;
+    ctx.p->gc_sweep_symbols = 0;
+
+    ctx.p->symbol_bucket_count = 1024;
+    ctx.p->symbol_buckets = calloc(ctx.p->symbol_bucket_count, sizeof(Symbol*));
+    ctx.p->symbol_count = 0;
+    ctx.p->env = lisp_null();
+    ctx.p->macros = lisp_null();
+    ctx.p->expand_cache = lisp_null();
+    ctx.p->output_port = lisp_null();
+    for (int i = 0; i < SYM_COUNT; ++i) ctx.p->symbol_cache[i] = lisp_null();
+    return ctx;
+}
+
+LispContext lisp_init(void)
+{
+    LispContext ctx = context_create_();
+    if (!ctx.p) return ctx;
+
+    ctx.p->env = lisp_null();
+    ctx.p->macros = lisp_make_table(ctx);
+
+    Lisp* c = ctx.p->symbol_cache;
+    c[SYM_IF] = lisp_make_symbol("IF", ctx);
+    c[SYM_BEGIN] = lisp_make_symbol("BEGIN", ctx);
+    c[SYM_QUOTE] = lisp_make_symbol("QUOTE", ctx);
+    c[SYM_QUASI_QUOTE] = lisp_make_symbol("QUASIQUOTE", ctx);
+    c[SYM_UNQUOTE] = lisp_make_symbol("UNQUOTE", ctx);
+    c[SYM_UNQUOTE_SPLICE] = lisp_make_symbol("UNQUOTESPLICE", ctx);
+    c[SYM_DEFINE] = lisp_make_symbol("_DEF", ctx);
+    c[SYM_DEFINE_MACRO] = lisp_make_symbol("DEFINE-MACRO", ctx);
+    c[SYM_SET] = lisp_make_symbol("_SET!", ctx);
+    c[SYM_LAMBDA] = lisp_make_symbol("/\\_", ctx);
+    c[SYM_CONS] = lisp_make_symbol("CONS", ctx);
+    return ctx;
+}
+
+void lisp_shutdown(LispContext ctx)
+{
+    if (ctx.p->profile) lisp_profile_end(NULL, NULL, ctx);
+    heap_shutdown(&ctx.p->heap);
+    heap_shutdown(&ctx.p->old_heap);
+    heap_shutdown(&ctx.p->symbol_heap);
+    pool_trim_(&ctx.p->page_pool, 0);
+    free(ctx.p->symbol_buckets);
+    free(ctx.p->stack);
+    free(ctx.p->handles);
+    free(ctx.p->handle_next);
+    free(ctx.p);
+}
+
+// -----------------------------------------
+// COPYING BETWEEN CONTEXTS
+// -----------------------------------------
+
+// Blocks are copied into dst's young heap and then scanned, like a collection,
+// except sources are left alone and forwarding addresses are kept in a hash map.
+typedef struct
+{
+    LispContext src;
+    LispContext dst;
+    // open addressing, keyed by source block.
+    Block** from;
+    Lisp* to;
+    size_t count;
+    size_t capacity;
+    // copied blocks which haven't been scanned
+    Block** pending;
+    size_t pending_count;
+    size_t pending_capacity;
+    // globals in src's user frame which copied code refers to.
+    // null if they aren't copied.
+    Lisp globals;
+    Lisp* global_names;
+    size_t global_count;
+    // copies of their values
+    Lisp* global_values;
+    size_t global_value_count;
+    jmp_buf error_jmp;
+} CopyMap;
+
+static size_t copy_slot_(const CopyMap* m, const Block* block)
+{
+    size_t i = (size_t)hash_uint64((uint64_t)(uintptr_t)block);
+    while (1)
+    {
+        i &= m->capacity - 1;
+        if (m->from[i] == NULL || m->from[i] == block) return i;
+        ++i;
+    }
+}
+
+static void copy_map_set_(CopyMap* m, Block* block, Lisp to)
+{
+    if (2 * (m->count + 1) > m->capacity)
+    {
+        CopyMap old = *m;
+        m->capacity = old.capacity ? old.capacity * 2 : 256;
+        m->from = calloc(m->capacity, sizeof(Block*));
+        m->to = malloc(m->capacity * sizeof(Lisp));
+        for (size_t i = 0; i < old.capacity; ++i)
+        {
+            if (!old.from[i]) continue;
+            size_t j = copy_slot_(m, old.from[i]);
+            m->from[j] = old.from[i];
+            m->to[j] = old.to[i];
+        }
+        free(old.from);
+        free(old.to);
+    }
+    size_t i = copy_slot_(m, block);
+    if (!m->from[i]) ++m->count;
+    m->from[i] = block;
+    m->to[i] = to;
+}
+
+static Lisp copy_r_(CopyMap* m, Lisp x)
+{
+    switch (lisp_type(x))
+    {
+        case LISP_PAIR:
+        case LISP_STRING:
+        case LISP_LAMBDA:
+        case LISP_VECTOR:
+        case LISP_PROMISE:
+        case LISP_TABLE:
+        case LISP_SYMBOL:
+        case LISP_CODE:
+        case LISP_FUNC_N:
+        case LISP_PORT:
+        case LISP_GLOBAL:
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
+        {
+            Block* block = x.val.ptr_val;
+            if (m->capacity > 0)
+            {
+                size_t i = copy_slot_(m, block);
+                if (m->from[i]) return m->to[i];
+            }
+
+            if (block->gen & GEN_FIXED)
+            {
+                Symbol* s = (Symbol*)block;
+                Lisp y = symbol_intern_(s->text, s->block.d.symbol.length, m->dst);
+                copy_map_set_(m, block, y);
+
+                int present = 0;
+                if (!lisp_is_null(m->globals)) lisp_table_get(m->globals, x, &present);
+                if (present)
+                {
+                    if (IS_POW2(m->global_count + 1))
+                        m->global_names = realloc(m->global_names, 2 * (m->global_count + 1) * sizeof(Lisp));
+                    m->global_names[m->global_count++] = x;
+                }
+                return y;
+            }
+
+            Block* dest = gc_alloc(block->info.size, block->type, m->dst);
+            uint8_t gen = dest->gen;
+            memcpy(dest, block, block->info.size);
+            dest->gc_state = GC_CLEAR;
+            dest->gen = gen;
+
+            Lisp y = x;
+            y.val.ptr_val = dest;
+            copy_map_set_(m, block, y);
+
+            if (m->pending_count == m->pending_capacity)
+            {
+                m->pending_capacity = m->pending_capacity * 2 + 64;
+                m->pending = realloc(m->pending, m->pending_capacity * sizeof(Block*));
+            }
+            m->pending[m->pending_count++] = dest;
+            return y;
+        }
+        case LISP_JUMP:
+            fprintf(m->src.p->err_port, "continuations can't be copied.\n");
+            longjmp(m->error_jmp, LISP_ERROR_ARG_TYPE);
+        default:
+            return x;
+    }
+}
+
+static LispVal copy_val_(CopyMap* m, LispVal val, LispType type)
+{
+    return copy_r_(m, VAL_(val, type)).val;
+}
+
+// replace everything a copied block references with its copy.
+static void copy_scan_block_(CopyMap* m, Block* block)
+{
+    switch (block->type)
+    {
+        case LISP_PAIR:
+        {
+            Pair* p = (Pair*)block;
+            p->car = copy_val_(m, p->car, p->block.d.pair.car_type);
+            p->cdr = copy_val_(m, p->cdr, p->block.d.pair.cdr_type);
+            break;
+        }
+        case LISP_VECTOR:
+        {
+            Lisp vector = VAL_BLOCK_(block, LISP_VECTOR);
+            Vector* v = (Vector*)block;
+            int n = vector_len_(v);
+            for (int i = 0; i < n; ++i)
+                v->entries[i] = copy_r_(m, lisp_vector_ref(vector, i)).val;
+            break;
+        }
+        case LISP_LAMBDA:
+        {
+            Lambda* l = (Lambda*)block;
+            l->args = copy_val_(m, l->args, (LispType)l->block.d.lambda.args_type);
+            l->body = copy_val_(m, l->body, (LispType)l->block.d.lambda.body_type);
+            l->env = copy_val_(m, l->env, l->env.ptr_val == NULL ? LISP_NULL : LISP_PAIR);
+            l->names = copy_val_(m, l->names, l->names.ptr_val == NULL ? LISP_NULL : LISP_VECTOR);
+            l->name = copy_val_(m, l->name, l->name.ptr_val == NULL ? LISP_NULL : LISP_SYMBOL);
+            break;
+        }
+        case LISP_CODE:
+        {
+            Code* c = (Code*)block;
+            c->consts = copy_val_(m, c->consts, LISP_VECTOR);
+            break;
+        }
+        case LISP_GLOBAL:
+        {
+            // the cache refers to src's environment.
+            GlobalRef* g = (GlobalRef*)block;
+            g->symbol = copy_val_(m, g->symbol, LISP_SYMBOL);
+            global_ref_clear_(g);
+            break;
+        }
+        case LISP_PORT:
+        {
+            Port* p = (Port*)block;
+            p->buffer = copy_val_(m, p->buffer, LISP_STRING);
+            break;
+        }
+        case LISP_PROMISE:
+        {
+            Promise* p = (Promise*)block;
+            p->val_or_proc = copy_val_(m, p->val_or_proc, (LispType)p->block.d.promise.type);
+            break;
+        }
+        case LISP_TABLE:
+        {
+            Table* t = (Table*)block;
+            if (t->capacity == 0) break;
+            t->keys = copy_val_(m, t->keys, LISP_VECTOR);
+            t->vals = copy_val_(m, t->vals, LISP_VECTOR);
+            break;
+        }
+        case LISP_SYMBOL:
+        {
+            // uninterned
+            Symbol* s = (Symbol*)block;
+            s->next.ptr_val = NULL;
+            break;
+        }
+        default:
+            break;
+    }
+}
 
-                        lisp_stack_push(*env, ctx);
-                        lisp_stack_push(lisp_car(arg_expr), ctx);
-                        Lisp new_arg = eval_r(error_jmp, ctx);
-                        lisp_stack_pop(ctx);
-                        lisp_stack_pop(ctx);
+// copies x and then the globals it refers to.
+// Kept apart from copy_ so nothing there changes between setjmp and longjmp.
+static LispError copy_run_(CopyMap* m, Lisp x, Lisp* out_result)
+{
+    LispError error = setjmp(m->error_jmp);
+    if (error != LISP_ERROR_NONE) return error;
 
-                        args = lisp_cons(new_arg, lisp_stack_pop(ctx), ctx);
-                        arg_expr = lisp_stack_pop(ctx);
-                    }
-                    
-                    operator_expr = lisp_stack_pop(ctx);
-                    operator = lisp_stack_pop(ctx);
-                    
-                    LispError error = LISP_ERROR_NONE;
-                    int needs_to_eval = apply(operator, lisp_list_reverse(args), x, env, &error, ctx);
-                    if (error != LISP_ERROR_NONE)
-                    {
-                        if (lisp_type(operator_expr) == LISP_SYMBOL)
-                        {
-                            fprintf(ctx.p->err_port, "operator: %s\n", lisp_symbol_string(operator_expr));
-                        }
+    *out_result = copy_r_(m, x);
 
-                        longjmp(error_jmp, error);
-                    }
+    // values of globals may refer to more globals
+    size_t scanned = 0;
+    while (scanned < m->pending_count || m->global_value_count < m->global_count)
+    {
+        while (scanned < m->pending_count)
+            copy_scan_block_(m, m->pending[scanned++]);
 
-                    if (!needs_to_eval)
-                    {
-                        return *x;
-                    }
-                    // Otherwise while will eval
-                }
-                break;
+        if (m->global_value_count < m->global_count)
+        {
+            m->global_values = realloc(m->global_values, m->global_count * sizeof(Lisp));
+            while (m->global_value_count < m->global_count)
+            {
+                int present;
+                Lisp val = lisp_table_get(m->globals, m->global_names[m->global_value_count], &present);
+                m->global_values[m->global_value_count++] = copy_r_(m, val);
             }
-            default:
-               return *x; // atom
         }
     }
+    return LISP_ERROR_NONE;
 }
 
-static Lisp expand_quasi_r(Lisp l, jmp_buf error_jmp, LispContext ctx)
+static Lisp copy_(Lisp x, LispContext src, LispContext dst, int closure, LispError* out_error)
 {
-    if (lisp_type(l) != LISP_PAIR)
+    switch (lisp_type(x))
     {
-        Lisp terms[] = { get_sym(SYM_QUOTE, ctx), l };
-        return lisp_make_list2(terms, 2, ctx);
+        case LISP_PAIR: case LISP_STRING: case LISP_LAMBDA: case LISP_VECTOR:
+        case LISP_PROMISE: case LISP_TABLE: case LISP_SYMBOL: case LISP_CODE:
+        case LISP_FUNC_N: case LISP_PORT: case LISP_JUMP: case LISP_GLOBAL:
+        case LISP_F64VECTOR: case LISP_S64VECTOR:
+            break;
+        default:
+            // nothing to copy
+            if (out_error) *out_error = LISP_ERROR_NONE;
+            return x;
     }
 
-    Lisp op = lisp_car(l);
-    int op_valid = lisp_type(op) == LISP_SYMBOL;
+    CopyMap m;
+    memset(&m, 0, sizeof(m));
+    m.src = src;
+    m.dst = dst;
+    m.globals = closure && lisp_is_pair(src.p->env) ? lisp_car(src.p->env) : lisp_null();
 
-    if (lisp_eq(op, get_sym(SYM_UNQUOTE, ctx)) && op_valid)
+    // the global environment is not copied.
+    Lisp src_env = src.p->env;
+    Lisp dst_env = dst.p->env;
+    while (lisp_is_pair(src_env) && lisp_is_pair(dst_env))
     {
-        return lisp_car(lisp_cdr(l));
+        copy_map_set_(&m, src_env.val.ptr_val, dst_env);
+        copy_map_set_(&m, lisp_car(src_env).val.ptr_val, lisp_car(dst_env));
+        src_env = lisp_cdr(src_env);
+        dst_env = lisp_cdr(dst_env);
     }
-    else if (lisp_eq(op, get_sym(SYM_UNQUOTE_SPLICE, ctx)) && op_valid)
+
+    Lisp result = lisp_null();
+    LispError error = copy_run_(&m, x, &result);
+    if (error == LISP_ERROR_NONE)
     {
-        fprintf(ctx.p->err_port, "slicing ,@ must be in a backquoted list.\n");
-        longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
+        // tables hash the addresses of their keys, which have all changed.
+        for (size_t i = 0; i < m.pending_count; ++i)
+        {
+            Block* block = m.pending[i];
+            if (block->type == LISP_TABLE && ((Table*)block)->capacity > 0)
+                table_grow_(VAL_BLOCK_(block, LISP_TABLE), ((Table*)block)->capacity, dst);
+        }
+
+        if (lisp_is_pair(dst.p->env))
+        {
+            for (size_t i = 0; i < m.global_value_count; ++i)
+                lisp_env_define(dst.p->env, copy_r_(&m, m.global_names[i]), m.global_values[i], dst);
+        }
     }
     else
     {
-        Lisp terms[] = {
-            get_sym(SYM_CONS, ctx),
-            expand_quasi_r(lisp_car(l), error_jmp, ctx),
-            expand_quasi_r(lisp_cdr(l), error_jmp, ctx),
-        };
-        return lisp_make_list2(terms, 3, ctx);
+        // the partial copy is garbage in dst
+        result = lisp_null();
     }
+
+    free(m.from);
+    free(m.to);
+    free(m.pending);
+    free(m.global_names);
+    free(m.global_values);
+    if (out_error) *out_error = error;
+    return result;
 }
 
-static Lisp expand_r(Lisp l, jmp_buf error_jmp, LispContext ctx)
+Lisp lisp_copy_to(Lisp x, LispContext src, LispContext dst, LispError* out_error)
 {
-    if (lisp_type(l) != LISP_PAIR) return l;
-
-    // 1. expand extended syntax into primitive syntax
-    // 2. perform optimizations
-    // 3. check syntax    
-
-    Lisp op = lisp_car(l);
-    if (lisp_type(op) == LISP_SYMBOL)
-    {
-        if (lisp_eq(op, get_sym(SYM_QUOTE, ctx)))
-        {
-            // don't expand quotes
-            if (lisp_list_length(l) != 2)
-            {
-                fprintf(ctx.p->err_port, "(quote x)\n");
-                longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
-            }
-            return l;
-        }
-        else if (lisp_eq(op, get_sym(SYM_QUASI_QUOTE, ctx)))
-        {
-            return expand_quasi_r(lisp_car(lisp_cdr(l)), error_jmp, ctx);
-        }
-        else if (lisp_eq(op, get_sym(SYM_DEFINE_MACRO, ctx)))
-        {
-            if (lisp_list_length(l) != 3)
-            {
-                fprintf(ctx.p->err_port, "(define-macro name proc)\n");
-                longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
-            } 
+    return copy_(x, src, dst, 0, out_error);
+}
 
-            Lisp symbol = lisp_list_ref(l, 1);
-            Lisp body = lisp_list_ref(l, 2);
+Lisp lisp_copy_closure_to(Lisp x, LispContext src, LispContext dst, LispError* out_error)
+{
+    return copy_(x, src, dst, 1, out_error);
+}
 
-            LispError e;
-            Lisp lambda = lisp_eval(body, &e, ctx);
+// -----------------------------------------
+// IMAGES
+// -----------------------------------------
 
-            if (e != LISP_ERROR_NONE)
-            {
-                longjmp(error_jmp, e);
-            }
-            if (lisp_type(lambda) != LISP_LAMBDA)
-            {
-                fprintf(ctx.p->err_port, "(define-macro name proc) not a procedure\n");
-                longjmp(error_jmp, LISP_ERROR_FORM_SYNTAX);
-            } 
+/* An image is a header followed by the pages of the old generation after a full collection,
+ and then the pages of the symbol heap.
+ Each page is its capacity, used size (8 bytes each) and its used bytes.
+ Pointers to blocks are saved as (page index + 1) << 32 | offset in the page,
+ and pointers to C functions as their index in a LispFuncDef table. */
+#define IMAGE_MAGIC_ "LISPIMG"
+#define IMAGE_VERSION_ 4
 
-            lisp_table_set(ctx.p->macros, symbol, lambda, ctx);
-            return lisp_null();
-        }
-        else 
-        {
-            int present;
-            Lisp proc = lisp_table_get(ctx.p->macros, op, &present);
+enum
+{
+    IMAGE_PLAIN_ = 0,
+    IMAGE_HEAP_,
+    IMAGE_FUNC_,
+    IMAGE_PTR_,
+};
 
-            if (present)
-            {
-                // EXPAND MACRO
+typedef struct
+{
+    char magic[8];
+    // sizes and options which change the layout of blocks.
+    // The image can only be loaded by a build where they all match.
+    uint32_t layout[16];
+    uint64_t page_count;
+    uint64_t symbol_page_count;
+    int64_t symbol_counter;
+    Lisp env;
+    Lisp macros;
+    Lisp symbol_cache[SYM_COUNT];
+} ImageHeader;
 
-                // TODO: need to make sure collection is not triggered
-                // while evaling a macro.
-                Lisp result;
-                Lisp calling_env;
-                LispError error = LISP_ERROR_NONE;
-                if (apply(proc, lisp_cdr(l), &result, &calling_env, &error, ctx) == 1)
-                {
-                    result = lisp_eval2(result, calling_env, &error, ctx);
-                }
+typedef struct
+{
+    int saving;
+    int failed;
+    // loading only. pages by their index in the image.
+    Page** pages;
+    size_t page_count;
+    const LispFuncDef* funcs;
+    int func_count;
+} ImageMap;
+
+static void image_layout_(uint32_t* layout)
+{
+    memset(layout, 0, sizeof(uint32_t) * 16);
+    layout[0] = 0x01020304; // byte order
+    layout[1] = sizeof(LispVal);
+    layout[2] = sizeof(Lisp);
+    layout[3] = sizeof(Block);
+    layout[4] = sizeof(Pair);
+    layout[5] = sizeof(Vector);
+    layout[6] = sizeof(Lambda);
+    layout[7] = sizeof(Table);
+    layout[8] = sizeof(Symbol);
+    layout[9] = sizeof(FuncN);
+    layout[10] = sizeof(Code);
+    layout[11] = sizeof(Promise);
+    layout[12] = LISP_PAGE_SIZE;
+    layout[13] = SYM_COUNT;
+    layout[14] = LISP_TYPE_COUNT;
+#ifdef LISP_TAGGED
+    layout[15] = 1;
+#endif
+}
 
-                if (error != LISP_ERROR_NONE)
-                {
-                    fprintf(ctx.p->out_port, "macroexpand failed: %s\n", lisp_symbol_string(op));
-                    longjmp(error_jmp, error);
-                }
-                return expand_r(result, error_jmp, ctx);
-            }
-        }
+// Classifies a value without looking at the block it points to,
+// which, in an image, isn't an address yet.
+static int image_kind_(LispVal v, LispType type)
+{
+#ifdef LISP_TAGGED
+    (void)type;
+    if (v.bits == 0) return IMAGE_PLAIN_;
+    switch (v.bits >> TAG_SHIFT_)
+    {
+        case TAG_HEAP_: return IMAGE_HEAP_;
+        case TAG_FUNC_: return IMAGE_FUNC_;
+        case TAG_PTR_: return IMAGE_PTR_;
+        default: return IMAGE_PLAIN_;
     }
-
-    // list
-    Lisp it = l;
-    while (lisp_is_pair(it))
+#else
+    switch (type)
     {
-        lisp_set_car(it, expand_r(lisp_car(it), error_jmp, ctx));
-        it = lisp_cdr(it);
+        case LISP_PAIR:
+        case LISP_STRING:
+        case LISP_LAMBDA:
+        case LISP_VECTOR:
+        case LISP_PROMISE:
+        case LISP_TABLE:
+        case LISP_SYMBOL:
+        case LISP_CODE:
+        case LISP_JUMP:
+        case LISP_FUNC_N:
+        case LISP_PORT:
+        case LISP_GLOBAL:
+        case LISP_F64VECTOR:
+        case LISP_S64VECTOR:
+            return IMAGE_HEAP_;
+        case LISP_FUNC: return IMAGE_FUNC_;
+        case LISP_PTR: return IMAGE_PTR_;
+        default: return IMAGE_PLAIN_;
     }
-    return l;
-
+#endif
 }
 
-Lisp lisp_macroexpand(Lisp lisp, LispError* out_error, LispContext ctx)
+static void* image_ptr_(ImageMap* m, void* ptr)
 {
-    jmp_buf error_jmp;
-    LispError error = setjmp(error_jmp);
-
-    if (error == LISP_ERROR_NONE)
+    if (m->saving)
     {
-        Lisp result = expand_r(lisp, error_jmp, ctx);
-        *out_error = error;
-        return result;
+        // lisp_image_save puts the index of each page in its dirty field.
+        Page* page = page_of_(ptr);
+        uint64_t index = (uint64_t)page->dirty;
+        return (void*)(uintptr_t)(((index + 1) << 32) | (uint64_t)((char*)ptr - page->buffer));
     }
     else
     {
-        *out_error = error;
-        return lisp_null();
+        uint64_t bits = (uint64_t)(uintptr_t)ptr;
+        uint64_t index = (bits >> 32) - 1;
+        uint64_t offset = bits & 0xFFFFFFFF;
+        if (index >= m->page_count || offset >= m->pages[index]->size)
+        {
+            m->failed = 1;
+            return NULL;
+        }
+        return m->pages[index]->buffer + offset;
     }
 }
 
-Lisp lisp_eval2(Lisp l, Lisp env, LispError* out_error, LispContext ctx)
+static int image_func_index_(ImageMap* m, LispCFunc func, LispCFuncN func_n)
 {
-    LispError error;
-    Lisp expanded = lisp_macroexpand(l, &error, ctx);
-    
-    if (error != LISP_ERROR_NONE)
+    for (int i = 0; i < m->func_count; ++i)
     {
-        if (out_error) *out_error = error;
-        return lisp_null();
+        if (func && m->funcs[i].func_ptr == func) return i;
+        if (func_n && m->funcs[i].func_n_ptr == func_n) return i;
     }
-    
-    size_t save_stack = ctx.p->stack_ptr;
-    
-    jmp_buf error_jmp;
-    error = setjmp(error_jmp);
-
-    if (error == LISP_ERROR_NONE)
-    {
-        lisp_stack_push(env, ctx);
-        lisp_stack_push(expanded, ctx);
-        
-        Lisp result = eval_r(error_jmp, ctx);
-        
-        lisp_stack_pop(ctx);
-        lisp_stack_pop(ctx);
-
-        if (out_error)
-        {
-            *out_error = error;
-        }
+    m->failed = 1;
+    return 0;
+}
 
-        return result; 
-    }
-    else
+static void image_fix_(ImageMap* m, LispVal* v, LispType type)
+{
+    switch (image_kind_(*v, type))
     {
-        if (out_error)
+        case IMAGE_HEAP_:
+            v->ptr_val = image_ptr_(m, v->ptr_val);
+            break;
+        case IMAGE_FUNC_:
         {
-            ctx.p->stack_ptr = save_stack;
-            *out_error = error;
+            LispCFunc func = lisp_func(VAL_(*v, LISP_FUNC));
+            if (m->saving)
+            {
+                int i = image_func_index_(m, func, NULL);
+                *v = lisp_make_func((LispCFunc)(uintptr_t)i).val;
+            }
+            else
+            {
+                uintptr_t i = (uintptr_t)func;
+                if (i >= (uintptr_t)m->func_count || !m->funcs[i].func_ptr)
+                    m->failed = 1;
+                else
+                    *v = lisp_make_func(m->funcs[i].func_ptr).val;
+            }
+            break;
         }
-
-        return lisp_null();
+        case IMAGE_PTR_:
+            // C pointers can't be saved
+            m->failed = 1;
+            break;
+        default:
+            break;
     }
 }
 
-Lisp lisp_eval(Lisp expr, LispError* out_error, LispContext ctx)
-{
-    return lisp_eval2(expr, lisp_env(ctx), out_error, ctx);
-}
-
-Lisp lisp_apply(Lisp operator, Lisp args, LispError* out_error, LispContext ctx)
+static void image_fix_lisp_(ImageMap* m, Lisp* x)
 {
-    // TODO: argument passing is a little more sophisitaed
-    // No environment required. procedures always bring their own enviornment
-    // to the call.
-    Lisp x;
-    Lisp env;
-    int needs_to_eval = apply(operator, args, &x, &env, out_error, ctx);
-    if (*out_error != LISP_ERROR_NONE) return lisp_false();
-    return needs_to_eval ? lisp_eval2(x, env, out_error, ctx) : x;
+#ifdef LISP_TAGGED
+    image_fix_(m, &x->val, LISP_NULL);
+#else
+    image_fix_(m, &x->val, x->type);
+#endif
 }
 
-static Lisp gc_move(Lisp x, LispContext ctx)
+// Translates every reference a block has.
+// This visits the same fields as gc_scan_block_.
+static void image_fix_block_(ImageMap* m, Block* block)
 {
-    switch (x.type)
+    switch (block->type)
     {
         case LISP_PAIR:
-        case LISP_STRING:
+        {
+            Pair* p = (Pair*)block;
+            image_fix_(m, &p->car, (LispType)p->block.d.pair.car_type);
+            image_fix_(m, &p->cdr, (LispType)p->block.d.pair.cdr_type);
+            break;
+        }
+        case LISP_VECTOR:
+        {
+            Vector* v = (Vector*)block;
+            int n = vector_len_(v);
+            for (int i = 0; i < n; ++i)
+            {
+#ifdef LISP_TAGGED
+                image_fix_(m, v->entries + i, LISP_NULL);
+#else
+                image_fix_(m, v->entries + i, (LispType)vector_types_(v)[i]);
+#endif
+            }
+            break;
+        }
         case LISP_LAMBDA:
-        case LISP_VECTOR:
+        {
+            Lambda* l = (Lambda*)block;
+            image_fix_(m, &l->args, (LispType)l->block.d.lambda.args_type);
+            image_fix_(m, &l->body, (LispType)l->block.d.lambda.body_type);
+            image_fix_(m, &l->env, l->env.ptr_val == NULL ? LISP_NULL : LISP_PAIR);
+            image_fix_(m, &l->names, l->names.ptr_val == NULL ? LISP_NULL : LISP_VECTOR);
+            image_fix_(m, &l->name, l->name.ptr_val == NULL ? LISP_NULL : LISP_SYMBOL);
+            break;
+        }
+        case LISP_CODE:
+        {
+            Code* c = (Code*)block;
+            image_fix_(m, &c->consts, LISP_VECTOR);
+            break;
+        }
+        case LISP_GLOBAL:
+        {
+            GlobalRef* g = (GlobalRef*)block;
+            image_fix_(m, &g->symbol, LISP_SYMBOL);
+            global_ref_clear_(g);
+            break;
+        }
+        case LISP_PORT:
+        {
+            Port* p = (Port*)block;
+            image_fix_(m, &p->buffer, LISP_STRING);
+            break;
+        }
         case LISP_PROMISE:
+        {
+            Promise* p = (Promise*)block;
+            image_fix_(m, &p->val_or_proc, (LispType)p->block.d.promise.type);
+            break;
+        }
         case LISP_TABLE:
+        {
+            Table* t = (Table*)block;
+            if (t->capacity == 0) break;
+            image_fix_(m, &t->keys, LISP_VECTOR);
+            image_fix_(m, &t->vals, LISP_VECTOR);
+            break;
+        }
         case LISP_SYMBOL:
         {
-            Block* block = x.val.ptr_val;
-            if (block->gc_state == GC_CLEAR)
+            Symbol* s = (Symbol*)block;
+            image_fix_(m, &s->next, s->next.ptr_val == NULL ? LISP_NULL : LISP_SYMBOL);
+            break;
+        }
+        case LISP_FUNC_N:
+        {
+            FuncN* f = (FuncN*)block;
+            if (m->saving)
             {
-                // copy the data to new block
-                Block* dest = heap_alloc(block->info.size, block->type, &ctx.p->heap);
-                memcpy(dest, block, block->info.size);
-                dest->gc_state = GC_NEED_VISIT;
-                
-                // save forwarding address (offset in to)
-                block->info.forward = dest;
-                block->gc_state = GC_GONE;
+                f->func = (LispCFuncN)(uintptr_t)image_func_index_(m, NULL, f->func);
             }
-
-            assert(block->gc_state == GC_GONE);
-            
-            // return the moved block address
-            x.val.ptr_val = block->info.forward;
-            return x;
+            else
+            {
+                uintptr_t i = (uintptr_t)f->func;
+                if (i >= (uintptr_t)m->func_count || !m->funcs[i].func_n_ptr)
+                    m->failed = 1;
+                else
+                    f->func = m->funcs[i].func_n_ptr;
+            }
+            break;
         }
+        case LISP_JUMP:
+            // continuations only live as long as their C stack frame.
+            m->failed = 1;
+            break;
         default:
-            return x;
+            break;
     }
 }
 
-static LispVal gc_move_val(LispVal val, LispType type, LispContext ctx)
+// translate all the blocks in the used part of a page.
+static int image_fix_blocks_(ImageMap* m, char* buffer, size_t size)
 {
-    return gc_move( (Lisp) { val, type}, ctx).val;
+    size_t offset = 0;
+    while (offset < size)
+    {
+        Block* block = (Block*)(buffer + offset);
+        if (block->info.size == 0 || block->info.size > size - offset) return 0;
+        image_fix_block_(m, block);
+        offset += block->info.size;
+    }
+    return !m->failed;
 }
 
-static void gc_move_v(Lisp* start, int n, LispContext ctx)
+static int func_def_count_(const LispFuncDef* funcs)
 {
-    for (int i = 0; i < n; ++i) start[i] = gc_move(start[i], ctx);
+    int n = 0;
+    while (funcs && funcs[n].name) ++n;
+    return n;
 }
 
-static Lisp gc_move_weak_symbols(Lisp old_table, LispContext ctx)
+// assigns a field at a time, so the zeroed padding of the header stays zero.
+static void image_header_set_(Lisp* slot, Lisp x)
 {
-    // move symbol table (weak references)
-    Table* from = table_get_(old_table);
-    Lisp to_table = lisp_make_table(ctx);
-    // preallocate
-    int cap = from->capacity;
-    table_grow_(to_table, cap, ctx);
-
-    Lisp hashes = { from->keys, LISP_VECTOR };
-    Lisp symbols = { from->vals, LISP_VECTOR };
-
-    for (int i = 0; i < cap; ++i)
-    {
-        Lisp hash = lisp_vector_ref(hashes, i); 
-        if (!lisp_is_null(hash))
-        {
-            Lisp old_symbol = lisp_vector_ref(symbols, i);
-            while (old_symbol.val.ptr_val != NULL)
-            {
-                if (symbol_get_(old_symbol)->block.gc_state == GC_GONE)
-                {
-                    Lisp to_insert = gc_move(old_symbol, ctx);
-                    int present;
-                    Lisp existing = lisp_table_get(to_table, hash, &present);
-                    symbol_get_(to_insert)->next = existing.val;
-                    lisp_table_set(to_table, hash, to_insert, ctx);
-                }
-                else
-                {
-#ifdef LISP_DEBUG
-                    //printf("losing symbol: %s\n", lisp_symbol_string(old_symbol));
+    slot->val = x.val;
+#ifndef LISP_TAGGED
+    slot->type = x.type;
 #endif
-                }
-                old_symbol.val = symbol_get_(old_symbol)->next;
-            }
-        }
-    }
-    return to_table;
 }
 
-Lisp lisp_collect(Lisp root_to_save, LispContext ctx)
+void* lisp_image_save(const LispFuncDef* funcs, size_t* out_size, LispContext ctx)
 {
-    time_t start_time = clock();
-
-    // copy of old heap
-    Heap from = ctx.p->heap;
-
-    // make new heap to allocate and copy to
-    heap_init(&ctx.p->heap);
-
-    // move root object
-    ctx.p->env = gc_move(ctx.p->env, ctx);
-    ctx.p->macros = gc_move(ctx.p->macros, ctx);
-
-    gc_move_v(ctx.p->symbol_cache, SYM_COUNT, ctx);
-    gc_move_v(ctx.p->stack, ctx.p->stack_ptr, ctx);
+    // afterwards everything live is packed in the old generation.
+    lisp_collect_full(lisp_null(), ctx);
+    const Heap* heaps[2] = { &ctx.p->old_heap, &ctx.p->symbol_heap };
 
-    Lisp result = gc_move(root_to_save, ctx);
+    ImageMap m;
+    m.saving = 1;
+    m.failed = 0;
+    m.funcs = funcs;
+    m.func_count = func_def_count_(funcs);
+    m.pages = NULL;
+    m.page_count = heaps[0]->page_count + heaps[1]->page_count;
 
-    // move references
-    const Page* page = ctx.p->heap.bottom;
-    int page_counter = 0;
-    while (page)
+    // Borrow each page's dirty field (clear after a full collection,
+    // and unused in the symbol heap) to hold its index.
+    size_t size = sizeof(ImageHeader);
+    size_t n = 0;
+    for (int h = 0; h < 2; ++h)
     {
-        size_t offset = 0;
-        while (offset < page->size)
+        for (Page* page = heaps[h]->bottom; page; page = heap_next_page_(heaps[h], page))
         {
-            Block* block = (Block*)(page->buffer + offset);
-            if (block->gc_state == GC_NEED_VISIT)
-            {
-                switch (block->type)
-                {
-                    // these add &to the buffer!
-                    // so lists are handled in a single pass
-                    case LISP_PAIR:
-                    {
-                        // move the CAR and CDR
-                        Pair* p = (Pair*)block;
-                        p->car = gc_move_val(p->car, p->block.d.pair.car_type, ctx);
-                        p->cdr = gc_move_val(p->cdr, p->block.d.pair.cdr_type, ctx);
-                        break;
-                    }
-                    case LISP_VECTOR:
-                    {
-                        Lisp vector;
-                        vector.val.ptr_val = block;
-                        vector.type = LISP_VECTOR;
-
-                        Vector* v = (Vector*)block;
-                        int n = vector_len_(v);
-                        for (int i = 0; i < n; ++i)
-                            v->entries[i] = gc_move(lisp_vector_ref(vector, i), ctx).val;
-                        break;
-                    }
-                    case LISP_LAMBDA:
-                    {
-                        // move the body and args
-                        Lambda* l = (Lambda*)block;
-                        l->args = gc_move_val(l->args, (LispType)l->block.d.lambda.args_type, ctx);
-                        l->body = gc_move_val(l->body, (LispType)l->block.d.lambda.body_type, ctx);
-                        l->env = gc_move_val(l->env, l->env.ptr_val == NULL ? LISP_NULL : LISP_PAIR, ctx);
-                        break;
-                    }
-                    case LISP_PROMISE:
-                    {
-                        Promise* p = (Promise*)block;
-                        p->val_or_proc = gc_move_val(p->val_or_proc, (LispType)p->block.d.promise.type, ctx);
-                        break;
-                    }
-                    case LISP_TABLE:
-                    {
-
-                        // During garbage collection all pointers change INCLUDING symbols,
-                        // so that means if a symbol pointer is being used as a key, it is no
-                        // longer in the correct place in the hash table.
-                        // So we have to move it to a new place during garbage collection.
-                        Lisp table;
-                        table.val.ptr_val = block;
-                        table.type = LISP_TABLE;
-
-                        Table* t = (Table*)block;
-                        int n = t->capacity;
+            size += 2 * sizeof(uint64_t) + page->size;
+            page->dirty = n++;
+        }
+    }
 
-                        Lisp keys = { t->keys, LISP_VECTOR };
-                        Lisp vals = { t->vals, LISP_VECTOR };
+    char* image = malloc(size);
+    // blocks stay aligned when they are translated in the image
+    assert(sizeof(ImageHeader) % sizeof(LispVal) == 0);
+
+    ImageHeader header;
+    memset(&header, 0, sizeof(ImageHeader));
+    memcpy(header.magic, IMAGE_MAGIC_, 7);
+    header.magic[7] = IMAGE_VERSION_;
+    image_layout_(header.layout);
+    header.page_count = heaps[0]->page_count;
+    header.symbol_page_count = heaps[1]->page_count;
+    header.symbol_counter = ctx.p->symbol_counter;
+
+    image_header_set_(&header.env, ctx.p->env);
+    image_header_set_(&header.macros, ctx.p->macros);
+    image_fix_lisp_(&m, &header.env);
+    image_fix_lisp_(&m, &header.macros);
+    for (int i = 0; i < SYM_COUNT; ++i)
+    {
+        image_header_set_(header.symbol_cache + i, ctx.p->symbol_cache[i]);
+        image_fix_lisp_(&m, header.symbol_cache + i);
+    }
+    memcpy(image, &header, sizeof(ImageHeader));
 
-                        for (int i = 0; i < n; ++i)
-                        {
-                            // move all the values, but borrow the old table for now.
-                            Lisp key = lisp_vector_ref(keys, i); 
-                            if (!lisp_is_null(key))
-                            {
-                                lisp_vector_set(keys, i, gc_move(key, ctx));
-                                lisp_vector_set(vals, i, gc_move(lisp_vector_ref(vals, i), ctx));
-                            }
-                        }
-                        // create new table and move the values in place.
-                        table_grow_(table, n, ctx);
-                        break;
-                     }
-                    default: break;
-                }
-                block->gc_state = GC_CLEAR;
-            }
-            offset += block->info.size;
+    char* c = image + sizeof(ImageHeader);
+    for (int h = 0; h < 2; ++h)
+    {
+        for (Page* page = heaps[h]->bottom; page; page = heap_next_page_(heaps[h], page))
+        {
+            uint64_t info[2] = { page->capacity, page->size };
+            memcpy(c, info, sizeof(info));
+            c += sizeof(info);
+
+            // translate the copy, so the context is unchanged.
+            memcpy(c, page->buffer, page->size);
+            if (!image_fix_blocks_(&m, c, page->size)) m.failed = 1;
+            c += page->size;
         }
-        page = page->next;
-        ++page_counter;
     }
-    // check that we visited all the pages
-    assert(page_counter == ctx.p->heap.page_count);
-    ctx.p->symbols = gc_move_weak_symbols(ctx.p->symbols, ctx);
-    
-#ifdef LISP_DEBUG
-     {
-          // DEBUG, check offsets
-          const Page* page = ctx.p->heap.bottom;
-          while (page)
-          {
-              size_t offset = 0;
-              while (offset < page->size)
-              {
-                  Block* block = (Block*)(page->buffer + offset);
-                  assert(block->gc_state == GC_CLEAR);
-                  assert(block->info.size <= page->size);
-                  assert(block->info.size % sizeof(LispVal) == 0);
-                  offset += block->info.size;
-              }
-              assert(offset == page->size);
-              page = page->next;
-          }
+
+    for (int h = 0; h < 2; ++h)
+    {
+        for (Page* page = heaps[h]->bottom; page; page = heap_next_page_(heaps[h], page))
+            page->dirty = 0;
     }
-#endif
-    
-    size_t diff = from.size - ctx.p->heap.size;
 
-    // swap the heaps
-    heap_shutdown(&from);
-    
-    time_t end_time = clock();
-    ctx.p->gc_stat_freed = diff;
-    ctx.p->gc_stat_time = 1000000 * (end_time - start_time) / CLOCKS_PER_SEC;
-    return result;
+    if (m.failed)
+    {
+        free(image);
+        return NULL;
+    }
+
+    *out_size = size;
+    return image;
 }
 
-void lisp_print_collect_stats(LispContext ctx)
+LispContext lisp_init_image(const void* image, size_t size, const LispFuncDef* funcs)
 {
-    Page* page = ctx.p->heap.bottom;
-    while (page)
+    LispContext ctx;
+    ctx.p = NULL;
+
+    ImageHeader header;
+    uint32_t layout[16];
+    image_layout_(layout);
+    if (size < sizeof(ImageHeader)) return ctx;
+    memcpy(&header, image, sizeof(ImageHeader));
+    if (memcmp(header.magic, IMAGE_MAGIC_, 7) != 0 || header.magic[7] != IMAGE_VERSION_ ||
+        memcmp(header.layout, layout, sizeof(layout)) != 0 || header.page_count == 0)
     {
-        printf("%lu/%lu ", page->size, page->capacity);
-        page = page->next;
+        return ctx;
     }
-    fprintf(ctx.p->out_port, "\ngc collected: %lu\t time: %lu us\n", ctx.p->gc_stat_freed, ctx.p->gc_stat_time);
-    fprintf(ctx.p->out_port, "heap size: %lu\t pages: %lu\n", ctx.p->heap.size, ctx.p->heap.page_count);
-    fprintf(ctx.p->out_port, "symbols: %lu \n", (size_t)lisp_table_size(ctx.p->symbols));
-}
 
-Lisp lisp_env(LispContext ctx) { return ctx.p->env; }
+    ctx = context_create_();
+    if (!ctx.p) return ctx;
 
-void lisp_set_env(Lisp env, LispContext ctx)
-{
-    assert(lisp_is_env(env));
-    ctx.p->env = env;
-}
+    ImageMap m;
+    m.saving = 0;
+    m.failed = 0;
+    m.funcs = funcs;
+    m.func_count = func_def_count_(funcs);
+    m.page_count = 0;
+    uint64_t total_pages = header.page_count + header.symbol_page_count;
+    m.pages = malloc(sizeof(Page*) * total_pages);
+
+    // replace the old generation and symbol heap with the image pages.
+    Heap* heaps[2] = { &ctx.p->old_heap, &ctx.p->symbol_heap };
+    for (int h = 0; h < 2; ++h)
+    {
+        Heap* heap = heaps[h];
+        heap_shutdown(heap);
+        heap->size = 0;
+        heap->page_count = 0;
+        heap->bottom = heap->top = heap->last = NULL;
+    }
 
-Lisp lisp_macro_table(LispContext ctx) { return ctx.p->macros; }
+    const char* c = (const char*)image + sizeof(ImageHeader);
+    const char* end = (const char*)image + size;
+    for (uint64_t i = 0; i < total_pages; ++i)
+    {
+        Heap* heap = heaps[i < header.page_count ? 0 : 1];
+        uint64_t info[2];
+        if ((size_t)(end - c) < sizeof(info)) break;
+        memcpy(info, c, sizeof(info));
+        c += sizeof(info);
+        if (info[1] > info[0] || info[1] > (uint64_t)(end - c) || info[0] < PAGE_CAPACITY_) break;
+
+        Page* page = page_create((size_t)info[0]);
+        memcpy(page->buffer, c, (size_t)info[1]);
+        page->size = (size_t)info[1];
+        c += info[1];
+
+        if (page->capacity > PAGE_CAPACITY_ && !(heap->gen & GEN_FIXED))
+        {
+            page->next = heap->large;
+            heap->large = page;
+        }
+        else
+        {
+            if (heap->last) heap->last->next = page;
+            else heap->bottom = page;
+            heap->last = page;
+            if (page->capacity == PAGE_CAPACITY_) heap->top = page;
+        }
+        heap->size += page->size;
+        ++heap->page_count;
+        m.pages[m.page_count++] = page;
+    }
 
-void lisp_set_macro_table(Lisp table, LispContext ctx)
-{
-    assert(lisp_type(table) == LISP_TABLE);
-    ctx.p->macros = table;
-}
+    if (m.page_count != total_pages || header.symbol_page_count == 0) m.failed = 1;
+    for (size_t i = 0; i < m.page_count && !m.failed; ++i)
+    {
+        if (!image_fix_blocks_(&m, m.pages[i]->buffer, m.pages[i]->size)) m.failed = 1;
+    }
 
-const char* lisp_error_string(LispError error)
-{
-    switch (error)
+    if (!m.failed)
     {
-        case LISP_ERROR_NONE:
-            return "none";
-        case LISP_ERROR_FILE_OPEN:
-            return "file error: could not open file";
-        case LISP_ERROR_READ_SYNTAX:
-            return "read/syntax error.";
-        case LISP_ERROR_FORM_SYNTAX:
-            return "expand error: bad special form";
-        case LISP_ERROR_UNDEFINED_VAR:
-            return "eval error: undefined variable";
-        case LISP_ERROR_BAD_OP:
-            return "eval error: attempt to apply something which was not an operator";
-        case LISP_ERROR_ARG_TYPE:
-            return "eval error: invalid argument type";
-        case LISP_ERROR_TOO_MANY_ARGS:
-            return "eval error: too many arguments";
-         case LISP_ERROR_TOO_FEW_ARGS:
-            return "eval error: missing arguments";
-        case LISP_ERROR_OUT_OF_BOUNDS:
-            return "eval error: index out of bounds";
-        case LISP_ERROR_RUNTIME:
-            return "evaluation called (error) and it was not handled";
-        default:
-            return "unknown error code";
+        image_fix_lisp_(&m, &header.env);
+        image_fix_lisp_(&m, &header.macros);
+        for (int i = 0; i < SYM_COUNT; ++i)
+            image_fix_lisp_(&m, header.symbol_cache + i);
     }
-}
 
-LispContext lisp_init(void)
-{
-    LispContext ctx;
-    ctx.p = malloc(sizeof(struct LispImpl));
-    if (!ctx.p) return ctx;
+    if (m.failed)
+    {
+        free(m.pages);
+        lisp_shutdown(ctx);
+        ctx.p = NULL;
+        return ctx;
+    }
+    gc_count_old_(ctx);
 
-    ctx.p->out_port = stdout;
-    ctx.p->in_port = stdin;
-    ctx.p->err_port = stderr;
+    for (int h = 0; h < 2; ++h)
+    {
+        Heap* heap = heaps[h];
+        if (!heap->top)
+        {
+            // only large pages. Allocations need a normal page to start from.
+            Page* page = page_create(PAGE_CAPACITY_);
+            if (heap->last) heap->last->next = page;
+            else heap->bottom = page;
+            heap->last = heap->top = page;
+            ++heap->page_count;
+        }
+    }
 
-    ctx.p->symbol_counter = 0;
-    ctx.p->stack_ptr = 0;
-    ctx.p->stack_depth = LISP_STACK_DEPTH;
-    ctx.p->stack = malloc(sizeof(Lisp) * LISP_STACK_DEPTH);
-    ctx.p->gc_stat_freed = 0;
-    ctx.p->gc_stat_time = 0;
-    
-    heap_init(&ctx.p->heap);
+    ctx.p->env = header.env;
+    ctx.p->macros = header.macros;
+    memcpy(ctx.p->symbol_cache, header.symbol_cache, sizeof(header.symbol_cache));
+    ctx.p->symbol_counter = (int)header.symbol_counter;
 
-    ctx.p->symbols = lisp_make_table(ctx);
-    ctx.p->env = lisp_null();
-    ctx.p->macros = lisp_make_table(ctx);
+    // Tables hash the addresses of their keys, which have all changed.
+    // Rebuild them in the old generation, like the collector does.
+    Heap young = ctx.p->heap;
+    ctx.p->heap = ctx.p->old_heap;
+    for (size_t i = 0; i < m.page_count; ++i)
+    {
+        Page* page = m.pages[i];
+        size_t offset = 0;
+        while (offset < page->size)
+        {
+            Block* block = (Block*)(page->buffer + offset);
+            if (block->type == LISP_TABLE && ((Table*)block)->capacity > 0)
+                table_grow_(VAL_BLOCK_(block, LISP_TABLE), ((Table*)block)->capacity, ctx);
+            // the symbol table is rebuilt from the symbol heap,
+            // and swept symbols go back on the free lists.
+            if (block->gen & GEN_FIXED)
+            {
+                if (block->gc_state == GC_FREE)
+                {
+                    ctx.p->symbol_heap.size += block->info.size;
+                    symbol_free_((Symbol*)block, ctx);
+                }
+                else
+                {
+                    if (ctx.p->symbol_count >= ctx.p->symbol_bucket_count)
+                        symbol_buckets_resize_(2 * ctx.p->symbol_bucket_count, ctx);
+                    symbol_link_((Symbol*)block, ctx);
+                }
+            }
+            offset += block->info.size;
+        }
+    }
+    ctx.p->old_heap = ctx.p->heap;
+    ctx.p->heap = young;
 
-    Lisp* c = ctx.p->symbol_cache;
-    c[SYM_IF] = lisp_make_symbol("IF", ctx);
-    c[SYM_BEGIN] = lisp_make_symbol("BEGIN", ctx);
-    c[SYM_QUOTE] = lisp_make_symbol("QUOTE", ctx);
-    c[SYM_QUASI_QUOTE] = lisp_make_symbol("QUASIQUOTE", ctx);
-    c[SYM_UNQUOTE] = lisp_make_symbol("UNQUOTE", ctx);
-    c[SYM_UNQUOTE_SPLICE] = lisp_make_symbol("UNQUOTESPLICE", ctx);
-    c[SYM_DEFINE] = lisp_make_symbol("_DEF", ctx);
-    c[SYM_DEFINE_MACRO] = lisp_make_symbol("DEFINE-MACRO", ctx);
-    c[SYM_SET] = lisp_make_symbol("_SET!", ctx);
-    c[SYM_LAMBDA] = lisp_make_symbol("/\\_", ctx);
-    c[SYM_CONS] = lisp_make_symbol("CONS", ctx);
-    return ctx;
-}
+    gc_set_full_threshold_(ctx);
+    gc_set_safepoint_size_(ctx);
 
-void lisp_shutdown(LispContext ctx)
-{
-    heap_shutdown(&ctx.p->heap);
-    free(ctx.p->stack);
-    free(ctx.p);
+    free(m.pages);
+    return ctx;
 }
 
 #endif
@@ -19,9 +19,14 @@ extern "C" {
 
 void lisp_lib_load(LispContext ctx);
 
-// convenience for init and load
+// convenience for init and load.
+// Starts from the baked library image when the build options match it (see lisp_image_save).
 LispContext lisp_init_with_lib(void);
 
+// The C functions defined by the library.
+// Images with the library in them need these (see lisp_image_save).
+const LispFuncDef* lisp_lib_funcs(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -91,10 +96,6 @@ static const char* lib_0_sequences_src_ =
  (if (zero? k) x  \n\
   (list-tail (cdr x) (- k 1))))  \n\
   \n\
-(define (reduce op acc lst)  \n\
-    (if (null? lst) acc  \n\
-        (reduce op (op acc (car lst)) (cdr lst))))  \n\
- \n\
 (define (_expand-shorthand-body path)  \n\
   (if (null? path) (cons 'pair '())  \n\
       (list (if (char=? (car path) #\\A)  \n\
@@ -122,9 +123,9 @@ static const char* lib_0_sequences_src_ =
 (define (string>? a b) (string<? b a))  \n\
 (define (string<=? a b) (not (string<? b a)))  \n\
  \n\
-(define (string-copy s) (substring s 0 (string-length v))) \n\
-(define (string-head s end) (subvector s 0 end))  \n\
-(define (string-tail s start) (subvector s start (string-length v)))";
+(define (string-copy s) (substring s 0 (string-length s))) \n\
+(define (string-head s end) (substring s 0 end))  \n\
+(define (string-tail s start) (substring s start (string-length s)))";
 
 static const char* lib_1_forms_src_ = 
 "(define (_make-lambda args body)  \n\
@@ -316,105 +317,28 @@ static const char* lib_3_math_src_ =
               (apply * (cdr args))))))";
 
 static const char* lib_4_sequences_src_ = 
-"(define (map proc . rest)  \n\
- (define (helper lists result)  \n\
-  (if (some? null? lists)  \n\
-   (reverse! result)  \n\
-   (helper (map1 cdr lists)  \n\
-    (cons (apply proc (map1 car lists)) result))))  \n\
- (helper rest '()))  \n\
- \n\
-(define (for-each proc . rest)  \n\
- (define (helper lists)  \n\
-  (if (some? null? lists)  \n\
-   '()  \n\
-   (begin  \n\
-    (apply proc (map1 car lists))  \n\
-    (helper (map1 cdr lists)))))  \n\
- (helper rest))  \n\
- \n\
-(define (filter pred l)  \n\
- (define (helper l result)  \n\
-  (cond ((null? l) result)  \n\
-   ((pred (car l))  \n\
-    (helper (cdr l) (cons (car l) result)))  \n\
-   (else  \n\
-    (helper (cdr l) result))))  \n\
- (reverse! (helper l '())))  \n\
- \n\
- \n\
-(define (alist->hash-table alist)  \n\
+"(define (alist->hash-table alist)  \n\
   (define h (make-hash-table))  \n\
   (for-each1 (lambda (pair)  \n\
                (hash-table-set! h (car pair) (cdr pair))) alist)  \n\
   h)  \n\
  \n\
-(define (_assoc key list eq?)  \n\
- (if (null? list) #f  \n\
-  (let ((pair (car list)))  \n\
-    (if (and (pair? pair) (eq? key (car pair)))  \n\
-        pair  \n\
-        (_assoc key (cdr list) eq?)))))  \n\
- \n\
-(define (assoc key list) (_assoc key list equal?))  \n\
-(define (assq key list) (_assoc key list eq?))  \n\
-(define (assv key list) (_assoc key list eqv?))  \n\
- \n\
-(define (_member x list eq?)  \n\
- (cond ((null? list) #f)  \n\
-  ((eq? (car list) x) list)  \n\
-  (else (_member x (cdr list) eq?))))  \n\
- \n\
-(define (member x list) (_member x list equal?))  \n\
-(define (memq x list) (_member x list eq?))  \n\
-(define (memv x list) (_member x list eqv?))  \n\
-  \n\
 (define (make-initialized-vector l fn)  \n\
   (let ((v (make-vector l '())))  \n\
     (do ((i 0 (+ i 1)))  \n\
       ((>= i l) v)  \n\
       (vector-set! v i (fn i)))))  \n\
  \n\
-(define (vector-map fn v)  \n\
-  (make-initialized-vector  \n\
-    (vector-length v)  \n\
-    (lambda (i) (fn (vector-ref v i)))))  \n\
- \n\
-(define (vector-binary-search v key< unwrap-key key)  \n\
-  (define (helper low high mid)  \n\
-    (if (<= (- high low) 1)  \n\
-        (if (key< (unwrap-key (vector-ref v low)) key) #f (vector-ref v low))  \n\
-        (begin  \n\
-          (set! mid (+ low (quotient (- high low) 2)))  \n\
-          (if (key< key (unwrap-key (vector-ref v mid)))  \n\
-              (helper low mid 0)  \n\
-              (helper mid high 0)))))  \n\
-  (helper 0 (vector-length v) 0))  \n\
- \n\
-(define (_quicksort-partition v lo hi op)  \n\
-  (do ((pivot (vector-ref v (/ (+ lo hi) 2)) pivot)  \n\
-       (i (- lo 1) i)  \n\
-       (j (+ hi 1) j))  \n\
-    ((>= i j) j)  \n\
-    (begin  \n\
-      (do ((x (set! i (+ i 1)) x))  \n\
-        ((not (op (vector-ref v i) pivot)) '())  \n\
-        (set! i (+ i 1)))  \n\
-      (do ((x (set! j (- j 1)) x))  \n\
-        ((not (op pivot (vector-ref v j))) '())  \n\
-        (set! j (- j 1)))  \n\
-      (if (< i j) (vector-swap! v i j)))))  \n\
- \n\
-(define (_quicksort-vector v lo hi op)  \n\
-  (if (and (>= lo 0) (>= hi 0) (< lo hi))  \n\
-      (let ((p (_quicksort-partition v lo hi op)))  \n\
-        (_quicksort-vector v lo p op)  \n\
-        (_quicksort-vector v (+ p 1) hi op))))  \n\
- \n\
-(define (sort! v op)  \n\
-  (_quicksort-vector v 0 (- (vector-length v) 1) op) v)  \n\
- \n\
-(define (sort list cmp) (vector->list (sort! (list->vector list) cmp)))";
+; fn runs on worker threads, with a copy of its data \n\
+; and the globals it uses. Results are copied back. \n\
+; Maps sequentially when no workers are free. \n\
+(define (parallel-vector-map fn v)  \n\
+  (or (_parallel-vector-map fn v) (vector-map fn v)))  \n\
+ \n\
+(define (parallel-map fn . lists)  \n\
+  (if (and (pair? lists) (null? (cdr lists)))  \n\
+      (vector->list (parallel-vector-map fn (list->vector (car lists))))  \n\
+      (apply map (cons fn lists))))";
 
 static const char* lib_5_streams_src_ = 
 "(define-macro delay (lambda (expr) \n\
@@ -427,6 +351,18 @@ static const char* lib_5_streams_src_ =
       (_promise-store! promise ((_promise-procedure promise)))) \n\
   (promise-value promise)) \n\
  \n\
+; a future runs on a worker thread if one is free, \n\
+; otherwise it runs when it is touched. \n\
+; Once it is finished its worker is given back when it is touched, \n\
+; or when its context next starts a future or map. \n\
+(define (future thunk) \n\
+  (let ((slot (_future-start thunk))) \n\
+    (if slot \n\
+        (make-promise (lambda () (_future-wait slot))) \n\
+        (make-promise thunk)))) \n\
+ \n\
+(define (touch future) (force future)) \n\
+ \n\
 (define-macro cons-stream (lambda (x expr) `(cons ,x (delay ,expr)))) \n\
  \n\
 (define (stream-car stream) (car stream)) \n\
@@ -436,6 +372,7 @@ static const char* lib_5_streams_src_ =
   (and (pair? x) (promise? (cdr x)))) \n\
  \n\
 (define (stream-null? stream) (null? stream)) \n\
+(define the-empty-stream '()) \n\
  \n\
 (define (stream->list-helper stream result) \n\
   (if (stream-null? stream) \n\
@@ -444,8 +381,6 @@ static const char* lib_5_streams_src_ =
         (force (cdr stream))  \n\
         (cons (car stream) result))))  \n\
  \n\
-(define (stream->list stream)  \n\
-  (stream->list-helper stream '()))  \n\
  \n\
 (define (list->stream list)  \n\
   (if (null? list)  \n\
@@ -467,18 +402,65 @@ static const char* lib_5_streams_src_ =
       stream  \n\
       (stream-tail (stream-cdr stream) (- k 1))))  \n\
  \n\
-(define (stream-filter pred stream)  \n\
-  (cond ((stream-null? stream) the-empty-stream)  \n\
-        ((pred (stream-car stream))  \n\
-         (cons-stream (stream-car stream)  \n\
-                      (stream-filter pred  \n\
-                                     (stream-cdr stream))))  \n\
-        (else (stream-filter pred (stream-cdr stream)))))";
+ \n\
+; These take streams or generators. Stages added to a generator \n\
+; run together when it is folded, instead of making a stream for each. \n\
+(define (stream-map proc stream) \n\
+  (cond ((generator? stream) (_generator-stage 0 proc stream)) \n\
+        ((stream-null? stream) the-empty-stream) \n\
+        (else (cons-stream (proc (stream-car stream)) \n\
+                           (stream-map proc (stream-cdr stream)))))) \n\
+ \n\
+(define (stream-filter pred stream) \n\
+  (cond ((generator? stream) (_generator-stage 1 pred stream)) \n\
+        ((stream-null? stream) the-empty-stream) \n\
+        ((pred (stream-car stream)) \n\
+         (cons-stream (stream-car stream) \n\
+                      (stream-filter pred (stream-cdr stream)))) \n\
+        (else (stream-filter pred (stream-cdr stream))))) \n\
+ \n\
+(define (stream-take stream k) \n\
+  (cond ((generator? stream) (_generator-stage 2 k stream)) \n\
+        ((or (= k 0) (stream-null? stream)) the-empty-stream) \n\
+        (else (cons-stream (stream-car stream) \n\
+                           (stream-take (stream-cdr stream) (- k 1)))))) \n\
+ \n\
+(define (stream-take-while pred stream) \n\
+  (cond ((generator? stream) (_generator-stage 3 pred stream)) \n\
+        ((or (stream-null? stream) (not (pred (stream-car stream)))) the-empty-stream) \n\
+        (else (cons-stream (stream-car stream) \n\
+                           (stream-take-while pred (stream-cdr stream)))))) \n\
+ \n\
+; (op acc x) like reduce \n\
+(define (stream-fold op acc stream) \n\
+  (cond ((generator? stream) (_generator-run 0 op acc stream)) \n\
+        ((stream-null? stream) acc) \n\
+        (else (stream-fold op (op acc (stream-car stream)) (stream-cdr stream))))) \n\
+ \n\
+(define (stream-for-each proc stream) \n\
+  (cond ((generator? stream) (_generator-run 1 proc '() stream)) \n\
+        ((stream-null? stream) '()) \n\
+        (else (proc (stream-car stream)) \n\
+              (stream-for-each proc (stream-cdr stream))))) \n\
+ \n\
+(define (stream->list stream) \n\
+  (if (generator? stream) \n\
+      (_generator-run 2 '() '() stream) \n\
+      (stream->list-helper stream '())))";
 
 static const char* lib_6_other_src_ = 
 "(define (procedure? p) (or (compiled-procedure? p) (compound-procedure? p)))  \n\
   \n\
-(define (newline) (write-char #\\newline))  \n\
+(define (newline . port) (apply write-char (cons #\\newline port))) \n\
+ \n\
+; output from thunk is collected in a string. \n\
+; An error inside resets the output port when evaluation unwinds. \n\
+(define (with-output-to-string thunk) \n\
+  (let* ((port (open-output-string)) \n\
+         (old (_set-output-port! port))) \n\
+    (thunk) \n\
+    (_set-output-port! old) \n\
+    (get-output-string port))) \n\
  \n\
 (define-macro assert (lambda (body)  \n\
                        `(if ,body '()  \n\
@@ -489,6 +471,5198 @@ static const char* lib_6_other_src_ =
 (define-macro ==>  (lambda (test expected)  \n\
                 `(assert (equal? ,test (quote ,expected))) ))";
 
+// Generated image of the library (see lisp_image_save).
+#define LISP_LIB_IMAGE_
+static const unsigned char lib_image_[] = {
+76,73,83,80,73,77,71,4,4,3,2,1,8,0,0,0,16,0,0,0,16,0,0,0,32,0,0,0,16,0,0,0,
+56,0,0,0,48,0,0,0,32,0,0,0,32,0,0,0,32,0,0,0,24,0,0,0,0,0,8,0,11,0,0,0,
+22,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,
+0,0,0,0,1,0,0,0,4,0,0,0,0,0,0,0,32,0,0,0,1,0,0,0,9,0,0,0,0,0,0,0,
+0,0,0,0,2,0,0,0,5,0,0,0,0,0,0,0,40,0,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+80,0,0,0,2,0,0,0,5,0,0,0,0,0,0,0,120,0,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+168,0,0,0,2,0,0,0,5,0,0,0,0,0,0,0,208,0,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+0,1,0,0,2,0,0,0,5,0,0,0,0,0,0,0,40,1,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+88,1,0,0,2,0,0,0,5,0,0,0,0,0,0,0,128,1,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+168,1,0,0,2,0,0,0,5,0,0,0,0,0,0,0,208,255,7,0,0,0,0,0,56,67,2,0,0,0,0,0,
+32,0,0,0,0,0,0,0,9,4,0,0,0,4,1,0,80,0,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+48,0,0,0,0,0,0,0,0,0,0,0,0,9,1,0,21,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,
+160,0,0,0,1,0,0,0,240,2,0,0,1,0,0,0,48,0,0,0,0,0,0,0,0,1,0,0,0,9,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,9,0,0,0,0,4,1,0,64,5,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+80,2,0,0,0,0,0,0,64,0,0,0,0,11,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,216,49,0,0,2,0,0,0,224,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,52,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,224,51,0,0,2,0,0,0,64,39,0,0,2,0,0,0,176,49,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,49,0,0,2,0,0,0,48,55,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,144,54,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+128,52,0,0,2,0,0,0,16,44,0,0,2,0,0,0,24,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,40,0,0,2,0,0,0,24,67,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,144,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+184,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,53,0,0,2,0,0,0,0,61,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,96,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,55,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,67,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,5,0,0,0,5,0,0,5,5,5,0,0,
+5,5,0,5,0,0,0,0,0,0,5,5,5,0,0,0,5,5,0,0,0,0,0,5,0,0,5,0,0,0,0,0,
+5,5,0,5,0,0,0,0,5,0,0,0,0,5,0,0,80,2,0,0,0,0,0,0,64,0,0,0,0,11,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,5,0,0,1,0,0,0,
+168,5,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+224,5,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,6,0,0,1,0,0,0,
+80,6,0,0,1,0,0,0,136,6,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+192,6,0,0,1,0,0,0,248,6,0,0,1,0,0,0,0,0,0,0,0,0,0,0,48,7,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,7,0,0,1,0,0,0,160,7,0,0,1,0,0,0,
+216,7,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,8,0,0,1,0,0,0,72,8,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,8,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,8,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+240,8,0,0,1,0,0,0,40,9,0,0,1,0,0,0,0,0,0,0,0,0,0,0,96,9,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+152,9,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,208,9,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,7,7,0,0,0,7,0,0,7,7,7,0,0,7,7,0,7,0,0,0,0,0,0,7,7,7,0,0,0,
+7,7,0,0,0,0,0,7,0,0,7,0,0,0,0,0,7,7,0,7,0,0,0,0,7,0,0,0,0,7,0,0,
+48,0,0,0,0,0,0,0,0,1,0,0,0,9,1,0,39,1,0,0,0,4,0,0,0,0,0,0,0,0,0,0,
+8,10,0,0,1,0,0,0,24,46,0,0,1,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,
+72,82,0,0,1,0,0,0,40,82,0,0,1,0,0,0,0,0,0,0,1,0,0,0,104,82,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,144,82,0,0,1,0,0,0,
+56,50,0,0,2,0,0,0,0,0,0,0,1,0,0,0,176,82,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,240,82,0,0,1,0,0,0,208,82,0,0,1,0,0,0,
+0,0,0,0,1,0,0,0,16,83,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+4,4,0,0,0,7,1,0,88,83,0,0,1,0,0,0,56,83,0,0,1,0,0,0,0,0,0,0,1,0,0,0,
+120,83,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,
+160,83,0,0,1,0,0,0,104,39,0,0,2,0,0,0,0,0,0,0,1,0,0,0,192,83,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,0,84,0,0,1,0,0,0,
+224,83,0,0,1,0,0,0,0,0,0,0,1,0,0,0,32,84,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,72,84,0,0,1,0,0,0,104,39,0,0,2,0,0,0,
+0,0,0,0,1,0,0,0,104,84,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,168,84,0,0,1,0,0,0,136,84,0,0,1,0,0,0,0,0,0,0,1,0,0,0,
+200,84,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,
+8,85,0,0,1,0,0,0,232,84,0,0,1,0,0,0,0,0,0,0,1,0,0,0,40,85,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,112,85,0,0,1,0,0,0,
+80,85,0,0,1,0,0,0,0,0,0,0,1,0,0,0,144,85,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,192,85,0,0,1,0,0,0,104,39,0,0,2,0,0,0,
+0,0,0,0,1,0,0,0,224,85,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,32,86,0,0,1,0,0,0,0,86,0,0,1,0,0,0,0,0,0,0,1,0,0,0,
+64,86,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+136,86,0,0,1,0,0,0,104,86,0,0,1,0,0,0,0,0,0,0,1,0,0,0,168,86,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,240,86,0,0,1,0,0,0,
+208,86,0,0,1,0,0,0,0,0,0,0,1,0,0,0,16,87,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,80,87,0,0,1,0,0,0,48,87,0,0,1,0,0,0,
+0,0,0,0,1,0,0,0,112,87,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+4,5,0,0,0,7,1,0,152,87,0,0,1,0,0,0,56,51,0,0,2,0,0,0,0,0,0,0,1,0,0,0,
+184,87,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,
+248,87,0,0,1,0,0,0,216,87,0,0,1,0,0,0,0,0,0,0,1,0,0,0,24,88,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,96,88,0,0,1,0,0,0,
+64,88,0,0,1,0,0,0,0,0,0,0,1,0,0,0,128,88,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,160,88,0,0,1,0,0,0,56,51,0,0,2,0,0,0,
+0,0,0,0,1,0,0,0,192,88,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,0,89,0,0,1,0,0,0,224,88,0,0,1,0,0,0,0,0,0,0,1,0,0,0,
+32,89,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+96,89,0,0,1,0,0,0,64,89,0,0,1,0,0,0,0,0,0,0,1,0,0,0,128,89,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,16,36,0,0,0,0,0,0,0,4,0,0,0,11,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,16,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,13,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,32,0,0,2,0,0,0,96,30,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,240,46,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+176,13,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,59,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+136,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,136,3,0,0,2,0,0,0,0,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,7,0,0,2,0,0,0,160,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,8,0,0,2,0,0,0,120,9,0,0,2,0,0,0,
+16,26,0,0,2,0,0,0,0,0,0,0,0,0,0,0,144,31,0,0,2,0,0,0,128,49,0,0,2,0,0,0,
+64,21,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,64,35,0,0,2,0,0,0,96,33,0,0,2,0,0,0,224,34,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,45,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,26,0,0,2,0,0,0,
+96,15,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,240,8,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,3,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,8,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,14,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+184,11,0,0,2,0,0,0,224,65,0,0,2,0,0,0,160,21,0,0,2,0,0,0,0,50,0,0,2,0,0,0,
+8,5,0,0,2,0,0,0,192,46,0,0,2,0,0,0,56,57,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,38,0,0,2,0,0,0,
+144,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+232,57,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,26,0,0,2,0,0,0,
+184,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,26,0,0,2,0,0,0,56,36,0,0,2,0,0,0,
+64,58,0,0,2,0,0,0,0,0,0,0,0,0,0,0,152,56,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,6,0,0,2,0,0,0,
+112,21,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,25,0,0,2,0,0,0,
+200,64,0,0,2,0,0,0,120,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+216,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,168,55,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,88,11,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,65,0,0,2,0,0,0,232,17,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,96,29,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,168,47,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+232,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,232,12,0,0,2,0,0,0,0,0,0,0,0,0,0,0,208,21,0,0,2,0,0,0,
+144,7,0,0,2,0,0,0,160,14,0,0,2,0,0,0,184,66,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,88,55,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,192,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+8,36,0,0,2,0,0,0,96,57,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,48,15,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+80,20,0,0,2,0,0,0,56,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,184,57,0,0,2,0,0,0,0,0,0,0,0,0,0,0,72,9,0,0,2,0,0,0,
+72,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,18,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,200,31,0,0,2,0,0,0,224,22,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+80,13,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,31,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,66,0,0,2,0,0,0,0,0,0,0,0,0,0,0,152,25,0,0,2,0,0,0,248,41,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,128,55,0,0,2,0,0,0,72,56,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,72,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+88,17,0,0,2,0,0,0,104,10,0,0,2,0,0,0,72,18,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,176,12,0,0,2,0,0,0,200,15,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+192,5,0,0,2,0,0,0,0,0,0,0,0,0,0,0,128,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+192,16,0,0,2,0,0,0,32,25,0,0,2,0,0,0,208,55,0,0,2,0,0,0,64,8,0,0,2,0,0,0,
+80,3,0,0,2,0,0,0,40,24,0,0,2,0,0,0,208,24,0,0,2,0,0,0,104,5,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+136,16,0,0,2,0,0,0,0,0,0,0,0,0,0,0,184,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,21,0,0,2,0,0,0,56,33,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,57,0,0,2,0,0,0,
+128,23,0,0,2,0,0,0,0,0,0,0,0,0,0,0,8,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+144,38,0,0,2,0,0,0,32,32,0,0,2,0,0,0,232,56,0,0,2,0,0,0,8,64,0,0,2,0,0,0,
+104,66,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+232,38,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,160,4,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+40,43,0,0,2,0,0,0,136,51,0,0,2,0,0,0,104,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,32,0,0,2,0,0,0,24,23,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,96,38,0,0,2,0,0,0,0,0,0,0,0,0,0,0,176,23,0,0,2,0,0,0,
+240,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,168,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+168,18,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+184,38,0,0,2,0,0,0,0,0,0,0,0,0,0,0,120,22,0,0,2,0,0,0,48,48,0,0,2,0,0,0,
+248,21,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,58,0,0,2,0,0,0,96,26,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+160,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,12,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,208,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,22,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,8,27,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,240,33,0,0,2,0,0,0,0,0,0,0,0,0,0,0,120,2,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,2,0,0,0,72,44,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,18,0,0,2,0,0,0,104,54,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,64,46,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,31,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,176,29,0,0,2,0,0,0,240,29,0,0,2,0,0,0,
+16,33,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,28,0,0,2,0,0,0,
+248,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,20,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,40,16,0,0,2,0,0,0,0,0,0,0,0,0,0,0,136,17,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,56,10,0,0,2,0,0,0,16,35,0,0,2,0,0,0,120,42,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,4,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,192,56,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,9,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,24,0,0,2,0,0,0,160,62,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+208,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+152,5,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,7,0,0,2,0,0,0,
+192,19,0,0,2,0,0,0,200,10,0,0,2,0,0,0,248,15,0,0,2,0,0,0,136,27,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,96,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,24,8,0,0,2,0,0,0,
+8,10,0,0,2,0,0,0,0,63,0,0,2,0,0,0,112,25,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,104,58,0,0,2,0,0,0,0,0,0,0,0,0,0,0,224,58,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,29,0,0,2,0,0,0,
+120,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,96,27,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,42,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,216,23,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+96,59,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+128,20,0,0,2,0,0,0,0,0,0,0,0,0,0,0,88,16,0,0,2,0,0,0,8,38,0,0,2,0,0,0,
+8,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,16,28,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+152,8,0,0,2,0,0,0,104,28,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,152,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+232,32,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,19,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,12,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+240,19,0,0,2,0,0,0,216,47,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,28,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,56,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,184,27,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+200,33,0,0,2,0,0,0,48,63,0,0,2,0,0,0,176,65,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+24,9,0,0,2,0,0,0,136,11,0,0,2,0,0,0,192,25,0,0,2,0,0,0,0,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,224,3,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,23,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,33,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,40,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,224,20,0,0,2,0,0,0,0,0,0,0,0,0,0,0,160,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,112,32,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+48,31,0,0,2,0,0,0,0,0,0,0,0,0,0,0,136,26,0,0,2,0,0,0,40,11,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,20,0,0,2,0,0,0,240,31,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,40,17,0,0,2,0,0,0,152,37,0,0,2,0,0,0,48,5,0,0,2,0,0,0,
+88,40,0,0,2,0,0,0,112,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+216,9,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+168,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,80,12,0,0,2,0,0,0,200,30,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,232,25,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,30,0,0,2,0,0,0,
+208,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,176,3,0,0,2,0,0,0,168,60,0,0,2,0,0,0,
+8,59,0,0,2,0,0,0,112,60,0,0,2,0,0,0,0,0,0,0,0,0,0,0,168,42,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,216,4,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,168,1,0,0,2,0,0,0,240,11,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+136,29,0,0,2,0,0,0,0,0,0,0,0,0,0,0,120,61,0,0,2,0,0,0,64,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,240,45,0,0,2,0,0,0,120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+48,19,0,0,2,0,0,0,176,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,46,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,47,0,0,2,0,0,0,144,15,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+72,22,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+248,55,0,0,2,0,0,0,224,27,0,0,2,0,0,0,104,7,0,0,2,0,0,0,56,59,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,80,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,10,0,0,2,0,0,0,248,28,0,0,2,0,0,0,
+224,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,13,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,144,30,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+216,35,0,0,2,0,0,0,32,47,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,64,28,0,0,2,0,0,0,192,32,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+208,14,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,22,0,0,2,0,0,0,
+16,14,0,0,2,0,0,0,200,44,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,152,10,0,0,2,0,0,0,16,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,35,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+16,60,0,0,2,0,0,0,24,46,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+216,18,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,80,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,14,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,184,17,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,19,0,0,2,0,0,0,80,2,0,0,2,0,0,0,24,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,224,13,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+232,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,63,0,0,2,0,0,0,136,57,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,112,56,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+144,6,0,0,2,0,0,0,16,4,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,43,0,0,2,0,0,0,232,5,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,27,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,44,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,64,4,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,5,0,5,0,0,0,0,0,5,5,0,5,0,0,5,0,0,0,0,0,0,0,0,0,5,
+0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,5,5,0,0,5,5,5,0,5,5,5,0,0,
+0,0,5,5,5,0,0,0,5,0,0,0,5,5,0,0,5,0,0,0,5,0,0,5,0,0,0,0,5,0,0,0,
+0,5,5,5,5,5,5,5,0,0,0,0,5,5,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,5,5,0,5,5,5,0,5,0,0,0,0,5,5,0,0,5,5,5,0,0,5,0,0,
+0,5,0,5,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,
+0,0,5,0,0,5,0,0,0,0,5,0,5,5,5,5,0,0,5,0,0,0,5,0,0,5,5,0,0,0,5,0,
+0,5,5,0,0,0,5,0,5,5,0,0,5,0,5,5,0,5,0,0,0,0,0,0,0,5,0,0,0,0,0,0,
+0,5,0,5,5,0,5,5,0,0,0,0,0,0,5,0,0,5,5,5,0,0,5,5,0,0,0,0,0,0,0,0,
+0,5,0,5,0,5,5,5,5,5,5,5,5,0,0,0,0,0,0,0,0,5,0,5,0,0,0,0,0,5,5,0,
+0,0,0,0,5,5,0,5,0,5,5,5,5,5,0,0,0,0,0,0,0,5,0,0,0,0,0,5,0,0,5,0,
+0,0,0,0,0,5,5,5,0,0,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,5,0,5,5,0,0,
+0,0,0,0,0,0,0,0,0,5,0,5,0,0,0,0,0,0,0,0,0,5,0,0,0,5,0,5,5,5,0,0,
+0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,0,5,0,0,5,0,5,0,0,0,0,0,5,0,5,0,
+0,0,5,0,5,0,0,0,0,0,0,5,5,0,0,0,0,5,5,0,0,0,5,0,0,0,0,5,0,0,0,0,
+0,0,0,0,0,5,0,5,5,5,0,0,0,0,0,0,5,5,0,5,0,0,0,0,0,0,5,0,5,0,5,5,
+5,0,0,0,0,0,0,0,5,0,0,0,5,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,5,0,0,5,5,0,0,0,0,0,0,5,0,5,0,0,0,0,0,0,
+0,5,0,0,5,5,5,5,5,0,5,0,5,5,5,5,0,0,0,0,0,0,5,0,5,0,0,0,0,0,0,0,
+0,0,0,0,5,5,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,5,0,5,0,
+0,5,0,0,0,5,0,5,5,5,0,5,0,5,5,0,0,0,0,0,0,0,0,0,0,0,5,0,0,5,0,0,
+5,0,0,5,0,0,0,0,0,5,5,0,0,0,0,0,0,0,0,5,0,0,0,0,0,0,0,0,5,0,5,0,
+0,0,0,0,0,5,5,5,0,5,5,5,5,0,5,0,0,0,0,0,5,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,5,0,0,5,0,0,0,5,0,5,0,5,0,0,5,0,5,5,0,0,5,5,0,5,5,5,5,5,0,
+0,5,0,0,0,5,0,5,5,0,5,0,0,0,0,0,5,5,0,5,5,5,5,0,5,0,0,5,0,0,0,0,
+0,0,5,0,0,0,0,0,5,0,5,5,0,0,0,0,0,0,0,0,0,5,0,5,5,0,5,5,0,5,5,0,
+0,0,0,0,5,0,0,5,5,0,0,0,0,5,0,0,0,0,0,5,0,5,5,5,5,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,5,0,0,0,0,5,5,5,0,0,5,0,5,0,0,5,5,0,0,0,5,5,
+0,5,0,0,5,5,5,0,0,0,5,5,0,0,0,0,5,0,0,0,0,0,0,0,0,5,5,0,0,0,0,0,
+0,5,0,0,0,0,0,0,0,0,5,0,0,0,0,5,0,0,0,0,0,0,5,0,0,5,5,5,0,0,0,0,
+5,0,0,5,0,5,0,0,0,0,0,5,5,0,0,0,0,0,5,0,0,5,5,0,0,0,0,5,5,0,0,0,
+0,0,0,0,0,0,0,0,5,0,0,5,0,0,5,0,0,0,0,0,0,0,0,0,16,36,0,0,0,0,0,0,
+0,4,0,0,0,11,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+168,89,0,0,1,0,0,0,0,0,0,0,0,0,0,0,200,89,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+232,89,0,0,1,0,0,0,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,90,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,90,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+96,90,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,90,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,9,0,0,0,0,0,0,0,
+208,90,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+8,91,0,0,1,0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,40,91,0,0,1,0,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+164,0,0,0,0,0,0,0,72,91,0,0,1,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,91,0,0,1,0,0,0,
+160,91,0,0,1,0,0,0,183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,192,91,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,138,0,0,0,0,0,0,0,248,91,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,24,92,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,92,0,0,1,0,0,0,88,92,0,0,1,0,0,0,
+108,0,0,0,0,0,0,0,144,92,0,0,1,0,0,0,200,92,0,0,1,0,0,0,232,92,0,0,1,0,0,0,
+32,93,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,200,0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,93,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,139,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+135,0,0,0,0,0,0,0,144,93,0,0,1,0,0,0,176,93,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+232,93,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,23,0,0,0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,129,0,0,0,0,0,0,0,32,94,0,0,1,0,0,0,181,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,94,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,94,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+176,94,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,94,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+8,95,0,0,1,0,0,0,64,95,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,95,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,95,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,109,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,184,95,0,0,1,0,0,0,
+216,95,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,96,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,96,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,96,0,0,1,0,0,0,160,96,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,96,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,101,0,0,0,0,0,0,0,195,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,96,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,48,97,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,104,97,0,0,1,0,0,0,0,0,0,0,0,0,0,0,136,97,0,0,1,0,0,0,
+115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,97,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,200,97,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+131,0,0,0,0,0,0,0,0,98,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,98,0,0,1,0,0,0,
+112,98,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,98,0,0,1,0,0,0,49,0,0,0,0,0,0,0,
+200,98,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,98,0,0,1,0,0,0,
+8,99,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,99,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+72,99,0,0,1,0,0,0,0,0,0,0,0,0,0,0,128,99,0,0,1,0,0,0,128,0,0,0,0,0,0,0,
+160,99,0,0,1,0,0,0,37,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,216,99,0,0,1,0,0,0,
+126,0,0,0,0,0,0,0,19,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,248,99,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+24,100,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,56,100,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,88,100,0,0,1,0,0,0,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+144,100,0,0,1,0,0,0,0,0,0,0,0,0,0,0,202,0,0,0,0,0,0,0,176,100,0,0,1,0,0,0,
+208,100,0,0,1,0,0,0,8,101,0,0,1,0,0,0,64,101,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,204,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+120,101,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,15,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,101,0,0,1,0,0,0,232,101,0,0,1,0,0,0,
+32,102,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+88,102,0,0,1,0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,201,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,120,102,0,0,1,0,0,0,152,102,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,102,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,103,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+113,0,0,0,0,0,0,0,40,103,0,0,1,0,0,0,96,103,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,103,0,0,1,0,0,0,136,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,103,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,216,103,0,0,1,0,0,0,0,0,0,0,0,0,0,0,248,103,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,104,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+80,104,0,0,1,0,0,0,112,104,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,104,0,0,1,0,0,0,200,104,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+163,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+155,0,0,0,0,0,0,0,156,0,0,0,0,0,0,0,56,105,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,88,105,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,144,105,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,176,105,0,0,1,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+184,0,0,0,0,0,0,0,208,105,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,8,106,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,14,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+40,106,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,96,106,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+128,106,0,0,1,0,0,0,160,106,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+216,106,0,0,1,0,0,0,0,0,0,0,0,0,0,0,248,106,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,107,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,80,107,0,0,1,0,0,0,98,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,
+112,107,0,0,1,0,0,0,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,196,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,144,107,0,0,1,0,0,0,176,107,0,0,1,0,0,0,
+130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,107,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,108,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,88,108,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,142,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,144,108,0,0,1,0,0,0,0,0,0,0,0,0,0,0,200,108,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,108,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,109,0,0,1,0,0,0,199,0,0,0,0,0,0,0,64,109,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,109,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,176,109,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+208,109,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,240,109,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,40,110,0,0,1,0,0,0,0,0,0,0,0,0,0,0,125,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,110,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+128,110,0,0,1,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,184,110,0,0,1,0,0,0,
+132,0,0,0,0,0,0,0,216,110,0,0,1,0,0,0,0,0,0,0,0,0,0,0,248,110,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,111,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,111,0,0,1,0,0,0,0,0,0,0,0,0,0,0,112,111,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+137,0,0,0,0,0,0,0,144,111,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+103,0,0,0,0,0,0,0,176,111,0,0,1,0,0,0,0,0,0,0,0,0,0,0,208,111,0,0,1,0,0,0,
+197,0,0,0,0,0,0,0,18,0,0,0,0,0,0,0,240,111,0,0,1,0,0,0,40,112,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,112,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+128,112,0,0,1,0,0,0,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,157,0,0,0,0,0,0,0,198,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+10,0,0,0,0,0,0,0,160,112,0,0,1,0,0,0,216,112,0,0,1,0,0,0,16,113,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,72,113,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+128,113,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,184,113,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,216,113,0,0,1,0,0,0,
+248,113,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,114,0,0,1,0,0,0,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,114,0,0,1,0,0,0,
+136,114,0,0,1,0,0,0,0,0,0,0,0,0,0,0,192,114,0,0,1,0,0,0,182,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,224,114,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+24,115,0,0,1,0,0,0,80,115,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+112,115,0,0,1,0,0,0,0,0,0,0,0,0,0,0,168,115,0,0,1,0,0,0,145,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,224,115,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,116,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+52,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,6,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,80,116,0,0,1,0,0,0,0,0,0,0,0,0,0,0,159,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,112,116,0,0,1,0,0,0,144,116,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,
+200,116,0,0,1,0,0,0,0,0,0,0,0,0,0,0,232,116,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,111,0,0,0,0,0,0,0,8,117,0,0,1,0,0,0,40,117,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,
+96,117,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,128,117,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,117,0,0,1,0,0,0,216,117,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,118,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+48,118,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,118,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+179,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+112,118,0,0,1,0,0,0,0,0,0,0,0,0,0,0,144,118,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+176,118,0,0,1,0,0,0,232,118,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,119,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,119,0,0,1,0,0,0,12,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+120,119,0,0,1,0,0,0,176,119,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+208,119,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,13,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,17,0,0,0,0,0,17,
+8,0,7,0,0,17,0,0,0,0,0,0,0,0,0,7,0,0,0,0,0,7,0,0,0,0,8,7,0,0,0,0,
+0,0,0,17,8,0,0,8,17,8,0,8,7,8,0,0,0,0,17,17,8,0,0,0,7,0,0,0,8,17,0,0,
+8,0,0,0,8,0,0,8,0,0,0,0,17,0,0,0,0,17,7,8,7,17,7,7,0,0,0,0,8,8,0,0,
+0,0,0,0,0,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,8,0,8,17,7,0,7,
+0,0,0,0,8,8,0,0,8,7,8,0,0,17,0,0,0,7,0,7,0,0,0,0,0,0,17,0,0,0,0,7,
+17,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,7,0,0,8,0,0,0,0,17,0,8,8,17,7,
+0,0,7,0,0,0,7,0,0,17,7,0,0,0,17,0,0,8,8,0,0,0,7,0,8,7,0,0,17,0,17,8,
+0,17,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,7,0,8,7,0,7,7,0,0,0,0,0,0,8,0,
+0,17,8,17,0,0,17,17,0,0,0,0,0,0,0,0,0,17,0,7,0,17,8,7,8,8,17,8,8,0,0,0,
+0,0,0,0,0,17,0,17,0,0,0,0,0,8,17,0,0,0,0,0,7,8,0,17,0,8,17,7,7,7,0,0,
+0,0,0,0,0,8,0,0,0,0,0,7,0,0,8,0,0,0,0,0,0,7,7,7,0,0,0,0,0,0,0,17,
+8,0,0,0,0,0,0,0,0,0,8,0,17,7,0,0,0,0,0,0,0,0,0,0,0,7,0,8,0,0,0,0,
+0,0,0,0,0,17,0,0,0,8,0,8,7,17,0,0,0,0,0,0,0,7,8,0,0,0,0,0,0,0,0,0,
+0,17,0,0,17,0,7,0,0,0,0,0,8,0,8,0,0,0,17,0,8,0,0,0,0,0,0,17,7,0,0,0,
+0,17,7,0,0,0,7,0,0,0,0,8,0,0,0,0,0,0,0,0,0,8,0,8,8,17,0,0,0,0,0,0,
+8,7,0,8,0,0,0,0,0,0,17,0,17,0,8,8,7,0,0,0,0,0,0,0,17,0,0,0,8,0,0,7,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,17,
+7,0,0,0,0,0,0,17,0,7,0,0,0,0,0,0,0,17,0,0,17,8,8,17,8,0,8,0,8,17,7,8,
+0,0,0,0,0,0,7,0,7,0,0,0,0,0,0,0,0,0,0,0,8,7,0,0,0,0,8,0,0,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,7,0,17,0,0,7,0,0,0,8,0,17,8,7,0,8,0,8,8,0,
+0,0,0,0,0,0,0,0,0,0,7,0,0,17,0,0,8,0,0,17,0,0,0,0,0,8,7,0,0,0,0,0,
+0,0,0,8,0,0,0,0,0,0,0,0,7,0,8,0,0,0,0,0,0,17,0,7,0,8,17,8,17,0,17,0,
+0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,17,0,0,8,0,0,0,8,0,7,0,17,0,
+0,8,0,8,17,0,0,8,17,0,17,8,8,7,17,0,0,8,0,0,0,7,0,17,8,0,8,0,0,0,0,0,
+8,8,0,8,7,7,7,0,7,0,0,7,0,0,0,0,0,0,17,0,0,0,0,0,8,0,17,17,0,0,0,0,
+0,0,0,0,0,8,0,7,8,0,7,7,0,17,8,0,0,0,0,0,7,0,0,7,17,0,0,0,0,8,0,0,
+0,0,0,7,0,7,8,8,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,7,0,0,0,0,8,
+8,8,0,0,17,0,8,0,0,17,7,0,0,0,8,17,0,17,0,0,8,17,7,0,0,0,8,17,0,0,0,0,
+17,0,0,0,0,0,0,0,0,7,7,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,17,0,0,0,0,17,
+0,0,0,0,0,0,17,0,0,8,8,8,0,0,0,0,8,0,0,17,0,17,0,0,0,0,0,7,7,0,0,0,
+0,0,7,0,0,17,8,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,8,0,0,7,0,0,8,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,5,0,0,0,4,1,0,104,48,0,0,2,0,0,0,
+8,48,0,0,2,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+8,120,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,104,48,0,0,2,0,0,0,
+8,48,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,40,120,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+56,50,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+160,44,0,0,2,0,0,0,72,120,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+104,120,0,0,1,0,0,0,160,120,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+160,44,0,0,2,0,0,0,32,41,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,5,0,0,0,4,1,0,8,52,0,0,2,0,0,0,56,50,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,192,120,0,0,1,0,0,0,224,120,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,8,52,0,0,2,0,0,0,56,50,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,0,121,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,104,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,5,0,0,0,4,1,0,104,48,0,0,2,0,0,0,8,48,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,32,121,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,104,48,0,0,2,0,0,0,8,48,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+64,121,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,104,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,121,0,0,1,0,0,0,
+152,121,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,224,39,0,0,2,0,0,0,
+184,121,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,121,0,0,1,0,0,0,
+248,121,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,
+184,54,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+168,52,0,0,2,0,0,0,24,122,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+56,122,0,0,1,0,0,0,88,122,0,0,1,0,0,0,48,0,0,0,0,0,0,0,3,0,0,0,0,11,1,0,
+168,52,0,0,2,0,0,0,208,52,0,0,2,0,0,0,0,53,0,0,2,0,0,0,5,5,5,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,122,0,0,1,0,0,0,176,122,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,104,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,224,39,0,0,2,0,0,0,208,122,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,122,0,0,1,0,0,0,40,123,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,48,52,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,5,0,0,0,4,1,0,184,39,0,0,2,0,0,0,
+48,40,0,0,2,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+72,123,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,184,39,0,0,2,0,0,0,
+48,40,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+8,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+104,123,0,0,1,0,0,0,160,123,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+8,48,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+184,39,0,0,2,0,0,0,192,123,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,224,123,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+184,39,0,0,2,0,0,0,224,39,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,0,124,0,0,1,0,0,0,32,124,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,56,51,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,240,53,0,0,2,0,0,0,64,124,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,96,124,0,0,1,0,0,0,152,124,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,240,53,0,0,2,0,0,0,8,48,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,48,52,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,184,124,0,0,1,0,0,0,240,124,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,48,52,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,125,0,0,1,0,0,0,72,125,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,56,51,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,125,0,0,1,0,0,0,160,125,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,104,67,0,0,2,0,0,0,192,125,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,125,0,0,1,0,0,0,24,126,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,104,67,0,0,2,0,0,0,144,67,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,83,0,0,0,0,0,0,0,
+1,0,0,0,3,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,63,0,0,0,0,0,0,0,
+1,0,0,0,3,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,168,0,0,0,0,0,0,0,
+3,0,0,0,3,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,88,126,0,0,1,0,0,0,
+56,126,0,0,1,0,0,0,128,0,0,0,1,0,0,0,120,126,0,0,1,0,0,0,240,46,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,66,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,192,126,0,0,1,0,0,0,160,126,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,224,126,0,0,1,0,0,0,136,59,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,40,127,0,0,1,0,0,0,8,127,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+72,127,0,0,1,0,0,0,136,50,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+136,127,0,0,1,0,0,0,104,127,0,0,1,0,0,0,128,0,0,0,1,0,0,0,168,127,0,0,1,0,0,0,
+0,43,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,30,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,44,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,232,127,0,0,1,0,0,0,
+200,127,0,0,1,0,0,0,128,0,0,0,1,0,0,0,8,128,0,0,1,0,0,0,128,49,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,185,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,175,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,80,128,0,0,1,0,0,0,48,128,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,112,128,0,0,1,0,0,0,32,45,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,75,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,69,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,56,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,184,128,0,0,1,0,0,0,152,128,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+216,128,0,0,1,0,0,0,224,65,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,
+24,129,0,0,1,0,0,0,248,128,0,0,1,0,0,0,128,0,0,0,1,0,0,0,56,129,0,0,1,0,0,0,
+0,50,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,17,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,120,129,0,0,1,0,0,0,
+88,129,0,0,1,0,0,0,128,0,0,0,1,0,0,0,152,129,0,0,1,0,0,0,192,46,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,224,129,0,0,1,0,0,0,192,129,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,0,130,0,0,1,0,0,0,56,57,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,64,130,0,0,1,0,0,0,32,130,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+96,130,0,0,1,0,0,0,232,57,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+190,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+160,130,0,0,1,0,0,0,128,130,0,0,1,0,0,0,128,0,0,0,1,0,0,0,192,130,0,0,1,0,0,0,
+64,58,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,8,131,0,0,1,0,0,0,
+232,130,0,0,1,0,0,0,128,0,0,0,1,0,0,0,40,131,0,0,1,0,0,0,152,56,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,104,131,0,0,1,0,0,0,72,131,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,136,131,0,0,1,0,0,0,200,64,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,193,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,208,131,0,0,1,0,0,0,176,131,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+240,131,0,0,1,0,0,0,72,62,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+48,132,0,0,1,0,0,0,16,132,0,0,1,0,0,0,128,0,0,0,1,0,0,0,80,132,0,0,1,0,0,0,
+168,55,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,54,0,0,0,0,0,0,0,
+0,0,0,0,255,255,255,255,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,144,132,0,0,1,0,0,0,
+112,132,0,0,1,0,0,0,128,0,0,0,1,0,0,0,176,132,0,0,1,0,0,0,48,65,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,88,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,0,133,0,0,1,0,0,0,224,132,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,32,133,0,0,1,0,0,0,168,47,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,62,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,71,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+4,4,0,0,0,7,1,0,104,133,0,0,1,0,0,0,72,133,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+136,133,0,0,1,0,0,0,184,66,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+200,133,0,0,1,0,0,0,168,133,0,0,1,0,0,0,128,0,0,0,1,0,0,0,232,133,0,0,1,0,0,0,
+88,55,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,40,134,0,0,1,0,0,0,
+8,134,0,0,1,0,0,0,128,0,0,0,1,0,0,0,72,134,0,0,1,0,0,0,192,48,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,189,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,168,134,0,0,1,0,0,0,136,134,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,200,134,0,0,1,0,0,0,96,57,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,74,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,8,135,0,0,1,0,0,0,232,134,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+40,135,0,0,1,0,0,0,184,57,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+104,135,0,0,1,0,0,0,72,135,0,0,1,0,0,0,128,0,0,0,1,0,0,0,136,135,0,0,1,0,0,0,
+72,41,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,91,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,165,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,64,0,0,0,0,0,0,0,
+2,0,0,0,4,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,216,135,0,0,1,0,0,0,
+184,135,0,0,1,0,0,0,128,0,0,0,1,0,0,0,248,135,0,0,1,0,0,0,16,66,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,56,136,0,0,1,0,0,0,24,136,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,88,136,0,0,1,0,0,0,248,41,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+0,4,1,0,0,7,1,0,0,0,0,0,0,0,0,0,128,136,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+160,136,0,0,1,0,0,0,128,55,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+224,136,0,0,1,0,0,0,192,136,0,0,1,0,0,0,128,0,0,0,1,0,0,0,0,137,0,0,1,0,0,0,
+72,56,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,85,0,0,0,0,0,0,0,
+2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,90,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,61,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,77,0,0,0,0,0,0,0,
+2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,21,0,0,0,0,0,0,0,
+2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,64,137,0,0,1,0,0,0,
+32,137,0,0,1,0,0,0,128,0,0,0,1,0,0,0,96,137,0,0,1,0,0,0,128,40,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,82,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,4,1,0,0,7,1,0,0,0,0,0,0,0,0,0,128,137,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,160,137,0,0,1,0,0,0,208,55,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,122,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,81,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,28,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,174,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+0,4,1,0,0,7,1,0,0,0,0,0,0,0,0,0,192,137,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+224,137,0,0,1,0,0,0,16,57,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+194,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+167,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,0,4,1,0,0,7,1,0,
+0,0,0,0,0,0,0,0,0,138,0,0,1,0,0,0,128,0,0,0,1,0,0,0,32,138,0,0,1,0,0,0,
+232,56,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,96,138,0,0,1,0,0,0,
+64,138,0,0,1,0,0,0,128,0,0,0,1,0,0,0,128,138,0,0,1,0,0,0,8,64,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,168,138,0,0,1,0,0,0,144,66,0,0,2,0,0,0,
+128,0,0,0,1,0,0,0,200,138,0,0,1,0,0,0,104,66,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,8,139,0,0,1,0,0,0,232,138,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+40,139,0,0,1,0,0,0,200,41,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+104,139,0,0,1,0,0,0,72,139,0,0,1,0,0,0,128,0,0,0,1,0,0,0,136,139,0,0,1,0,0,0,
+40,43,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,200,139,0,0,1,0,0,0,
+168,139,0,0,1,0,0,0,128,0,0,0,1,0,0,0,232,139,0,0,1,0,0,0,136,51,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,48,140,0,0,1,0,0,0,16,140,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,80,140,0,0,1,0,0,0,104,64,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,170,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,110,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,152,140,0,0,1,0,0,0,120,140,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+184,140,0,0,1,0,0,0,240,61,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+248,140,0,0,1,0,0,0,216,140,0,0,1,0,0,0,128,0,0,0,1,0,0,0,24,141,0,0,1,0,0,0,
+56,64,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,92,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,96,141,0,0,1,0,0,0,
+64,141,0,0,1,0,0,0,128,0,0,0,1,0,0,0,128,141,0,0,1,0,0,0,48,48,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,110,0,0,0,0,0,0,0,0,0,0,0,255,255,255,255,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,192,141,0,0,1,0,0,0,160,141,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,224,141,0,0,1,0,0,0,24,58,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,192,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,58,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,40,142,0,0,1,0,0,0,8,142,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+72,142,0,0,1,0,0,0,208,40,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+178,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+73,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,
+112,142,0,0,1,0,0,0,104,39,0,0,2,0,0,0,128,0,0,0,1,0,0,0,144,142,0,0,1,0,0,0,
+72,44,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,89,0,0,0,0,0,0,0,
+2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,208,142,0,0,1,0,0,0,
+176,142,0,0,1,0,0,0,128,0,0,0,1,0,0,0,240,142,0,0,1,0,0,0,104,54,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,24,143,0,0,1,0,0,0,104,46,0,0,2,0,0,0,
+128,0,0,0,1,0,0,0,56,143,0,0,1,0,0,0,64,46,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,173,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,0,0,0,7,1,0,120,143,0,0,1,0,0,0,88,143,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+152,143,0,0,1,0,0,0,248,64,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+79,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+86,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+224,143,0,0,1,0,0,0,192,143,0,0,1,0,0,0,128,0,0,0,1,0,0,0,0,144,0,0,1,0,0,0,
+120,42,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,26,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,4,1,0,0,7,1,0,0,0,0,0,0,0,0,0,
+32,144,0,0,1,0,0,0,128,0,0,0,1,0,0,0,64,144,0,0,1,0,0,0,192,56,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,45,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,124,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,128,144,0,0,1,0,0,0,96,144,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,160,144,0,0,1,0,0,0,160,62,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,187,0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,224,144,0,0,1,0,0,0,192,144,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+0,145,0,0,1,0,0,0,208,62,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+20,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+31,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+78,0,0,0,0,0,0,0,3,0,0,0,3,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+47,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+64,145,0,0,1,0,0,0,32,145,0,0,1,0,0,0,128,0,0,0,1,0,0,0,96,145,0,0,1,0,0,0,
+0,63,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,5,0,0,0,7,1,0,128,145,0,0,1,0,0,0,
+144,58,0,0,2,0,0,0,128,0,0,0,1,0,0,0,160,145,0,0,1,0,0,0,104,58,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,5,0,0,0,7,1,0,192,145,0,0,1,0,0,0,144,58,0,0,2,0,0,0,
+128,0,0,0,1,0,0,0,224,145,0,0,1,0,0,0,224,58,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,32,146,0,0,1,0,0,0,0,146,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+64,146,0,0,1,0,0,0,120,45,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+136,146,0,0,1,0,0,0,104,146,0,0,1,0,0,0,128,0,0,0,1,0,0,0,168,146,0,0,1,0,0,0,
+32,42,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,120,0,0,0,0,0,0,0,
+0,0,0,0,255,255,255,255,56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,208,146,0,0,1,0,0,0,
+104,39,0,0,2,0,0,0,128,0,0,0,1,0,0,0,240,146,0,0,1,0,0,0,96,59,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,80,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,48,147,0,0,1,0,0,0,16,147,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,80,147,0,0,1,0,0,0,8,51,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,0,0,0,7,1,0,144,147,0,0,1,0,0,0,112,147,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+176,147,0,0,1,0,0,0,152,64,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+172,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+60,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+248,147,0,0,1,0,0,0,216,147,0,0,1,0,0,0,128,0,0,0,1,0,0,0,24,148,0,0,1,0,0,0,
+216,47,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,96,148,0,0,1,0,0,0,
+64,148,0,0,1,0,0,0,128,0,0,0,1,0,0,0,128,148,0,0,1,0,0,0,32,56,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,177,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,192,148,0,0,1,0,0,0,160,148,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,224,148,0,0,1,0,0,0,176,65,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,55,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,121,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,11,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,176,0,0,0,0,0,0,0,4,0,0,0,4,0,0,0,56,0,0,0,0,0,0,0,
+4,4,0,0,0,7,1,0,40,149,0,0,1,0,0,0,8,149,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+72,149,0,0,1,0,0,0,160,63,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+169,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+53,0,0,0,0,0,0,0,1,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+166,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+84,0,0,0,0,0,0,0,2,0,0,0,4,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+136,149,0,0,1,0,0,0,104,149,0,0,1,0,0,0,128,0,0,0,1,0,0,0,168,149,0,0,1,0,0,0,
+88,40,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,191,0,0,0,0,0,0,0,
+4,0,0,0,4,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,232,149,0,0,1,0,0,0,
+200,149,0,0,1,0,0,0,128,0,0,0,1,0,0,0,8,150,0,0,1,0,0,0,168,40,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,59,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,72,150,0,0,1,0,0,0,40,150,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,104,150,0,0,1,0,0,0,168,60,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,176,150,0,0,1,0,0,0,144,150,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+208,150,0,0,1,0,0,0,8,59,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,
+24,151,0,0,1,0,0,0,248,150,0,0,1,0,0,0,128,0,0,0,1,0,0,0,56,151,0,0,1,0,0,0,
+112,60,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,128,151,0,0,1,0,0,0,
+96,151,0,0,1,0,0,0,128,0,0,0,1,0,0,0,160,151,0,0,1,0,0,0,168,42,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,232,151,0,0,1,0,0,0,200,151,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,8,152,0,0,1,0,0,0,104,63,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,25,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,57,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,0,0,0,7,1,0,80,152,0,0,1,0,0,0,48,152,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+112,152,0,0,1,0,0,0,120,61,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+176,152,0,0,1,0,0,0,144,152,0,0,1,0,0,0,128,0,0,0,1,0,0,0,208,152,0,0,1,0,0,0,
+240,45,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,248,152,0,0,1,0,0,0,
+104,39,0,0,2,0,0,0,128,0,0,0,1,0,0,0,24,153,0,0,1,0,0,0,120,62,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,22,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,88,153,0,0,1,0,0,0,56,153,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,120,153,0,0,1,0,0,0,144,46,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,192,153,0,0,1,0,0,0,160,153,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+224,153,0,0,1,0,0,0,120,47,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+76,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+40,154,0,0,1,0,0,0,8,154,0,0,1,0,0,0,128,0,0,0,1,0,0,0,72,154,0,0,1,0,0,0,
+40,61,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,136,154,0,0,1,0,0,0,
+104,154,0,0,1,0,0,0,128,0,0,0,1,0,0,0,168,154,0,0,1,0,0,0,248,55,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,4,5,1,0,0,7,1,0,200,154,0,0,1,0,0,0,104,39,0,0,2,0,0,0,
+128,0,0,0,1,0,0,0,232,154,0,0,1,0,0,0,56,59,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,40,155,0,0,1,0,0,0,8,155,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+72,155,0,0,1,0,0,0,80,42,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+65,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+188,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+136,155,0,0,1,0,0,0,104,155,0,0,1,0,0,0,128,0,0,0,1,0,0,0,168,155,0,0,1,0,0,0,
+32,47,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,171,0,0,0,0,0,0,0,
+2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,72,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,68,0,0,0,0,0,0,0,
+1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,232,155,0,0,1,0,0,0,
+200,155,0,0,1,0,0,0,128,0,0,0,1,0,0,0,8,156,0,0,1,0,0,0,200,44,0,0,2,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,205,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,186,0,0,0,0,0,0,0,1,0,0,0,3,0,0,0,
+56,0,0,0,0,0,0,0,4,4,0,0,0,7,1,0,80,156,0,0,1,0,0,0,48,156,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,112,156,0,0,1,0,0,0,16,60,0,0,2,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,184,156,0,0,1,0,0,0,152,156,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+216,156,0,0,1,0,0,0,24,46,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+123,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+70,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+87,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+67,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+29,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+32,157,0,0,1,0,0,0,0,157,0,0,1,0,0,0,128,0,0,0,1,0,0,0,64,157,0,0,1,0,0,0,
+208,63,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,144,157,0,0,1,0,0,0,
+112,157,0,0,1,0,0,0,128,0,0,0,1,0,0,0,176,157,0,0,1,0,0,0,136,57,0,0,2,0,0,0,
+56,0,0,0,0,0,0,0,0,4,1,0,0,7,1,0,0,0,0,0,0,0,0,0,208,157,0,0,1,0,0,0,
+128,0,0,0,1,0,0,0,240,157,0,0,1,0,0,0,112,56,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,17,1,0,27,0,0,0,0,0,0,0,1,0,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+4,4,1,0,0,7,1,0,48,158,0,0,1,0,0,0,16,158,0,0,1,0,0,0,128,0,0,0,1,0,0,0,
+80,158,0,0,1,0,0,0,176,43,0,0,2,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,17,1,0,
+22,0,0,0,0,0,0,0,2,0,0,0,2,0,0,0,56,0,0,0,0,0,0,0,4,4,1,0,0,7,1,0,
+144,158,0,0,1,0,0,0,112,158,0,0,1,0,0,0,128,0,0,0,1,0,0,0,176,158,0,0,1,0,0,0,
+112,44,0,0,2,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,158,0,0,1,0,0,0,
+240,158,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,16,159,0,0,1,0,0,0,
+48,159,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,32,41,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,80,159,0,0,1,0,0,0,112,159,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,144,159,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,176,159,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,159,0,0,1,0,0,0,240,159,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,16,160,0,0,1,0,0,0,48,160,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,80,160,0,0,1,0,0,0,112,160,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,144,160,0,0,1,0,0,0,176,160,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,184,54,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,208,160,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,240,160,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,5,0,0,0,4,1,0,208,52,0,0,2,0,0,0,0,53,0,0,2,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,16,161,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,48,161,0,0,1,0,0,0,80,161,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+112,161,0,0,1,0,0,0,144,161,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+48,52,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,161,0,0,1,0,0,0,
+208,161,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,240,161,0,0,1,0,0,0,
+16,162,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,48,162,0,0,1,0,0,0,80,162,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,112,162,0,0,1,0,0,0,144,162,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,176,162,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,162,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,8,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,240,162,0,0,1,0,0,0,16,163,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+48,163,0,0,1,0,0,0,80,163,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+8,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,112,163,0,0,1,0,0,0,144,163,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,144,67,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,176,163,0,0,1,0,0,0,208,163,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,160,45,0,0,2,0,0,0,240,163,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,16,164,0,0,1,0,0,0,72,164,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,192,59,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,104,164,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,192,59,0,0,2,0,0,0,232,59,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,56,50,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+136,164,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,56,50,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,164,0,0,1,0,0,0,
+224,164,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,104,48,0,0,2,0,0,0,
+0,165,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+32,165,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,104,48,0,0,2,0,0,0,
+8,48,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+160,44,0,0,2,0,0,0,64,165,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+96,165,0,0,1,0,0,0,152,165,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+160,44,0,0,2,0,0,0,80,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,184,165,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,56,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,216,165,0,0,1,0,0,0,16,166,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,56,50,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,160,45,0,0,2,0,0,0,48,166,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,80,166,0,0,1,0,0,0,136,166,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,166,0,0,1,0,0,0,224,166,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,167,0,0,1,0,0,0,56,167,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,160,45,0,0,2,0,0,0,88,167,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,167,0,0,1,0,0,0,176,167,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,208,167,0,0,1,0,0,0,
+8,168,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,120,62,0,0,2,0,0,0,
+40,168,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+72,168,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,
+216,42,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+104,168,0,0,1,0,0,0,160,168,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+120,62,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,168,0,0,1,0,0,0,248,168,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+96,65,0,0,2,0,0,0,24,169,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,56,169,0,0,1,0,0,0,48,0,0,0,0,0,0,0,3,0,0,0,0,11,1,0,
+96,65,0,0,2,0,0,0,136,65,0,0,2,0,0,0,120,62,0,0,2,0,0,0,5,5,5,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,47,0,0,2,0,0,0,88,169,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,169,0,0,1,0,0,0,176,169,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,80,47,0,0,2,0,0,0,80,45,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,160,61,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,169,0,0,1,0,0,0,
+240,169,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,160,61,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,170,0,0,1,0,0,0,
+72,170,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,184,39,0,0,2,0,0,0,
+104,170,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+136,170,0,0,1,0,0,0,64,0,0,0,0,0,0,0,5,0,0,0,0,11,1,0,184,39,0,0,2,0,0,0,
+104,48,0,0,2,0,0,0,8,48,0,0,2,0,0,0,248,48,0,0,2,0,0,0,40,49,0,0,2,0,0,0,
+5,5,5,5,5,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,170,0,0,1,0,0,0,
+224,170,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,171,0,0,1,0,0,0,
+56,171,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,120,41,0,0,2,0,0,0,
+88,171,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+120,171,0,0,1,0,0,0,48,0,0,0,0,0,0,0,3,0,0,0,0,11,1,0,120,41,0,0,2,0,0,0,
+32,41,0,0,2,0,0,0,160,41,0,0,2,0,0,0,5,5,5,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,64,66,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,152,171,0,0,1,0,0,0,184,171,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,64,66,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,120,41,0,0,2,0,0,0,216,171,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,248,171,0,0,1,0,0,0,48,172,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,120,41,0,0,2,0,0,0,32,41,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,80,172,0,0,1,0,0,0,136,172,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,172,0,0,1,0,0,0,224,172,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,120,62,0,0,2,0,0,0,0,173,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,173,0,0,1,0,0,0,88,173,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,216,42,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,173,0,0,1,0,0,0,
+176,173,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,144,66,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,32,41,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,208,173,0,0,1,0,0,0,
+8,174,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,32,41,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,96,43,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+40,174,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,96,43,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,56,51,0,0,2,0,0,0,
+72,174,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+104,174,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,56,51,0,0,2,0,0,0,
+184,39,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+120,41,0,0,2,0,0,0,136,174,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,168,174,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+120,41,0,0,2,0,0,0,120,62,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,120,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,200,174,0,0,1,0,0,0,0,175,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,120,61,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,120,62,0,0,2,0,0,0,32,175,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,64,175,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,216,42,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,104,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,175,0,0,1,0,0,0,152,175,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,104,48,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,160,45,0,0,2,0,0,0,184,175,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,175,0,0,1,0,0,0,16,176,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,248,40,0,0,2,0,0,0,
+48,176,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+80,176,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,248,40,0,0,2,0,0,0,
+32,41,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+112,176,0,0,1,0,0,0,168,176,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+104,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+160,45,0,0,2,0,0,0,200,176,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+232,176,0,0,1,0,0,0,32,177,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,64,177,0,0,1,0,0,0,120,177,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,104,46,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,248,40,0,0,2,0,0,0,152,177,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,184,177,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,248,40,0,0,2,0,0,0,120,62,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,216,177,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,177,0,0,1,0,0,0,48,178,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,80,178,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,178,0,0,1,0,0,0,168,178,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,178,0,0,1,0,0,0,0,179,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,144,58,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,179,0,0,1,0,0,0,88,179,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,144,58,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,160,45,0,0,2,0,0,0,120,179,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,179,0,0,1,0,0,0,208,179,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,120,41,0,0,2,0,0,0,
+240,179,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+16,180,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,120,41,0,0,2,0,0,0,
+32,41,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,48,180,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+104,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+56,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,80,180,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+56,51,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+248,40,0,0,2,0,0,0,112,180,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,144,180,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+248,40,0,0,2,0,0,0,120,62,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,104,39,0,0,2,0,0,0,176,180,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,208,180,0,0,1,0,0,0,8,181,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,104,39,0,0,2,0,0,0,8,48,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,40,181,0,0,1,0,0,0,96,181,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,120,41,0,0,2,0,0,0,128,181,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,160,181,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,120,41,0,0,2,0,0,0,120,62,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,104,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+192,181,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,104,7,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,181,0,0,1,0,0,0,
+24,182,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,182,0,0,1,0,0,0,
+112,182,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,5,0,0,0,4,1,0,72,60,0,0,2,0,0,0,
+216,60,0,0,2,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+144,182,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,72,60,0,0,2,0,0,0,
+216,60,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+160,45,0,0,2,0,0,0,176,182,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,208,182,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,72,60,0,0,2,0,0,0,240,182,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,16,183,0,0,1,0,0,0,48,183,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,72,60,0,0,2,0,0,0,160,44,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,224,39,0,0,2,0,0,0,80,183,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,112,183,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,224,39,0,0,2,0,0,0,216,42,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,120,62,0,0,2,0,0,0,
+144,183,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+176,183,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,
+160,41,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+160,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+208,183,0,0,1,0,0,0,240,183,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+160,61,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+160,45,0,0,2,0,0,0,16,184,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+48,184,0,0,1,0,0,0,104,184,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,136,184,0,0,1,0,0,0,192,184,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,104,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,160,45,0,0,2,0,0,0,224,184,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,0,185,0,0,1,0,0,0,56,185,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,47,0,0,2,0,0,0,88,185,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,185,0,0,1,0,0,0,176,185,0,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,80,47,0,0,2,0,0,0,248,44,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,80,61,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+208,185,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,80,61,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,185,0,0,1,0,0,0,
+40,186,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+72,186,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,104,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,32,41,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,186,0,0,1,0,0,0,
+160,186,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,32,41,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,80,47,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,186,0,0,1,0,0,0,
+248,186,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,80,47,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,160,44,0,0,2,0,0,0,
+24,187,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,187,0,0,1,0,0,0,
+112,187,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,160,44,0,0,2,0,0,0,
+248,44,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+32,41,0,0,2,0,0,0,144,187,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+176,187,0,0,1,0,0,0,208,187,0,0,1,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,
+32,41,0,0,2,0,0,0,72,60,0,0,2,0,0,0,5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,160,45,0,0,2,0,0,0,240,187,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,16,188,0,0,1,0,0,0,72,188,0,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,160,45,0,0,2,0,0,0,200,45,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,120,62,0,0,2,0,0,0,104,188,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,136,188,0,0,1,0,0,0,
+48,0,0,0,0,0,0,0,3,0,0,0,0,11,1,0,120,62,0,0,2,0,0,0,216,42,0,0,2,0,0,0,
+160,41,0,0,2,0,0,0,5,5,5,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+168,188,0,0,1,0,0,0,224,188,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+224,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+232,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+0,189,0,0,1,0,0,0,56,189,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+232,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+160,44,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,189,0,0,1,0,0,0,144,189,0,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+160,44,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,189,0,0,1,0,0,0,232,189,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+8,190,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+40,190,0,0,1,0,0,0,96,190,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+128,190,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,160,190,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+192,190,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+224,190,0,0,1,0,0,0,0,191,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,
+32,191,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,191,0,0,1,0,0,0,144,191,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+176,191,0,0,1,0,0,0,208,191,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+240,191,0,0,1,0,0,0,40,192,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+72,192,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+104,192,0,0,1,0,0,0,160,192,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+192,192,0,0,1,0,0,0,224,192,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,0,193,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+32,193,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+64,193,0,0,1,0,0,0,96,193,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,
+128,193,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+184,193,0,0,1,0,0,0,216,193,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,248,193,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+24,194,0,0,1,0,0,0,56,194,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,88,194,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+120,194,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,152,194,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+184,194,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+216,194,0,0,1,0,0,0,16,195,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+48,195,0,0,1,0,0,0,80,195,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,112,195,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+144,195,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,176,195,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+208,195,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+240,195,0,0,1,0,0,0,16,196,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,
+48,196,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,104,196,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,136,196,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+168,196,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,200,196,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+232,196,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,8,197,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+40,197,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,197,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,104,197,0,0,1,0,0,0,
+136,197,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,197,0,0,1,0,0,0,
+200,197,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,176,23,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,232,197,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,8,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,8,198,0,0,1,0,0,0,40,198,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,80,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,152,10,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,72,198,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,104,198,0,0,1,0,0,0,136,198,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,32,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+168,198,0,0,1,0,0,0,200,198,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+96,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+232,198,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,248,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,120,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,8,199,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+40,199,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,216,42,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,72,199,0,0,1,0,0,0,
+104,199,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,136,65,0,0,2,0,0,0,136,199,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,168,199,0,0,1,0,0,0,200,199,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,80,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,232,199,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,8,200,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+40,200,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,200,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,104,48,0,0,2,0,0,0,
+104,200,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,200,0,0,1,0,0,0,
+168,200,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,200,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,54,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,232,200,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,32,41,0,0,2,0,0,0,8,201,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,40,201,0,0,1,0,0,0,72,201,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,104,201,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,136,201,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,32,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,72,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,168,201,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,201,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,216,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,208,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,232,201,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,56,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+8,202,0,0,1,0,0,0,64,202,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,8,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+96,202,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,128,202,0,0,1,0,0,0,
+160,202,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,184,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,202,0,0,1,0,0,0,
+224,202,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,120,62,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,0,203,0,0,1,0,0,0,
+32,203,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,40,61,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,216,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,203,0,0,1,0,0,0,96,203,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,32,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,128,203,0,0,1,0,0,0,160,203,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,120,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,192,203,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+32,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+224,203,0,0,1,0,0,0,0,204,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+200,10,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,200,45,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,204,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,21,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,64,204,0,0,1,0,0,0,96,204,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,128,204,0,0,1,0,0,0,160,204,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,40,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+192,204,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+224,204,0,0,1,0,0,0,0,205,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,32,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,205,0,0,1,0,0,0,64,205,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,32,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,96,205,0,0,1,0,0,0,128,205,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+160,205,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+32,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+192,205,0,0,1,0,0,0,224,205,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+0,206,0,0,1,0,0,0,32,206,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+64,206,0,0,1,0,0,0,96,206,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+128,206,0,0,1,0,0,0,160,206,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+8,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,206,0,0,1,0,0,0,
+224,206,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,207,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,120,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,207,0,0,1,0,0,0,64,207,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,207,0,0,1,0,0,0,128,207,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+160,207,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+192,207,0,0,1,0,0,0,224,207,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+0,208,0,0,1,0,0,0,32,208,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+160,44,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,64,208,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+96,208,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+216,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+128,208,0,0,1,0,0,0,160,208,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+160,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+192,208,0,0,1,0,0,0,224,208,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,0,209,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+32,209,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+32,22,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+64,209,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,160,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,96,209,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,248,44,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,128,209,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+160,209,0,0,1,0,0,0,192,209,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,224,209,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,0,210,0,0,1,0,0,0,
+32,210,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,200,41,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,210,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,96,210,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,248,44,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,152,10,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,128,210,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+72,60,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,160,210,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+192,210,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+200,45,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,224,210,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,216,42,0,0,2,0,0,0,
+0,211,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,211,0,0,1,0,0,0,
+64,211,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,96,211,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,128,211,0,0,1,0,0,0,160,211,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,152,10,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,192,211,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+48,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,211,0,0,1,0,0,0,
+24,212,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,50,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,212,0,0,1,0,0,0,112,212,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,144,212,0,0,1,0,0,0,200,212,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,48,52,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,232,212,0,0,1,0,0,0,8,213,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,29,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,40,213,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+72,213,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+48,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,213,0,0,1,0,0,0,
+160,213,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,192,213,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,213,0,0,1,0,0,0,24,214,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,214,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,214,0,0,1,0,0,0,144,214,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,224,54,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,214,0,0,1,0,0,0,208,214,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,29,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,53,0,0,2,0,0,0,240,214,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,16,215,0,0,1,0,0,0,48,215,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,80,215,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,112,215,0,0,1,0,0,0,144,215,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,176,215,0,0,1,0,0,0,232,215,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,8,216,0,0,1,0,0,0,64,216,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,28,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,96,216,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+128,216,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+160,216,0,0,1,0,0,0,216,216,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+248,216,0,0,1,0,0,0,24,217,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+56,217,0,0,1,0,0,0,112,217,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+184,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+144,217,0,0,1,0,0,0,176,217,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+56,29,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,217,0,0,1,0,0,0,
+240,217,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,72,34,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,218,0,0,1,0,0,0,
+72,218,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,218,0,0,1,0,0,0,
+160,218,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,24,67,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,218,0,0,1,0,0,0,
+248,218,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,24,219,0,0,1,0,0,0,
+80,219,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,1,0,0,2,0,0,0,
+112,219,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,144,219,0,0,1,0,0,0,
+176,219,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,208,219,0,0,1,0,0,0,
+8,220,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,40,220,0,0,1,0,0,0,
+72,220,0,0,1,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,220,0,0,1,0,0,0,
+160,220,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,220,0,0,1,0,0,0,
+224,220,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,221,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,221,0,0,1,0,0,0,
+88,221,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,221,0,0,1,0,0,0,
+152,221,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,
+184,221,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,221,0,0,1,0,0,0,
+16,222,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,48,222,0,0,1,0,0,0,
+104,222,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,222,0,0,1,0,0,0,
+168,222,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,120,62,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,222,0,0,1,0,0,0,
+0,223,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,223,0,0,1,0,0,0,
+64,223,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+96,223,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,128,223,0,0,1,0,0,0,
+160,223,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,192,223,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,223,0,0,1,0,0,0,
+48,224,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,8,48,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,80,224,0,0,1,0,0,0,
+136,224,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,224,0,0,1,0,0,0,
+200,224,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,224,0,0,1,0,0,0,
+32,225,0,0,1,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,160,41,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,225,0,0,1,0,0,0,
+120,225,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,225,0,0,1,0,0,0,
+184,225,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,225,0,0,1,0,0,0,
+248,225,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+24,226,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+56,226,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,226,0,0,1,0,0,0,
+144,226,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+176,226,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,120,2,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,226,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,226,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,227,0,0,1,0,0,0,72,227,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,104,227,0,0,1,0,0,0,136,227,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,227,0,0,1,0,0,0,224,227,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,0,228,0,0,1,0,0,0,32,228,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,228,0,0,1,0,0,0,120,228,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,228,0,0,1,0,0,0,184,228,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,228,0,0,1,0,0,0,16,229,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,48,229,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,80,229,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,229,0,0,1,0,0,0,168,229,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,10,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,200,229,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,229,0,0,1,0,0,0,32,230,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,230,0,0,1,0,0,0,120,230,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,230,0,0,1,0,0,0,184,230,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,230,0,0,1,0,0,0,16,231,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,48,231,0,0,1,0,0,0,80,231,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,231,0,0,1,0,0,0,168,231,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,231,0,0,1,0,0,0,0,232,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,232,0,0,1,0,0,0,64,232,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,96,232,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,128,232,0,0,1,0,0,0,160,232,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,192,232,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,224,232,0,0,1,0,0,0,0,233,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,233,0,0,1,0,0,0,88,233,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,233,0,0,1,0,0,0,176,233,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,233,0,0,1,0,0,0,240,233,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,234,0,0,1,0,0,0,72,234,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,104,234,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,136,234,0,0,1,0,0,0,192,234,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,224,234,0,0,1,0,0,0,0,235,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,235,0,0,1,0,0,0,88,235,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,235,0,0,1,0,0,0,152,235,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,184,235,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,216,235,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,235,0,0,1,0,0,0,48,236,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,80,236,0,0,1,0,0,0,136,236,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,236,0,0,1,0,0,0,200,236,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,236,0,0,1,0,0,0,32,237,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,237,0,0,1,0,0,0,96,237,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,237,0,0,1,0,0,0,184,237,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,216,237,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,248,237,0,0,1,0,0,0,24,238,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,238,0,0,1,0,0,0,112,238,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,144,238,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,238,0,0,1,0,0,0,208,238,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,240,238,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,239,0,0,1,0,0,0,72,239,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,104,239,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,136,239,0,0,1,0,0,0,192,239,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,224,239,0,0,1,0,0,0,0,240,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,240,0,0,1,0,0,0,64,240,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,240,0,0,1,0,0,0,152,240,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,184,240,0,0,1,0,0,0,240,240,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,16,241,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,48,241,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,241,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,241,0,0,1,0,0,0,168,241,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,241,0,0,1,0,0,0,0,242,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,32,242,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,242,0,0,1,0,0,0,120,242,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,152,242,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,184,242,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,242,0,0,1,0,0,0,248,242,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,24,243,0,0,1,0,0,0,80,243,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,243,0,0,1,0,0,0,168,243,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,160,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,243,0,0,1,0,0,0,0,244,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,244,0,0,1,0,0,0,64,244,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,244,0,0,1,0,0,0,152,244,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,184,244,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,216,244,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,248,244,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,24,245,0,0,1,0,0,0,56,245,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,136,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,88,245,0,0,1,0,0,0,
+120,245,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,245,0,0,1,0,0,0,
+208,245,0,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,240,245,0,0,1,0,0,0,
+16,246,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,48,246,0,0,1,0,0,0,
+80,246,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,246,0,0,1,0,0,0,
+168,246,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,128,49,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,200,246,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,246,0,0,1,0,0,0,32,247,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,192,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,64,247,0,0,1,0,0,0,96,247,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,128,247,0,0,1,0,0,0,184,247,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,216,247,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+248,247,0,0,1,0,0,0,48,248,0,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,
+80,248,0,0,1,0,0,0,112,248,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,53,0,0,2,0,0,0,144,248,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,176,248,0,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,
+208,248,0,0,1,0,0,0,8,249,0,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,40,249,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+72,249,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,249,0,0,1,0,0,0,
+160,249,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,192,249,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,224,249,0,0,1,0,0,0,0,250,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,32,250,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,64,250,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,96,250,0,0,1,0,0,0,152,250,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,184,250,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+216,250,0,0,1,0,0,0,248,250,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+24,251,0,0,1,0,0,0,80,251,0,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,
+112,251,0,0,1,0,0,0,144,251,0,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+24,54,0,0,2,0,0,0,176,251,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+208,251,0,0,1,0,0,0,240,251,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,16,252,0,0,1,0,0,0,
+48,252,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,80,252,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,112,252,0,0,1,0,0,0,144,252,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,96,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,176,252,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,208,252,0,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+240,252,0,0,1,0,0,0,40,253,0,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+72,253,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,253,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,136,253,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,168,253,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,253,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,232,253,0,0,1,0,0,0,32,254,0,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,64,254,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,96,254,0,0,1,0,0,0,128,254,0,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,120,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,160,254,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+192,254,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,224,254,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,35,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,255,0,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,255,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,255,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,144,66,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,255,0,0,1,0,0,0,128,255,0,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+48,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,1,0,0,2,0,0,0,
+160,255,0,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,255,0,0,1,0,0,0,
+224,255,0,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,208,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,0,0,1,0,1,0,0,0,56,0,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,88,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,120,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,160,0,1,0,1,0,0,0,192,0,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,224,0,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+0,1,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+32,1,1,0,1,0,0,0,88,1,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,120,1,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,1,1,0,1,0,0,0,
+208,1,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,1,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,16,2,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,48,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,80,2,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,112,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,176,23,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,144,2,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+176,2,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+208,2,1,0,1,0,0,0,240,2,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,3,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,120,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,48,3,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,80,3,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,112,3,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+144,3,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,3,1,0,1,0,0,0,232,3,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,8,4,1,0,1,0,0,0,64,4,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,4,1,0,1,0,0,0,128,4,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,160,4,1,0,1,0,0,0,216,4,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,248,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,24,5,1,0,1,0,0,0,56,5,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,5,1,0,1,0,0,0,144,5,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,176,5,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,32,22,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,208,5,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,240,5,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+16,6,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,48,6,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,80,6,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,112,6,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,144,6,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,176,6,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,64,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,208,6,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+240,6,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,7,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,48,7,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,7,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,112,7,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,144,7,1,0,1,0,0,0,176,7,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,208,7,1,0,1,0,0,0,8,8,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,40,8,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,176,23,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,72,8,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+104,8,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+136,8,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+176,8,1,0,1,0,0,0,208,8,1,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+0,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,8,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,9,1,0,1,0,0,0,72,9,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,9,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,200,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,9,1,0,1,0,0,0,168,9,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,216,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,96,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,200,9,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+232,9,1,0,1,0,0,0,8,10,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+40,10,1,0,1,0,0,0,96,10,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,128,10,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,160,10,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,232,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,192,10,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,160,44,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,224,10,1,0,1,0,0,0,0,11,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,24,9,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,32,11,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+32,22,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+64,11,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,176,23,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,96,11,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,11,1,0,1,0,0,0,184,11,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,216,11,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,184,27,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,8,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,248,11,1,0,1,0,0,0,48,12,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,80,12,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,12,1,0,1,0,0,0,168,12,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,200,12,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,232,12,1,0,1,0,0,0,32,13,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,64,13,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+96,13,1,0,1,0,0,0,128,13,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+48,52,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+160,13,1,0,1,0,0,0,216,13,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+248,13,1,0,1,0,0,0,24,14,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,6,0,0,0,0,4,1,0,56,14,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,88,40,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,120,14,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,14,1,0,1,0,0,0,184,14,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,192,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,216,14,1,0,1,0,0,0,248,14,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,24,15,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+56,15,1,0,1,0,0,0,88,15,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+224,54,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+120,53,0,0,2,0,0,0,120,15,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+152,15,1,0,1,0,0,0,184,15,1,0,1,0,0,0,56,0,0,0,0,0,0,0,4,0,0,0,0,11,1,0,
+40,53,0,0,2,0,0,0,80,53,0,0,2,0,0,0,120,53,0,0,2,0,0,0,160,53,0,0,2,0,0,0,
+5,5,5,5,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,216,15,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,176,43,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,16,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,48,16,1,0,1,0,0,0,104,16,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,16,1,0,1,0,0,0,168,16,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,200,16,1,0,1,0,0,0,232,16,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,8,17,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,40,17,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,72,17,1,0,1,0,0,0,128,17,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,160,17,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,192,17,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+224,17,1,0,1,0,0,0,0,18,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+184,39,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,5,0,0,0,4,1,0,
+64,54,0,0,2,0,0,0,160,41,0,0,2,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+32,18,1,0,1,0,0,0,88,18,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,
+120,18,1,0,1,0,0,0,168,18,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+200,18,1,0,1,0,0,0,0,19,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+32,19,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+64,19,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+96,19,1,0,1,0,0,0,152,19,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+184,19,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+216,19,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+32,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,248,19,1,0,1,0,0,0,
+24,20,1,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+56,20,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,88,20,1,0,1,0,0,0,
+120,20,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,20,1,0,1,0,0,0,
+208,20,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,20,1,0,1,0,0,0,
+40,21,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,112,36,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,72,21,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,21,1,0,1,0,0,0,160,21,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,96,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,21,1,0,1,0,0,0,224,21,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,22,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,32,22,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,22,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,96,22,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,22,1,0,1,0,0,0,184,22,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,22,1,0,1,0,0,0,248,22,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,24,23,1,0,1,0,0,0,56,23,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,4,0,0,0,0,0,0,0,88,23,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,1,0,0,2,0,0,0,120,23,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,152,23,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,200,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,184,23,1,0,1,0,0,0,240,23,1,0,1,0,0,0,40,0,0,0,0,0,0,0,
+3,0,0,0,0,5,1,0,0,0,0,0,0,0,0,0,91,169,2,230,127,148,181,220,58,71,52,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,16,24,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,48,24,1,0,1,0,0,0,80,24,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,112,24,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,144,24,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+3,4,0,0,0,4,1,0,10,0,0,0,0,0,0,0,176,24,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+208,24,1,0,1,0,0,0,240,24,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+16,25,1,0,1,0,0,0,72,25,1,0,1,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,104,25,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+136,25,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,168,25,1,0,1,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+200,25,1,0,1,0,0,0,0,26,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+152,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+32,26,1,0,1,0,0,0,64,26,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,96,26,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+128,26,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,160,26,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,26,1,0,1,0,0,0,248,26,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+120,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,24,27,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,34,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,27,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,184,58,0,0,2,0,0,0,88,27,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,27,1,0,1,0,0,0,152,27,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,184,27,1,0,1,0,0,0,240,27,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,184,58,0,0,2,0,0,0,16,28,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,48,28,1,0,1,0,0,0,80,28,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+112,28,1,0,1,0,0,0,168,28,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,200,28,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+232,28,1,0,1,0,0,0,32,29,1,0,1,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,64,29,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+96,29,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,128,29,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,160,29,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+192,29,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,224,29,1,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+0,30,1,0,1,0,0,0,56,30,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,30,1,0,1,0,0,0,144,30,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,30,1,0,1,0,0,0,232,30,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+8,31,1,0,1,0,0,0,40,31,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,10,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,31,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,31,1,0,1,0,0,0,
+160,31,1,0,1,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,31,1,0,1,0,0,0,
+248,31,1,0,1,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,1,0,0,0,0,0,0,0,0,0,
+116,169,2,230,127,145,181,220,58,71,49,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,24,32,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,
+56,32,1,0,1,0,0,0,88,32,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+120,32,1,0,1,0,0,0,176,32,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+200,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,208,32,1,0,1,0,0,0,
+8,33,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+40,33,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,72,33,1,0,1,0,0,0,
+104,33,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,136,33,1,0,1,0,0,0,
+192,33,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,224,33,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,224,34,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,34,1,0,1,0,0,0,56,34,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,34,1,0,1,0,0,0,144,34,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,34,1,0,1,0,0,0,232,34,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,8,35,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,40,35,1,0,1,0,0,0,72,35,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,35,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,200,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,136,35,1,0,1,0,0,0,192,35,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+224,35,1,0,1,0,0,0,0,36,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+32,36,1,0,1,0,0,0,88,36,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+216,47,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,36,1,0,1,0,0,0,
+152,36,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,184,36,1,0,1,0,0,0,
+240,36,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,16,37,1,0,1,0,0,0,48,37,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,80,37,1,0,1,0,0,0,136,37,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,168,37,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,37,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,232,37,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,8,38,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,40,38,1,0,1,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,
+45,0,0,0,0,6,1,0,108,97,109,98,100,97,32,109,105,115,115,105,110,103,32,97,114,103,117,109,101,110,116,58,
+32,40,108,97,109,98,100,97,32,40,97,114,103,115,41,32,98,111,100,121,41,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,72,38,1,0,1,0,0,0,128,38,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,160,38,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,192,38,1,0,1,0,0,0,248,38,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,24,39,1,0,1,0,0,0,56,39,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,39,1,0,1,0,0,0,144,39,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,176,39,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,208,39,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,160,53,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,240,39,1,0,1,0,0,0,40,40,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,72,40,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,56,29,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+104,40,1,0,1,0,0,0,160,40,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,192,40,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,40,1,0,1,0,0,0,
+24,41,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,41,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,41,1,0,1,0,0,0,
+144,41,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,41,1,0,1,0,0,0,
+208,41,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,41,1,0,1,0,0,0,
+40,42,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,42,1,0,1,0,0,0,
+128,42,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,248,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,6,0,0,0,0,4,1,0,160,42,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,88,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,42,1,0,1,0,0,0,0,43,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,32,43,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,43,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,96,43,1,0,1,0,0,0,128,43,1,0,1,0,0,0,48,0,0,0,0,0,0,0,
+3,0,0,0,0,11,1,0,24,54,0,0,2,0,0,0,64,54,0,0,2,0,0,0,160,41,0,0,2,0,0,0,
+5,5,5,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,160,43,1,0,1,0,0,0,192,43,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,224,43,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,44,1,0,1,0,0,0,56,44,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,88,44,1,0,1,0,0,0,120,44,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,152,44,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,0,0,0,0,4,1,0,184,44,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,240,44,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,16,45,1,0,1,0,0,0,48,45,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,80,45,1,0,1,0,0,0,136,45,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,168,45,1,0,1,0,0,0,200,45,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+232,45,1,0,1,0,0,0,8,46,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+120,9,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,40,46,1,0,1,0,0,0,
+72,46,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,104,46,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,136,46,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,168,46,1,0,1,0,0,0,200,46,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,46,1,0,1,0,0,0,32,47,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,47,1,0,1,0,0,0,96,47,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,47,1,0,1,0,0,0,184,47,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,47,1,0,1,0,0,0,248,47,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,240,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,24,48,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,56,48,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,144,66,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,88,48,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,5,0,0,0,0,0,0,0,120,48,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,152,48,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,72,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,184,48,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+216,48,1,0,1,0,0,0,248,48,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+120,0,1,0,1,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,24,49,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+56,49,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,88,49,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,49,1,0,1,0,0,0,
+152,49,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,184,49,1,0,1,0,0,0,
+240,49,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,16,50,1,0,1,0,0,0,
+48,50,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,64,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,80,50,1,0,1,0,0,0,112,50,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,144,50,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,176,50,1,0,1,0,0,0,208,50,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,240,50,1,0,1,0,0,0,16,51,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,48,51,1,0,1,0,0,0,104,51,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,51,1,0,1,0,0,0,168,51,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,200,51,1,0,1,0,0,0,0,52,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,32,52,1,0,1,0,0,0,88,52,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,120,52,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+11,4,0,0,0,4,1,0,152,52,1,0,1,0,0,0,192,52,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+224,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,224,52,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,
+0,53,1,0,1,0,0,0,40,53,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,72,53,1,0,1,0,0,0,
+104,53,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,96,27,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,136,53,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,53,1,0,1,0,0,0,200,53,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,53,1,0,1,0,0,0,32,54,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,54,1,0,1,0,0,0,96,54,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,128,54,1,0,1,0,0,0,160,54,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,54,1,0,1,0,0,0,248,54,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,24,55,1,0,1,0,0,0,56,55,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,88,55,1,0,1,0,0,0,120,55,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,55,1,0,1,0,0,0,
+208,55,1,0,1,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,55,1,0,1,0,0,0,
+40,56,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,37,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,56,1,0,1,0,0,0,128,56,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,8,59,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,160,56,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,192,56,1,0,1,0,0,0,224,56,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,136,8,1,0,1,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+0,57,1,0,1,0,0,0,32,57,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,57,1,0,1,0,0,0,
+96,57,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+128,57,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,200,61,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,160,57,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,57,1,0,1,0,0,0,248,57,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,8,59,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+24,58,1,0,1,0,0,0,56,58,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+240,19,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,
+88,58,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,160,44,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+120,58,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,208,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,58,1,0,1,0,0,0,184,58,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,58,1,0,1,0,0,0,16,59,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,48,59,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,120,9,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,80,59,1,0,1,0,0,0,136,59,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,168,59,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,248,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+200,59,1,0,1,0,0,0,232,59,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,8,60,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+40,60,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+72,60,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,88,49,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,60,1,0,1,0,0,0,
+160,60,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,60,1,0,1,0,0,0,
+248,60,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,24,61,1,0,1,0,0,0,
+56,61,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,61,1,0,1,0,0,0,
+144,61,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,61,1,0,1,0,0,0,232,61,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,88,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,8,62,1,0,1,0,0,0,64,62,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,96,62,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+128,62,1,0,1,0,0,0,160,62,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+88,49,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,62,1,0,1,0,0,0,248,62,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+32,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,24,63,1,0,1,0,0,0,
+56,63,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,63,1,0,1,0,0,0,
+144,63,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,63,1,0,1,0,0,0,208,63,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,63,1,0,1,0,0,0,40,64,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+6,0,0,0,0,4,1,0,72,64,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,64,1,0,1,0,0,0,168,64,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+200,64,1,0,1,0,0,0,0,65,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+32,65,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,65,1,0,1,0,0,0,
+96,65,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,28,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,19,0,0,0,0,6,1,0,115,101,116,33,32,110,111,116,32,97,32,118,97,114,105,97,
+98,108,101,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,128,65,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,88,49,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,160,65,1,0,1,0,0,0,216,65,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,248,65,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,24,66,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,56,66,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,88,66,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,120,66,1,0,1,0,0,0,152,66,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,184,66,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,216,66,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,96,30,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+248,66,1,0,1,0,0,0,24,67,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+56,67,1,0,1,0,0,0,112,67,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+144,67,1,0,1,0,0,0,176,67,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,67,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,67,1,0,1,0,0,0,
+40,68,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,68,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+104,68,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,68,1,0,1,0,0,0,
+168,68,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+200,68,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,232,68,1,0,1,0,0,0,
+8,69,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,40,69,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,72,69,1,0,1,0,0,0,
+104,69,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,96,50,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,36,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,136,69,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,69,1,0,1,0,0,0,200,69,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,232,69,1,0,1,0,0,0,8,70,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,112,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+2,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,40,70,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,72,70,1,0,1,0,0,0,128,70,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,160,70,1,0,1,0,0,0,192,70,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,224,70,1,0,1,0,0,0,0,71,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,32,71,1,0,1,0,0,0,88,71,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,120,71,1,0,1,0,0,0,176,71,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,208,71,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,240,71,1,0,1,0,0,0,16,72,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,48,72,1,0,1,0,0,0,80,72,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,112,72,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,144,72,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,176,72,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,208,72,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,240,72,1,0,1,0,0,0,40,73,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,72,73,1,0,1,0,0,0,104,73,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,56,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,136,73,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+168,73,1,0,1,0,0,0,224,73,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+0,74,1,0,1,0,0,0,32,74,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+64,74,1,0,1,0,0,0,120,74,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+152,74,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+184,74,1,0,1,0,0,0,216,74,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,
+152,48,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,248,74,1,0,1,0,0,0,32,0,0,0,0,0,0,0,10,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,24,75,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+56,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,3,0,0,0,0,0,0,0,
+56,75,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,88,75,1,0,1,0,0,0,
+120,75,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,75,1,0,1,0,0,0,
+184,75,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,216,75,1,0,1,0,0,0,248,75,1,0,1,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,11,1,0,184,58,0,0,2,0,0,0,224,39,0,0,2,0,0,0,5,5,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,24,76,1,0,1,0,0,0,56,76,1,0,1,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,11,1,0,184,58,0,0,2,0,0,0,224,39,0,0,2,0,0,0,
+5,5,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+88,76,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,120,76,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,76,1,0,1,0,0,0,
+208,76,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,76,1,0,1,0,0,0,
+40,77,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,72,77,1,0,1,0,0,0,
+104,77,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,36,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,136,77,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,77,1,0,1,0,0,0,224,77,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,0,78,1,0,1,0,0,0,32,78,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,78,1,0,1,0,0,0,120,78,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,78,1,0,1,0,0,0,184,78,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,112,36,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+2,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,216,78,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,248,78,1,0,1,0,0,0,48,79,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,80,79,1,0,1,0,0,0,112,79,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,144,79,1,0,1,0,0,0,200,79,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,232,79,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+8,80,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+112,60,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+40,80,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,200,31,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,80,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,80,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,136,80,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,168,80,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,80,1,0,1,0,0,0,0,81,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,81,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,81,1,0,1,0,0,0,120,81,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,152,81,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,184,81,1,0,1,0,0,0,216,81,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,81,1,0,1,0,0,0,48,82,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,176,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,80,82,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,82,1,0,1,0,0,0,168,82,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,200,82,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,232,82,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,8,83,1,0,1,0,0,0,64,83,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,96,83,1,0,1,0,0,0,128,83,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+160,83,1,0,1,0,0,0,192,83,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+224,83,1,0,1,0,0,0,24,84,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,56,84,1,0,1,0,0,0,
+88,84,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,84,1,0,1,0,0,0,
+176,84,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,
+208,84,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,84,1,0,1,0,0,0,
+40,85,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,85,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,104,85,1,0,1,0,0,0,136,85,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,168,85,1,0,1,0,0,0,224,85,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,0,86,1,0,1,0,0,0,32,86,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,6,0,0,0,0,4,1,0,
+64,86,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,128,40,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,136,86,1,0,1,0,0,0,192,86,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,86,1,0,1,0,0,0,24,87,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,87,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,88,87,1,0,1,0,0,0,120,87,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,152,87,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+184,87,1,0,1,0,0,0,216,87,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+248,87,1,0,1,0,0,0,48,88,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+80,88,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,22,0,0,0,0,6,1,0,100,101,102,105,110,101,58,32,
+40,100,101,102,105,110,101,32,118,97,114,32,120,41,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,112,88,1,0,1,0,0,0,
+144,88,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,88,1,0,1,0,0,0,208,88,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,88,1,0,1,0,0,0,40,89,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,89,1,0,1,0,0,0,128,89,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,160,89,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,192,89,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,224,89,1,0,1,0,0,0,0,90,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,128,52,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,32,90,1,0,1,0,0,0,88,90,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,64,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,120,90,1,0,1,0,0,0,176,90,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,208,90,1,0,1,0,0,0,8,91,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,40,91,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,232,5,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,72,91,1,0,1,0,0,0,128,91,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,160,91,1,0,1,0,0,0,192,91,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,152,5,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+224,91,1,0,1,0,0,0,0,92,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+32,92,1,0,1,0,0,0,88,92,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+120,92,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+152,92,1,0,1,0,0,0,208,92,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,92,1,0,1,0,0,0,
+40,93,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,88,49,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,93,1,0,1,0,0,0,
+128,93,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,160,93,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+192,93,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+224,93,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+0,94,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,94,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+64,94,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,
+96,94,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,128,94,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+160,94,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,192,94,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+224,94,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,95,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,95,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,240,66,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,95,1,0,1,0,0,0,96,95,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,3,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,216,47,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+128,95,1,0,1,0,0,0,160,95,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,95,1,0,1,0,0,0,248,95,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+24,96,1,0,1,0,0,0,80,96,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+112,96,1,0,1,0,0,0,144,96,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,96,1,0,1,0,0,0,232,96,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+8,97,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,40,97,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,72,97,1,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+104,97,1,0,1,0,0,0,136,97,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,168,97,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+200,97,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,232,97,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+8,98,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,40,98,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,98,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,160,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,104,98,1,0,1,0,0,0,160,98,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,192,98,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,224,98,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,0,99,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,32,99,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,64,99,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,96,99,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,128,99,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,160,99,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,192,99,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,224,99,1,0,1,0,0,0,24,100,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,56,100,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,100,1,0,1,0,0,0,144,100,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,176,100,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,208,100,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,240,100,1,0,1,0,0,0,40,101,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,40,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+72,101,1,0,1,0,0,0,104,101,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,136,101,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+168,101,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,101,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+232,101,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,8,102,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,40,102,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,72,102,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,104,102,1,0,1,0,0,0,160,102,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,192,102,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,224,102,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,0,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,0,103,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+32,103,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,103,1,0,1,0,0,0,
+120,103,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,103,1,0,1,0,0,0,
+208,103,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,103,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,104,1,0,1,0,0,0,
+72,104,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,104,1,0,1,0,0,0,
+160,104,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+192,104,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+224,104,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,105,1,0,1,0,0,0,56,105,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,40,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,88,105,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,120,105,1,0,1,0,0,0,176,105,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,208,105,1,0,1,0,0,0,8,106,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,40,106,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,16,35,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+72,106,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,106,1,0,1,0,0,0,
+160,106,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,106,1,0,1,0,0,0,
+224,106,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,40,61,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,107,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,107,1,0,1,0,0,0,88,107,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,120,107,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,107,1,0,1,0,0,0,208,107,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,107,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,40,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,16,108,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,48,108,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,8,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+80,108,1,0,1,0,0,0,112,108,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+144,108,1,0,1,0,0,0,176,108,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+208,108,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+240,108,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,109,1,0,1,0,0,0,
+72,109,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,109,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,136,109,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,109,1,0,1,0,0,0,224,109,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,110,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+72,0,0,0,0,0,0,0,53,0,0,0,0,6,1,0,108,97,109,98,100,97,32,109,105,115,115,105,110,103,32,98,
+111,100,121,32,101,120,112,114,101,115,115,105,111,110,115,58,32,40,108,97,109,98,100,97,32,40,97,114,103,115,41,32,
+98,111,100,121,41,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,110,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,64,110,1,0,1,0,0,0,96,110,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,128,110,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,160,110,1,0,1,0,0,0,216,110,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,248,110,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,24,111,1,0,1,0,0,0,56,111,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,111,1,0,1,0,0,0,144,111,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,176,111,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+208,111,1,0,1,0,0,0,240,111,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,16,112,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,48,112,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+80,112,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,112,112,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+144,112,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,6,0,0,0,0,4,1,0,176,112,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,112,1,0,1,0,0,0,248,112,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,24,113,1,0,1,0,0,0,80,113,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,113,1,0,1,0,0,0,168,113,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,113,1,0,1,0,0,0,0,114,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,114,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,64,114,1,0,1,0,0,0,96,114,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+128,114,1,0,1,0,0,0,160,114,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,114,1,0,1,0,0,0,
+224,114,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+0,115,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,32,115,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,115,1,0,1,0,0,0,120,115,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,152,115,1,0,1,0,0,0,184,115,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,115,1,0,1,0,0,0,16,116,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,48,116,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,80,116,1,0,1,0,0,0,112,116,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,144,116,1,0,1,0,0,0,200,116,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,232,116,1,0,1,0,0,0,
+8,117,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,40,117,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,117,1,0,1,0,0,0,128,117,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,160,117,1,0,1,0,0,0,192,117,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,224,117,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,0,118,1,0,1,0,0,0,32,118,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,64,118,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,96,118,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,152,118,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,184,118,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,216,118,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,248,118,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,24,119,1,0,1,0,0,0,56,119,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,119,1,0,1,0,0,0,144,119,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,248,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,176,119,1,0,1,0,0,0,208,119,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+240,119,1,0,1,0,0,0,40,120,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+72,120,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,120,1,0,1,0,0,0,
+160,120,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,192,120,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+224,120,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,121,1,0,1,0,0,0,
+56,121,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,88,121,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,121,1,0,1,0,0,0,
+176,121,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,121,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+240,121,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,16,122,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+72,122,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,104,122,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,122,1,0,1,0,0,0,168,122,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,200,122,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,122,1,0,1,0,0,0,32,123,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,123,1,0,1,0,0,0,120,123,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,123,1,0,1,0,0,0,184,123,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,216,123,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,248,123,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,48,124,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,58,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,80,124,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,120,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,112,124,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+144,124,1,0,1,0,0,0,200,124,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+32,42,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+232,124,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,8,125,1,0,1,0,0,0,
+64,125,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,96,125,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,125,1,0,1,0,0,0,
+184,125,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,216,125,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,
+248,125,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,0,0,0,0,4,1,0,24,126,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+80,126,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,126,1,0,1,0,0,0,
+168,126,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,126,1,0,1,0,0,0,0,127,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,127,1,0,1,0,0,0,64,127,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,96,127,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,128,127,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,160,127,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,127,1,0,1,0,0,0,248,127,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+24,128,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,56,27,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,56,128,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,88,128,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,120,128,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,152,128,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,184,128,1,0,1,0,0,0,240,128,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+16,129,1,0,1,0,0,0,48,129,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+72,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,129,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,129,1,0,1,0,0,0,
+168,129,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,129,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,232,129,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,8,130,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,40,130,1,0,1,0,0,0,72,130,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,130,1,0,1,0,0,0,160,130,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,192,130,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,224,130,1,0,1,0,0,0,24,131,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,152,28,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+56,131,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,88,131,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+120,131,1,0,1,0,0,0,176,131,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+208,131,1,0,1,0,0,0,240,131,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+16,132,1,0,1,0,0,0,72,132,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+152,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+104,132,1,0,1,0,0,0,136,132,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+168,132,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,200,132,1,0,1,0,0,0,
+232,132,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,8,133,1,0,1,0,0,0,
+64,133,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,133,1,0,1,0,0,0,
+152,133,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,184,133,1,0,1,0,0,0,216,133,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,133,1,0,1,0,0,0,48,134,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,80,134,1,0,1,0,0,0,136,134,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,168,134,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,134,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,232,134,1,0,1,0,0,0,8,135,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,40,135,1,0,1,0,0,0,96,135,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,184,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,128,135,1,0,1,0,0,0,160,135,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+192,135,1,0,1,0,0,0,224,135,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,0,136,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,32,136,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+64,136,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+0,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+96,136,1,0,1,0,0,0,152,136,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+0,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+184,136,1,0,1,0,0,0,240,136,1,0,1,0,0,0,40,0,0,0,0,0,0,0,20,0,0,0,0,6,1,0,
+100,101,102,105,110,101,58,32,110,111,116,32,97,32,115,121,109,98,111,108,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,16,137,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,48,137,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+80,137,1,0,1,0,0,0,112,137,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+144,137,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,137,1,0,1,0,0,0,208,137,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,137,1,0,1,0,0,0,40,138,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,138,1,0,1,0,0,0,128,138,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,160,138,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,192,138,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,224,138,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,0,139,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,139,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,139,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,31,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,1,0,0,0,96,139,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,136,43,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+128,139,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,160,139,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,192,139,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+224,139,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,0,140,1,0,1,0,0,0,
+32,140,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+64,140,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,140,1,0,1,0,0,0,
+152,140,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,128,49,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,184,140,1,0,1,0,0,0,216,140,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,140,1,0,1,0,0,0,48,141,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,141,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,112,141,1,0,1,0,0,0,144,141,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,176,141,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,141,1,0,1,0,0,0,248,141,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,48,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,24,142,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,56,142,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,88,142,1,0,1,0,0,0,120,142,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,240,66,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,248,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+152,142,1,0,1,0,0,0,184,142,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,216,142,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,4,0,0,0,0,0,0,0,
+248,142,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,24,143,1,0,1,0,0,0,
+80,143,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,112,143,1,0,1,0,0,0,144,143,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,143,1,0,1,0,0,0,232,143,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,8,144,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,248,21,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,40,144,1,0,1,0,0,0,72,144,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,104,144,1,0,1,0,0,0,160,144,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,144,1,0,1,0,0,0,248,144,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+24,145,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+48,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,145,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,145,1,0,1,0,0,0,
+144,145,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,176,145,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,145,1,0,1,0,0,0,
+240,145,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,208,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,16,146,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,48,146,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,88,146,1,0,1,0,0,0,120,146,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,48,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+152,146,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,184,146,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,80,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,146,1,0,1,0,0,0,248,146,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,24,147,1,0,1,0,0,0,80,147,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,147,1,0,1,0,0,0,168,147,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,200,147,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,48,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+232,147,1,0,1,0,0,0,8,148,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,40,148,1,0,1,0,0,0,72,148,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,104,148,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,136,148,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,148,1,0,1,0,0,0,200,148,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,232,148,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,200,10,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,8,149,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,40,149,1,0,1,0,0,0,96,149,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,128,149,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+2,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+160,149,1,0,1,0,0,0,216,149,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,248,149,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+72,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,24,150,1,0,1,0,0,0,
+80,150,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,150,1,0,1,0,0,0,
+168,150,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,200,150,1,0,1,0,0,0,
+232,150,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,8,151,1,0,1,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,48,151,1,0,1,0,0,0,80,151,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,151,1,0,1,0,0,0,168,151,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,136,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,16,21,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+152,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+200,151,1,0,1,0,0,0,232,151,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,41,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,8,152,1,0,1,0,0,0,
+40,152,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+72,152,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,104,152,1,0,1,0,0,0,
+136,152,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,152,1,0,1,0,0,0,
+224,152,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,153,1,0,1,0,0,0,
+56,153,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,88,153,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,153,1,0,1,0,0,0,152,153,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,184,153,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,216,153,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,248,153,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+24,154,1,0,1,0,0,0,56,154,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,0,24,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,154,1,0,1,0,0,0,
+144,154,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,154,1,0,1,0,0,0,
+232,154,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,8,155,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,40,155,1,0,1,0,0,0,72,155,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,104,155,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,136,155,1,0,1,0,0,0,168,155,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,200,155,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,232,155,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,0,61,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,8,156,1,0,1,0,0,0,64,156,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,96,156,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+128,156,1,0,1,0,0,0,160,156,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,156,1,0,1,0,0,0,248,156,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+24,157,1,0,1,0,0,0,80,157,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+112,157,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+144,157,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,157,1,0,1,0,0,0,232,157,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+8,158,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,40,158,1,0,1,0,0,0,
+72,158,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,104,158,1,0,1,0,0,0,136,158,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,158,1,0,1,0,0,0,224,158,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,159,1,0,1,0,0,0,56,159,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,216,23,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,159,1,0,1,0,0,0,144,159,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,159,1,0,1,0,0,0,232,159,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,8,160,1,0,1,0,0,0,40,160,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,160,1,0,1,0,0,0,128,160,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,184,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,160,160,1,0,1,0,0,0,216,160,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,248,160,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,24,161,1,0,1,0,0,0,56,161,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,161,1,0,1,0,0,0,144,161,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+176,161,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+208,161,1,0,1,0,0,0,8,162,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+40,162,1,0,1,0,0,0,96,162,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+128,162,1,0,1,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,1,0,
+0,0,0,0,0,0,0,0,193,171,2,230,127,146,181,220,58,71,50,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,160,162,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+11,4,0,0,0,4,1,0,192,162,1,0,1,0,0,0,224,162,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,0,163,1,0,1,0,0,0,56,163,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,163,1,0,1,0,0,0,144,163,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,176,163,1,0,1,0,0,0,208,163,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,240,163,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,16,164,1,0,1,0,0,0,48,164,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+80,164,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,112,164,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+96,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,144,164,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,164,1,0,1,0,0,0,
+232,164,1,0,1,0,0,0,32,0,0,0,0,0,0,0,3,0,0,0,0,4,1,0,65,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,8,165,1,0,1,0,0,0,40,165,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,72,165,1,0,1,0,0,0,128,165,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,160,165,1,0,1,0,0,0,216,165,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+248,165,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+24,166,1,0,1,0,0,0,80,166,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+112,166,1,0,1,0,0,0,168,166,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+200,166,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+232,166,1,0,1,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,1,0,
+0,0,0,0,0,0,0,0,14,168,2,230,127,147,181,220,58,71,51,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,8,167,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+11,4,0,0,0,4,1,0,40,167,1,0,1,0,0,0,72,167,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,104,167,1,0,1,0,0,0,160,167,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,192,167,1,0,1,0,0,0,248,167,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,24,168,1,0,1,0,0,0,80,168,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,112,168,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,56,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+144,168,1,0,1,0,0,0,200,168,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,168,1,0,1,0,0,0,
+32,169,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+64,169,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,169,1,0,1,0,0,0,
+128,169,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+160,169,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+192,169,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,224,169,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,170,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,170,1,0,1,0,0,0,
+88,170,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,160,36,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,120,170,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,152,170,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,184,170,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,120,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,1,0,0,2,0,0,0,
+216,170,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,248,170,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,1,0,0,0,0,0,0,0,0,0,
+39,166,2,230,127,144,181,220,58,71,48,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+24,171,1,0,1,0,0,0,80,171,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+224,20,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,6,4,0,0,0,4,1,0,112,171,1,0,1,0,0,0,
+136,171,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,171,1,0,1,0,0,0,
+224,171,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,0,172,1,0,1,0,0,0,
+32,172,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,
+64,172,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,152,48,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,172,1,0,1,0,0,0,128,172,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,160,172,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,192,172,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,224,172,1,0,1,0,0,0,24,173,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,56,173,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,173,1,0,1,0,0,0,144,173,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,128,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,176,173,1,0,1,0,0,0,232,173,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,8,174,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,40,174,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,72,174,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+104,174,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+136,174,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,174,1,0,1,0,0,0,
+224,174,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,175,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,175,1,0,1,0,0,0,
+64,175,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,184,39,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,64,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,175,1,0,1,0,0,0,
+152,175,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,184,175,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,216,175,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,175,1,0,1,0,0,0,48,176,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,176,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,112,176,1,0,1,0,0,0,144,176,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+176,176,1,0,1,0,0,0,208,176,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,240,176,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,16,177,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+48,177,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+80,177,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,177,1,0,1,0,0,0,
+168,177,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,177,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,177,1,0,1,0,0,0,
+32,178,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,178,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,178,1,0,1,0,0,0,128,178,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,160,178,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,192,178,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,224,178,1,0,1,0,0,0,
+0,179,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,179,1,0,1,0,0,0,
+88,179,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,120,179,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,152,179,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,184,179,1,0,1,0,0,0,240,179,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,16,180,1,0,1,0,0,0,48,180,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+80,180,1,0,1,0,0,0,136,180,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,6,0,0,0,0,4,1,0,168,180,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,180,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,180,1,0,1,0,0,0,40,181,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,72,181,1,0,1,0,0,0,104,181,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,176,141,1,0,1,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,136,181,1,0,1,0,0,0,168,181,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,48,65,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,200,181,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+232,181,1,0,1,0,0,0,32,182,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+64,182,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+96,182,1,0,1,0,0,0,128,182,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+152,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+160,182,1,0,1,0,0,0,192,182,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+224,182,1,0,1,0,0,0,24,183,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+56,183,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,183,1,0,1,0,0,0,144,183,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+176,183,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,183,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,240,183,1,0,1,0,0,0,16,184,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,48,184,1,0,1,0,0,0,80,184,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,184,1,0,1,0,0,0,168,184,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,6,4,0,0,0,4,1,0,
+200,184,1,0,1,0,0,0,232,184,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,8,185,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,40,185,1,0,1,0,0,0,
+96,185,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,185,1,0,1,0,0,0,
+184,185,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,185,1,0,1,0,0,0,
+248,185,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,48,146,1,0,1,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,24,186,1,0,1,0,0,0,56,186,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,186,1,0,1,0,0,0,144,186,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+40,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,176,186,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,186,1,0,1,0,0,0,240,186,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,187,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,48,187,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,187,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,112,187,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,144,187,1,0,1,0,0,0,200,187,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,232,187,1,0,1,0,0,0,8,188,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,40,188,1,0,1,0,0,0,96,188,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,128,188,1,0,1,0,0,0,160,188,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,192,188,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,224,188,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,24,0,0,0,0,0,0,0,1,0,0,0,0,6,1,0,
+67,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,189,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,88,40,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,152,48,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,189,1,0,1,0,0,0,64,189,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,96,189,1,0,1,0,0,0,152,189,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,184,189,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,216,189,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,248,189,1,0,1,0,0,0,24,190,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,56,190,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,88,190,1,0,1,0,0,0,
+120,190,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,128,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,190,1,0,1,0,0,0,
+208,190,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,190,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,191,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,48,191,1,0,1,0,0,0,80,191,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,191,1,0,1,0,0,0,168,191,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,200,191,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,232,191,1,0,1,0,0,0,8,192,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,40,192,1,0,1,0,0,0,72,192,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,104,192,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,136,192,1,0,1,0,0,0,192,192,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+224,192,1,0,1,0,0,0,24,193,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,56,193,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+88,193,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,120,193,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+152,193,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+184,193,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+136,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+216,193,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+248,193,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,24,194,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,56,194,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,194,1,0,1,0,0,0,144,194,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,176,194,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,194,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,194,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,16,195,1,0,1,0,0,0,72,195,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,195,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,136,195,1,0,1,0,0,0,192,195,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,224,195,1,0,1,0,0,0,24,196,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+56,196,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,196,1,0,1,0,0,0,144,196,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+176,196,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,20,0,0,0,0,6,1,0,99,111,110,100,58,32,105,110,
+118,97,108,105,100,32,99,108,97,117,115,101,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+208,196,1,0,1,0,0,0,8,197,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+248,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,6,0,0,0,0,4,1,0,40,197,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,
+88,197,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,120,197,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,197,1,0,1,0,0,0,
+208,197,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,197,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,16,198,1,0,1,0,0,0,
+48,198,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,3,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,80,198,1,0,1,0,0,0,136,198,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,152,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,198,1,0,1,0,0,0,200,198,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,198,1,0,1,0,0,0,32,199,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,64,199,1,0,1,0,0,0,96,199,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,216,47,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,128,199,1,0,1,0,0,0,160,199,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,192,199,1,0,1,0,0,0,248,199,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,152,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+24,200,1,0,1,0,0,0,80,200,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,112,200,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+144,200,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,176,200,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+208,200,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,6,1,0,98,97,100,32,108,101,116,32,
+98,105,110,100,105,110,103,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,240,200,1,0,1,0,0,0,
+40,201,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,248,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,6,4,0,0,0,4,1,0,72,201,1,0,1,0,0,0,120,201,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,152,201,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,184,201,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,216,201,1,0,1,0,0,0,16,202,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,48,202,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,56,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+80,202,1,0,1,0,0,0,136,202,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+168,202,1,0,1,0,0,0,224,202,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,0,203,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+32,203,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+64,203,1,0,1,0,0,0,120,203,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+152,203,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,184,203,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+216,203,1,0,1,0,0,0,16,204,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+176,65,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+48,204,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,80,204,1,0,1,0,0,0,
+136,204,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,168,204,1,0,1,0,0,0,
+184,204,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,96,33,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,216,204,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,204,1,0,1,0,0,0,48,205,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,80,205,1,0,1,0,0,0,96,205,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,128,205,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,6,0,0,0,0,4,1,0,160,205,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,152,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,184,205,1,0,1,0,0,0,216,205,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,248,205,1,0,1,0,0,0,24,206,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,56,206,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,206,1,0,1,0,0,0,144,206,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,176,206,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,208,206,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,240,206,1,0,1,0,0,0,40,207,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,72,207,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+104,207,1,0,1,0,0,0,136,207,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+168,207,1,0,1,0,0,0,224,207,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+0,208,1,0,1,0,0,0,56,208,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,88,208,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+120,208,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,208,1,0,1,0,0,0,
+184,208,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,208,1,0,1,0,0,0,
+248,208,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,
+24,209,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,56,209,1,0,1,0,0,0,
+88,209,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+120,209,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,152,209,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+184,209,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,209,1,0,1,0,0,0,248,209,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,24,210,1,0,1,0,0,0,56,210,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,88,210,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,120,210,1,0,1,0,0,0,176,210,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,208,210,1,0,1,0,0,0,8,211,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,40,211,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+72,211,1,0,1,0,0,0,104,211,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+136,211,1,0,1,0,0,0,192,211,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,224,211,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+0,212,1,0,1,0,0,0,56,212,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,88,212,1,0,1,0,0,0,
+120,212,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+152,212,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,184,212,1,0,1,0,0,0,240,212,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+16,213,1,0,1,0,0,0,48,213,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+80,213,1,0,1,0,0,0,136,213,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,31,0,0,0,0,6,1,0,99,111,110,100,58,32,99,108,
+97,117,115,101,32,109,105,115,115,105,110,103,32,101,120,112,114,101,115,115,105,111,110,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,168,213,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,200,213,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+232,213,1,0,1,0,0,0,32,214,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,64,214,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+96,214,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+224,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,214,1,0,1,0,0,0,
+184,214,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,216,214,1,0,1,0,0,0,
+248,214,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,128,40,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,152,48,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,24,215,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,215,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,40,43,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+88,215,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+120,215,1,0,1,0,0,0,176,215,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+208,215,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+240,215,1,0,1,0,0,0,40,216,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,28,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,72,216,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,24,0,0,0,0,6,1,0,108,101,116,32,101,110,116,114,
+121,32,109,105,115,115,105,110,103,32,115,121,109,98,111,108,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,104,216,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,136,216,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+168,216,1,0,1,0,0,0,224,216,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+56,59,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,217,1,0,1,0,0,0,56,217,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,88,217,1,0,1,0,0,0,144,217,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,176,217,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+208,217,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+160,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,217,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,11,1,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,8,37,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,11,1,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,16,218,1,0,1,0,0,0,
+24,0,0,0,0,0,0,0,1,0,0,0,0,6,1,0,82,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,48,218,1,0,1,0,0,0,104,218,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+11,4,0,0,0,4,1,0,136,218,1,0,1,0,0,0,168,218,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,200,218,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,232,218,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,1,0,0,0,8,219,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+224,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+40,219,1,0,1,0,0,0,96,219,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,219,1,0,1,0,0,0,
+184,219,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,219,1,0,1,0,0,0,
+16,220,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,48,220,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,80,220,1,0,1,0,0,0,112,220,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,144,220,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,176,220,1,0,1,0,0,0,232,220,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,8,221,1,0,1,0,0,0,64,221,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,96,221,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,128,221,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,160,221,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,192,221,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,224,221,1,0,1,0,0,0,0,222,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,32,222,1,0,1,0,0,0,88,222,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,120,222,1,0,1,0,0,0,176,222,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,208,222,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,240,222,1,0,1,0,0,0,40,223,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,72,223,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+104,223,1,0,1,0,0,0,136,223,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,223,1,0,1,0,0,0,
+200,223,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,223,1,0,1,0,0,0,
+32,224,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,64,224,1,0,1,0,0,0,
+120,224,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,152,224,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,1,0,0,0,184,224,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,216,224,1,0,1,0,0,0,248,224,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,24,225,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,56,225,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,88,225,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+120,225,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+136,50,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,152,225,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,184,225,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+216,225,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,34,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,248,225,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,24,226,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,226,1,0,1,0,0,0,112,226,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,88,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+1,0,0,0,0,11,1,0,152,48,0,0,2,0,0,0,5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,144,226,1,0,1,0,0,0,200,226,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,232,226,1,0,1,0,0,0,32,227,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+64,227,1,0,1,0,0,0,96,227,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+128,227,1,0,1,0,0,0,184,227,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+72,34,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,216,227,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,227,1,0,1,0,0,0,
+48,228,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,228,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+112,228,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,34,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,144,228,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,176,228,1,0,1,0,0,0,208,228,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+240,228,1,0,1,0,0,0,16,229,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+48,229,1,0,1,0,0,0,104,229,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+136,229,1,0,1,0,0,0,192,229,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+224,229,1,0,1,0,0,0,24,230,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+56,230,1,0,1,0,0,0,88,230,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,230,1,0,1,0,0,0,
+152,230,1,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,152,48,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,184,230,1,0,1,0,0,0,
+240,230,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,231,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,248,41,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,48,231,1,0,1,0,0,0,80,231,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,112,231,1,0,1,0,0,0,144,231,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,231,1,0,1,0,0,0,232,231,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,8,232,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+40,232,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+72,232,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+104,232,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,232,1,0,1,0,0,0,168,232,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,232,1,0,1,0,0,0,0,233,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,32,233,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,233,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,233,1,0,1,0,0,0,128,233,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,160,233,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,192,233,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,224,233,1,0,1,0,0,0,0,234,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,32,234,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,64,234,1,0,1,0,0,0,
+96,234,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+128,234,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,160,234,1,0,1,0,0,0,
+216,234,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,248,234,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,24,235,1,0,1,0,0,0,
+80,235,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,112,235,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,144,235,1,0,1,0,0,0,176,235,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,208,235,1,0,1,0,0,0,240,235,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,16,236,1,0,1,0,0,0,72,236,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,104,236,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,136,236,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,168,236,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,80,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,200,236,1,0,1,0,0,0,0,237,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,32,237,1,0,1,0,0,0,88,237,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,120,237,1,0,1,0,0,0,176,237,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,208,237,1,0,1,0,0,0,8,238,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,40,238,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,72,238,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,104,238,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,160,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,136,238,1,0,1,0,0,0,
+168,238,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,238,1,0,1,0,0,0,0,239,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,32,239,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,128,1,0,0,2,0,0,0,64,239,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,88,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+96,239,1,0,1,0,0,0,152,239,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,184,239,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,216,239,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+248,239,1,0,1,0,0,0,48,240,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+80,240,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+112,240,1,0,1,0,0,0,168,240,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+200,240,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+152,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+232,240,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,160,62,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,24,54,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,8,241,1,0,1,0,0,0,40,241,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,72,241,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,104,241,1,0,1,0,0,0,136,241,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,168,241,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,200,241,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,232,241,1,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+8,242,1,0,1,0,0,0,64,242,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+96,242,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,128,242,1,0,1,0,0,0,
+160,242,1,0,1,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+192,242,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+224,242,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,243,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+32,243,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,243,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,96,243,1,0,1,0,0,0,128,243,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,160,243,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,243,1,0,1,0,0,0,248,243,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,88,1,0,0,2,0,0,0,24,244,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,56,244,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,88,244,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,244,1,0,1,0,0,0,176,244,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,244,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,240,244,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,245,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,48,245,1,0,1,0,0,0,80,245,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,245,1,0,1,0,0,0,168,245,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+200,245,1,0,1,0,0,0,232,245,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,8,246,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,40,246,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+72,246,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,104,246,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+136,246,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,246,1,0,1,0,0,0,
+200,246,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+232,246,1,0,1,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+8,247,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,40,247,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,72,247,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+176,23,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,1,0,0,0,
+104,247,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,136,247,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+168,247,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,247,1,0,1,0,0,0,
+0,248,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,248,1,0,1,0,0,0,
+88,248,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,120,248,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,248,1,0,1,0,0,0,184,248,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,248,1,0,1,0,0,0,16,249,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,48,249,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,63,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,80,249,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,112,249,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+144,249,1,0,1,0,0,0,200,249,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,249,1,0,1,0,0,0,
+32,250,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,64,250,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+96,250,1,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,128,250,1,0,1,0,0,0,
+160,250,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,250,1,0,1,0,0,0,
+248,250,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,24,251,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,251,1,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,88,251,1,0,1,0,0,0,
+120,251,1,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,152,251,1,0,1,0,0,0,184,251,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,216,251,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,251,1,0,1,0,0,0,48,252,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,252,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,252,1,0,1,0,0,0,168,252,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,252,1,0,1,0,0,0,0,253,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,253,1,0,1,0,0,0,88,253,1,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,120,253,1,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,152,253,1,0,1,0,0,0,208,253,1,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,1,0,0,0,240,253,1,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,16,254,1,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,48,254,1,0,1,0,0,0,80,254,1,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+112,254,1,0,1,0,0,0,144,254,1,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,254,1,0,1,0,0,0,232,254,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+64,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+8,255,1,0,1,0,0,0,64,255,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,96,255,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+128,255,1,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,160,255,1,0,1,0,0,0,
+192,255,1,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+224,255,1,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,0,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,0,2,0,1,0,0,0,
+88,0,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,104,54,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,0,2,0,1,0,0,0,
+176,0,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+208,0,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,0,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,1,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,48,1,2,0,1,0,0,0,
+104,1,2,0,1,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,136,1,2,0,1,0,0,0,
+192,1,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,224,1,2,0,1,0,0,0,
+0,2,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,62,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,32,2,2,0,1,0,0,0,64,2,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,96,2,2,0,1,0,0,0,152,2,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,184,2,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,216,2,2,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+248,2,2,0,1,0,0,0,24,3,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+56,3,2,0,1,0,0,0,88,3,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+120,3,2,0,1,0,0,0,176,3,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+208,3,2,0,1,0,0,0,240,3,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,16,4,2,0,1,0,0,0,
+48,4,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,34,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,4,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,4,2,0,1,0,0,0,168,4,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,200,4,2,0,1,0,0,0,232,4,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,24,54,0,0,2,0,0,0,5,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,88,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,8,5,2,0,1,0,0,0,64,5,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,96,5,2,0,1,0,0,0,152,5,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,152,48,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,184,5,2,0,1,0,0,0,216,5,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,248,5,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,24,6,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+56,6,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,88,6,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+120,6,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,152,6,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,184,6,2,0,1,0,0,0,216,6,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,248,6,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+24,7,2,0,1,0,0,0,56,7,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+88,7,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+120,7,2,0,1,0,0,0,176,7,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+88,1,0,0,2,0,0,0,208,7,2,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+3,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,240,7,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+16,8,2,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,48,8,2,0,1,0,0,0,
+80,8,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,112,8,2,0,1,0,0,0,144,8,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,80,2,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,8,2,0,1,0,0,0,232,8,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,8,9,2,0,1,0,0,0,64,9,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,96,9,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,80,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,9,2,0,1,0,0,0,184,9,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,216,9,2,0,1,0,0,0,248,9,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,24,10,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+56,10,2,0,1,0,0,0,88,10,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,120,10,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,152,10,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,63,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,184,10,2,0,1,0,0,0,240,10,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,16,11,2,0,1,0,0,0,32,11,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,64,11,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,96,11,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,128,11,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,160,11,2,0,1,0,0,0,216,11,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,248,11,2,0,1,0,0,0,48,12,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,80,12,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,12,2,0,1,0,0,0,168,12,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+11,4,0,0,0,4,1,0,200,12,2,0,1,0,0,0,216,12,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+248,12,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+24,13,2,0,1,0,0,0,80,13,2,0,1,0,0,0,32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,
+112,13,2,0,1,0,0,0,128,13,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+160,13,2,0,1,0,0,0,216,13,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+248,13,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+128,1,0,0,2,0,0,0,24,14,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+160,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,14,2,0,1,0,0,0,
+112,14,2,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,2,0,0,0,
+144,14,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,128,40,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,176,14,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,208,14,2,0,1,0,0,0,8,15,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+11,4,0,0,0,4,1,0,40,15,2,0,1,0,0,0,72,15,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,104,15,2,0,1,0,0,0,160,15,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,192,15,2,0,1,0,0,0,248,15,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,24,16,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,56,16,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,88,16,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,120,16,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,152,16,2,0,1,0,0,0,208,16,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,240,16,2,0,1,0,0,0,40,17,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+3,0,0,0,1,0,0,0,72,17,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+8,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+104,17,2,0,1,0,0,0,160,17,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+192,17,2,0,1,0,0,0,248,17,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+24,18,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+56,18,2,0,1,0,0,0,112,18,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+144,18,2,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,176,18,2,0,1,0,0,0,
+208,18,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,240,18,2,0,1,0,0,0,16,19,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,48,19,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,80,19,2,0,1,0,0,0,112,19,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,144,19,2,0,1,0,0,0,200,19,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,232,19,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,8,20,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,40,20,2,0,1,0,0,0,96,20,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,3,0,0,0,0,0,0,0,128,20,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,200,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+160,20,2,0,1,0,0,0,192,20,2,0,1,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,11,1,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,8,40,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,5,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,224,20,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+0,21,2,0,1,0,0,0,32,21,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,64,21,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+96,21,2,0,1,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,11,1,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,128,21,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,248,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,1,0,0,0,160,21,2,0,1,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,11,1,0,
+32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,8,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,192,21,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,224,21,2,0,1,0,0,0,24,22,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,4,0,0,0,4,1,0,0,0,0,0,0,0,0,0,56,22,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,54,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+4,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,88,22,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+120,22,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+152,22,2,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,184,22,2,0,1,0,0,0,
+216,22,2,0,1,0,0,0,32,0,0,0,0,0,0,0,1,0,0,0,0,11,1,0,152,48,0,0,2,0,0,0,
+5,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,248,22,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,24,23,2,0,1,0,0,0,80,23,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,144,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,23,2,0,1,0,0,0,168,23,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,200,23,2,0,1,0,0,0,
+232,23,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,8,24,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,4,0,0,0,0,0,0,0,40,24,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,4,0,0,0,0,0,0,0,72,24,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,104,24,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+136,24,2,0,1,0,0,0,192,24,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+224,24,2,0,1,0,0,0,24,25,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+56,25,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,88,25,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+120,25,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,152,25,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+184,25,2,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,216,25,2,0,1,0,0,0,
+248,25,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+24,26,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,26,2,0,1,0,0,0,
+112,26,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,144,26,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,176,26,2,0,1,0,0,0,232,26,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,8,27,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,40,27,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,72,27,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,27,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,136,27,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,168,27,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,200,27,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,232,27,2,0,1,0,0,0,32,28,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,64,28,2,0,1,0,0,0,96,28,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,128,28,2,0,1,0,0,0,160,28,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,40,0,0,0,2,0,0,0,192,28,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,224,28,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,0,29,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,32,29,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,1,0,0,0,64,29,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,1,0,0,0,
+96,29,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,29,2,0,1,0,0,0,
+184,29,2,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,29,2,0,1,0,0,0,
+16,30,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,48,30,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,80,30,2,0,1,0,0,0,112,30,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,144,30,2,0,1,0,0,0,176,30,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,208,30,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,208,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,240,30,2,0,1,0,0,0,40,31,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,72,31,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,104,31,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,136,31,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,168,31,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+200,31,2,0,1,0,0,0,0,32,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+160,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,32,2,0,1,0,0,0,
+88,32,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,32,2,0,1,0,0,0,
+176,32,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,208,32,2,0,1,0,0,0,
+8,33,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,40,33,2,0,1,0,0,0,
+96,33,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,128,33,2,0,1,0,0,0,
+184,33,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,216,33,2,0,1,0,0,0,
+16,34,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,48,34,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,34,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,34,2,0,1,0,0,0,168,34,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,11,4,0,0,0,4,1,0,200,34,2,0,1,0,0,0,216,34,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,248,34,2,0,1,0,0,0,24,35,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,56,35,2,0,1,0,0,0,88,35,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,120,35,2,0,1,0,0,0,176,35,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,208,35,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,240,35,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+16,36,2,0,1,0,0,0,48,36,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+80,36,2,0,1,0,0,0,136,36,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+0,0,0,0,2,0,0,0,168,36,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+200,36,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,232,36,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+8,37,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,40,37,2,0,1,0,0,0,
+72,37,2,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,216,23,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,104,37,2,0,1,0,0,0,
+160,37,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,192,37,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,0,24,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,2,0,0,0,1,0,0,0,224,37,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+0,38,2,0,1,0,0,0,32,38,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,0,0,0,0,
+64,38,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,160,62,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,72,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,160,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,10,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,96,38,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+152,64,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+128,38,2,0,1,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,11,1,0,32,0,0,0,0,0,0,0,
+10,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,160,38,2,0,1,0,0,0,216,38,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,248,38,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,24,39,2,0,1,0,0,0,80,39,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,112,39,2,0,1,0,0,0,144,39,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,176,39,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+208,39,2,0,1,0,0,0,8,40,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+40,40,2,0,1,0,0,0,96,40,2,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+3,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,128,40,2,0,1,0,0,0,
+160,40,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,40,2,0,1,0,0,0,
+224,40,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+0,41,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,41,2,0,1,0,0,0,
+88,41,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+120,41,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,152,41,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,184,41,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,216,41,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,248,41,2,0,1,0,0,0,48,42,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,80,42,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,112,42,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,144,42,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,9,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,4,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,2,0,0,0,176,42,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,208,42,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+240,42,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+16,43,2,0,1,0,0,0,72,43,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+104,43,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,
+136,43,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,168,43,2,0,1,0,0,0,224,43,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,0,44,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,32,44,2,0,1,0,0,0,88,44,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,120,44,2,0,1,0,0,0,152,44,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,184,44,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+6,0,0,0,0,4,1,0,216,44,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,248,44,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,24,45,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,56,45,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,45,2,0,1,0,0,0,144,45,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,45,2,0,1,0,0,0,232,45,2,0,1,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,8,46,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+40,46,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+72,46,2,0,1,0,0,0,128,46,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,160,46,2,0,1,0,0,0,
+192,46,2,0,1,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,46,2,0,1,0,0,0,
+24,47,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,56,47,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,88,47,2,0,1,0,0,0,120,47,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,152,47,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,24,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,184,47,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,216,47,2,0,1,0,0,0,16,48,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,48,48,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,80,48,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+14,0,0,0,0,6,1,0,32,97,115,115,101,114,116,32,102,97,105,108,101,100,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,48,2,0,1,0,0,0,168,48,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,200,48,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+160,62,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,232,48,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,8,49,2,0,1,0,0,0,
+64,49,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,96,49,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,128,49,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,160,49,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,192,49,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,224,49,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,0,50,2,0,1,0,0,0,56,50,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+88,50,2,0,1,0,0,0,144,50,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,176,50,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,208,50,2,0,1,0,0,0,
+240,50,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,16,51,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,2,0,0,0,3,0,0,0,
+48,51,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,216,23,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,80,51,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,16,33,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,112,51,2,0,1,0,0,0,168,51,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,64,39,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,51,2,0,1,0,0,0,0,52,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+32,52,2,0,1,0,0,0,64,52,2,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,96,52,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+128,52,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+160,52,2,0,1,0,0,0,216,52,2,0,1,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,1,0,0,0,
+248,52,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,1,0,0,0,0,0,0,0,24,53,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,56,53,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,2,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,88,53,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,120,53,2,0,1,0,0,0,152,53,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,184,53,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,216,53,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,0,0,0,0,4,1,0,40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,248,53,2,0,1,0,0,0,48,54,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,80,54,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,112,54,2,0,1,0,0,0,168,54,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,200,54,2,0,1,0,0,0,0,55,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,136,51,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+32,55,2,0,1,0,0,0,64,55,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,96,55,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,128,55,2,0,1,0,0,0,
+160,55,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,192,55,2,0,1,0,0,0,224,55,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,0,56,2,0,1,0,0,0,56,56,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,88,56,2,0,1,0,0,0,144,56,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,176,56,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,208,56,2,0,1,0,0,0,8,57,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,40,57,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,1,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,
+72,57,2,0,1,0,0,0,104,57,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,136,57,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,168,57,2,0,1,0,0,0,
+200,57,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+232,57,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+8,58,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,40,58,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+72,58,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,104,58,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,136,58,2,0,1,0,0,0,
+192,58,2,0,1,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,0,0,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,58,2,0,1,0,0,0,
+24,59,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,56,59,2,0,1,0,0,0,88,59,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,120,59,2,0,1,0,0,0,152,59,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,184,59,2,0,1,0,0,0,240,59,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,16,60,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,48,60,2,0,1,0,0,0,104,60,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,136,60,2,0,1,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+3,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,
+80,0,0,0,2,0,0,0,168,60,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,200,60,2,0,1,0,0,0,
+0,61,2,0,1,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,32,61,2,0,1,0,0,0,64,61,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,0,0,0,0,2,0,0,0,96,61,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,128,61,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,160,61,2,0,1,0,0,0,192,61,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,224,61,2,0,1,0,0,0,24,62,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,56,62,2,0,1,0,0,0,112,62,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,144,62,2,0,1,0,0,0,176,62,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+4,4,0,0,0,4,1,0,208,62,2,0,1,0,0,0,240,62,2,0,1,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,64,7,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+16,63,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+48,63,2,0,1,0,0,0,104,63,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+136,63,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+168,63,2,0,1,0,0,0,224,63,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,
+0,64,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+32,64,2,0,1,0,0,0,88,64,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+104,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,120,64,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,
+152,64,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,4,0,0,0,4,1,0,184,64,2,0,1,0,0,0,216,64,2,0,1,0,0,0,
+32,0,0,0,0,0,0,0,5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,248,64,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+19,4,0,0,0,4,1,0,24,65,2,0,1,0,0,0,80,65,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+5,4,0,0,0,4,1,0,80,0,0,0,2,0,0,0,112,65,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+4,0,0,0,0,4,1,0,144,65,2,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+0,0,0,0,0,4,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+0,0,0,0,0,19,1,0,144,6,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,0,0,0,0,4,1,0,
+2,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,5,0,0,0,0,4,1,0,
+40,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,
+176,65,2,0,1,0,0,0,232,65,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,
+64,8,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,15,4,0,0,0,4,1,0,3,0,0,0,1,0,0,0,
+8,66,2,0,1,0,0,0,32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,40,66,2,0,1,0,0,0,
+0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,72,66,2,0,1,0,0,0,
+128,66,2,0,1,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,104,7,0,0,2,0,0,0,
+0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,4,0,0,0,0,4,1,0,160,66,2,0,1,0,0,0,0,0,0,0,0,0,0,0,
+32,0,0,0,0,0,0,0,19,4,0,0,0,4,1,0,192,66,2,0,1,0,0,0,248,66,2,0,1,0,0,0,
+56,0,0,0,0,0,0,0,0,0,0,0,0,19,1,0,168,1,0,0,2,0,0,0,0,0,0,0,0,0,0,0,
+0,0,0,0,0,0,0,0,2,0,0,0,255,255,255,255,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,
+15,4,0,0,0,4,1,0,4,0,0,0,0,0,0,0,24,67,2,0,1,0,0,0,32,0,0,0,0,0,0,0,
+15,0,0,0,0,4,1,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,208,255,7,0,0,0,0,0,
+192,67,0,0,0,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+32,150,140,53,106,219,39,109,73,70,0,0,0,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,12,21,97,68,177,225,107,96,66,69,71,73,78,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,16,221,226,166,120,183,112,229,81,85,79,84,69,0,0,0,
+48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,167,140,251,107,213,47,144,84,
+81,85,65,83,73,81,85,79,84,69,0,0,0,0,0,0,40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,44,36,29,90,181,1,27,114,85,78,81,85,79,84,69,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,185,89,95,145,164,174,152,187,85,78,81,85,79,84,69,83,
+80,76,73,67,69,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+244,184,123,210,92,206,2,170,95,68,69,70,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,9,56,251,104,149,45,153,77,68,69,70,73,78,69,45,77,65,67,82,79,0,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,130,31,193,209,1,218,53,175,
+95,83,69,84,33,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+18,115,191,213,127,162,44,45,47,92,95,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,50,75,208,249,57,174,48,90,67,79,78,83,0,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,200,191,220,168,150,105,60,28,69,82,82,79,82,0,0,0,
+48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,237,193,194,56,242,189,62,42,
+83,89,78,84,65,88,45,69,82,82,79,82,0,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,238,190,206,213,79,167,142,240,87,82,73,84,69,0,0,0,40,0,0,0,0,0,0,0,
+7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,194,31,58,108,66,127,165,44,68,73,83,80,76,65,89,0,
+48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,204,193,253,134,50,9,144,20,
+87,82,73,84,69,45,67,72,65,82,0,0,0,0,0,0,56,0,0,0,0,0,0,0,18,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,147,205,25,167,144,170,124,18,79,80,69,78,45,79,85,84,80,85,84,45,83,84,82,73,
+78,71,0,0,0,0,0,0,56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+121,119,194,231,134,227,70,93,71,69,84,45,79,85,84,80,85,84,45,83,84,82,73,78,71,0,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,92,144,199,109,69,255,222,100,
+95,83,69,84,45,79,85,84,80,85,84,45,80,79,82,84,33,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,49,13,41,223,126,153,134,106,70,76,85,83,72,45,79,85,
+84,80,85,84,45,80,79,82,84,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,50,248,219,35,17,177,242,78,82,69,65,68,0,0,0,0,48,0,0,0,0,0,0,0,
+11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,27,47,37,148,35,160,122,91,82,69,65,68,45,83,72,65,
+82,69,68,0,0,0,0,0,48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+214,22,2,218,51,219,235,84,82,69,65,68,45,70,73,76,69,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,222,23,169,149,228,194,160,255,69,79,70,45,79,66,74,69,
+67,84,63,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+246,63,210,167,142,102,37,133,87,82,73,84,69,45,66,73,78,65,82,89,0,0,0,0,48,0,0,0,0,0,0,0,
+11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,20,238,25,69,181,214,82,252,82,69,65,68,45,66,73,78,
+65,82,89,0,0,0,0,0,56,0,0,0,0,0,0,0,18,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+102,217,59,106,141,99,202,146,71,69,84,45,85,78,73,86,69,82,83,65,76,45,84,73,77,69,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,42,211,191,78,97,214,209,113,
+82,69,65,76,45,84,73,77,69,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,109,152,240,103,32,55,11,10,82,85,78,84,73,77,69,0,56,0,0,0,0,0,0,0,
+19,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,4,19,125,25,28,149,141,181,80,82,73,78,84,45,71,67,
+45,83,84,65,84,73,83,84,73,67,83,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,52,173,202,122,120,69,90,252,77,65,67,82,79,69,88,80,65,78,68,0,0,0,0,0,
+40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,73,210,64,64,127,56,144,153,
+69,81,63,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+41,97,151,45,58,76,51,79,69,81,86,63,0,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,228,123,45,160,12,215,220,10,69,81,85,65,76,63,0,0,48,0,0,0,0,0,0,0,
+8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,156,156,211,117,136,185,72,108,66,79,79,76,69,65,78,63,
+0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+64,95,165,4,120,32,29,237,78,79,84,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,16,78,150,63,127,87,150,132,67,65,82,0,0,0,0,0,40,0,0,0,0,0,0,0,
+3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,221,3,148,63,127,89,144,132,67,68,82,0,0,0,0,0,
+48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,63,41,248,211,115,4,68,210,
+83,69,84,45,67,65,82,33,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,205,63,123,86,114,137,226,189,83,69,84,45,67,68,82,33,0,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,59,232,148,60,215,144,218,135,
+78,85,76,76,63,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+76,250,218,46,78,105,48,26,80,65,73,82,63,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,95,187,50,144,0,200,248,110,76,73,83,84,0,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,213,92,67,197,245,56,119,195,76,73,83,84,63,0,0,0,
+48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,145,232,82,215,5,109,27,126,
+77,65,75,69,45,76,73,83,84,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,205,80,76,178,195,186,59,1,76,73,83,84,45,67,79,80,89,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,84,178,59,60,2,110,197,157,
+76,69,78,71,84,72,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+48,165,160,117,86,76,208,32,65,80,80,69,78,68,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,95,24,109,31,243,157,97,228,65,80,80,69,78,68,45,82,69,86,69,82,83,69,33,0,
+48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,149,166,95,236,121,165,240,195,
+76,73,83,84,45,82,69,70,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,63,188,238,107,201,110,110,93,78,84,72,67,68,82,0,0,40,0,0,0,0,0,0,0,
+7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,88,36,51,191,9,194,134,185,86,69,67,84,79,82,63,0,
+48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,209,6,191,104,53,248,61,240,
+77,65,75,69,45,86,69,67,84,79,82,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,240,36,2,79,39,227,81,44,86,69,67,84,79,82,45,71,82,79,87,0,0,0,0,0,
+48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,200,8,0,0,2,0,0,0,63,180,36,115,218,240,104,32,
+86,69,67,84,79,82,45,76,69,78,71,84,72,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,52,234,25,89,67,124,9,137,86,69,67,84,79,82,45,83,69,84,33,0,0,0,0,0,
+48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,9,3,62,97,197,171,9,163,
+86,69,67,84,79,82,45,83,87,65,80,33,0,0,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,85,118,141,183,235,140,168,220,86,69,67,84,79,82,45,82,69,70,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,6,130,72,163,237,238,0,114,
+86,69,67,84,79,82,45,70,73,76,76,33,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,26,129,54,206,138,164,223,217,86,69,67,84,79,82,45,65,83,83,81,0,0,0,0,0,
+48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,146,223,105,104,121,156,101,83,
+83,85,66,86,69,67,84,79,82,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,78,74,98,190,42,170,101,221,76,73,83,84,45,62,86,69,67,84,79,82,0,0,0,0,
+48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,119,223,168,81,218,128,89,127,
+86,69,67,84,79,82,45,62,76,73,83,84,0,0,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,252,70,151,56,19,17,23,93,77,65,75,69,45,70,54,52,86,69,67,84,79,82,0,0,
+48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,178,64,29,224,14,201,182,20,
+70,54,52,86,69,67,84,79,82,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,
+24,9,0,0,2,0,0,0,209,158,108,158,70,49,216,79,70,54,52,86,69,67,84,79,82,63,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,16,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,105,228,131,28,14,99,188,97,
+70,54,52,86,69,67,84,79,82,45,76,69,78,71,84,72,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,51,183,135,212,42,137,178,119,70,54,52,86,69,67,84,79,
+82,45,82,69,70,0,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+188,217,50,69,201,155,23,226,70,54,52,86,69,67,84,79,82,45,83,69,84,33,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,15,95,5,216,39,141,201,30,70,54,52,86,69,67,84,79,
+82,45,62,76,73,83,84,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+171,38,65,26,109,162,41,163,76,73,83,84,45,62,70,54,52,86,69,67,84,79,82,0,56,0,0,0,0,0,0,0,
+17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,30,249,83,77,241,176,186,113,70,54,52,86,69,67,84,79,
+82,45,62,86,69,67,84,79,82,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,210,92,44,33,136,67,87,167,86,69,67,84,79,82,45,62,70,54,52,86,69,67,84,79,
+82,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+17,8,51,36,137,34,219,17,70,54,52,86,69,67,84,79,82,45,67,79,80,89,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,249,232,114,195,167,16,32,148,70,54,52,86,69,67,84,79,
+82,45,70,73,76,76,33,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+124,115,29,240,43,56,72,61,70,54,52,86,69,67,84,79,82,45,65,68,68,0,0,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,29,84,44,220,43,194,64,58,70,54,52,86,69,67,84,79,
+82,45,77,85,76,0,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+203,183,194,55,16,245,120,204,70,54,52,86,69,67,84,79,82,45,83,67,65,76,69,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,141,35,122,214,42,173,97,116,70,54,52,86,69,67,84,79,
+82,45,83,85,77,0,0,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+100,72,29,155,43,69,197,64,70,54,52,86,69,67,84,79,82,45,68,79,84,0,0,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,183,203,66,220,43,200,12,58,70,54,52,86,69,67,84,79,
+82,45,77,73,78,0,0,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,144,7,0,0,2,0,0,0,
+213,128,87,220,43,118,20,58,70,54,52,86,69,67,84,79,82,45,77,65,88,0,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,137,19,14,166,123,176,230,124,70,54,52,86,69,67,84,79,
+82,45,83,79,82,84,33,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+211,201,235,16,82,130,251,76,77,65,75,69,45,83,54,52,86,69,67,84,79,82,0,0,48,0,0,0,0,0,0,0,
+9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,230,48,239,184,124,112,251,145,83,54,52,86,69,67,84,79,
+82,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+85,252,0,195,238,252,112,253,83,54,52,86,69,67,84,79,82,63,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+16,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,80,43,34,35,194,196,64,7,83,54,52,86,69,67,84,79,
+82,45,76,69,78,71,84,72,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,
+176,12,0,0,2,0,0,0,30,25,87,187,224,230,198,83,83,54,52,86,69,67,84,79,82,45,82,69,70,0,0,0,
+48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,79,106,164,154,217,64,18,246,
+83,54,52,86,69,67,84,79,82,45,83,69,84,33,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,2,86,16,169,164,183,28,137,83,54,52,86,69,67,84,79,82,45,62,76,73,83,84,0,
+48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,143,122,145,117,8,148,59,202,
+76,73,83,84,45,62,83,54,52,86,69,67,84,79,82,0,56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,61,141,179,40,1,185,185,34,83,54,52,86,69,67,84,79,82,45,62,86,69,67,84,79,
+82,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+45,173,44,68,143,32,101,61,86,69,67,84,79,82,45,62,83,54,52,86,69,67,84,79,82,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,15,156,235,189,8,82,114,225,
+83,54,52,86,69,67,84,79,82,45,67,79,80,89,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,2,115,136,225,246,129,90,170,83,54,52,86,69,67,84,79,82,45,70,73,76,76,33,0,
+48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,25,121,192,75,237,253,165,53,
+83,54,52,86,69,67,84,79,82,45,65,68,68,0,0,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,4,74,45,93,225,173,164,94,83,54,52,86,69,67,84,79,82,45,77,85,76,0,0,0,
+48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,190,167,209,92,179,233,56,249,
+83,54,52,86,69,67,84,79,82,45,83,67,65,76,69,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,184,140,241,191,224,194,245,83,83,54,52,86,69,67,84,79,82,45,83,85,77,0,0,0,
+48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,217,45,77,89,237,114,50,49,
+83,54,52,86,69,67,84,79,82,45,68,79,84,0,0,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,
+104,10,0,0,2,0,0,0,26,185,240,93,225,219,129,94,83,54,52,86,69,67,84,79,82,45,77,73,78,0,0,0,
+48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,1,0,0,2,0,0,0,244,208,47,93,225,193,60,94,
+83,54,52,86,69,67,84,79,82,45,77,65,88,0,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,157,217,247,85,122,75,157,44,83,54,52,86,69,67,84,79,82,45,83,79,82,84,33,0,
+40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,169,139,96,171,250,118,69,59,
+83,84,82,73,78,71,63,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+193,39,200,73,198,56,37,89,77,65,75,69,45,83,84,82,73,78,71,0,0,0,0,0,48,0,0,0,0,0,0,0,
+8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,69,183,128,32,241,13,133,26,83,84,82,73,78,71,61,63,
+0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+168,194,155,34,241,161,147,23,83,84,82,73,78,71,60,63,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,117,24,166,3,200,113,81,56,83,85,66,83,84,82,73,78,
+71,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+77,206,245,128,189,244,246,198,83,84,82,73,78,71,45,78,85,76,76,63,0,0,0,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,177,98,119,43,15,218,32,42,83,84,82,73,78,71,45,76,
+69,78,71,84,72,0,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+251,189,79,217,64,136,122,29,83,84,82,73,78,71,45,82,69,70,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,233,164,93,44,60,98,161,77,83,84,82,73,78,71,45,83,
+69,84,33,0,0,0,0,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+141,62,253,90,35,215,26,211,83,84,82,73,78,71,45,85,80,67,65,83,69,0,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,255,38,47,199,139,91,244,151,83,84,82,73,78,71,45,68,
+79,87,78,67,65,83,69,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+242,194,200,189,224,90,207,243,83,84,82,73,78,71,45,65,80,80,69,78,68,0,0,0,48,0,0,0,0,0,0,0,
+12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,69,177,93,168,45,11,100,97,83,84,82,73,78,71,45,62,
+76,73,83,84,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+69,52,10,27,144,46,200,246,76,73,83,84,45,62,83,84,82,73,78,71,0,0,0,0,48,0,0,0,0,0,0,0,
+14,0,0,0,0,5,5,0,16,6,0,0,2,0,0,0,156,196,141,188,54,50,196,4,83,84,82,73,78,71,45,62,
+78,85,77,66,69,82,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+107,208,73,251,24,124,35,43,78,85,77,66,69,82,45,62,83,84,82,73,78,71,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,212,184,218,104,104,207,156,9,67,72,65,82,63,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,165,237,173,27,106,73,34,48,
+67,72,65,82,61,63,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+140,143,190,27,106,9,40,48,67,72,65,82,60,63,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,85,123,122,118,198,87,94,178,67,72,65,82,45,85,80,67,65,83,69,0,0,0,0,0,
+48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,163,193,238,77,152,153,53,22,
+67,72,65,82,45,68,79,87,78,67,65,83,69,0,0,0,56,0,0,0,0,0,0,0,16,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,196,45,209,151,156,147,154,66,67,72,65,82,45,87,72,73,84,69,83,80,65,67,69,63,
+0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,18,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+247,176,176,158,6,122,223,246,67,72,65,82,45,65,76,80,72,65,78,85,77,69,82,73,67,63,0,0,0,0,0,0,
+56,0,0,0,0,0,0,0,16,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,120,225,113,19,93,155,140,139,
+67,72,65,82,45,65,76,80,72,65,66,69,84,73,67,63,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,220,182,44,146,146,1,51,147,67,72,65,82,45,78,85,77,
+69,82,73,67,63,0,0,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+77,209,168,58,40,183,233,134,67,72,65,82,45,62,73,78,84,69,71,69,82,0,0,0,40,0,0,0,0,0,0,0,
+1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,132,17,98,41,76,176,99,175,61,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,134,54,98,41,76,166,99,175,
+43,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+212,38,98,41,76,160,99,175,45,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,
+80,3,0,0,2,0,0,0,49,53,98,41,76,167,99,175,42,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,178,43,98,41,76,162,99,175,47,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,55,18,98,41,76,177,99,175,
+60,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,24,7,0,0,2,0,0,0,
+59,160,7,163,57,98,113,188,73,78,84,69,71,69,82,63,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,40,24,0,0,2,0,0,0,49,149,218,149,232,241,18,124,69,86,69,78,63,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,48,23,216,236,31,13,96,2,
+82,69,65,76,63,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,192,16,0,0,2,0,0,0,
+45,9,196,64,127,97,100,153,69,88,80,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,160,60,135,100,59,36,155,105,69,88,80,84,0,0,0,0,40,0,0,0,0,0,0,0,
+3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,87,78,187,15,120,93,100,227,76,79,71,0,0,0,0,0,
+40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,11,245,72,171,120,203,94,80,
+83,73,78,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,136,11,0,0,2,0,0,0,
+209,62,239,63,127,210,168,132,67,79,83,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,
+128,1,0,0,2,0,0,0,18,235,239,252,120,16,2,10,84,65,78,0,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,64,212,123,149,76,126,118,26,65,84,65,78,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,147,84,240,17,10,85,169,7,
+83,81,82,84,0,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+174,229,167,55,142,251,221,238,82,79,85,78,68,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,251,166,220,163,226,52,205,106,70,76,79,79,82,0,0,0,40,0,0,0,0,0,0,0,
+7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,84,4,81,77,218,225,0,146,67,69,73,76,73,78,71,0,
+48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,144,152,169,203,174,200,126,58,
+81,85,79,84,73,69,78,84,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,198,157,200,53,192,226,39,206,82,69,77,65,73,78,68,69,82,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,240,59,184,113,7,119,165,214,
+77,79,68,85,76,79,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+114,106,45,75,127,136,58,143,65,66,83,0,0,0,0,0,48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,
+64,7,0,0,2,0,0,0,76,50,102,174,146,51,182,251,77,65,71,78,73,84,85,68,69,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,198,134,115,8,221,206,183,219,
+69,88,65,67,84,63,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+94,243,226,200,166,163,41,17,69,88,65,67,84,45,62,73,78,69,88,65,67,84,0,0,48,0,0,0,0,0,0,0,
+14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,147,158,60,207,54,50,128,185,73,78,69,88,65,67,84,45,
+62,69,88,65,67,84,0,0,40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+134,139,68,94,231,49,13,207,83,89,77,66,79,76,63,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,
+152,8,0,0,2,0,0,0,149,22,150,54,37,67,2,24,83,89,77,66,79,76,60,63,0,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,248,193,100,91,59,36,163,141,
+83,84,82,73,78,71,45,62,83,89,77,66,79,76,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,187,34,120,103,16,235,84,177,83,89,77,66,79,76,45,62,83,84,82,73,78,71,0,0,
+64,0,0,0,0,0,0,0,26,0,0,0,0,5,5,0,248,10,0,0,2,0,0,0,119,175,244,234,178,244,138,33,
+71,69,78,69,82,65,84,69,45,85,78,73,78,84,69,82,78,69,68,45,83,89,77,66,79,76,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,108,138,248,10,14,37,45,163,
+71,69,78,83,89,77,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+190,228,152,53,58,26,105,25,69,86,65,76,0,0,0,0,40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,61,199,217,46,170,28,26,143,67,79,77,80,73,76,69,0,64,0,0,0,0,0,0,0,
+25,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,239,73,7,91,230,117,156,130,83,89,83,84,69,77,45,71,
+76,79,66,65,76,45,69,78,86,73,82,79,78,77,69,78,84,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,
+24,0,0,0,0,5,5,0,176,29,0,0,2,0,0,0,239,33,235,204,116,43,119,219,85,83,69,82,45,73,78,73,
+84,73,65,76,45,69,78,86,73,82,79,78,77,69,78,84,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,24,167,118,178,34,6,89,65,72,65,83,72,45,84,65,66,
+76,69,63,0,0,0,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+24,156,49,128,2,177,148,251,77,65,75,69,45,72,65,83,72,45,84,65,66,76,69,0,56,0,0,0,0,0,0,0,
+21,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,126,75,245,125,137,5,211,253,77,65,75,69,45,69,81,85,
+65,76,45,72,65,83,72,45,84,65,66,76,69,0,0,0,56,0,0,0,0,0,0,0,22,0,0,0,0,5,5,0,
+80,12,0,0,2,0,0,0,15,175,176,88,215,4,179,115,77,65,75,69,45,83,84,82,73,78,71,45,72,65,83,72,
+45,84,65,66,76,69,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+1,165,9,85,102,3,32,197,72,65,83,72,45,84,65,66,76,69,45,83,69,84,33,0,48,0,0,0,0,0,0,0,
+14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,249,138,233,211,246,230,23,26,72,65,83,72,45,84,65,66,
+76,69,45,82,69,70,0,0,48,0,0,0,0,0,0,0,15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+227,173,223,243,110,187,167,216,72,65,83,72,45,84,65,66,76,69,45,83,73,90,69,0,56,0,0,0,0,0,0,0,
+17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,67,68,150,15,212,131,248,161,72,65,83,72,45,84,65,66,
+76,69,45,62,65,76,73,83,84,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,246,64,114,234,121,43,167,235,77,65,80,0,0,0,0,0,48,0,0,0,0,0,0,0,
+8,0,0,0,0,5,5,0,176,20,0,0,2,0,0,0,255,182,76,190,9,92,50,153,70,79,82,45,69,65,67,72,
+0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+82,105,239,77,159,116,235,224,70,73,76,84,69,82,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,23,236,113,12,198,91,110,148,82,69,68,85,67,69,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,246,110,72,164,76,106,172,38,65,83,83,81,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,119,153,79,164,76,101,172,38,
+65,83,83,86,0,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,64,28,0,0,2,0,0,0,
+134,83,42,53,59,117,99,6,65,83,83,79,67,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,165,106,199,136,41,93,229,169,77,69,77,81,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,240,105,199,136,41,92,229,169,77,69,77,86,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,70,69,191,17,232,208,54,94,
+77,69,77,66,69,82,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+75,236,192,165,234,143,140,105,86,69,67,84,79,82,45,77,65,80,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+20,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,235,158,24,225,226,205,42,168,86,69,67,84,79,82,45,66,
+73,78,65,82,89,45,83,69,65,82,67,72,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,205,34,121,122,10,163,254,45,83,79,82,84,0,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,202,161,7,187,206,246,209,160,83,79,82,84,33,0,0,0,
+48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,195,59,151,240,160,35,226,234,
+80,82,79,77,73,83,69,63,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,22,197,56,117,76,9,131,167,77,65,75,69,45,80,82,79,77,73,83,69,0,0,0,0,
+56,0,0,0,0,0,0,0,18,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,162,52,122,154,87,137,204,209,
+95,80,82,79,77,73,83,69,45,80,82,79,67,69,68,85,82,69,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,48,19,0,0,2,0,0,0,69,75,79,129,72,114,147,136,95,80,82,79,77,73,83,69,
+45,83,84,79,82,69,33,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+76,144,242,43,116,50,78,250,80,82,79,77,73,83,69,45,86,65,76,85,69,0,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,56,10,0,0,2,0,0,0,6,22,57,105,251,10,216,234,80,82,79,77,73,83,69,45,
+70,79,82,67,69,68,63,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+74,228,59,121,241,213,68,181,71,69,78,69,82,65,84,79,82,63,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,152,131,154,234,106,235,231,190,82,65,78,71,69,45,71,69,
+78,69,82,65,84,79,82,0,56,0,0,0,0,0,0,0,16,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+63,226,154,103,241,73,132,128,86,69,67,84,79,82,45,71,69,78,69,82,65,84,79,82,0,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,129,123,55,167,158,159,242,195,
+76,73,83,84,45,71,69,78,69,82,65,84,79,82,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,225,232,163,91,167,28,47,177,70,73,76,69,45,71,69,78,69,82,65,84,79,82,0,0,
+56,0,0,0,0,0,0,0,16,0,0,0,0,5,5,0,56,26,0,0,2,0,0,0,147,52,57,67,89,25,94,195,
+95,71,69,78,69,82,65,84,79,82,45,83,84,65,71,69,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+14,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,6,27,48,62,178,16,102,161,95,71,69,78,69,82,65,84,
+79,82,45,82,85,78,0,0,56,0,0,0,0,0,0,0,20,0,0,0,0,5,5,0,208,0,0,0,2,0,0,0,
+185,145,218,88,11,212,239,248,95,80,65,82,65,76,76,69,76,45,86,69,67,84,79,82,45,77,65,80,0,0,0,0,
+48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,165,32,215,89,100,129,253,141,
+95,70,85,84,85,82,69,45,83,84,65,82,84,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,79,149,44,86,13,154,64,222,95,70,85,84,85,82,69,45,87,65,73,84,0,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,234,240,115,199,236,231,223,135,
+65,80,80,76,89,0,0,0,56,0,0,0,0,0,0,0,19,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+82,186,91,153,25,140,249,20,67,79,77,80,73,76,69,68,45,80,82,79,67,69,68,85,82,69,63,0,0,0,0,0,
+56,0,0,0,0,0,0,0,19,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,3,171,138,43,15,177,221,145,
+67,79,77,80,79,85,78,68,45,80,82,79,67,69,68,85,82,69,63,0,0,0,0,0,56,0,0,0,0,0,0,0,
+21,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,25,67,184,9,216,228,168,182,80,82,79,67,69,68,85,82,
+69,45,69,78,86,73,82,79,78,77,69,78,84,0,0,0,48,0,0,0,0,0,0,0,14,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,144,254,122,109,212,104,84,89,80,82,79,67,69,68,85,82,69,45,66,79,68,89,0,0,
+40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,116,16,171,52,157,134,129,109,
+67,65,76,76,47,67,67,0,48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+130,189,91,136,13,233,222,32,67,79,78,84,73,78,85,65,84,73,79,78,63,0,0,0,40,0,0,0,0,0,0,0,
+6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,81,21,180,83,104,253,189,86,82,65,78,68,79,77,0,0,
+48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,161,85,8,241,128,134,143,199,
+82,65,78,68,79,77,45,83,69,69,68,33,0,0,0,0,40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,93,1,116,157,63,86,77,84,71,67,45,70,76,73,80,0,48,0,0,0,0,0,0,0,
+13,0,0,0,0,5,5,0,152,10,0,0,2,0,0,0,146,147,63,213,57,216,98,184,71,67,45,83,84,65,84,73,
+83,84,73,67,83,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+12,190,191,241,42,90,6,255,76,65,77,66,68,65,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,27,176,15,141,76,33,34,26,65,82,71,83,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,39,198,109,59,11,144,203,16,83,69,84,33,0,0,0,0,
+40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,68,234,208,233,120,106,74,26,
+86,65,82,0,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+43,88,102,41,76,21,100,175,88,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,224,59,184,78,210,190,146,191,68,69,70,73,78,69,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,180,215,194,40,235,103,177,249,69,88,80,82,83,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,48,5,0,0,2,0,0,0,4,59,175,236,105,86,124,10,
+70,73,82,83,84,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+43,181,111,222,160,244,40,232,83,69,67,79,78,68,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,13,235,158,120,98,179,46,19,84,72,73,82,68,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,190,245,90,64,204,109,77,229,83,79,77,69,63,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,207,163,158,90,244,55,15,176,
+80,82,69,68,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,144,39,0,0,2,0,0,0,
+39,42,102,41,76,1,100,175,76,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,241,172,203,173,44,27,214,135,95,77,65,80,49,45,72,69,76,80,69,82,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,56,29,0,0,2,0,0,0,108,46,214,90,244,180,52,176,
+80,82,79,67,0,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+122,212,215,66,221,104,242,16,82,69,83,85,76,84,0,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,99,57,80,242,106,215,149,216,82,69,86,69,82,83,69,33,0,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,40,0,0,0,2,0,0,0,12,181,107,191,41,167,79,223,
+77,65,80,49,0,0,0,0,48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+132,146,19,193,142,50,73,157,70,79,82,45,69,65,67,72,49,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,114,155,74,164,225,103,142,244,82,69,86,69,82,83,69,0,
+48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,16,35,0,0,2,0,0,0,6,186,65,48,85,53,49,45,
+76,65,83,84,45,80,65,73,82,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,32,103,190,107,41,93,44,208,76,73,83,84,45,84,65,73,76,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,166,53,102,41,76,6,100,175,
+75,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,136,3,0,0,2,0,0,0,
+50,244,4,141,89,82,151,46,90,69,82,79,63,0,0,0,56,0,0,0,0,0,0,0,22,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,109,145,159,3,96,213,74,230,95,69,88,80,65,78,68,45,83,72,79,82,84,72,65,78,
+68,45,66,79,68,89,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+110,250,167,150,245,212,200,114,80,65,84,72,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,201,203,48,150,245,230,180,114,80,65,73,82,0,0,0,0,56,0,0,0,0,0,0,0,
+17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,227,203,174,192,68,17,225,139,95,69,88,80,65,78,68,45,
+83,72,79,82,84,72,65,78,68,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,129,154,138,141,153,27,213,255,84,69,88,84,0,0,0,0,56,0,0,0,0,0,0,0,
+20,0,0,0,0,5,5,0,104,39,0,0,2,0,0,0,27,68,148,1,42,132,169,30,95,83,72,79,82,84,72,65,
+78,68,45,65,67,67,69,83,83,79,82,83,0,0,0,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,212,205,72,201,1,220,49,116,86,69,67,84,79,82,0,0,48,0,0,0,0,0,0,0,
+11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,243,251,179,128,122,134,37,229,86,69,67,84,79,82,45,67,
+79,80,89,0,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+37,55,102,41,76,11,100,175,86,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+16,14,0,0,2,0,0,0,141,39,95,192,114,241,179,164,86,69,67,84,79,82,45,72,69,65,68,0,0,0,0,0,
+40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,71,121,67,64,127,77,27,153,
+69,78,68,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+80,164,231,188,254,144,208,71,86,69,67,84,79,82,45,84,65,73,76,0,0,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,100,246,202,176,167,33,70,81,83,84,65,82,84,0,0,0,
+40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,109,38,156,130,76,48,31,88,
+67,72,65,82,62,61,63,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+160,222,97,41,76,252,99,175,65,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,73,215,97,41,76,255,99,175,66,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,66,211,146,27,106,89,31,48,67,72,65,82,62,63,0,0,
+40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,162,219,50,182,77,110,137,146,
+67,72,65,82,60,61,63,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+222,5,116,137,43,132,165,154,83,84,82,73,78,71,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+64,6,0,0,2,0,0,0,64,251,218,104,104,179,156,9,67,72,65,82,83,0,0,0,48,0,0,0,0,0,0,0,
+9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,76,187,95,49,189,81,210,151,83,84,82,73,78,71,62,61,
+63,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+110,40,132,34,241,221,149,23,83,84,82,73,78,71,62,63,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,26,164,62,101,189,3,153,171,83,84,82,73,78,71,60,61,
+63,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,88,1,0,0,2,0,0,0,
+130,11,167,77,112,210,84,204,83,84,82,73,78,71,45,67,79,80,89,0,0,0,0,0,40,0,0,0,0,0,0,0,
+1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,206,79,102,41,76,14,100,175,83,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,79,83,83,25,106,40,125,82,
+83,84,82,73,78,71,45,72,69,65,68,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,202,236,168,147,143,195,108,107,83,84,82,73,78,71,45,84,65,73,76,0,0,0,0,0,
+48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,178,86,50,164,152,242,7,15,
+95,77,65,75,69,45,76,65,77,66,68,65,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,94,92,38,210,40,238,6,103,66,79,68,89,0,0,0,0,56,0,0,0,0,0,0,0,
+19,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,164,121,221,204,41,121,126,132,95,67,72,69,67,75,45,66,
+73,78,68,73,78,71,45,76,73,83,84,0,0,0,0,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,234,205,94,113,25,102,221,246,66,73,78,68,73,78,71,83,0,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,120,146,236,93,44,235,130,230,
+69,78,84,82,89,0,0,0,56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+222,24,146,30,89,71,2,140,95,76,69,84,45,62,67,79,77,66,73,78,65,84,73,79,78,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,196,126,248,7,146,231,114,105,
+66,79,68,89,45,70,85,78,67,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,177,155,67,42,9,146,72,2,73,78,73,84,73,65,76,45,65,82,71,83,0,0,0,0,
+40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,208,0,133,15,120,78,90,227,
+76,69,84,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,144,31,0,0,2,0,0,0,
+67,4,230,209,126,251,214,42,95,76,69,84,42,45,72,69,76,80,69,82,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,204,248,116,136,2,80,116,215,76,69,84,42,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,67,66,95,168,110,28,107,13,
+76,69,84,82,69,67,0,0,56,0,0,0,0,0,0,0,19,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+108,0,7,161,171,58,11,227,95,67,79,78,68,45,67,72,69,67,75,45,67,76,65,85,83,69,83,0,0,0,0,0,
+40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,139,93,91,61,161,161,70,131,
+67,76,65,85,83,69,83,0,40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+125,154,136,210,212,206,255,152,67,76,65,85,83,69,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,45,100,1,145,72,137,57,147,95,67,79,78,68,45,72,69,76,80,69,82,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,137,48,178,83,58,97,2,100,
+69,76,83,69,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+131,203,209,249,57,195,48,90,67,79,78,68,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+88,16,0,0,2,0,0,0,143,150,84,46,85,237,141,18,95,65,78,68,45,72,69,76,80,69,82,0,0,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,33,178,239,51,53,176,127,200,
+80,82,69,68,83,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,112,44,0,0,2,0,0,0,
+243,91,10,75,127,241,142,143,65,78,68,0,0,0,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,110,213,163,180,112,124,91,194,95,79,82,45,72,69,76,80,69,82,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,2,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,106,58,191,53,106,231,30,109,
+79,82,0,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+139,214,231,237,57,128,182,225,67,65,83,69,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,6,60,244,233,120,32,202,3,75,69,89,0,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,200,31,0,0,2,0,0,0,246,8,135,100,59,42,155,105,69,88,80,82,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,8,86,14,2,248,248,140,216,
+80,85,83,72,0,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,5,5,0,72,18,0,0,2,0,0,0,
+26,161,146,57,106,108,197,104,68,79,0,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,96,199,160,48,117,2,93,125,86,65,82,83,0,0,0,0,48,0,0,0,0,0,0,0,
+10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,111,237,207,211,35,143,96,154,76,79,79,80,45,67,72,69,
+67,75,0,0,0,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+91,64,188,182,127,62,98,93,76,79,79,80,83,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,174,255,195,139,46,213,1,21,78,65,77,69,83,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,24,62,173,82,130,133,39,56,73,78,73,84,83,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,15,25,188,210,167,118,195,56,
+83,84,69,80,83,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+117,218,97,41,76,251,99,175,70,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,112,141,84,207,237,146,155,179,68,79,84,73,77,69,83,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,195,212,118,250,62,35,127,64,70,79,82,77,0,0,0,0,
+40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,200,52,102,41,76,4,100,175,
+73,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,168,18,0,0,2,0,0,0,
+157,45,102,41,76,3,100,175,78,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,218,153,213,57,106,58,127,104,62,61,0,0,0,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,56,36,0,0,2,0,0,0,147,36,75,24,115,254,49,32,83,87,65,80,33,0,0,0,
+40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,248,95,102,41,76,20,100,175,
+89,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+80,189,237,141,153,61,202,255,84,69,77,80,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,184,229,91,103,144,13,139,215,73,78,67,33,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,208,123,249,147,81,58,243,3,68,69,67,33,0,0,0,0,
+40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,218,96,182,184,55,15,21,181,
+67,65,65,82,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+14,37,220,220,57,30,153,213,67,68,68,82,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,171,32,169,184,55,11,24,181,67,65,68,82,0,0,0,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,47,5,227,220,57,194,160,213,67,68,65,82,0,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,93,35,122,138,174,83,92,106,
+67,65,65,65,82,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,248,48,0,0,2,0,0,0,
+196,218,113,138,174,103,87,106,67,65,65,68,82,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+128,55,0,0,2,0,0,0,14,21,18,157,174,216,176,94,67,65,68,65,82,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,218,11,207,182,82,125,40,227,67,68,65,65,82,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,151,152,1,157,174,220,176,94,
+67,65,68,68,82,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+23,70,202,182,82,101,45,227,67,68,65,68,82,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+144,38,0,0,2,0,0,0,81,69,92,133,82,176,194,207,67,68,68,65,82,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,76,17,105,133,82,144,197,207,67,68,68,68,82,0,0,0,
+40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,0,50,0,0,2,0,0,0,108,76,248,38,216,51,37,90,
+78,85,77,66,69,82,63,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,8,36,0,0,2,0,0,0,
+225,228,91,82,103,181,119,151,79,68,68,63,0,0,0,0,48,0,0,0,0,0,0,0,8,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,212,63,63,38,230,172,168,53,73,78,69,88,65,67,84,63,0,0,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,238,252,69,70,61,5,38,220,
+80,79,83,73,84,73,86,69,63,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,9,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,125,40,231,99,125,81,251,154,78,69,71,65,84,73,86,69,63,0,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,173,21,98,41,76,179,99,175,
+62,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+148,232,220,57,106,78,120,104,60,61,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,94,74,114,234,121,51,167,235,77,65,88,0,0,0,0,0,40,0,0,0,0,0,0,0,
+2,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,118,139,130,53,106,168,24,109,76,83,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,244,41,102,41,76,0,100,175,
+77,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+96,202,48,234,121,17,158,235,77,73,78,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,29,223,101,22,57,249,238,213,95,71,67,68,45,72,69,76,80,69,82,0,0,0,0,0,
+40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,168,52,0,0,2,0,0,0,96,211,130,66,127,161,116,170,
+71,67,68,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+137,66,159,15,120,199,106,227,76,67,77,0,0,0,0,0,56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,39,36,21,158,153,120,231,19,65,76,73,83,84,45,62,72,65,83,72,45,84,65,66,76,
+69,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+233,146,214,221,234,7,167,208,65,76,73,83,84,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,123,55,102,41,76,5,100,175,72,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+23,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,161,43,53,182,10,145,79,31,77,65,75,69,45,73,78,73,
+84,73,65,76,73,90,69,68,45,86,69,67,84,79,82,0,40,0,0,0,0,0,0,0,2,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,43,239,251,57,106,61,190,104,70,78,0,0,0,0,0,0,56,0,0,0,0,0,0,0,
+19,0,0,0,0,5,5,0,8,59,0,0,2,0,0,0,29,27,158,185,179,191,56,119,80,65,82,65,76,76,69,76,
+45,86,69,67,84,79,82,45,77,65,80,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,
+176,3,0,0,2,0,0,0,27,147,71,171,169,178,106,51,80,65,82,65,76,76,69,76,45,77,65,80,0,0,0,0,
+40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,145,49,69,197,245,228,118,195,
+76,73,83,84,83,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+112,79,186,195,158,108,72,171,68,69,76,65,89,0,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,91,171,196,150,3,98,230,14,70,79,82,67,69,0,0,0,40,0,0,0,0,0,0,0,
+7,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,174,86,150,249,40,255,190,176,80,82,79,77,73,83,69,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,63,247,88,173,84,71,247,27,
+70,85,84,85,82,69,0,0,40,0,0,0,0,0,0,0,5,0,0,0,0,5,5,0,8,51,0,0,2,0,0,0,
+143,198,242,170,97,236,241,250,84,72,85,78,75,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,197,157,53,103,10,76,54,49,83,76,79,84,0,0,0,0,40,0,0,0,0,0,0,0,
+5,0,0,0,0,5,5,0,176,23,0,0,2,0,0,0,132,81,245,81,180,93,129,144,84,79,85,67,72,0,0,0,
+48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,26,62,220,128,228,30,110,49,
+67,79,78,83,45,83,84,82,69,65,77,0,0,0,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,169,216,72,140,111,24,113,69,83,84,82,69,65,77,45,67,65,82,0,0,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,67,63,254,177,43,108,154,177,
+83,84,82,69,65,77,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+56,158,64,140,111,170,87,69,83,84,82,69,65,77,45,67,68,82,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,65,198,13,165,124,181,236,57,83,84,82,69,65,77,45,80,
+65,73,82,63,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,8,10,0,0,2,0,0,0,
+85,2,50,157,163,9,64,66,83,84,82,69,65,77,45,78,85,76,76,63,0,0,0,0,56,0,0,0,0,0,0,0,
+16,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,206,170,68,236,190,99,205,17,84,72,69,45,69,77,80,84,
+89,45,83,84,82,69,65,77,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,19,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,35,171,84,250,115,163,189,7,83,84,82,69,65,77,45,62,76,73,83,84,45,72,69,76,
+80,69,82,0,0,0,0,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+244,214,181,27,144,240,45,253,76,73,83,84,45,62,83,84,82,69,65,77,0,0,0,0,56,0,0,0,0,0,0,0,
+18,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,211,55,6,45,117,123,82,196,83,84,82,69,65,77,45,72,
+69,65,68,45,72,69,76,80,69,82,0,0,0,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+232,56,0,0,2,0,0,0,81,77,194,95,7,111,212,170,83,84,82,69,65,77,45,72,69,65,68,0,0,0,0,0,
+48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,216,60,0,0,2,0,0,0,145,145,63,254,167,210,105,145,
+83,84,82,69,65,77,45,84,65,73,76,0,0,0,0,0,48,0,0,0,0,0,0,0,10,0,0,0,0,5,5,0,
+40,43,0,0,2,0,0,0,109,253,51,183,111,236,56,31,83,84,82,69,65,77,45,77,65,80,0,0,0,0,0,0,
+48,0,0,0,0,0,0,0,13,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,162,46,100,175,254,78,200,17,
+83,84,82,69,65,77,45,70,73,76,84,69,82,0,0,0,48,0,0,0,0,0,0,0,11,0,0,0,0,5,5,0,
+72,25,0,0,2,0,0,0,160,252,13,254,167,215,108,145,83,84,82,69,65,77,45,84,65,75,69,0,0,0,0,0,
+56,0,0,0,0,0,0,0,17,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,249,145,109,126,211,64,94,221,
+83,84,82,69,65,77,45,84,65,75,69,45,87,72,73,76,69,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,
+11,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,183,84,184,120,145,14,245,137,83,84,82,69,65,77,45,70,
+79,76,68,0,0,0,0,0,40,0,0,0,0,0,0,0,2,0,0,0,0,5,5,0,248,41,0,0,2,0,0,0,
+12,9,191,53,106,233,30,109,79,80,0,0,0,0,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,207,225,53,75,127,140,50,143,65,67,67,0,0,0,0,0,48,0,0,0,0,0,0,0,
+15,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,207,182,131,175,89,48,217,158,83,84,82,69,65,77,45,70,
+79,82,45,69,65,67,72,0,48,0,0,0,0,0,0,0,12,0,0,0,0,5,5,0,184,11,0,0,2,0,0,0,
+105,184,237,186,247,66,42,52,83,84,82,69,65,77,45,62,76,73,83,84,0,0,0,0,48,0,0,0,0,0,0,0,
+10,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,9,13,154,99,189,152,205,97,80,82,79,67,69,68,85,82,
+69,63,0,0,0,0,0,0,40,0,0,0,0,0,0,0,1,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+131,50,102,41,76,13,100,175,80,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,7,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,85,225,176,14,247,130,104,35,78,69,87,76,73,78,69,0,40,0,0,0,0,0,0,0,
+4,0,0,0,0,5,5,0,208,55,0,0,2,0,0,0,47,97,136,55,244,250,41,141,80,79,82,84,0,0,0,0,
+56,0,0,0,0,0,0,0,21,0,0,0,0,5,5,0,208,21,0,0,2,0,0,0,212,180,65,10,179,201,243,121,
+87,73,84,72,45,79,85,84,80,85,84,45,84,79,45,83,84,82,73,78,71,0,0,0,40,0,0,0,0,0,0,0,
+3,0,0,0,0,5,5,0,16,21,0,0,2,0,0,0,69,97,248,120,121,7,193,40,79,76,68,0,0,0,0,0,
+40,0,0,0,0,0,0,0,6,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,97,48,194,144,156,127,84,3,
+65,83,83,69,82,84,0,0,40,0,0,0,0,0,0,0,3,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,
+253,111,62,19,128,129,87,83,61,61,62,0,0,0,0,0,40,0,0,0,0,0,0,0,4,0,0,0,0,5,5,0,
+0,0,0,0,0,0,0,0,210,135,147,141,153,29,151,255,84,69,83,84,0,0,0,0,48,0,0,0,0,0,0,0,
+8,0,0,0,0,5,5,0,0,0,0,0,0,0,0,0,128,243,150,175,125,24,76,46,69,88,80,69,67,84,69,68,
+0,0,0,0,0,0,0,0,
+};
+
 #include <stdlib.h>
 #include <ctype.h>
 #include <memory.h>
@@ -497,6 +5671,13 @@ static const char* lib_6_other_src_ =
 #include <math.h>
 #include <stdint.h>
 #include <assert.h>
+#include <time.h>
+
+#if !defined(LISP_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+#define LISP_THREADS_
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 #define ARITY_CHECK(min_, max_) do { \
   int args_length_ = lisp_list_length(args); \
@@ -504,103 +5685,146 @@ static const char* lib_6_other_src_ =
   if (args_length_ > max_) { *e = LISP_ERROR_TOO_MANY_ARGS; return lisp_null(); } \
 } while (0);
 
-static Lisp sch_cons(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_cons(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp y = lisp_car(args);
-    return lisp_cons(x, y, ctx);
+    return lisp_cons(argv[0], argv[1], ctx);
 }
 
-static Lisp sch_car(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_car(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_car(lisp_car(args));
+    return lisp_car(argv[0]);
 }
 
-static Lisp sch_cdr(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_cdr(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_cdr(lisp_car(args));
+    return lisp_cdr(argv[0]);
 }
 
-static Lisp sch_set_car(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_set_car(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    lisp_set_car(a, b);
+    lisp_set_car(argv[0], argv[1]);
     return lisp_null();
 }
 
-static Lisp sch_set_cdr(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_set_cdr(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    lisp_set_cdr(a, b);
+    lisp_set_cdr(argv[0], argv[1]);
     return lisp_null();
 }
 
-static Lisp sch_exact_eq(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_exact_eq(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    return lisp_make_bool(lisp_eq(a, b));
+    return lisp_make_bool(lisp_eq(argv[0], argv[1]));
 }
 
-static Lisp sch_equal(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_equal(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    return lisp_make_bool(lisp_equal(a, b));
+    return lisp_make_bool(lisp_equal(argv[0], argv[1]));
 }
 
-static Lisp sch_equal_r(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_equal_r(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    return lisp_make_bool(lisp_equal_r(a, b));
+    return lisp_make_bool(lisp_equal_r(argv[0], argv[1]));
 }
 
-static Lisp sch_is_null(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_is_null(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_is_null(lisp_car(args)));
+    return lisp_make_bool(lisp_is_null(argv[0]));
 }
 
-static Lisp sch_is_pair(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_is_pair(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_PAIR);
+    return lisp_make_bool(lisp_type(argv[0]) == LISP_PAIR);
+}
+
+// Output goes to an explicit port argument, then the current output port,
+// and then stdout. Returns null and sets the error for a non port.
+static Lisp output_port_(Lisp args, LispError* e, LispContext ctx)
+{
+    if (lisp_is_pair(args))
+    {
+        Lisp port = lisp_car(args);
+        if (lisp_type(port) != LISP_PORT) *e = LISP_ERROR_ARG_TYPE;
+        return port;
+    }
+    return lisp_output_port(ctx);
 }
 
 static Lisp sch_write(Lisp args, LispError* e, LispContext ctx)
 {
-    lisp_printf(lisp_stdout(ctx), lisp_car(args));
+    ARITY_CHECK(1, 2);
+    Lisp port = output_port_(lisp_cdr(args), e, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+
+    if (lisp_is_null(port))
+        lisp_printf(lisp_stdout(ctx), lisp_car(args));
+    else
+        lisp_port_print(port, lisp_car(args), ctx);
     return lisp_null();
 }
 
 static Lisp sch_display(Lisp args, LispError* e, LispContext ctx)
 {
+    ARITY_CHECK(1, 2);
     Lisp x = lisp_car(args);
-    lisp_displayf(lisp_stdout(ctx), x);
+    Lisp port = output_port_(lisp_cdr(args), e, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+
+    if (lisp_is_null(port))
+        lisp_displayf(lisp_stdout(ctx), x);
+    else
+        lisp_port_display(port, x, ctx);
     return x;
 }
 
 static Lisp sch_write_char(Lisp args, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    fputc(lisp_char(lisp_car(args)), lisp_stdout(ctx));
+    ARITY_CHECK(1, 2);
+    Lisp port = output_port_(lisp_cdr(args), e, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+
+    char c = (char)lisp_char(lisp_car(args));
+    if (lisp_is_null(port))
+        fputc(c, lisp_stdout(ctx));
+    else
+        lisp_port_write(port, &c, 1, ctx);
     return lisp_false();
 }
 
+static Lisp sch_open_output_string(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(0, 0);
+    return lisp_make_string_port(ctx);
+}
+
+static Lisp sch_get_output_string(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    Lisp port = lisp_car(args);
+    if (lisp_type(port) != LISP_PORT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    return lisp_port_string(port, ctx);
+}
+
+// (_set-output-port! port) redirects output, returning the previous port.
+// Null restores stdout.
+static Lisp sch_set_output_port(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    Lisp port = lisp_car(args);
+    if (!lisp_is_null(port) && lisp_type(port) != LISP_PORT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp old = lisp_output_port(ctx);
+    lisp_set_output_port(port, ctx);
+    return old;
+}
+
 static Lisp sch_flush(Lisp args, LispError* e, LispContext ctx)
 {
     fflush(lisp_stdout(ctx)); return lisp_false();
@@ -611,6 +5835,51 @@ static Lisp sch_read(Lisp args, LispError* e, LispContext ctx)
     return lisp_read_file(lisp_stdin(ctx), e, ctx);
 }
 
+static Lisp sch_read_shared(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_read_file_shared(lisp_stdin(ctx), e, ctx);
+}
+
+static Lisp sch_write_binary(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    lisp_write_binary(lisp_stdout(ctx), lisp_car(args), e, ctx);
+    return lisp_null();
+}
+
+// list of every datum in a file
+static Lisp sch_read_file(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_STRING)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    FILE* file = fopen(lisp_string(argv[0]), "r");
+    if (!file)
+    {
+        *e = LISP_ERROR_FILE_OPEN;
+        return lisp_null();
+    }
+
+    LispReader* reader = lisp_reader_open(file);
+    Lisp result = lisp_null();
+    while (1)
+    {
+        Lisp x = lisp_reader_next(reader, e, ctx);
+        if (*e != LISP_ERROR_NONE || lisp_equal(x, lisp_eof())) break;
+        result = lisp_cons(x, result, ctx);
+    }
+    lisp_reader_close(reader);
+    fclose(file);
+    return lisp_list_reverse(result);
+}
+
+static Lisp sch_read_binary(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_read_binary(lisp_stdin(ctx), e, ctx);
+}
+
 static Lisp sch_is_eof(Lisp args, LispError* e, LispContext ctx)
 {
     return lisp_make_bool(lisp_equal(lisp_car(args), lisp_eof()));
@@ -649,16 +5918,12 @@ static Lisp sch_syntax_error(Lisp args, LispError* e, LispContext ctx)
     return lisp_null();
 }
 
-static Lisp sch_equals(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_equals(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp to_check  = lisp_car(args);
-    if (lisp_is_null(to_check)) return lisp_true();
-    args = lisp_cdr(args);
-
-    while (lisp_is_pair(args))
+    if (argc == 0 || lisp_is_null(argv[0])) return lisp_true();
+    for (int i = 1; i < argc; ++i)
     {
-        if (lisp_bool(lisp_car(args)) != lisp_bool(to_check)) return lisp_false();
-        args = lisp_cdr(args);
+        if (lisp_bool(argv[i]) != lisp_bool(argv[0])) return lisp_false();
     }
     return lisp_true();
 }
@@ -744,15 +6009,14 @@ static Lisp sch_list_advance(Lisp args, LispError* e, LispContext ctx)
     return lisp_list_advance(x, lisp_int(count));
 }
 
-static Lisp sch_add(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_add(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
     LispInt exact = 0;
     LispReal inexact = 0; 
 
-    while (lisp_is_pair(args))
+    for (int i = 0; i < argc; ++i)
     {
-        Lisp x = lisp_car(args);
-        args = lisp_cdr(args);
+        Lisp x = argv[i];
         switch (lisp_type(x))
         {
             case LISP_INT:
@@ -772,15 +6036,14 @@ static Lisp sch_add(Lisp args, LispError* e, LispContext ctx)
         : lisp_make_real(inexact + (LispReal)exact);
 }
 
-static Lisp sch_mult(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_mult(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
     LispInt exact = 1;
     LispReal inexact = 1; 
 
-    while (lisp_is_pair(args))
+    for (int i = 0; i < argc; ++i)
     {
-        Lisp x = lisp_car(args);
-        args = lisp_cdr(args);
+        Lisp x = argv[i];
         switch (lisp_type(x))
         {
             case LISP_INT:
@@ -800,21 +6063,18 @@ static Lisp sch_mult(Lisp args, LispError* e, LispContext ctx)
         : lisp_make_real(inexact * (LispReal)exact);
 }
 
-static Lisp sch_sub(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_sub(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-
+    Lisp x = argv[0];
     Lisp y;
-    if (lisp_is_null(args))
+    if (argc == 1)
     {
         y = x;
         x = lisp_make_int(0);
     }
     else
     {
-        y = lisp_car(args);
+        y = argv[1];
     }
     switch (lisp_type(x))
     {
@@ -838,12 +6098,10 @@ static Lisp sch_sub(Lisp args, LispError* e, LispContext ctx)
     }
 }
 
-static Lisp sch_divide(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_divide(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp y = lisp_car(args);
+    Lisp x = argv[0];
+    Lisp y = argv[1];
 
     switch (lisp_type(x))
     {
@@ -868,12 +6126,10 @@ static Lisp sch_divide(Lisp args, LispError* e, LispContext ctx)
     }
 }
 
-static Lisp sch_less(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_less(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp y = lisp_car(args);
+    Lisp x = argv[0];
+    Lisp y = argv[1];
 
     switch (lisp_type(x))
     {
@@ -971,7 +6227,7 @@ static Lisp sch_string_is_null(Lisp args, LispError* e, LispContext ctx)
 {
     ARITY_CHECK(1, 1);
     Lisp a = lisp_car(args);
-    return lisp_make_bool(lisp_string(a)[0] == '\0');
+    return lisp_make_bool(lisp_string_length(a) == 0);
 }
 
 static Lisp sch_make_string(Lisp args, LispError* e, LispContext ctx)
@@ -1030,6 +6286,11 @@ static Lisp sch_string_ref(Lisp args, LispError* e, LispContext ctx)
         *e = LISP_ERROR_ARG_TYPE;
         return lisp_null();
     }
+    if (lisp_int(index) < 0 || lisp_int(index) >= lisp_string_length(str))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
 
     return lisp_make_char((int)lisp_string_ref(str, lisp_int(index)));
 }
@@ -1046,6 +6307,11 @@ static Lisp sch_string_set(Lisp args, LispError* e, LispContext ctx)
         *e = LISP_ERROR_ARG_TYPE;
         return lisp_null();
     }
+    if (lisp_int(index) < 0 || lisp_int(index) >= lisp_string_length(str))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
 
     lisp_string_set(str, lisp_int(index), (char)lisp_int(val));
     return lisp_null();
@@ -1078,7 +6344,7 @@ static Lisp sch_string_append(Lisp args, LispError* e, LispContext ctx)
     while (lisp_is_pair(it))
     {
         Lisp x = lisp_car(it);
-        count += strlen(lisp_string(x));
+        count += lisp_string_length(x);
         it = lisp_cdr(it);
     }
 
@@ -1089,7 +6355,7 @@ static Lisp sch_string_append(Lisp args, LispError* e, LispContext ctx)
     while (lisp_is_pair(it))
     {
         Lisp x = lisp_car(it);
-        int n = (LispInt)strlen(lisp_string(x));
+        int n = lisp_string_length(x);
         memcpy(c, lisp_string(x), n);
         c += n;
         it = lisp_cdr(it);
@@ -1099,14 +6365,11 @@ static Lisp sch_string_append(Lisp args, LispError* e, LispContext ctx)
 
 static Lisp sch_string_to_list(Lisp args, LispError* e, LispContext ctx)
 {
-    const char* c = lisp_string(lisp_car(args));
+    Lisp s = lisp_car(args);
     Lisp tail = lisp_null();
-    while (*c)
-    {
-        tail = lisp_cons(lisp_make_char(*c), tail, ctx);
-        ++c;
-    }
-    return lisp_list_reverse(tail);
+    for (int i = lisp_string_length(s) - 1; i >= 0; --i)
+        tail = lisp_cons(lisp_make_char(lisp_string_ref(s, i)), tail, ctx);
+    return tail;
 }
 
 static Lisp sch_list_to_string(Lisp args, LispError* e, LispContext ctx)
@@ -1128,7 +6391,7 @@ static Lisp sch_string_to_number(Lisp args, LispError* e, LispContext ctx)
 {
     ARITY_CHECK(1, 1);
     const char* string = lisp_string(lisp_car(args));
-    if (strchr(string, '.'))
+    if (strchr(string, '.') || strchr(string, 'e') || strchr(string, 'E'))
     {
         return lisp_parse_real(string);
     }
@@ -1141,23 +6404,17 @@ static Lisp sch_string_to_number(Lisp args, LispError* e, LispContext ctx)
 static Lisp sch_number_to_string(Lisp args, LispError* e, LispContext ctx)
 {
     ARITY_CHECK(1, 1);
-    char scratch[64];
     Lisp val = lisp_car(args);
-    switch (lisp_type(val))
+    if (lisp_type(val) != LISP_REAL && lisp_type(val) != LISP_INT)
     {
-        case LISP_REAL:
-            snprintf(scratch, 64, "%f", lisp_real(val));
-            break;
-        case LISP_INT:
-            snprintf(scratch, 64, "%lli", lisp_int(val));
-            break;
-        default:
-        {
-            *e = LISP_ERROR_ARG_TYPE;
-            return lisp_null();
-        }
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
     }
-    return lisp_make_string2(scratch, ctx);
+    // same digits as the printer
+    char* text = lisp_print_to_buffer(val, NULL);
+    Lisp s = lisp_make_string2(text, ctx);
+    free(text);
+    return s;
 }
 
 static Lisp sch_char_less(Lisp args, LispError* e, LispContext ctx)
@@ -1463,9 +6720,9 @@ static Lisp sch_vector_grow(Lisp args, LispError* e, LispContext ctx)
     return lisp_vector_grow(v, lisp_int(length), ctx);
 }
 
-static Lisp sch_vector_length(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_vector_length(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp v = lisp_car(args);
+    Lisp v = argv[0];
     if (lisp_type(v) != LISP_VECTOR)
     {
         *e = LISP_ERROR_ARG_TYPE;
@@ -1475,10 +6732,10 @@ static Lisp sch_vector_length(Lisp args, LispError* e, LispContext ctx)
     return lisp_make_int(lisp_vector_length(v));
 }
 
-static Lisp sch_vector_ref(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_vector_ref(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp v = lisp_car(args);
-    Lisp i = lisp_car(lisp_cdr(args));
+    Lisp v = argv[0];
+    Lisp i = argv[1];
 
     if (lisp_type(v) != LISP_VECTOR || lisp_type(i) != LISP_INT)
     {
@@ -1495,11 +6752,11 @@ static Lisp sch_vector_ref(Lisp args, LispError* e, LispContext ctx)
     return lisp_vector_ref(v, lisp_int(i));
 }
 
-static Lisp sch_vector_set(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_vector_set(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp v = lisp_list_ref(args, 0);
-    Lisp i = lisp_list_ref(args, 1);
-    Lisp x = lisp_list_ref(args, 2);
+    Lisp v = argv[0];
+    Lisp i = argv[1];
+    Lisp x = argv[2];
 
     if (lisp_type(v) != LISP_VECTOR || lisp_type(i) != LISP_INT)
     {
@@ -1590,197 +6847,1894 @@ static Lisp sch_vector_to_list(Lisp args, LispError* e, LispContext ctx)
     return lisp_list_reverse(tail);
 }
 
-static Lisp sch_pseudo_seed(Lisp args, LispError* e, LispContext ctx)
+// NUMERIC VECTORS
+// Each f64vector and s64vector procedure is a wrapper which passes the type it expects.
+// The loops over data are kept simple so the compiler can vectorize them.
+
+static int numvector_length_(Lisp v)
 {
-    Lisp seed = lisp_car(args);
-    srand((unsigned int)lisp_int(seed));
-    return lisp_null();
+    return lisp_type(v) == LISP_F64VECTOR ? lisp_f64vector_length(v) : lisp_s64vector_length(v);
 }
 
-static Lisp sch_pseudo_rand(Lisp args, LispError* e, LispContext ctx)
+static Lisp make_numvector_(LispType type, int n, LispContext ctx)
 {
-    Lisp n = lisp_car(args);
-    return lisp_make_int(rand() % lisp_int(n));
+    return type == LISP_F64VECTOR ? lisp_make_f64vector(n, ctx) : lisp_make_s64vector(n, ctx);
 }
 
-static Lisp sch_univeral_time(Lisp args, LispError* e, LispContext ctx)
+// reals only go in an f64vector. ints go in either.
+static int numvector_accepts_(LispType type, Lisp x)
 {
-    return lisp_make_int((LispInt)time(NULL));
+    return lisp_type(x) == LISP_INT || (type == LISP_F64VECTOR && lisp_type(x) == LISP_REAL);
 }
 
-static Lisp sch_is_table(Lisp args, LispError* e, LispContext ctx)
+// elements are full 64 bit ints, but LISP_TAGGED ints are only 48 bits.
+// (arithmetic on s64vectors can make bigger ones.)
+// One which doesn't fit is an error instead of being truncated.
+static Lisp s64_to_int_(LispInt n, LispError* e)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_TABLE);
+    Lisp x = lisp_make_int(n);
+    if (lisp_int(x) != n) *e = LISP_ERROR_OUT_OF_BOUNDS;
+    return x;
 }
 
-static Lisp sch_table_make(Lisp args, LispError* e, LispContext ctx)
+static Lisp numvector_ref_(Lisp v, int i, LispError* e)
 {
-    return lisp_make_table(ctx);
+    if (lisp_type(v) == LISP_F64VECTOR) return lisp_make_real(lisp_f64vector(v)[i]);
+    return s64_to_int_(lisp_s64vector(v)[i], e);
 }
 
-static Lisp sch_table_get(Lisp args, LispError* e, LispContext ctx)
+static void numvector_set_(Lisp v, int i, Lisp x)
 {
-    ARITY_CHECK(2, 3);
-    Lisp table = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp key = lisp_car(args);
-    args = lisp_cdr(args);
+    if (lisp_type(v) == LISP_F64VECTOR)
+        lisp_f64vector(v)[i] = lisp_number_to_real(x);
+    else
+        lisp_s64vector(v)[i] = lisp_int(x);
+}
 
-    Lisp def;
-    if (lisp_is_pair(args))
+// the first n arguments must be vectors of the type and the same length.
+static int numvector_check_(int n, Lisp* argv, LispType type, LispError* e)
+{
+    for (int i = 0; i < n; ++i)
     {
-        def = lisp_car(args);
+        if (lisp_type(argv[i]) != type)
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return 0;
+        }
+        if (numvector_length_(argv[i]) != numvector_length_(argv[0]))
+        {
+            *e = LISP_ERROR_OUT_OF_BOUNDS;
+            return 0;
+        }
     }
-    else
+    return 1;
+}
+
+// (index start end) arguments, from argv[first] onwards.
+static int numvector_range_(int argc, Lisp* argv, int first, int length, int* start, int* end, LispError* e)
+{
+    *start = 0;
+    *end = length;
+    if (argc > first)
     {
-        def = lisp_null();
+        if (lisp_type(argv[first]) != LISP_INT) { *e = LISP_ERROR_ARG_TYPE; return 0; }
+        *start = (int)lisp_int(argv[first]);
     }
-
-    int present;
-    Lisp result = lisp_table_get(table, key, &present);
-    return present ? result : def;
+    if (argc > first + 1)
+    {
+        if (lisp_type(argv[first + 1]) != LISP_INT) { *e = LISP_ERROR_ARG_TYPE; return 0; }
+        *end = (int)lisp_int(argv[first + 1]);
+    }
+    if (*start < 0 || *start > *end || *end > length)
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return 0;
+    }
+    return 1;
 }
 
-static Lisp sch_table_set(Lisp args, LispError* e, LispContext ctx)
+// Kernels.
+// s64 arithmetic wraps around instead of overflowing.
+// Sums keep several partial results, so they vectorize without -ffast-math.
+static void f64_add_(LispReal* out, const LispReal* a, const LispReal* b, int n)
 {
-    ARITY_CHECK(3, 3);
-    Lisp table = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp key = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp x = lisp_car(args);
-    lisp_table_set(table, key, x, ctx);
-    return lisp_null();
+    for (int i = 0; i < n; ++i) out[i] = a[i] + b[i];
 }
 
-static Lisp sch_table_size(Lisp args, LispError* e, LispContext ctx)
+static void s64_add_(LispInt* out, const LispInt* a, const LispInt* b, int n)
 {
-    Lisp table = lisp_car(args);
-    return lisp_make_int(lisp_table_size(table));
+    for (int i = 0; i < n; ++i) out[i] = (LispInt)((uint64_t)a[i] + (uint64_t)b[i]);
 }
 
-static Lisp sch_table_to_alist(Lisp args, LispError* e, LispContext ctx)
+static void f64_mul_(LispReal* out, const LispReal* a, const LispReal* b, int n)
 {
-    Lisp table = lisp_car(args);
-    return lisp_table_to_alist(table, ctx);
+    for (int i = 0; i < n; ++i) out[i] = a[i] * b[i];
 }
 
-static Lisp sch_is_promise(Lisp args, LispError* e, LispContext ctx)
+static void s64_mul_(LispInt* out, const LispInt* a, const LispInt* b, int n)
 {
-  return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_PROMISE);
+    for (int i = 0; i < n; ++i) out[i] = (LispInt)((uint64_t)a[i] * (uint64_t)b[i]);
 }
 
-static Lisp sch_make_promise(Lisp args, LispError* e, LispContext ctx)
+static void f64_scale_(LispReal* out, const LispReal* a, LispReal k, int n)
 {
-    Lisp proc = lisp_car(args);
-    return lisp_make_promise(proc, ctx);
+    for (int i = 0; i < n; ++i) out[i] = a[i] * k;
 }
 
-static Lisp sch_promise_store(Lisp args, LispError* e, LispContext ctx)
+static void s64_scale_(LispInt* out, const LispInt* a, LispInt k, int n)
 {
-    Lisp promise = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp val = lisp_car(args);
-    lisp_promise_store(promise, val);
-    return lisp_null();
+    for (int i = 0; i < n; ++i) out[i] = (LispInt)((uint64_t)a[i] * (uint64_t)k);
 }
 
-static Lisp sch_promise_proc(Lisp args, LispError* e, LispContext ctx)
+static LispReal f64_dot_(const LispReal* a, const LispReal* b, int n)
 {
-    return lisp_promise_proc(lisp_car(args));
+    LispReal s[4] = { 0.0, 0.0, 0.0, 0.0 };
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s[0] += a[i] * b[i];
+        s[1] += a[i + 1] * b[i + 1];
+        s[2] += a[i + 2] * b[i + 2];
+        s[3] += a[i + 3] * b[i + 3];
+    }
+    LispReal total = (s[0] + s[1]) + (s[2] + s[3]);
+    for (; i < n; ++i) total += a[i] * b[i];
+    return total;
 }
 
-static Lisp sch_promise_val(Lisp args, LispError* e, LispContext ctx)
+static LispInt s64_dot_(const LispInt* a, const LispInt* b, int n)
 {
-    return lisp_promise_val(lisp_car(args));
+    uint64_t total = 0;
+    for (int i = 0; i < n; ++i) total += (uint64_t)a[i] * (uint64_t)b[i];
+    return (LispInt)total;
 }
 
-static Lisp sch_promise_forced(Lisp args, LispError* e, LispContext ctx)
+static LispReal f64_sum_(const LispReal* a, int n)
 {
-    return lisp_make_bool(lisp_promise_forced(lisp_car(args)));
+    LispReal s[4] = { 0.0, 0.0, 0.0, 0.0 };
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s[0] += a[i];
+        s[1] += a[i + 1];
+        s[2] += a[i + 2];
+        s[3] += a[i + 3];
+    }
+    LispReal total = (s[0] + s[1]) + (s[2] + s[3]);
+    for (; i < n; ++i) total += a[i];
+    return total;
 }
 
-static Lisp sch_apply(Lisp args, LispError* e, LispContext ctx)
+static LispInt s64_sum_(const LispInt* a, int n)
 {
-    Lisp operator = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp op_args = lisp_car(args);
-    return lisp_apply(operator, op_args, e, ctx);
+    uint64_t total = 0;
+    for (int i = 0; i < n; ++i) total += (uint64_t)a[i];
+    return (LispInt)total;
 }
 
-static Lisp sch_is_lambda(Lisp args, LispError* e, LispContext ctx)
+// n > 0. the maximum instead if max is set.
+static LispReal f64_min_(const LispReal* a, int n, int max)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_LAMBDA);
+    LispReal m = a[0];
+    if (max)
+    {
+        for (int i = 1; i < n; ++i) m = a[i] > m ? a[i] : m;
+    }
+    else
+    {
+        for (int i = 1; i < n; ++i) m = a[i] < m ? a[i] : m;
+    }
+    return m;
 }
 
-static Lisp sch_lambda_env(Lisp args, LispError* e, LispContext ctx)
+static LispInt s64_min_(const LispInt* a, int n, int max)
 {
-    return lisp_lambda_env(lisp_car(args));
+    LispInt m = a[0];
+    if (max)
+    {
+        for (int i = 1; i < n; ++i) m = a[i] > m ? a[i] : m;
+    }
+    else
+    {
+        for (int i = 1; i < n; ++i) m = a[i] < m ? a[i] : m;
+    }
+    return m;
 }
 
-static Lisp sch_is_func(Lisp args, LispError* e, LispContext ctx)
+static int f64_compare_(const void* a, const void* b)
 {
-    ARITY_CHECK(1, 1);
-    int type = lisp_type(lisp_car(args));
-    return lisp_make_bool(type == LISP_FUNC);
+    LispReal x = *(const LispReal*)a;
+    LispReal y = *(const LispReal*)b;
+    return (x > y) - (x < y);
 }
 
-static Lisp sch_lambda_body(Lisp args, LispError* e, LispContext ctx)
+static int s64_compare_(const void* a, const void* b)
 {
-    return lisp_lambda_body(lisp_car(args));
+    LispInt x = *(const LispInt*)a;
+    LispInt y = *(const LispInt*)b;
+    return (x > y) - (x < y);
 }
 
-static Lisp sch_macroexpand(Lisp args, LispError* e, LispContext ctx)
+static Lisp numvector_make(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
+    if (lisp_type(argv[0]) != LISP_INT || (argc > 1 && !numvector_accepts_(type, argv[1])))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispInt n = lisp_int(argv[0]);
+    if (n < 0 || n > INT32_MAX)
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+
+    Lisp v = make_numvector_(type, (int)n, ctx);
+    if (type == LISP_F64VECTOR)
+    {
+        LispReal x = argc > 1 ? lisp_number_to_real(argv[1]) : 0.0;
+        LispReal* data = lisp_f64vector(v);
+        for (int i = 0; i < n; ++i) data[i] = x;
+    }
+    else
+    {
+        LispInt x = argc > 1 ? lisp_int(argv[1]) : 0;
+        LispInt* data = lisp_s64vector(v);
+        for (int i = 0; i < n; ++i) data[i] = x;
+    }
+    return v;
+}
+
+static Lisp numvector_new(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    for (int i = 0; i < argc; ++i)
+    {
+        if (!numvector_accepts_(type, argv[i]))
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+        }
+    }
+    Lisp v = make_numvector_(type, argc, ctx);
+    for (int i = 0; i < argc; ++i) numvector_set_(v, i, argv[i]);
+    return v;
+}
+
+static Lisp numvector_is(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    return lisp_make_bool(lisp_type(argv[0]) == type);
+}
+
+static Lisp numvector_length(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    return lisp_make_int(numvector_length_(argv[0]));
+}
+
+static Lisp numvector_ref(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (lisp_type(argv[1]) != LISP_INT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispInt i = lisp_int(argv[1]);
+    if (i < 0 || i >= numvector_length_(argv[0]))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+    Lisp x = numvector_ref_(argv[0], (int)i, e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_set(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (lisp_type(argv[1]) != LISP_INT || !numvector_accepts_(type, argv[2]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispInt i = lisp_int(argv[1]);
+    if (i < 0 || i >= numvector_length_(argv[0]))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+    numvector_set_(argv[0], (int)i, argv[2]);
+    return lisp_null();
+}
+
+static Lisp numvector_to_list(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    Lisp tail = lisp_null();
+    for (int i = numvector_length_(argv[0]) - 1; i >= 0; --i)
+    {
+        tail = lisp_cons(numvector_ref_(argv[0], i, e), tail, ctx);
+        if (*e != LISP_ERROR_NONE) return lisp_null();
+    }
+    return tail;
+}
+
+static Lisp numvector_from_list(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    int n = 0;
+    for (Lisp l = argv[0]; !lisp_is_null(l); l = lisp_cdr(l), ++n)
+    {
+        if (!lisp_is_pair(l) || !numvector_accepts_(type, lisp_car(l)))
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+        }
+    }
+
+    Lisp v = make_numvector_(type, n, ctx);
+    Lisp l = argv[0];
+    for (int i = 0; i < n; ++i, l = lisp_cdr(l))
+        numvector_set_(v, i, lisp_car(l));
+    return v;
+}
+
+static Lisp numvector_to_vector(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    Lisp v = lisp_make_vector(n, ctx);
+    for (int i = 0; i < n; ++i)
+    {
+        lisp_vector_set(v, i, numvector_ref_(argv[0], i, e));
+        if (*e != LISP_ERROR_NONE) return lisp_null();
+    }
+    return v;
+}
+
+static Lisp numvector_from_vector(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int n = lisp_vector_length(argv[0]);
+    for (int i = 0; i < n; ++i)
+    {
+        if (!numvector_accepts_(type, lisp_vector_ref(argv[0], i)))
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+        }
+    }
+
+    Lisp v = make_numvector_(type, n, ctx);
+    for (int i = 0; i < n; ++i) numvector_set_(v, i, lisp_vector_ref(argv[0], i));
+    return v;
+}
+
+static Lisp numvector_copy(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int start, end;
+    if (!numvector_range_(argc, argv, 1, numvector_length_(argv[0]), &start, &end, e)) return lisp_null();
+
+    Lisp v = make_numvector_(type, end - start, ctx);
+    // both element types are 8 bytes.
+    if (type == LISP_F64VECTOR)
+        memcpy(lisp_f64vector(v), lisp_f64vector(argv[0]) + start, sizeof(LispReal) * (end - start));
+    else
+        memcpy(lisp_s64vector(v), lisp_s64vector(argv[0]) + start, sizeof(LispInt) * (end - start));
+    return v;
+}
+
+static Lisp numvector_fill(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (!numvector_accepts_(type, argv[1]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int start, end;
+    if (!numvector_range_(argc, argv, 2, numvector_length_(argv[0]), &start, &end, e)) return lisp_null();
+
+    if (type == LISP_F64VECTOR)
+    {
+        LispReal x = lisp_number_to_real(argv[1]);
+        LispReal* data = lisp_f64vector(argv[0]);
+        for (int i = start; i < end; ++i) data[i] = x;
+    }
+    else
+    {
+        LispInt x = lisp_int(argv[1]);
+        LispInt* data = lisp_s64vector(argv[0]);
+        for (int i = start; i < end; ++i) data[i] = x;
+    }
+    return lisp_null();
+}
+
+static Lisp numvector_add(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(2, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    Lisp v = make_numvector_(type, n, ctx);
+    if (type == LISP_F64VECTOR)
+        f64_add_(lisp_f64vector(v), lisp_f64vector(argv[0]), lisp_f64vector(argv[1]), n);
+    else
+        s64_add_(lisp_s64vector(v), lisp_s64vector(argv[0]), lisp_s64vector(argv[1]), n);
+    return v;
+}
+
+static Lisp numvector_mul(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(2, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    Lisp v = make_numvector_(type, n, ctx);
+    if (type == LISP_F64VECTOR)
+        f64_mul_(lisp_f64vector(v), lisp_f64vector(argv[0]), lisp_f64vector(argv[1]), n);
+    else
+        s64_mul_(lisp_s64vector(v), lisp_s64vector(argv[0]), lisp_s64vector(argv[1]), n);
+    return v;
+}
+
+static Lisp numvector_scale(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (!numvector_accepts_(type, argv[1]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int n = numvector_length_(argv[0]);
+    Lisp v = make_numvector_(type, n, ctx);
+    if (type == LISP_F64VECTOR)
+        f64_scale_(lisp_f64vector(v), lisp_f64vector(argv[0]), lisp_number_to_real(argv[1]), n);
+    else
+        s64_scale_(lisp_s64vector(v), lisp_s64vector(argv[0]), lisp_int(argv[1]), n);
+    return v;
+}
+
+static Lisp numvector_sum(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (type == LISP_F64VECTOR) return lisp_make_real(f64_sum_(lisp_f64vector(argv[0]), n));
+    Lisp x = s64_to_int_(s64_sum_(lisp_s64vector(argv[0]), n), e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_dot(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(2, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (type == LISP_F64VECTOR) return lisp_make_real(f64_dot_(lisp_f64vector(argv[0]), lisp_f64vector(argv[1]), n));
+    Lisp x = s64_to_int_(s64_dot_(lisp_s64vector(argv[0]), lisp_s64vector(argv[1]), n), e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_extreme_(int argc, Lisp* argv, LispType type, int max, LispError* e)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (n == 0)
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+    if (type == LISP_F64VECTOR) return lisp_make_real(f64_min_(lisp_f64vector(argv[0]), n, max));
+    Lisp x = s64_to_int_(s64_min_(lisp_s64vector(argv[0]), n, max), e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_min(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    return numvector_extreme_(argc, argv, type, 0, e);
+}
+
+static Lisp numvector_max(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    return numvector_extreme_(argc, argv, type, 1, e);
+}
+
+static Lisp numvector_sort(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (type == LISP_F64VECTOR)
+        qsort(lisp_f64vector(argv[0]), n, sizeof(LispReal), f64_compare_);
+    else
+        qsort(lisp_s64vector(argv[0]), n, sizeof(LispInt), s64_compare_);
+    return argv[0];
+}
+
+#define NUMVECTOR_FUNC_(name) \
+static Lisp sch_f64vector_##name(int argc, Lisp* argv, LispError* e, LispContext ctx) { return numvector_##name(argc, argv, LISP_F64VECTOR, e, ctx); } \
+static Lisp sch_s64vector_##name(int argc, Lisp* argv, LispError* e, LispContext ctx) { return numvector_##name(argc, argv, LISP_S64VECTOR, e, ctx); }
+
+NUMVECTOR_FUNC_(make)
+NUMVECTOR_FUNC_(new)
+NUMVECTOR_FUNC_(is)
+NUMVECTOR_FUNC_(length)
+NUMVECTOR_FUNC_(ref)
+NUMVECTOR_FUNC_(set)
+NUMVECTOR_FUNC_(to_list)
+NUMVECTOR_FUNC_(from_list)
+NUMVECTOR_FUNC_(to_vector)
+NUMVECTOR_FUNC_(from_vector)
+NUMVECTOR_FUNC_(copy)
+NUMVECTOR_FUNC_(fill)
+NUMVECTOR_FUNC_(add)
+NUMVECTOR_FUNC_(mul)
+NUMVECTOR_FUNC_(scale)
+NUMVECTOR_FUNC_(sum)
+NUMVECTOR_FUNC_(dot)
+NUMVECTOR_FUNC_(min)
+NUMVECTOR_FUNC_(max)
+NUMVECTOR_FUNC_(sort)
+
+#undef NUMVECTOR_FUNC_
+
+static Lisp sch_pseudo_seed(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp seed = lisp_car(args);
+    lisp_seed_random((uint64_t)lisp_int(seed), ctx);
+    return lisp_null();
+}
+
+static Lisp sch_pseudo_rand(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp n = lisp_car(args);
+    return lisp_make_int((LispInt)(lisp_random(ctx) % (uint64_t)lisp_int(n)));
+}
+
+static Lisp sch_univeral_time(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_int((LispInt)time(NULL));
+}
+
+// milliseconds from an arbitrary point (a monotonic clock where there is one).
+static Lisp sch_real_time(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return lisp_make_real((LispReal)t.tv_sec * 1000.0 + (LispReal)t.tv_nsec / 1000000.0);
+#else
+    return lisp_make_real(1000.0 * (LispReal)clock() / CLOCKS_PER_SEC);
+#endif
+}
+
+// processor time in seconds
+static Lisp sch_runtime(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    return lisp_make_real((LispReal)clock() / CLOCKS_PER_SEC);
+}
+
+static Lisp sch_is_table(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_TABLE);
+}
+
+static Lisp sch_table_make(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_table(ctx);
+}
+
+static Lisp sch_equal_table_make(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_equal_table(ctx);
+}
+
+static Lisp sch_table_get(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(2, 3);
+    Lisp table = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp key = lisp_car(args);
+    args = lisp_cdr(args);
+
+    Lisp def;
+    if (lisp_is_pair(args))
+    {
+        def = lisp_car(args);
+    }
+    else
+    {
+        def = lisp_null();
+    }
+
+    int present;
+    Lisp result = lisp_table_get(table, key, &present);
+    return present ? result : def;
+}
+
+static Lisp sch_table_set(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(3, 3);
+    Lisp table = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp key = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp x = lisp_car(args);
+    lisp_table_set(table, key, x, ctx);
+    return lisp_null();
+}
+
+static Lisp sch_table_size(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp table = lisp_car(args);
+    return lisp_make_int(lisp_table_size(table));
+}
+
+static Lisp sch_table_to_alist(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp table = lisp_car(args);
+    return lisp_table_to_alist(table, ctx);
+}
+
+static Lisp sch_is_promise(Lisp args, LispError* e, LispContext ctx)
+{
+  return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_PROMISE);
+}
+
+static Lisp sch_make_promise(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp proc = lisp_car(args);
+    return lisp_make_promise(proc, ctx);
+}
+
+static Lisp sch_promise_store(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp promise = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp val = lisp_car(args);
+    lisp_promise_store(promise, val);
+    return lisp_null();
+}
+
+static Lisp sch_promise_proc(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_promise_proc(lisp_car(args));
+}
+
+static Lisp sch_promise_val(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_promise_val(lisp_car(args));
+}
+
+static Lisp sch_promise_forced(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_bool(lisp_promise_forced(lisp_car(args)));
+}
+
+static Lisp sch_apply(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp operator = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp op_args = lisp_car(args);
+    return lisp_apply(operator, op_args, e, ctx);
+}
+
+static Lisp sch_is_lambda(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_LAMBDA);
+}
+
+static Lisp sch_lambda_env(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_lambda_env(lisp_car(args));
+}
+
+static Lisp sch_is_func(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    int type = lisp_type(lisp_car(args));
+    return lisp_make_bool(type == LISP_FUNC || type == LISP_FUNC_N);
+}
+
+static Lisp sch_lambda_body(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_lambda_body(lisp_car(args));
+}
+
+static Lisp sch_macroexpand(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
     return lisp_macroexpand(lisp_car(args), e, ctx);
 }
 
-static Lisp sch_eval(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_compile(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_compile(lisp_car(args), e, ctx);
+}
+
+static Lisp sch_eval(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(2, 2);
+    return lisp_eval_cached(lisp_car(args), lisp_car(lisp_cdr(args)), e, ctx);
+}
+
+static Lisp sch_system_env(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_cdr(lisp_env(ctx));
+}
+
+static Lisp sch_user_env(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_env(ctx);
+}
+
+// (gc-flip [full])
+static Lisp sch_gc_flip(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(0, 1);
+    if (lisp_is_pair(args) && lisp_is_true(lisp_car(args))) lisp_collect_full(lisp_null(), ctx);
+    else lisp_collect(lisp_null(), ctx);
+    return lisp_false();
+}
+
+// (name . n) for each type with a nonzero count
+static Lisp gc_type_alist_(const size_t* counts, LispContext ctx)
+{
+    Lisp result = lisp_null();
+    for (int i = LISP_TYPE_COUNT - 1; i >= 0; --i)
+    {
+        if (counts[i] == 0) continue;
+        Lisp name = lisp_make_symbol(lisp_type_name((LispType)i), ctx);
+        result = lisp_cons(lisp_cons(name, lisp_make_int((LispInt)counts[i]), ctx), result, ctx);
+    }
+    return result;
+}
+
+static Lisp gc_stat_(const char* name, Lisp x, Lisp rest, LispContext ctx)
+{
+    return lisp_cons(lisp_cons(lisp_make_symbol(name, ctx), x, ctx), rest, ctx);
+}
+
+static Lisp sch_gc_statistics(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    LispGCStats stats = lisp_gc_stats(ctx);
+
+    Lisp histogram = lisp_make_vector(LISP_GC_PAUSE_BUCKETS, ctx);
+    for (int i = 0; i < LISP_GC_PAUSE_BUCKETS; ++i)
+        lisp_vector_set(histogram, i, lisp_make_int((LispInt)stats.pause_histogram[i]));
+
+    Lisp result = lisp_null();
+    result = gc_stat_("PAGES-POOLED", lisp_make_int((LispInt)stats.pages_pooled), result, ctx);
+    result = gc_stat_("PAGES-REUSED", lisp_make_int((LispInt)stats.pages_reused), result, ctx);
+    result = gc_stat_("LIVE-BYTES", gc_type_alist_(stats.live_bytes, ctx), result, ctx);
+    result = gc_stat_("LIVE-COUNTS", gc_type_alist_(stats.live_count, ctx), result, ctx);
+    result = gc_stat_("BYTES-ALLOCATED", gc_type_alist_(stats.bytes_allocated, ctx), result, ctx);
+    result = gc_stat_("ALLOCATIONS", gc_type_alist_(stats.allocations, ctx), result, ctx);
+    result = gc_stat_("BYTES-COPIED", lisp_make_int((LispInt)stats.bytes_copied), result, ctx);
+    result = gc_stat_("PAUSE-HISTOGRAM", histogram, result, ctx);
+    result = gc_stat_("PAUSE-MAX-US", lisp_make_int((LispInt)stats.pause_max_us), result, ctx);
+    result = gc_stat_("PAUSE-TOTAL-US", lisp_make_int((LispInt)stats.pause_total_us), result, ctx);
+    result = gc_stat_("FULL-COLLECTIONS", lisp_make_int((LispInt)stats.full_collections), result, ctx);
+    result = gc_stat_("COLLECTIONS", lisp_make_int((LispInt)stats.collections), result, ctx);
+    return result;
+}
+
+static Lisp sch_print_gc_stats(Lisp args, LispError* e, LispContext ctx)
+{
+    lisp_print_collect_stats(ctx);
+    return lisp_false();
+}
+
+static Lisp sch_call_cc(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_call_cc(lisp_car(args), e, ctx);
+}
+
+static Lisp sch_is_cont(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_JUMP);
+}
+
+// SEQUENCES
+// Native versions of the procedures programs call most.
+// Anything which calls a procedure keeps its values in roots (see lisp_push_root),
+// and reads them again after each call, since the collector may move them.
+
+// Builtin predicates which never evaluate or allocate are called directly.
+static LispCFuncN builtin_predicate_(Lisp proc)
+{
+    if (lisp_type(proc) != LISP_FUNC_N) return NULL;
+    LispCFuncN f = lisp_func_n(proc);
+    if (f == sch_less || f == sch_equals || f == sch_exact_eq || f == sch_equal || f == sch_equal_r) return f;
+    return NULL;
+}
+
+// argv must be roots, unless direct is set.
+static Lisp seq_call_(Lisp proc, LispCFuncN direct, int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (direct) return direct(argc, argv, e, ctx);
+    return lisp_apply_argv(proc, argc, argv, e, ctx);
+}
+
+// (map proc list ...) and (for-each proc list ...) stop at the end of the shortest list.
+static Lisp seq_map_(int argc, Lisp* argv, int keep, LispError* e, LispContext ctx)
+{
+    int n = argc - 1;
+    // proc, results (reversed), the lists left, then the arguments of a call.
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(lisp_null(), ctx);
+    for (int i = 0; i < n; ++i) lisp_push_root(argv[i + 1], ctx);
+    for (int i = 0; i < n; ++i) lisp_push_root(lisp_null(), ctx);
+    Lisp* lists = roots + 2;
+    Lisp* args = lists + n;
+
+    while (*e == LISP_ERROR_NONE)
+    {
+        int i;
+        for (i = 0; i < n && lisp_is_pair(lists[i]); ++i)
+        {
+            args[i] = lisp_car(lists[i]);
+            lists[i] = lisp_cdr(lists[i]);
+        }
+        if (i < n) break;
+
+        Lisp x = lisp_apply_argv(roots[0], n, args, e, ctx);
+        if (keep) roots[1] = lisp_cons(x, roots[1], ctx);
+    }
+
+    Lisp result = roots[1];
+    lisp_pop_roots(2 + 2 * n, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    return lisp_list_reverse(result);
+}
+
+static Lisp sch_map(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    return seq_map_(argc, argv, 1, e, ctx);
+}
+
+static Lisp sch_for_each(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    seq_map_(argc, argv, 0, e, ctx);
+    return lisp_null();
+}
+
+// (filter pred list) keeps the order.
+static Lisp sch_filter(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    LispCFuncN direct = builtin_predicate_(argv[0]);
+    // pred, list left, results (reversed), argument
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(lisp_null(), ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    while (lisp_is_pair(roots[1]) && *e == LISP_ERROR_NONE)
+    {
+        roots[3] = lisp_car(roots[1]);
+        roots[1] = lisp_cdr(roots[1]);
+        if (lisp_is_true(seq_call_(roots[0], direct, 1, roots + 3, e, ctx)))
+        {
+            roots[2] = lisp_cons(roots[3], roots[2], ctx);
+        }
+    }
+
+    Lisp result = roots[2];
+    lisp_pop_roots(4, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    return lisp_list_reverse(result);
+}
+
+// (reduce op acc list) calls (op acc x) from the left.
+static Lisp sch_reduce(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    // op, list left, then acc and x, the arguments of a call.
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[2], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    while (lisp_is_pair(roots[1]) && *e == LISP_ERROR_NONE)
+    {
+        roots[3] = lisp_car(roots[1]);
+        roots[1] = lisp_cdr(roots[1]);
+        Lisp acc = lisp_apply_argv(roots[0], 2, roots + 2, e, ctx);
+        roots[2] = acc;
+    }
+
+    Lisp result = roots[2];
+    lisp_pop_roots(4, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// equality of assq, assv, assoc etc.
+enum { SEQ_EQ = 0, SEQ_EQV, SEQ_EQUAL };
+
+static int seq_same_(Lisp a, Lisp b, int kind)
+{
+    switch (kind)
+    {
+        case SEQ_EQ: return lisp_eq(a, b);
+        case SEQ_EQV: return lisp_equal(a, b);
+        default: return lisp_equal_r(a, b);
+    }
+}
+
+// the first pair in an alist whose car is key, skipping entries which aren't pairs.
+static Lisp seq_assoc_(Lisp key, Lisp l, int kind)
+{
+    for (; lisp_is_pair(l); l = lisp_cdr(l))
+    {
+        Lisp entry = lisp_car(l);
+        if (lisp_is_pair(entry) && seq_same_(key, lisp_car(entry), kind)) return entry;
+    }
+    return lisp_false();
+}
+
+// the tail of the list starting with x.
+static Lisp seq_member_(Lisp x, Lisp l, int kind)
+{
+    for (; lisp_is_pair(l); l = lisp_cdr(l))
+    {
+        if (seq_same_(x, lisp_car(l), kind)) return l;
+    }
+    return lisp_false();
+}
+
+static Lisp sch_assq(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_assoc_(argv[0], argv[1], SEQ_EQ); }
+static Lisp sch_assv(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_assoc_(argv[0], argv[1], SEQ_EQV); }
+static Lisp sch_assoc(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_assoc_(argv[0], argv[1], SEQ_EQUAL); }
+static Lisp sch_memq(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_member_(argv[0], argv[1], SEQ_EQ); }
+static Lisp sch_memv(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_member_(argv[0], argv[1], SEQ_EQV); }
+static Lisp sch_member(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_member_(argv[0], argv[1], SEQ_EQUAL); }
+
+static Lisp sch_vector_map(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[1]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int n = lisp_vector_length(argv[1]);
+    Lisp result = lisp_make_vector(n, ctx);
+    lisp_vector_fill(result, lisp_null());
+
+    // fn, input, result, argument
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(result, ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    for (int i = 0; i < n && *e == LISP_ERROR_NONE; ++i)
+    {
+        roots[3] = lisp_vector_ref(roots[1], i);
+        Lisp x = lisp_apply_argv(roots[0], 1, roots + 3, e, ctx);
+        lisp_vector_set(roots[2], i, x);
+    }
+
+    result = roots[2];
+    lisp_pop_roots(4, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// (vector-binary-search v key< unwrap-key key) of a vector sorted by key<.
+// Returns the element whose key is neither less nor greater than key, or #f.
+static Lisp sch_vector_binary_search(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispCFuncN direct = builtin_predicate_(argv[1]);
+    // v, key<, unwrap-key, key, then the arguments of a comparison.
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(argv[2], ctx);
+    lisp_push_root(argv[3], ctx);
+    lisp_push_root(lisp_null(), ctx);
+    lisp_push_root(lisp_null(), ctx);
+    Lisp* args = roots + 4;
+
+    // the first index whose key isn't less than key.
+    int lo = 0;
+    int hi = lisp_vector_length(roots[0]);
+    while (lo < hi && *e == LISP_ERROR_NONE)
+    {
+        int mid = lo + (hi - lo) / 2;
+        args[1] = lisp_vector_ref(roots[0], mid);
+        Lisp k = lisp_apply_argv(roots[2], 1, args + 1, e, ctx);
+        args[0] = k;
+        args[1] = roots[3];
+        if (lisp_is_true(seq_call_(roots[1], direct, 2, args, e, ctx))) lo = mid + 1; else hi = mid;
+    }
+
+    Lisp result = lisp_false();
+    if (lo < lisp_vector_length(roots[0]) && *e == LISP_ERROR_NONE)
+    {
+        args[1] = lisp_vector_ref(roots[0], lo);
+        Lisp k = lisp_apply_argv(roots[2], 1, args + 1, e, ctx);
+        args[1] = k;
+        args[0] = roots[3];
+        if (!lisp_is_true(seq_call_(roots[1], direct, 2, args, e, ctx))) result = lisp_vector_ref(roots[0], lo);
+    }
+
+    lisp_pop_roots(6, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// Sorting is a stable bottom up merge sort, back and forth between two copies,
+// so the vector is left as it was if a comparison fails.
+enum
+{
+    SORT_LESS = 0,
+    SORT_VECTOR,
+    SORT_FROM,
+    SORT_TO,
+    SORT_A, // these two are the arguments to a comparison
+    SORT_B,
+    SORT_ROOT_COUNT
+};
+
+static int sort_less_(Lisp* roots, LispCFuncN direct, int i, int j, LispError* e, LispContext ctx)
+{
+    roots[SORT_A] = lisp_vector_ref(roots[SORT_FROM], i);
+    roots[SORT_B] = lisp_vector_ref(roots[SORT_FROM], j);
+    return lisp_is_true(seq_call_(roots[SORT_LESS], direct, 2, roots + SORT_A, e, ctx));
+}
+
+// sorts v in place with less.
+static void seq_sort_(Lisp v, Lisp less, LispError* e, LispContext ctx)
+{
+    int n = lisp_vector_length(v);
+    if (n < 2) return;
+
+    LispCFuncN direct = builtin_predicate_(less);
+    Lisp* roots = lisp_push_root(less, ctx);
+    lisp_push_root(v, ctx);
+    lisp_push_root(lisp_subvector(v, 0, n, ctx), ctx);
+    lisp_push_root(lisp_subvector(v, 0, n, ctx), ctx);
+    lisp_push_root(lisp_null(), ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    for (int width = 1; width < n && *e == LISP_ERROR_NONE; width *= 2)
+    {
+        for (int lo = 0; lo < n && *e == LISP_ERROR_NONE; lo += 2 * width)
+        {
+            int mid = lo + width < n ? lo + width : n;
+            int hi = lo + 2 * width < n ? lo + 2 * width : n;
+            int i = lo, j = mid, k = lo;
+            while (i < mid && j < hi)
+            {
+                // equal elements keep their order
+                int right = sort_less_(roots, direct, j, i, e, ctx);
+                if (*e != LISP_ERROR_NONE) break;
+                int from = right ? j++ : i++;
+                lisp_vector_set(roots[SORT_TO], k++, lisp_vector_ref(roots[SORT_FROM], from));
+            }
+            while (i < mid) lisp_vector_set(roots[SORT_TO], k++, lisp_vector_ref(roots[SORT_FROM], i++));
+            while (j < hi) lisp_vector_set(roots[SORT_TO], k++, lisp_vector_ref(roots[SORT_FROM], j++));
+        }
+        Lisp from = roots[SORT_FROM];
+        roots[SORT_FROM] = roots[SORT_TO];
+        roots[SORT_TO] = from;
+    }
+
+    if (*e == LISP_ERROR_NONE)
+    {
+        for (int i = 0; i < n; ++i) lisp_vector_set(roots[SORT_VECTOR], i, lisp_vector_ref(roots[SORT_FROM], i));
+    }
+    lisp_pop_roots(SORT_ROOT_COUNT, ctx);
+}
+
+static Lisp sch_sort_inplace(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp* v = lisp_push_root(argv[0], ctx);
+    seq_sort_(*v, argv[1], e, ctx);
+    Lisp result = *v;
+    lisp_pop_roots(1, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// (sort sequence less) of a list or vector returns a sorted copy.
+static Lisp sch_sort(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    int is_list = lisp_type(argv[0]) != LISP_VECTOR;
+    if (is_list && !lisp_is_list(argv[0]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp v;
+    if (is_list)
+    {
+        v = lisp_make_vector(lisp_list_length(argv[0]), ctx);
+        int i = 0;
+        for (Lisp it = argv[0]; lisp_is_pair(it); it = lisp_cdr(it)) lisp_vector_set(v, i++, lisp_car(it));
+    }
+    else
+    {
+        v = lisp_subvector(argv[0], 0, lisp_vector_length(argv[0]), ctx);
+    }
+
+    Lisp* root = lisp_push_root(v, ctx);
+    seq_sort_(*root, argv[1], e, ctx);
+    v = *root;
+    lisp_pop_roots(1, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    if (!is_list) return v;
+
+    Lisp result = lisp_null();
+    for (int i = lisp_vector_length(v) - 1; i >= 0; --i) result = lisp_cons(lisp_vector_ref(v, i), result, ctx);
+    return result;
+}
+
+// GENERATORS
+// A generator describes a lazy sequence: a source, and stages applied to each element.
+// Nothing runs until a sink (fold, for-each, ->list) pulls the elements through,
+// one at a time and every stage at once, so there are no intermediate sequences,
+// and elements aren't allocated unless the source or a stage makes them.
+// It is a vector #(_GENERATOR source a b c stages), where stages is a list of
+// (kind . procedure or count), newest first. Adding a stage copies the vector,
+// so a generator can be run or extended any number of times.
+
+enum
+{
+    GEN_RANGE = 0, // start end (or #f) step
+    GEN_VECTOR,    // vector start end
+    GEN_LIST,      // list
+    GEN_FILE,      // path. datums are read as they are needed.
+};
+
+enum
+{
+    GEN_MAP = 0,
+    GEN_FILTER,
+    GEN_TAKE,
+    GEN_TAKE_WHILE,
+};
+
+enum
+{
+    GEN_SINK_FOLD = 0,
+    GEN_SINK_FOR_EACH,
+    GEN_SINK_LIST,
+};
+
+#define GEN_LENGTH_ 6
+
+static int is_generator_(Lisp x, LispContext ctx)
+{
+    return lisp_type(x) == LISP_VECTOR &&
+        lisp_vector_length(x) == GEN_LENGTH_ &&
+        lisp_eq(lisp_vector_ref(x, 0), lisp_make_symbol("_GENERATOR", ctx));
+}
+
+static Lisp make_generator_(int source, Lisp a, Lisp b, Lisp c, Lisp stages, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    return lisp_eval2(lisp_car(args), lisp_car(lisp_cdr(args)), e, ctx);
+    Lisp g = lisp_make_vector(GEN_LENGTH_, ctx);
+    lisp_vector_set(g, 0, lisp_make_symbol("_GENERATOR", ctx));
+    lisp_vector_set(g, 1, lisp_make_int(source));
+    lisp_vector_set(g, 2, a);
+    lisp_vector_set(g, 3, b);
+    lisp_vector_set(g, 4, c);
+    lisp_vector_set(g, 5, stages);
+    return g;
 }
 
-static Lisp sch_system_env(Lisp args, LispError* e, LispContext ctx)
+static int is_number_(Lisp x)
 {
-    return lisp_cdr(lisp_env(ctx));
+    return lisp_type(x) == LISP_INT || lisp_type(x) == LISP_REAL;
 }
 
-static Lisp sch_user_env(Lisp args, LispError* e, LispContext ctx)
+// (range-generator start [end step]). No end counts forever.
+static Lisp sch_range_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    return lisp_env(ctx);
+    Lisp end = argc > 1 ? argv[1] : lisp_false();
+    Lisp step = argc > 2 ? argv[2] : lisp_make_int(1);
+    if (!is_number_(argv[0]) || !(is_number_(end) || (lisp_type(end) == LISP_BOOL && !lisp_bool(end))) || !is_number_(step))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    return make_generator_(GEN_RANGE, argv[0], end, step, lisp_null(), ctx);
 }
 
-static Lisp sch_gc_flip(Lisp args, LispError* e, LispContext ctx)
+// (vector-generator v [start end]) of a vector, f64vector or s64vector.
+static Lisp sch_vector_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(0, 0);
-    lisp_collect(lisp_null(), ctx);
-    return lisp_false();
+    int length;
+    switch (lisp_type(argv[0]))
+    {
+        case LISP_VECTOR: length = lisp_vector_length(argv[0]); break;
+        case LISP_F64VECTOR: case LISP_S64VECTOR: length = numvector_length_(argv[0]); break;
+        default:
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+    }
+    int start, end;
+    if (!numvector_range_(argc, argv, 1, length, &start, &end, e)) return lisp_null();
+    return make_generator_(GEN_VECTOR, argv[0], lisp_make_int(start), lisp_make_int(end), lisp_null(), ctx);
 }
 
-static Lisp sch_print_gc_stats(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_list_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    lisp_print_collect_stats(ctx);
-    return lisp_false();
+    return make_generator_(GEN_LIST, argv[0], lisp_null(), lisp_null(), lisp_null(), ctx);
 }
 
-static Lisp sch_call_cc(Lisp args, LispError* e, LispContext ctx)
+// every datum in a file. The file is opened by each run, and closed when it ends.
+static Lisp sch_file_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_call_cc(lisp_car(args), e, ctx);
+    if (lisp_type(argv[0]) != LISP_STRING)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    return make_generator_(GEN_FILE, argv[0], lisp_null(), lisp_null(), lisp_null(), ctx);
 }
 
-static Lisp sch_is_cont(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_is_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_JUMP);
+    return lisp_make_bool(is_generator_(argv[0], ctx));
+}
+
+// (_generator-stage kind x generator)
+static Lisp sch_generator_stage(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    Lisp g = argv[2];
+    if (!is_generator_(g, ctx) || lisp_type(argv[0]) != LISP_INT ||
+        (lisp_int(argv[0]) == GEN_TAKE && lisp_type(argv[1]) != LISP_INT))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp stages = lisp_cons(lisp_cons(argv[0], argv[1], ctx), lisp_vector_ref(g, 5), ctx);
+    return make_generator_(
+            (int)lisp_int(lisp_vector_ref(g, 1)),
+            lisp_vector_ref(g, 2),
+            lisp_vector_ref(g, 3),
+            lisp_vector_ref(g, 4),
+            stages,
+            ctx
+    );
+}
+
+// Where a run keeps its values. Procedures may collect, so they are roots (see lisp_push_root).
+enum
+{
+    GEN_ROOT_GENERATOR = 0,
+    GEN_ROOT_STAGES,  // vector of kind, procedure or count left, in order
+    GEN_ROOT_SINK,
+    GEN_ROOT_CURSOR,  // list left, or the vector
+    GEN_ROOT_ACC,     // these two are the arguments to a fold
+    GEN_ROOT_X,
+    GEN_ROOT_COUNT
+};
+
+static int generator_next_(int source, Lisp* roots, LispInt* i, LispReal* r, int is_real,
+                           LispReader* reader, LispError* e, LispContext ctx)
+{
+    Lisp g = roots[GEN_ROOT_GENERATOR];
+    switch (source)
+    {
+        case GEN_RANGE:
+        {
+            Lisp end = lisp_vector_ref(g, 3);
+            Lisp step = lisp_vector_ref(g, 4);
+            if (is_real)
+            {
+                LispReal s = lisp_number_to_real(step);
+                if (is_number_(end) && (s >= 0 ? *r >= lisp_number_to_real(end) : *r <= lisp_number_to_real(end))) return 0;
+                roots[GEN_ROOT_X] = lisp_make_real(*r);
+                *r += s;
+            }
+            else
+            {
+                LispInt s = lisp_int(step);
+                if (is_number_(end) && (s >= 0 ? *i >= lisp_int(end) : *i <= lisp_int(end))) return 0;
+                roots[GEN_ROOT_X] = lisp_make_int(*i);
+                *i += s;
+            }
+            return 1;
+        }
+        case GEN_VECTOR:
+        {
+            if (*i >= lisp_int(lisp_vector_ref(g, 4))) return 0;
+            Lisp v = roots[GEN_ROOT_CURSOR];
+            roots[GEN_ROOT_X] = lisp_type(v) == LISP_VECTOR ? lisp_vector_ref(v, (int)*i) : numvector_ref_(v, (int)*i, e);
+            ++*i;
+            return *e == LISP_ERROR_NONE;
+        }
+        case GEN_LIST:
+        {
+            Lisp l = roots[GEN_ROOT_CURSOR];
+            if (!lisp_is_pair(l)) return 0;
+            roots[GEN_ROOT_X] = lisp_car(l);
+            roots[GEN_ROOT_CURSOR] = lisp_cdr(l);
+            return 1;
+        }
+        case GEN_FILE:
+        {
+            Lisp x = lisp_reader_next(reader, e, ctx);
+            if (*e != LISP_ERROR_NONE || lisp_equal(x, lisp_eof())) return 0;
+            roots[GEN_ROOT_X] = x;
+            return 1;
+        }
+        default:
+            assert(0);
+            return 0;
+    }
+}
+
+// (_generator-run sink procedure acc generator)
+static Lisp sch_generator_run(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    Lisp g = argv[3];
+    if (!is_generator_(g, ctx) || lisp_type(argv[0]) != LISP_INT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int sink = (int)lisp_int(argv[0]);
+    int source = (int)lisp_int(lisp_vector_ref(g, 1));
+
+    // stages in the order they apply, with counts which the run can use up.
+    int n = lisp_list_length(lisp_vector_ref(g, 5));
+    Lisp stages = lisp_make_vector(2 * n, ctx);
+    int done = 0;
+    int k = n;
+    for (Lisp it = lisp_vector_ref(g, 5); lisp_is_pair(it); it = lisp_cdr(it))
+    {
+        --k;
+        lisp_vector_set(stages, 2 * k, lisp_car(lisp_car(it)));
+        lisp_vector_set(stages, 2 * k + 1, lisp_cdr(lisp_car(it)));
+        if (lisp_int(lisp_car(lisp_car(it))) == GEN_TAKE && lisp_int(lisp_cdr(lisp_car(it))) <= 0) done = 1;
+    }
+
+    FILE* file = NULL;
+    LispReader* reader = NULL;
+    if (source == GEN_FILE)
+    {
+        file = fopen(lisp_string(lisp_vector_ref(g, 2)), "r");
+        if (!file)
+        {
+            *e = LISP_ERROR_FILE_OPEN;
+            return lisp_null();
+        }
+        reader = lisp_reader_open(file);
+    }
+
+    Lisp* roots = lisp_push_root(g, ctx);
+    lisp_push_root(stages, ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(source == GEN_LIST || source == GEN_VECTOR ? lisp_vector_ref(g, 2) : lisp_null(), ctx);
+    lisp_push_root(sink == GEN_SINK_LIST ? lisp_null() : argv[2], ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    // range and vector positions
+    Lisp start = lisp_vector_ref(g, source == GEN_VECTOR ? 3 : 2);
+    int is_real = source == GEN_RANGE &&
+        (lisp_type(start) == LISP_REAL || lisp_type(lisp_vector_ref(g, 3)) == LISP_REAL || lisp_type(lisp_vector_ref(g, 4)) == LISP_REAL);
+    LispInt i = lisp_type(start) == LISP_INT ? lisp_int(start) : 0;
+    LispReal r = is_number_(start) ? lisp_number_to_real(start) : 0.0;
+
+    while (!done && *e == LISP_ERROR_NONE)
+    {
+        // nothing is held outside of the roots.
+        lisp_safe_point(ctx);
+        if (!generator_next_(source, roots, &i, &r, is_real, reader, e, ctx)) break;
+
+        int keep = 1;
+        for (k = 0; k < n && keep; ++k)
+        {
+            switch (lisp_int(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k)))
+            {
+                case GEN_MAP:
+                {
+                    Lisp x = lisp_apply_argv(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1), 1, roots + GEN_ROOT_X, e, ctx);
+                    roots[GEN_ROOT_X] = x;
+                    break;
+                }
+                case GEN_FILTER:
+                    keep = lisp_is_true(lisp_apply_argv(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1), 1, roots + GEN_ROOT_X, e, ctx));
+                    break;
+                case GEN_TAKE_WHILE:
+                    keep = lisp_is_true(lisp_apply_argv(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1), 1, roots + GEN_ROOT_X, e, ctx));
+                    if (!keep) done = 1;
+                    break;
+                case GEN_TAKE:
+                {
+                    // stop after the last one, instead of pulling another
+                    LispInt left = lisp_int(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1)) - 1;
+                    lisp_vector_set(roots[GEN_ROOT_STAGES], 2 * k + 1, lisp_make_int(left));
+                    if (left <= 0) done = 1;
+                    break;
+                }
+            }
+            if (*e != LISP_ERROR_NONE) keep = 0;
+        }
+        if (!keep) continue;
+
+        switch (sink)
+        {
+            case GEN_SINK_FOLD:
+            {
+                Lisp acc = lisp_apply_argv(roots[GEN_ROOT_SINK], 2, roots + GEN_ROOT_ACC, e, ctx);
+                roots[GEN_ROOT_ACC] = acc;
+                break;
+            }
+            case GEN_SINK_FOR_EACH:
+                lisp_apply_argv(roots[GEN_ROOT_SINK], 1, roots + GEN_ROOT_X, e, ctx);
+                break;
+            case GEN_SINK_LIST:
+                roots[GEN_ROOT_ACC] = lisp_cons(roots[GEN_ROOT_X], roots[GEN_ROOT_ACC], ctx);
+                break;
+        }
+    }
+
+    Lisp result = roots[GEN_ROOT_ACC];
+    lisp_pop_roots(GEN_ROOT_COUNT, ctx);
+    if (reader)
+    {
+        lisp_reader_close(reader);
+        fclose(file);
+    }
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    return sink == GEN_SINK_LIST ? lisp_list_reverse(result) : result;
 }
 
 #undef ARITY_CHECK
 
+// PARALLELISM
+// A fixed pool of threads, each running its own context.
+// Procedures and their data are copied in to a worker (see lisp_copy_closure_to)
+// while it waits, and results are copied back by the caller.
+#ifdef LISP_THREADS_
+
+#define WORKER_MAX_ 64
+
+enum
+{
+    WORKER_STARTING = 0,
+    WORKER_IDLE,
+    WORKER_RESERVED, // a caller is copying in to it
+    WORKER_MAP,
+    WORKER_FUTURE,
+    WORKER_DONE,     // holding a result for its caller
+    WORKER_RESET,    // clearing its user environment before becoming idle
+};
+
+struct MapJob;
+
+typedef struct
+{
+    pthread_t thread;
+    LispContext ctx;
+    int state;
+    unsigned generation;
+    LispContext caller;
+    LispError error;
+    // handle in the caller to the slot a future's result is kept in, or -1.
+    LispHandle slot;
+
+    struct MapJob* job;
+    // indices left to map. Thieves take the upper half.
+    pthread_mutex_t range_lock;
+    int lo;
+    int hi;
+} Worker;
+
+typedef struct MapJob
+{
+    // the caller's vector of inputs. The caller waits, so it doesn't move.
+    Lisp input;
+    LispContext caller;
+    Worker* workers[WORKER_MAX_];
+    int worker_count;
+    int active;
+    LispError error;
+} MapJob;
+
+static struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t wake;    // workers wait for a job
+    pthread_cond_t changed; // callers wait for workers
+    int count;
+    Worker workers[WORKER_MAX_];
+} pool_ = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+static pthread_once_t pool_once_ = PTHREAD_ONCE_INIT;
+
+// workers keep what they are working on in globals, so it is saved by collections.
+static Lisp worker_get_(const char* name, LispContext ctx)
+{
+    int present;
+    return lisp_env_lookup(lisp_env(ctx), lisp_make_symbol(name, ctx), &present);
+}
+
+static void worker_set_(const char* name, Lisp x, LispContext ctx)
+{
+    lisp_env_define(lisp_env(ctx), lisp_make_symbol(name, ctx), x, ctx);
+}
+
+// next index to map, or -1 when everything is taken.
+static int worker_next_(Worker* w)
+{
+    pthread_mutex_lock(&w->range_lock);
+    int k = w->lo < w->hi ? w->lo++ : -1;
+    pthread_mutex_unlock(&w->range_lock);
+    if (k != -1) return k;
+
+    MapJob* job = w->job;
+    for (int i = 0; i < job->worker_count; ++i)
+    {
+        Worker* victim = job->workers[i];
+        if (victim == w) continue;
+
+        pthread_mutex_lock(&victim->range_lock);
+        int lo = victim->lo;
+        int hi = victim->hi;
+        int mid = lo + (hi - lo) / 2;
+        if (lo < hi) victim->hi = mid;
+        pthread_mutex_unlock(&victim->range_lock);
+
+        if (lo < hi)
+        {
+            pthread_mutex_lock(&w->range_lock);
+            w->lo = mid + 1;
+            w->hi = hi;
+            pthread_mutex_unlock(&w->range_lock);
+            return mid;
+        }
+    }
+    return -1;
+}
+
+static LispError worker_map_(Worker* w)
+{
+    MapJob* job = w->job;
+    LispContext ctx = w->ctx;
+
+    int k;
+    while ((k = worker_next_(w)) != -1)
+    {
+        LispError error;
+        // other workers copy out of the caller too, which is fine while it waits
+        Lisp x = lisp_copy_to(lisp_vector_ref(job->input, k), job->caller, ctx, &error);
+        if (error != LISP_ERROR_NONE) return error;
+
+        Lisp result = lisp_apply(worker_get_("_WORKER-PROC", ctx), lisp_cons(x, lisp_null(), ctx), &error, ctx);
+        if (error != LISP_ERROR_NONE) return error;
+
+        Lisp results = worker_get_("_WORKER-RESULT", ctx);
+        worker_set_("_WORKER-RESULT", lisp_cons(lisp_cons(lisp_make_int(k), result, ctx), results, ctx), ctx);
+    }
+    return LISP_ERROR_NONE;
+}
+
+static void* worker_main_(void* arg)
+{
+    Worker* w = arg;
+    LispContext ctx = lisp_init_with_lib();
+    lisp_set_auto_collect(8 * LISP_PAGE_SIZE, ctx);
+
+    pthread_mutex_lock(&pool_.lock);
+    w->ctx = ctx;
+    w->state = WORKER_IDLE;
+    pthread_cond_broadcast(&pool_.changed);
+
+    while (1)
+    {
+        while (w->state != WORKER_MAP && w->state != WORKER_FUTURE && w->state != WORKER_RESET)
+            pthread_cond_wait(&pool_.wake, &pool_.lock);
+
+        int state = w->state;
+        pthread_mutex_unlock(&pool_.lock);
+
+        LispError error = LISP_ERROR_NONE;
+        if (state == WORKER_MAP)
+        {
+            error = worker_map_(w);
+            if (error != LISP_ERROR_NONE)
+            {
+                // stop the others
+                MapJob* job = w->job;
+                for (int i = 0; i < job->worker_count; ++i)
+                {
+                    pthread_mutex_lock(&job->workers[i]->range_lock);
+                    job->workers[i]->lo = job->workers[i]->hi;
+                    pthread_mutex_unlock(&job->workers[i]->range_lock);
+                }
+            }
+        }
+        else if (state == WORKER_FUTURE)
+        {
+            Lisp result = lisp_apply(worker_get_("_WORKER-PROC", ctx), lisp_null(), &error, ctx);
+            worker_set_("_WORKER-RESULT", result, ctx);
+        }
+        else
+        {
+            // a new frame, so defines in it are seen by cached global references
+            lisp_set_env(lisp_env_extend(lisp_cdr(lisp_env(ctx)), lisp_make_table(ctx), ctx), ctx);
+            lisp_collect(lisp_null(), ctx);
+        }
+
+        pthread_mutex_lock(&pool_.lock);
+        if (state == WORKER_MAP)
+        {
+            if (w->job->error == LISP_ERROR_NONE) w->job->error = error;
+            --w->job->active;
+            w->state = WORKER_DONE;
+        }
+        else if (state == WORKER_FUTURE)
+        {
+            w->error = error;
+            w->state = WORKER_DONE;
+        }
+        else
+        {
+            w->state = WORKER_IDLE;
+        }
+        pthread_cond_broadcast(&pool_.changed);
+    }
+    return NULL;
+}
+
+static void pool_start_(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) n = 1;
+    if (n > WORKER_MAX_) n = WORKER_MAX_;
+
+    pthread_mutex_lock(&pool_.lock);
+    for (int i = 0; i < n; ++i)
+    {
+        Worker* w = pool_.workers + pool_.count;
+        w->state = WORKER_STARTING;
+        w->generation = 0;
+        w->slot = -1;
+        pthread_mutex_init(&w->range_lock, NULL);
+        if (pthread_create(&w->thread, NULL, worker_main_, w) != 0) break;
+        pthread_detach(w->thread);
+        ++pool_.count;
+    }
+    pthread_mutex_unlock(&pool_.lock);
+}
+
+static void pool_release_(Worker** workers, int n);
+
+// copies a finished future's result (or error) in to its slot in the caller,
+// and lets the worker go.
+static void future_claim_(Worker* w, LispContext ctx)
+{
+    LispError error = w->error;
+    Lisp result = lisp_null();
+    if (error == LISP_ERROR_NONE)
+        result = lisp_copy_to(worker_get_("_WORKER-RESULT", w->ctx), w->ctx, ctx, &error);
+
+    Lisp slot = lisp_handle_get(w->slot, ctx);
+    lisp_vector_set(slot, 1, lisp_make_int(error));
+    lisp_vector_set(slot, 2, result);
+    lisp_handle_free(w->slot, ctx);
+
+    pthread_mutex_lock(&pool_.lock);
+    w->slot = -1;
+    pthread_mutex_unlock(&pool_.lock);
+    pool_release_(&w, 1);
+}
+
+// claims up to max idle workers for the caller.
+// The caller's finished futures give their workers back first,
+// so futures which are never touched don't keep them.
+static int pool_reserve_(Worker** out, int max, LispContext caller)
+{
+    pthread_once(&pool_once_, pool_start_);
+
+    Worker* done[WORKER_MAX_];
+    int done_count = 0;
+    pthread_mutex_lock(&pool_.lock);
+    for (int i = 0; i < pool_.count; ++i)
+    {
+        Worker* w = pool_.workers + i;
+        if (w->state == WORKER_DONE && w->slot != -1 && w->caller.p == caller.p) done[done_count++] = w;
+    }
+    pthread_mutex_unlock(&pool_.lock);
+    for (int i = 0; i < done_count; ++i) future_claim_(done[i], caller);
+
+    pthread_mutex_lock(&pool_.lock);
+    // workers which are starting or resetting will be idle soon.
+    int waiting = 1;
+    while (waiting)
+    {
+        waiting = 0;
+        for (int i = 0; i < pool_.count; ++i)
+        {
+            int state = pool_.workers[i].state;
+            if (state == WORKER_STARTING || state == WORKER_RESET) waiting = 1;
+        }
+        if (waiting) pthread_cond_wait(&pool_.changed, &pool_.lock);
+    }
+
+    int n = 0;
+    for (int i = 0; i < pool_.count && n < max; ++i)
+    {
+        Worker* w = pool_.workers + i;
+        if (w->state != WORKER_IDLE) continue;
+        w->state = WORKER_RESERVED;
+        w->caller = caller;
+        out[n++] = w;
+    }
+    pthread_mutex_unlock(&pool_.lock);
+    return n;
+}
+
+static void pool_release_(Worker** workers, int n)
+{
+    pthread_mutex_lock(&pool_.lock);
+    for (int i = 0; i < n; ++i) workers[i]->state = WORKER_RESET;
+    pthread_cond_broadcast(&pool_.wake);
+    pthread_mutex_unlock(&pool_.lock);
+}
+
+// copies a procedure in to reserved workers.
+static LispError pool_send_proc_(Worker** workers, int n, Lisp proc, LispContext ctx)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        LispError error;
+        Lisp copy = lisp_copy_closure_to(proc, ctx, workers[i]->ctx, &error);
+        if (error != LISP_ERROR_NONE) return error;
+        worker_set_("_WORKER-PROC", copy, workers[i]->ctx);
+        worker_set_("_WORKER-RESULT", lisp_null(), workers[i]->ctx);
+    }
+    return LISP_ERROR_NONE;
+}
+
+static Lisp sch_parallel_vector_map(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[1]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+
+    MapJob job;
+    job.input = argv[1];
+    job.caller = ctx;
+    job.error = LISP_ERROR_NONE;
+
+    int n = lisp_vector_length(job.input);
+    job.worker_count = pool_reserve_(job.workers, n < WORKER_MAX_ ? n : WORKER_MAX_, ctx);
+    // the library maps sequentially instead
+    if (job.worker_count == 0) return lisp_false();
+
+    *e = pool_send_proc_(job.workers, job.worker_count, argv[0], ctx);
+    if (*e != LISP_ERROR_NONE)
+    {
+        pool_release_(job.workers, job.worker_count);
+        return lisp_null();
+    }
+
+    pthread_mutex_lock(&pool_.lock);
+    job.active = job.worker_count;
+    for (int i = 0; i < job.worker_count; ++i)
+    {
+        Worker* w = job.workers[i];
+        w->job = &job;
+        w->lo = (int)((long long)n * i / job.worker_count);
+        w->hi = (int)((long long)n * (i + 1) / job.worker_count);
+        w->state = WORKER_MAP;
+    }
+    pthread_cond_broadcast(&pool_.wake);
+    while (job.active > 0) pthread_cond_wait(&pool_.changed, &pool_.lock);
+    pthread_mutex_unlock(&pool_.lock);
+
+    Lisp result = lisp_null();
+    *e = job.error;
+    if (*e == LISP_ERROR_NONE)
+    {
+        result = lisp_make_vector(n, ctx);
+        for (int i = 0; i < job.worker_count && *e == LISP_ERROR_NONE; ++i)
+        {
+            LispContext w_ctx = job.workers[i]->ctx;
+            Lisp it = lisp_copy_to(worker_get_("_WORKER-RESULT", w_ctx), w_ctx, ctx, e);
+            while (lisp_is_pair(it))
+            {
+                Lisp entry = lisp_car(it);
+                lisp_vector_set(result, (int)lisp_int(lisp_car(entry)), lisp_cdr(entry));
+                it = lisp_cdr(it);
+            }
+        }
+    }
+    pool_release_(job.workers, job.worker_count);
+    return result;
+}
+
+// returns a slot for the result of a worker running thunk, or #f if none are free.
+// The slot is #(ticket error result), and error is #f until the result is copied in.
+static Lisp sch_future_start(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    Worker* w;
+    if (pool_reserve_(&w, 1, ctx) == 0) return lisp_false();
+
+    *e = pool_send_proc_(&w, 1, argv[0], ctx);
+    if (*e != LISP_ERROR_NONE)
+    {
+        pool_release_(&w, 1);
+        return lisp_null();
+    }
+
+    Lisp slot = lisp_make_vector(3, ctx);
+    lisp_vector_set(slot, 1, lisp_false());
+    lisp_vector_set(slot, 2, lisp_null());
+    LispHandle h = lisp_handle_new(slot, ctx);
+
+    pthread_mutex_lock(&pool_.lock);
+    unsigned generation = ++w->generation;
+    w->slot = h;
+    w->state = WORKER_FUTURE;
+    pthread_cond_broadcast(&pool_.wake);
+    pthread_mutex_unlock(&pool_.lock);
+
+    lisp_vector_set(slot, 0, lisp_make_int((LispInt)generation * WORKER_MAX_ + (w - pool_.workers)));
+    return slot;
+}
+
+static Lisp sch_future_wait(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR || lisp_vector_length(argv[0]) != 3 ||
+        lisp_type(lisp_vector_ref(argv[0], 0)) != LISP_INT || lisp_int(lisp_vector_ref(argv[0], 0)) < 0)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+
+    // still with its worker
+    if (lisp_type(lisp_vector_ref(argv[0], 1)) != LISP_INT)
+    {
+        LispInt ticket = lisp_int(lisp_vector_ref(argv[0], 0));
+        Worker* w = pool_.workers + ticket % WORKER_MAX_;
+
+        pthread_mutex_lock(&pool_.lock);
+        int valid = ticket % WORKER_MAX_ < pool_.count && w->generation == (unsigned)(ticket / WORKER_MAX_) &&
+            w->caller.p == ctx.p && (w->state == WORKER_FUTURE || w->state == WORKER_DONE);
+        while (valid && w->state != WORKER_DONE) pthread_cond_wait(&pool_.changed, &pool_.lock);
+        pthread_mutex_unlock(&pool_.lock);
+
+        if (!valid)
+        {
+            fprintf(lisp_stderr(ctx), "not a running future.\n");
+            *e = LISP_ERROR_RUNTIME;
+            return lisp_null();
+        }
+        future_claim_(w, ctx);
+    }
+
+    *e = (LispError)lisp_int(lisp_vector_ref(argv[0], 1));
+    return *e == LISP_ERROR_NONE ? lisp_vector_ref(argv[0], 2) : lisp_null();
+}
+
+#else
+
+// without threads the library runs everything sequentially.
+static Lisp sch_parallel_vector_map(int argc, Lisp* argv, LispError* e, LispContext ctx) { return lisp_false(); }
+static Lisp sch_future_start(int argc, Lisp* argv, LispError* e, LispContext ctx) { return lisp_false(); }
+static Lisp sch_future_wait(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    *e = LISP_ERROR_RUNTIME;
+    return lisp_null();
+}
+
+#endif
+
 static const LispFuncDef lib_cfunc_defs[] = {
     
     { "ERROR", sch_error },
@@ -1790,33 +8744,43 @@ static const LispFuncDef lib_cfunc_defs[] = {
     { "WRITE", sch_write },
     { "DISPLAY", sch_display },
     { "WRITE-CHAR", sch_write_char },
+    { "OPEN-OUTPUT-STRING", sch_open_output_string },
+    { "GET-OUTPUT-STRING", sch_get_output_string },
+    { "_SET-OUTPUT-PORT!", sch_set_output_port },
     { "FLUSH-OUTPUT-PORT", sch_flush },
     { "READ", sch_read },
+    { "READ-SHARED", sch_read_shared },
+    { "READ-FILE", NULL, sch_read_file, 1, 1 },
     { "EOF-OBJECT?", sch_is_eof },
+    { "WRITE-BINARY", sch_write_binary },
+    { "READ-BINARY", sch_read_binary },
     
     // Universal Time https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Universal-Time.html
     { "GET-UNIVERSAL-TIME", sch_univeral_time },
+    // Machine Time https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Machine-Time.html
+    { "REAL-TIME", NULL, sch_real_time, 0, 0 },
+    { "RUNTIME", NULL, sch_runtime, 0, 0 },
     { "PRINT-GC-STATISTICS", sch_print_gc_stats },
     
     { "MACROEXPAND", sch_macroexpand },
     
     // Equivalence Predicates https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Equivalence-Predicates.html
-    { "EQ?", sch_exact_eq },
-    { "EQV?", sch_equal },
-    { "EQUAL?", sch_equal_r },
+    { "EQ?", NULL, sch_exact_eq, 2, 2 },
+    { "EQV?", NULL, sch_equal, 2, 2 },
+    { "EQUAL?", NULL, sch_equal_r, 2, 2 },
     
     // Booleans https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Booleans.html
     { "BOOLEAN?", sch_is_boolean },
     { "NOT", sch_not },
 
     // PAIRS
-    { "CONS", sch_cons },
-    { "CAR", sch_car },
-    { "CDR", sch_cdr },
-    { "SET-CAR!", sch_set_car },
-    { "SET-CDR!", sch_set_cdr },
-    { "NULL?", sch_is_null },
-    { "PAIR?", sch_is_pair },
+    { "CONS", NULL, sch_cons, 2, 2 },
+    { "CAR", NULL, sch_car, 1, 1 },
+    { "CDR", NULL, sch_cdr, 1, 1 },
+    { "SET-CAR!", NULL, sch_set_car, 2, 2 },
+    { "SET-CDR!", NULL, sch_set_cdr, 2, 2 },
+    { "NULL?", NULL, sch_is_null, 1, 1 },
+    { "PAIR?", NULL, sch_is_pair, 1, 1 },
 
     // Lists https://groups.csail.mit.edu/mac/ftpdir/scheme-7.4/doc-html/scheme_8.html
     { "LIST", sch_list },
@@ -1833,20 +8797,63 @@ static const LispFuncDef lib_cfunc_defs[] = {
     { "VECTOR?", sch_is_vector },
     { "MAKE-VECTOR", sch_make_vector },
     { "VECTOR-GROW", sch_vector_grow },
-    { "VECTOR-LENGTH", sch_vector_length },
-    { "VECTOR-SET!", sch_vector_set },
+    { "VECTOR-LENGTH", NULL, sch_vector_length, 1, 1 },
+    { "VECTOR-SET!", NULL, sch_vector_set, 3, 3 },
     { "VECTOR-SWAP!", sch_vector_swap },
-    { "VECTOR-REF", sch_vector_ref },
+    { "VECTOR-REF", NULL, sch_vector_ref, 2, 2 },
     { "VECTOR-FILL!", sch_vector_fill },
     { "VECTOR-ASSQ", sch_vector_assq },
     { "SUBVECTOR", sch_subvector },
     { "LIST->VECTOR", sch_list_to_vector },
     { "VECTOR->LIST", sch_vector_to_list },
 
+    // Numeric vectors (SRFI 4 names) and bulk operations on them
+    { "MAKE-F64VECTOR", NULL, sch_f64vector_make, 1, 2 },
+    { "F64VECTOR", NULL, sch_f64vector_new, 0, -1 },
+    { "F64VECTOR?", NULL, sch_f64vector_is, 1, 1 },
+    { "F64VECTOR-LENGTH", NULL, sch_f64vector_length, 1, 1 },
+    { "F64VECTOR-REF", NULL, sch_f64vector_ref, 2, 2 },
+    { "F64VECTOR-SET!", NULL, sch_f64vector_set, 3, 3 },
+    { "F64VECTOR->LIST", NULL, sch_f64vector_to_list, 1, 1 },
+    { "LIST->F64VECTOR", NULL, sch_f64vector_from_list, 1, 1 },
+    { "F64VECTOR->VECTOR", NULL, sch_f64vector_to_vector, 1, 1 },
+    { "VECTOR->F64VECTOR", NULL, sch_f64vector_from_vector, 1, 1 },
+    { "F64VECTOR-COPY", NULL, sch_f64vector_copy, 1, 3 },
+    { "F64VECTOR-FILL!", NULL, sch_f64vector_fill, 2, 4 },
+    { "F64VECTOR-ADD", NULL, sch_f64vector_add, 2, 2 },
+    { "F64VECTOR-MUL", NULL, sch_f64vector_mul, 2, 2 },
+    { "F64VECTOR-SCALE", NULL, sch_f64vector_scale, 2, 2 },
+    { "F64VECTOR-SUM", NULL, sch_f64vector_sum, 1, 1 },
+    { "F64VECTOR-DOT", NULL, sch_f64vector_dot, 2, 2 },
+    { "F64VECTOR-MIN", NULL, sch_f64vector_min, 1, 1 },
+    { "F64VECTOR-MAX", NULL, sch_f64vector_max, 1, 1 },
+    { "F64VECTOR-SORT!", NULL, sch_f64vector_sort, 1, 1 },
+
+    { "MAKE-S64VECTOR", NULL, sch_s64vector_make, 1, 2 },
+    { "S64VECTOR", NULL, sch_s64vector_new, 0, -1 },
+    { "S64VECTOR?", NULL, sch_s64vector_is, 1, 1 },
+    { "S64VECTOR-LENGTH", NULL, sch_s64vector_length, 1, 1 },
+    { "S64VECTOR-REF", NULL, sch_s64vector_ref, 2, 2 },
+    { "S64VECTOR-SET!", NULL, sch_s64vector_set, 3, 3 },
+    { "S64VECTOR->LIST", NULL, sch_s64vector_to_list, 1, 1 },
+    { "LIST->S64VECTOR", NULL, sch_s64vector_from_list, 1, 1 },
+    { "S64VECTOR->VECTOR", NULL, sch_s64vector_to_vector, 1, 1 },
+    { "VECTOR->S64VECTOR", NULL, sch_s64vector_from_vector, 1, 1 },
+    { "S64VECTOR-COPY", NULL, sch_s64vector_copy, 1, 3 },
+    { "S64VECTOR-FILL!", NULL, sch_s64vector_fill, 2, 4 },
+    { "S64VECTOR-ADD", NULL, sch_s64vector_add, 2, 2 },
+    { "S64VECTOR-MUL", NULL, sch_s64vector_mul, 2, 2 },
+    { "S64VECTOR-SCALE", NULL, sch_s64vector_scale, 2, 2 },
+    { "S64VECTOR-SUM", NULL, sch_s64vector_sum, 1, 1 },
+    { "S64VECTOR-DOT", NULL, sch_s64vector_dot, 2, 2 },
+    { "S64VECTOR-MIN", NULL, sch_s64vector_min, 1, 1 },
+    { "S64VECTOR-MAX", NULL, sch_s64vector_max, 1, 1 },
+    { "S64VECTOR-SORT!", NULL, sch_s64vector_sort, 1, 1 },
+
     // Strings https://groups.csail.mit.edu/mac/ftpdir/scheme-7.4/doc-html/scheme_7.html#SEC61
     { "STRING?", sch_is_string },
     { "MAKE-STRING", sch_make_string },
-    { "STRING=?", sch_equal_r },
+    { "STRING=?", NULL, sch_equal_r, 2, 2 },
     { "STRING<?", sch_string_less },
     { "SUBSTRING", sch_substring },
     { "STRING-NULL?", sch_string_is_null },
@@ -1863,7 +8870,7 @@ static const LispFuncDef lib_cfunc_defs[] = {
 
     // Characters https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Characters.html#Characters
     { "CHAR?", sch_is_char },
-    { "CHAR=?", sch_equals },
+    { "CHAR=?", NULL, sch_equals, 0, -1 },
     { "CHAR<?", sch_char_less },
     { "CHAR-UPCASE", sch_char_upcase },
     { "CHAR-DOWNCASE", sch_char_downcase },
@@ -1875,12 +8882,12 @@ static const LispFuncDef lib_cfunc_defs[] = {
 
     // Association Lists https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Association-Lists.html
     // Numerical operations https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Numerical-operations.html
-    { "=", sch_equals },
-    { "+", sch_add },
-    { "-", sch_sub },
-    { "*", sch_mult },
-    { "/", sch_divide },
-    { "<", sch_less },
+    { "=", NULL, sch_equals, 0, -1 },
+    { "+", NULL, sch_add, 0, -1 },
+    { "-", NULL, sch_sub, 1, 2 },
+    { "*", NULL, sch_mult, 0, -1 },
+    { "/", NULL, sch_divide, 2, 2 },
+    { "<", NULL, sch_less, 2, 2 },
     { "INTEGER?", sch_is_int },
     { "EVEN?", sch_is_even },
     { "REAL?", sch_is_real },
@@ -1916,6 +8923,7 @@ static const LispFuncDef lib_cfunc_defs[] = {
 
     // Environments https://groups.csail.mit.edu/mac/ftpdir/scheme-7.4/doc-html/scheme_14.html
     { "EVAL", sch_eval },
+    { "COMPILE", sch_compile },
     { "SYSTEM-GLOBAL-ENVIRONMENT", sch_system_env },
     { "USER-INITIAL-ENVIRONMENT", sch_user_env },
     // { "THE-ENVIRONMENT", sch_current_env },
@@ -1923,17 +8931,46 @@ static const LispFuncDef lib_cfunc_defs[] = {
     // Hash Tables https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Basic-Hash-Table-Operations.html#Basic-Hash-Table-Operations
     { "HASH-TABLE?", sch_is_table },
     { "MAKE-HASH-TABLE", sch_table_make },
+    { "MAKE-EQUAL-HASH-TABLE", sch_equal_table_make },
+    { "MAKE-STRING-HASH-TABLE", sch_equal_table_make },
     { "HASH-TABLE-SET!", sch_table_set },
     { "HASH-TABLE-REF", sch_table_get },
     { "HASH-TABLE-SIZE", sch_table_size },
     { "HASH-TABLE->ALIST", sch_table_to_alist },
 
+    { "MAP", NULL, sch_map, 2, -1 },
+    { "FOR-EACH", NULL, sch_for_each, 2, -1 },
+    { "FILTER", NULL, sch_filter, 2, 2 },
+    { "REDUCE", NULL, sch_reduce, 3, 3 },
+    { "ASSQ", NULL, sch_assq, 2, 2 },
+    { "ASSV", NULL, sch_assv, 2, 2 },
+    { "ASSOC", NULL, sch_assoc, 2, 2 },
+    { "MEMQ", NULL, sch_memq, 2, 2 },
+    { "MEMV", NULL, sch_memv, 2, 2 },
+    { "MEMBER", NULL, sch_member, 2, 2 },
+    { "VECTOR-MAP", NULL, sch_vector_map, 2, 2 },
+    { "VECTOR-BINARY-SEARCH", NULL, sch_vector_binary_search, 4, 4 },
+    { "SORT", NULL, sch_sort, 2, 2 },
+    { "SORT!", NULL, sch_sort_inplace, 2, 2 },
+
     { "PROMISE?", sch_is_promise },
     { "MAKE-PROMISE", sch_make_promise },
     { "_PROMISE-PROCEDURE", sch_promise_proc },
     { "_PROMISE-STORE!", sch_promise_store },
     { "PROMISE-VALUE", sch_promise_val },
     { "PROMISE-FORCED?", sch_promise_forced },
+
+    { "GENERATOR?", NULL, sch_is_generator, 1, 1 },
+    { "RANGE-GENERATOR", NULL, sch_range_generator, 1, 3 },
+    { "VECTOR-GENERATOR", NULL, sch_vector_generator, 1, 3 },
+    { "LIST-GENERATOR", NULL, sch_list_generator, 1, 1 },
+    { "FILE-GENERATOR", NULL, sch_file_generator, 1, 1 },
+    { "_GENERATOR-STAGE", NULL, sch_generator_stage, 3, 3 },
+    { "_GENERATOR-RUN", NULL, sch_generator_run, 4, 4 },
+
+    { "_PARALLEL-VECTOR-MAP", NULL, sch_parallel_vector_map, 2, 2 },
+    { "_FUTURE-START", NULL, sch_future_start, 1, 1 },
+    { "_FUTURE-WAIT", NULL, sch_future_wait, 1, 1 },
     
     // Procedures https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Procedure-Operations.html#Procedure-Operations
     { "APPLY", sch_apply },
@@ -1951,6 +8988,7 @@ static const LispFuncDef lib_cfunc_defs[] = {
    
     // Garbage Collection https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-user/Garbage-Collection.html
     { "GC-FLIP", sch_gc_flip },
+    { "GC-STATISTICS", NULL, sch_gc_statistics, 0, 0 },
     
     { NULL, NULL }
     
@@ -1975,6 +9013,9 @@ void lisp_lib_load(LispContext ctx)
 
     for (int i = 0; i < n; ++i)
     {
+        // eval may collect
+        system_env = lisp_cdr(lisp_env(ctx));
+
         LispError error;
         Lisp src = lisp_read(to_load[i], &error, ctx);
 
@@ -1999,9 +9040,17 @@ void lisp_lib_load(LispContext ctx)
 #endif
 }
 
+const LispFuncDef* lisp_lib_funcs(void) { return lib_cfunc_defs; }
+
 LispContext lisp_init_with_lib(void)
 {
-    LispContext ctx = lisp_init();
+    LispContext ctx;
+#ifdef LISP_LIB_IMAGE_
+    // start from the baked image, unless it was made with different build options.
+    ctx = lisp_init_image(lib_image_, sizeof(lib_image_), lib_cfunc_defs);
+    if (ctx.p) return ctx;
+#endif
+    ctx = lisp_init();
     lisp_lib_load(ctx);
     return ctx;
 }
@@ -5,20 +5,33 @@
 #define LISP_IMPLEMENTATION
 #include "lisp.h"
 
+// usage: printer [--to-binary | --from-binary] < input > output
 int main(int argc, const char* argv[])
 {
+    int to_binary = argc > 1 && strcmp(argv[1], "--to-binary") == 0;
+    int from_binary = argc > 1 && strcmp(argv[1], "--from-binary") == 0;
+
     LispContext ctx = lisp_init();
     LispError error;
-    Lisp data = lisp_read_file(stdin, &error, ctx);
+    Lisp data = from_binary ? lisp_read_binary(stdin, &error, ctx) : lisp_read_file(stdin, &error, ctx);
 
     if (error != LISP_ERROR_NONE)
     {
         fprintf(stderr, "error: %s\n", lisp_error_string(error));
     }
     data = lisp_collect(data, ctx);
-    lisp_print(data);
+
+    if (to_binary)
+    {
+        lisp_write_binary(stdout, data, &error, ctx);
+        if (error != LISP_ERROR_NONE)
+            fprintf(stderr, "error: %s\n", lisp_error_string(error));
+    }
+    else
+    {
+        lisp_print(data);
+    }
 
     lisp_shutdown(ctx);
     return 0;
 }
-
@@ -14,15 +14,44 @@
 static Lisp sch_load(Lisp args, LispError* e, LispContext ctx)
 {
     Lisp path = lisp_car(args);
-    Lisp result = lisp_read_path(lisp_string(path), e, ctx);
-    if (*e != LISP_ERROR_NONE) return lisp_null();
-    return lisp_eval(result, e, ctx);
+    FILE* file = fopen(lisp_string(path), "r");
+    if (!file)
+    {
+        *e = LISP_ERROR_FILE_OPEN;
+        return lisp_null();
+    }
+
+    // evaluate one form at a time. Only the last result is kept,
+    // as eval may collect.
+    LispReader* reader = lisp_reader_open(file);
+    Lisp result = lisp_null();
+    while (1)
+    {
+        Lisp form = lisp_reader_next(reader, e, ctx);
+        if (*e != LISP_ERROR_NONE || lisp_equal(form, lisp_eof())) break;
+
+        result = lisp_eval(form, e, ctx);
+        if (*e != LISP_ERROR_NONE) break;
+    }
+    lisp_reader_close(reader);
+    fclose(file);
+    return result;
 }
 
+// clock() may be a system call, so only measure when it is printed.
+static clock_t now_(int verbose) { return verbose ? clock() : 0; }
+
 int main(int argc, const char* argv[])
 {
     const char* file_path = NULL;
     int run_script = 0;
+    int compile = 0;
+    int auto_collect = 0;
+    int profile = 0;
+    int profile_sample = 0;
+    int gc_threads = 1;
+    size_t max_heap = 0;
+    const char* profile_stacks_path = NULL;
     int verbose;
 #ifdef LISP_DEBUG
     verbose = 1;
@@ -41,6 +70,39 @@ int main(int argc, const char* argv[])
             file_path = argv[i + 1];
             run_script = 1;
         }
+        if (strcmp(argv[i], "--compile") == 0)
+        {
+            compile = 1;
+        }
+        if (strcmp(argv[i], "--auto-gc") == 0)
+        {
+            auto_collect = 1;
+        }
+        if (strcmp(argv[i], "--gc-threads") == 0 && i + 1 < argc)
+        {
+            gc_threads = atoi(argv[i + 1]);
+        }
+        // in megabytes
+        if (strcmp(argv[i], "--max-heap") == 0 && i + 1 < argc)
+        {
+            max_heap = (size_t)atoi(argv[i + 1]) << 20;
+        }
+        // flat profile to stderr
+        if (strcmp(argv[i], "--profile") == 0)
+        {
+            profile = 1;
+        }
+        if (strcmp(argv[i], "--profile-sample") == 0)
+        {
+            profile = 1;
+            profile_sample = 1;
+        }
+        // collapsed stacks for flame graphs
+        if (strcmp(argv[i], "--profile-stacks") == 0)
+        {
+            profile = 1;
+            profile_stacks_path = argv[i + 1];
+        }
     }
     
     LispContext ctx = lisp_init_with_lib();
@@ -59,6 +121,25 @@ int main(int argc, const char* argv[])
             ctx
     );
 
+    if (auto_collect)
+    {
+        lisp_set_auto_collect(8 * LISP_PAGE_SIZE, ctx);
+    }
+
+    lisp_set_gc_threads(gc_threads, ctx);
+
+    if (max_heap)
+    {
+        LispHeapPolicy policy = lisp_heap_policy(ctx);
+        policy.max_size = max_heap;
+        lisp_set_heap_policy(policy, ctx);
+    }
+
+    if (profile)
+    {
+        lisp_profile_begin(profile_sample, ctx);
+    }
+
     clock_t start_time, end_time;
         
     if (file_path)
@@ -68,7 +149,6 @@ int main(int argc, const char* argv[])
             printf("loading: %s\n", file_path);
         }
 
-        start_time = clock();        
         FILE* file = fopen(file_path, "r");
         
         if (!file)
@@ -76,53 +156,62 @@ int main(int argc, const char* argv[])
             fprintf(stderr, "failed to open: %s", file_path);
             return 2;
         }
-     
-        LispError error;
-        Lisp l = lisp_read_file(file, &error, ctx);
 
-        if (error != LISP_ERROR_NONE)
+        clock_t read_time = 0;
+        clock_t expand_time = 0;
+        clock_t eval_time = 0;
+
+        // read, expand and evaluate one form at a time,
+        // collecting in between.
+        LispReader* reader = lisp_reader_open(file);
+        while (1)
         {
-            fprintf(stderr, "%s\n", lisp_error_string(error));
-        }
+            LispError error;
+            start_time = now_(verbose);
+            Lisp l = lisp_reader_next(reader, &error, ctx);
+            end_time = now_(verbose);
+            read_time += end_time - start_time;
 
+            if (error != LISP_ERROR_NONE)
+            {
+                fprintf(stderr, "%s\n", lisp_error_string(error));
+                exit(1);
+            }
+            if (lisp_equal(l, lisp_eof())) break;
 
-        fclose(file);
-        end_time = clock();
+            start_time = now_(verbose);
+            Lisp code = compile ? lisp_compile(l, &error, ctx) : lisp_macroexpand(l, &error, ctx);
+            end_time = now_(verbose);
+            expand_time += end_time - start_time;
 
-        if (verbose)
-            printf("read (us): %lu\n", 1000000 * (end_time - start_time) / CLOCKS_PER_SEC);
+            if (error != LISP_ERROR_NONE)
+            {
+                fprintf(stderr, "%s\n", lisp_error_string(error));
+                exit(1);
+            }
 
-        start_time = clock();
+            start_time = now_(verbose); 
+            lisp_eval(code, &error, ctx);  
+            end_time = now_(verbose);
+            eval_time += end_time - start_time;
 
-        Lisp code = lisp_macroexpand(l, &error, ctx);
+            if (error != LISP_ERROR_NONE)
+            {
+                fprintf(stderr, "%s\n", lisp_error_string(error));
+                exit(1);
+            }
 
-        if (error != LISP_ERROR_NONE)
-        {
-            fprintf(stderr, "%s\n", lisp_error_string(error));
-            exit(1);
+            lisp_collect(lisp_null(), ctx);
         }
-
-
-        end_time = clock();
+        lisp_reader_close(reader);
+        fclose(file);
 
         if (verbose)
-            printf("expand (us): %lu\n", 1000000 * (end_time - start_time) / CLOCKS_PER_SEC);
-
-
-        start_time = clock(); 
-        lisp_eval(code, &error, ctx);  
-        end_time = clock();
-
-        if (error != LISP_ERROR_NONE)
         {
-            fprintf(stderr, "%s\n", lisp_error_string(error));
-            exit(1);
+            printf("read (us): %lu\n", 1000000 * read_time / CLOCKS_PER_SEC);
+            printf("expand (us): %lu\n", 1000000 * expand_time / CLOCKS_PER_SEC);
+            printf("eval (us): %lu\n", 1000000 * eval_time / CLOCKS_PER_SEC);
         }
-
-        lisp_collect(lisp_null(), ctx);
-
-        if (verbose)
-            printf("eval (us): %lu\n", 1000000 * (end_time - start_time) / CLOCKS_PER_SEC);
     }
 
     if (!run_script)
@@ -162,6 +251,13 @@ int main(int argc, const char* argv[])
        }
     }
 
+    if (profile)
+    {
+        FILE* stacks_file = profile_stacks_path ? fopen(profile_stacks_path, "w") : NULL;
+        lisp_profile_end(stderr, stacks_file, ctx);
+        if (stacks_file) fclose(stacks_file);
+    }
+
     lisp_shutdown(ctx);
 
     return 0;
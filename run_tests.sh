@@ -21,6 +21,36 @@ do
     printf "\n"
 done
 
+# again with the bytecode compiler, automatic collection and collector threads
+for FILE in *.scm
+do
+    ../../lisp --compile --auto-gc --gc-threads 4 --script "$FILE" > /dev/null
+    RESULT=$?
+
+    if [ $RESULT = "0" ]
+    then
+        echo "FINISHED $FILE (compiled)"
+    else
+        echo "*FAILED* $FILE (compiled)"
+        PASS=0
+    fi
+done
+
+# and under the profiler
+for FILE in *.scm
+do
+    ../../lisp --profile --script "$FILE" > /dev/null 2>&1
+    RESULT=$?
+
+    if [ $RESULT = "0" ]
+    then
+        echo "FINISHED $FILE (profiled)"
+    else
+        echo "*FAILED* $FILE (profiled)"
+        PASS=0
+    fi
+done
+
 cd ../
 cd data
 
@@ -49,6 +79,20 @@ else
     PASS=0
 fi
 
+cd ../
+cd api
+
+( ./test.sh )
+RESULT=$?
+
+if [ $RESULT = "0" ]
+then
+    echo "FINISHED api test"
+else
+    echo "*FAILED* api test"
+    PASS=0
+fi
+
 if [ $PASS = "0" ]
 then
   echo "**TESTS FAILED**"
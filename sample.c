@@ -48,6 +48,22 @@ int main(int argc, const char* argv[])
     lisp_print(result);
 
     if (e != LISP_ERROR_NONE) fprintf(stderr, "error: %s\n", lisp_error_string(e));
+    printf("\n");
+
+    // keep a procedure and a list of results across collections
+    LispHandle square = lisp_handle_new(lisp_eval(lisp_read("(lambda (x) (* x x))", &e, ctx), &e, ctx), ctx);
+    LispHandle squares = lisp_handle_new(lisp_null(), ctx);
+    for (int i = 0; i < 10; ++i)
+    {
+        Lisp x = lisp_make_int(i);
+        Lisp y = lisp_apply_argv(lisp_handle_get(square, ctx), 1, &x, &e, ctx);
+        lisp_handle_set(squares, lisp_cons(y, lisp_handle_get(squares, ctx), ctx), ctx);
+        lisp_collect(lisp_null(), ctx);
+    }
+    lisp_print(lisp_handle_get(squares, ctx));
+    printf("\n");
+    lisp_handle_free(square, ctx);
+    lisp_handle_free(squares, ctx);
 
     lisp_shutdown(ctx);
     return 0;
@@ -57,10 +57,6 @@
  (if (zero? k) x 
   (list-tail (cdr x) (- k 1)))) 
  
-(define (reduce op acc lst) 
-    (if (null? lst) acc 
-        (reduce op (op acc (car lst)) (cdr lst)))) 
-
 (define (_expand-shorthand-body path) 
   (if (null? path) (cons 'pair '()) 
       (list (if (char=? (car path) #\A) 
@@ -88,7 +84,7 @@
 (define (string>? a b) (string<? b a)) 
 (define (string<=? a b) (not (string<? b a))) 
 
-(define (string-copy s) (substring s 0 (string-length v)))
-(define (string-head s end) (subvector s 0 end)) 
-(define (string-tail s start) (subvector s start (string-length v))) 
+(define (string-copy s) (substring s 0 (string-length s)))
+(define (string-head s end) (substring s 0 end)) 
+(define (string-tail s start) (substring s start (string-length s))) 
  
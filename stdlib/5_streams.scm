@@ -9,6 +9,18 @@
       (_promise-store! promise ((_promise-procedure promise))))
   (promise-value promise))
 
+; a future runs on a worker thread if one is free,
+; otherwise it runs when it is touched.
+; Once it is finished its worker is given back when it is touched,
+; or when its context next starts a future or map.
+(define (future thunk)
+  (let ((slot (_future-start thunk)))
+    (if slot
+        (make-promise (lambda () (_future-wait slot)))
+        (make-promise thunk))))
+
+(define (touch future) (force future))
+
 (define-macro cons-stream (lambda (x expr) `(cons ,x (delay ,expr))))
 
 (define (stream-car stream) (car stream))
@@ -18,6 +30,7 @@
   (and (pair? x) (promise? (cdr x))))
 
 (define (stream-null? stream) (null? stream))
+(define the-empty-stream '())
 
 (define (stream->list-helper stream result)
   (if (stream-null? stream)
@@ -26,8 +39,6 @@
         (force (cdr stream)) 
         (cons (car stream) result)))) 
 
-(define (stream->list stream) 
-  (stream->list-helper stream '())) 
 
 (define (list->stream list) 
   (if (null? list) 
@@ -49,10 +60,48 @@
       stream 
       (stream-tail (stream-cdr stream) (- k 1)))) 
 
-(define (stream-filter pred stream) 
-  (cond ((stream-null? stream) the-empty-stream) 
-        ((pred (stream-car stream)) 
-         (cons-stream (stream-car stream) 
-                      (stream-filter pred 
-                                     (stream-cdr stream)))) 
+
+; These take streams or generators. Stages added to a generator
+; run together when it is folded, instead of making a stream for each.
+(define (stream-map proc stream)
+  (cond ((generator? stream) (_generator-stage 0 proc stream))
+        ((stream-null? stream) the-empty-stream)
+        (else (cons-stream (proc (stream-car stream))
+                           (stream-map proc (stream-cdr stream))))))
+
+(define (stream-filter pred stream)
+  (cond ((generator? stream) (_generator-stage 1 pred stream))
+        ((stream-null? stream) the-empty-stream)
+        ((pred (stream-car stream))
+         (cons-stream (stream-car stream)
+                      (stream-filter pred (stream-cdr stream))))
         (else (stream-filter pred (stream-cdr stream)))))
+
+(define (stream-take stream k)
+  (cond ((generator? stream) (_generator-stage 2 k stream))
+        ((or (= k 0) (stream-null? stream)) the-empty-stream)
+        (else (cons-stream (stream-car stream)
+                           (stream-take (stream-cdr stream) (- k 1))))))
+
+(define (stream-take-while pred stream)
+  (cond ((generator? stream) (_generator-stage 3 pred stream))
+        ((or (stream-null? stream) (not (pred (stream-car stream)))) the-empty-stream)
+        (else (cons-stream (stream-car stream)
+                           (stream-take-while pred (stream-cdr stream))))))
+
+; (op acc x) like reduce
+(define (stream-fold op acc stream)
+  (cond ((generator? stream) (_generator-run 0 op acc stream))
+        ((stream-null? stream) acc)
+        (else (stream-fold op (op acc (stream-car stream)) (stream-cdr stream)))))
+
+(define (stream-for-each proc stream)
+  (cond ((generator? stream) (_generator-run 1 proc '() stream))
+        ((stream-null? stream) '())
+        (else (proc (stream-car stream))
+              (stream-for-each proc (stream-cdr stream)))))
+
+(define (stream->list stream)
+  (if (generator? stream)
+      (_generator-run 2 '() '() stream)
+      (stream->list-helper stream '())))
@@ -1,6 +1,15 @@
 (define (procedure? p) (or (compiled-procedure? p) (compound-procedure? p))) 
  
-(define (newline) (write-char #\newline)) 
+(define (newline . port) (apply write-char (cons #\newline port)))
+
+; output from thunk is collected in a string.
+; An error inside resets the output port when evaluation unwinds.
+(define (with-output-to-string thunk)
+  (let* ((port (open-output-string))
+         (old (_set-output-port! port)))
+    (thunk)
+    (_set-output-port! old)
+    (get-output-string port)))
 
 (define-macro assert (lambda (body) 
                        `(if ,body '() 
@@ -1,5 +1,8 @@
 #!/bin/bash
 
+# usage: ./concat.sh [image.h]
+# The image (from image.c) is optional. Without it the library loads from source.
+
 SRC=*.scm
 
 cat lib.h
@@ -15,6 +18,11 @@ do
     echo ""
 done
 
+if [ -n "$1" ]
+then
+    cat $1
+fi
+
 cat lib.c
 
 echo "#endif"
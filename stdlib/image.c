@@ -0,0 +1,44 @@
+// Prints an image of the library as C source, for concat.sh.
+// It is built against the library without an image,
+// and only loads in builds with the same options.
+#include <stdio.h>
+#include <stdlib.h>
+
+#define LISP_IMPLEMENTATION
+#include "lisp.h"
+#include "lisp_lib_src.h"
+
+int main(int argc, const char* argv[])
+{
+    LispContext ctx = lisp_init_with_lib();
+    size_t size;
+    unsigned char* image = lisp_image_save(lisp_lib_funcs(), &size, ctx);
+    lisp_shutdown(ctx);
+    if (!image)
+    {
+        fprintf(stderr, "failed to save library image\n");
+        return 1;
+    }
+
+    // make sure it loads
+    ctx = lisp_init_image(image, size, lisp_lib_funcs());
+    if (!ctx.p)
+    {
+        fprintf(stderr, "failed to load library image\n");
+        return 1;
+    }
+    lisp_shutdown(ctx);
+
+    printf("// Generated image of the library (see lisp_image_save).\n");
+    printf("#define LISP_LIB_IMAGE_\n");
+    printf("static const unsigned char lib_image_[] = {\n");
+    for (size_t i = 0; i < size; ++i)
+    {
+        printf("%d,", image[i]);
+        if (i % 32 == 31) printf("\n");
+    }
+    printf("\n};\n\n");
+
+    free(image);
+    return 0;
+}
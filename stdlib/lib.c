@@ -6,6 +6,13 @@
 #include <math.h>
 #include <stdint.h>
 #include <assert.h>
+#include <time.h>
+
+#if !defined(LISP_NO_THREADS) && (defined(__unix__) || defined(__APPLE__))
+#define LISP_THREADS_
+#include <pthread.h>
+#include <unistd.h>
+#endif
 
 #define ARITY_CHECK(min_, max_) do { \
   int args_length_ = lisp_list_length(args); \
@@ -13,103 +20,146 @@
   if (args_length_ > max_) { *e = LISP_ERROR_TOO_MANY_ARGS; return lisp_null(); } \
 } while (0);
 
-static Lisp sch_cons(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_cons(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp y = lisp_car(args);
-    return lisp_cons(x, y, ctx);
+    return lisp_cons(argv[0], argv[1], ctx);
 }
 
-static Lisp sch_car(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_car(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_car(lisp_car(args));
+    return lisp_car(argv[0]);
 }
 
-static Lisp sch_cdr(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_cdr(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_cdr(lisp_car(args));
+    return lisp_cdr(argv[0]);
 }
 
-static Lisp sch_set_car(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_set_car(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    lisp_set_car(a, b);
+    lisp_set_car(argv[0], argv[1]);
     return lisp_null();
 }
 
-static Lisp sch_set_cdr(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_set_cdr(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    lisp_set_cdr(a, b);
+    lisp_set_cdr(argv[0], argv[1]);
     return lisp_null();
 }
 
-static Lisp sch_exact_eq(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_exact_eq(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    return lisp_make_bool(lisp_eq(a, b));
+    return lisp_make_bool(lisp_eq(argv[0], argv[1]));
 }
 
-static Lisp sch_equal(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_equal(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    return lisp_make_bool(lisp_equal(a, b));
+    return lisp_make_bool(lisp_equal(argv[0], argv[1]));
 }
 
-static Lisp sch_equal_r(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_equal_r(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp a = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp b = lisp_car(args);
-    return lisp_make_bool(lisp_equal_r(a, b));
+    return lisp_make_bool(lisp_equal_r(argv[0], argv[1]));
 }
 
-static Lisp sch_is_null(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_is_null(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_is_null(lisp_car(args)));
+    return lisp_make_bool(lisp_is_null(argv[0]));
 }
 
-static Lisp sch_is_pair(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_is_pair(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_PAIR);
+    return lisp_make_bool(lisp_type(argv[0]) == LISP_PAIR);
+}
+
+// Output goes to an explicit port argument, then the current output port,
+// and then stdout. Returns null and sets the error for a non port.
+static Lisp output_port_(Lisp args, LispError* e, LispContext ctx)
+{
+    if (lisp_is_pair(args))
+    {
+        Lisp port = lisp_car(args);
+        if (lisp_type(port) != LISP_PORT) *e = LISP_ERROR_ARG_TYPE;
+        return port;
+    }
+    return lisp_output_port(ctx);
 }
 
 static Lisp sch_write(Lisp args, LispError* e, LispContext ctx)
 {
-    lisp_printf(lisp_stdout(ctx), lisp_car(args));
+    ARITY_CHECK(1, 2);
+    Lisp port = output_port_(lisp_cdr(args), e, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+
+    if (lisp_is_null(port))
+        lisp_printf(lisp_stdout(ctx), lisp_car(args));
+    else
+        lisp_port_print(port, lisp_car(args), ctx);
     return lisp_null();
 }
 
 static Lisp sch_display(Lisp args, LispError* e, LispContext ctx)
 {
+    ARITY_CHECK(1, 2);
     Lisp x = lisp_car(args);
-    lisp_displayf(lisp_stdout(ctx), x);
+    Lisp port = output_port_(lisp_cdr(args), e, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+
+    if (lisp_is_null(port))
+        lisp_displayf(lisp_stdout(ctx), x);
+    else
+        lisp_port_display(port, x, ctx);
     return x;
 }
 
 static Lisp sch_write_char(Lisp args, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    fputc(lisp_char(lisp_car(args)), lisp_stdout(ctx));
+    ARITY_CHECK(1, 2);
+    Lisp port = output_port_(lisp_cdr(args), e, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+
+    char c = (char)lisp_char(lisp_car(args));
+    if (lisp_is_null(port))
+        fputc(c, lisp_stdout(ctx));
+    else
+        lisp_port_write(port, &c, 1, ctx);
     return lisp_false();
 }
 
+static Lisp sch_open_output_string(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(0, 0);
+    return lisp_make_string_port(ctx);
+}
+
+static Lisp sch_get_output_string(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    Lisp port = lisp_car(args);
+    if (lisp_type(port) != LISP_PORT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    return lisp_port_string(port, ctx);
+}
+
+// (_set-output-port! port) redirects output, returning the previous port.
+// Null restores stdout.
+static Lisp sch_set_output_port(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    Lisp port = lisp_car(args);
+    if (!lisp_is_null(port) && lisp_type(port) != LISP_PORT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp old = lisp_output_port(ctx);
+    lisp_set_output_port(port, ctx);
+    return old;
+}
+
 static Lisp sch_flush(Lisp args, LispError* e, LispContext ctx)
 {
     fflush(lisp_stdout(ctx)); return lisp_false();
@@ -120,6 +170,51 @@ static Lisp sch_read(Lisp args, LispError* e, LispContext ctx)
     return lisp_read_file(lisp_stdin(ctx), e, ctx);
 }
 
+static Lisp sch_read_shared(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_read_file_shared(lisp_stdin(ctx), e, ctx);
+}
+
+static Lisp sch_write_binary(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    lisp_write_binary(lisp_stdout(ctx), lisp_car(args), e, ctx);
+    return lisp_null();
+}
+
+// list of every datum in a file
+static Lisp sch_read_file(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_STRING)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    FILE* file = fopen(lisp_string(argv[0]), "r");
+    if (!file)
+    {
+        *e = LISP_ERROR_FILE_OPEN;
+        return lisp_null();
+    }
+
+    LispReader* reader = lisp_reader_open(file);
+    Lisp result = lisp_null();
+    while (1)
+    {
+        Lisp x = lisp_reader_next(reader, e, ctx);
+        if (*e != LISP_ERROR_NONE || lisp_equal(x, lisp_eof())) break;
+        result = lisp_cons(x, result, ctx);
+    }
+    lisp_reader_close(reader);
+    fclose(file);
+    return lisp_list_reverse(result);
+}
+
+static Lisp sch_read_binary(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_read_binary(lisp_stdin(ctx), e, ctx);
+}
+
 static Lisp sch_is_eof(Lisp args, LispError* e, LispContext ctx)
 {
     return lisp_make_bool(lisp_equal(lisp_car(args), lisp_eof()));
@@ -158,16 +253,12 @@ static Lisp sch_syntax_error(Lisp args, LispError* e, LispContext ctx)
     return lisp_null();
 }
 
-static Lisp sch_equals(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_equals(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp to_check  = lisp_car(args);
-    if (lisp_is_null(to_check)) return lisp_true();
-    args = lisp_cdr(args);
-
-    while (lisp_is_pair(args))
+    if (argc == 0 || lisp_is_null(argv[0])) return lisp_true();
+    for (int i = 1; i < argc; ++i)
     {
-        if (lisp_bool(lisp_car(args)) != lisp_bool(to_check)) return lisp_false();
-        args = lisp_cdr(args);
+        if (lisp_bool(argv[i]) != lisp_bool(argv[0])) return lisp_false();
     }
     return lisp_true();
 }
@@ -253,15 +344,14 @@ static Lisp sch_list_advance(Lisp args, LispError* e, LispContext ctx)
     return lisp_list_advance(x, lisp_int(count));
 }
 
-static Lisp sch_add(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_add(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
     LispInt exact = 0;
     LispReal inexact = 0; 
 
-    while (lisp_is_pair(args))
+    for (int i = 0; i < argc; ++i)
     {
-        Lisp x = lisp_car(args);
-        args = lisp_cdr(args);
+        Lisp x = argv[i];
         switch (lisp_type(x))
         {
             case LISP_INT:
@@ -281,15 +371,14 @@ static Lisp sch_add(Lisp args, LispError* e, LispContext ctx)
         : lisp_make_real(inexact + (LispReal)exact);
 }
 
-static Lisp sch_mult(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_mult(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
     LispInt exact = 1;
     LispReal inexact = 1; 
 
-    while (lisp_is_pair(args))
+    for (int i = 0; i < argc; ++i)
     {
-        Lisp x = lisp_car(args);
-        args = lisp_cdr(args);
+        Lisp x = argv[i];
         switch (lisp_type(x))
         {
             case LISP_INT:
@@ -309,21 +398,18 @@ static Lisp sch_mult(Lisp args, LispError* e, LispContext ctx)
         : lisp_make_real(inexact * (LispReal)exact);
 }
 
-static Lisp sch_sub(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_sub(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-
+    Lisp x = argv[0];
     Lisp y;
-    if (lisp_is_null(args))
+    if (argc == 1)
     {
         y = x;
         x = lisp_make_int(0);
     }
     else
     {
-        y = lisp_car(args);
+        y = argv[1];
     }
     switch (lisp_type(x))
     {
@@ -347,12 +433,10 @@ static Lisp sch_sub(Lisp args, LispError* e, LispContext ctx)
     }
 }
 
-static Lisp sch_divide(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_divide(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp y = lisp_car(args);
+    Lisp x = argv[0];
+    Lisp y = argv[1];
 
     switch (lisp_type(x))
     {
@@ -377,12 +461,10 @@ static Lisp sch_divide(Lisp args, LispError* e, LispContext ctx)
     }
 }
 
-static Lisp sch_less(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_less(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(2, 2);
-    Lisp x = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp y = lisp_car(args);
+    Lisp x = argv[0];
+    Lisp y = argv[1];
 
     switch (lisp_type(x))
     {
@@ -480,7 +562,7 @@ static Lisp sch_string_is_null(Lisp args, LispError* e, LispContext ctx)
 {
     ARITY_CHECK(1, 1);
     Lisp a = lisp_car(args);
-    return lisp_make_bool(lisp_string(a)[0] == '\0');
+    return lisp_make_bool(lisp_string_length(a) == 0);
 }
 
 static Lisp sch_make_string(Lisp args, LispError* e, LispContext ctx)
@@ -539,6 +621,11 @@ static Lisp sch_string_ref(Lisp args, LispError* e, LispContext ctx)
         *e = LISP_ERROR_ARG_TYPE;
         return lisp_null();
     }
+    if (lisp_int(index) < 0 || lisp_int(index) >= lisp_string_length(str))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
 
     return lisp_make_char((int)lisp_string_ref(str, lisp_int(index)));
 }
@@ -555,6 +642,11 @@ static Lisp sch_string_set(Lisp args, LispError* e, LispContext ctx)
         *e = LISP_ERROR_ARG_TYPE;
         return lisp_null();
     }
+    if (lisp_int(index) < 0 || lisp_int(index) >= lisp_string_length(str))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
 
     lisp_string_set(str, lisp_int(index), (char)lisp_int(val));
     return lisp_null();
@@ -587,7 +679,7 @@ static Lisp sch_string_append(Lisp args, LispError* e, LispContext ctx)
     while (lisp_is_pair(it))
     {
         Lisp x = lisp_car(it);
-        count += strlen(lisp_string(x));
+        count += lisp_string_length(x);
         it = lisp_cdr(it);
     }
 
@@ -598,7 +690,7 @@ static Lisp sch_string_append(Lisp args, LispError* e, LispContext ctx)
     while (lisp_is_pair(it))
     {
         Lisp x = lisp_car(it);
-        int n = (LispInt)strlen(lisp_string(x));
+        int n = lisp_string_length(x);
         memcpy(c, lisp_string(x), n);
         c += n;
         it = lisp_cdr(it);
@@ -608,14 +700,11 @@ static Lisp sch_string_append(Lisp args, LispError* e, LispContext ctx)
 
 static Lisp sch_string_to_list(Lisp args, LispError* e, LispContext ctx)
 {
-    const char* c = lisp_string(lisp_car(args));
+    Lisp s = lisp_car(args);
     Lisp tail = lisp_null();
-    while (*c)
-    {
-        tail = lisp_cons(lisp_make_char(*c), tail, ctx);
-        ++c;
-    }
-    return lisp_list_reverse(tail);
+    for (int i = lisp_string_length(s) - 1; i >= 0; --i)
+        tail = lisp_cons(lisp_make_char(lisp_string_ref(s, i)), tail, ctx);
+    return tail;
 }
 
 static Lisp sch_list_to_string(Lisp args, LispError* e, LispContext ctx)
@@ -637,7 +726,7 @@ static Lisp sch_string_to_number(Lisp args, LispError* e, LispContext ctx)
 {
     ARITY_CHECK(1, 1);
     const char* string = lisp_string(lisp_car(args));
-    if (strchr(string, '.'))
+    if (strchr(string, '.') || strchr(string, 'e') || strchr(string, 'E'))
     {
         return lisp_parse_real(string);
     }
@@ -650,23 +739,17 @@ static Lisp sch_string_to_number(Lisp args, LispError* e, LispContext ctx)
 static Lisp sch_number_to_string(Lisp args, LispError* e, LispContext ctx)
 {
     ARITY_CHECK(1, 1);
-    char scratch[64];
     Lisp val = lisp_car(args);
-    switch (lisp_type(val))
+    if (lisp_type(val) != LISP_REAL && lisp_type(val) != LISP_INT)
     {
-        case LISP_REAL:
-            snprintf(scratch, 64, "%f", lisp_real(val));
-            break;
-        case LISP_INT:
-            snprintf(scratch, 64, "%lli", lisp_int(val));
-            break;
-        default:
-        {
-            *e = LISP_ERROR_ARG_TYPE;
-            return lisp_null();
-        }
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
     }
-    return lisp_make_string2(scratch, ctx);
+    // same digits as the printer
+    char* text = lisp_print_to_buffer(val, NULL);
+    Lisp s = lisp_make_string2(text, ctx);
+    free(text);
+    return s;
 }
 
 static Lisp sch_char_less(Lisp args, LispError* e, LispContext ctx)
@@ -972,9 +1055,9 @@ static Lisp sch_vector_grow(Lisp args, LispError* e, LispContext ctx)
     return lisp_vector_grow(v, lisp_int(length), ctx);
 }
 
-static Lisp sch_vector_length(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_vector_length(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp v = lisp_car(args);
+    Lisp v = argv[0];
     if (lisp_type(v) != LISP_VECTOR)
     {
         *e = LISP_ERROR_ARG_TYPE;
@@ -984,10 +1067,10 @@ static Lisp sch_vector_length(Lisp args, LispError* e, LispContext ctx)
     return lisp_make_int(lisp_vector_length(v));
 }
 
-static Lisp sch_vector_ref(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_vector_ref(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp v = lisp_car(args);
-    Lisp i = lisp_car(lisp_cdr(args));
+    Lisp v = argv[0];
+    Lisp i = argv[1];
 
     if (lisp_type(v) != LISP_VECTOR || lisp_type(i) != LISP_INT)
     {
@@ -1004,11 +1087,11 @@ static Lisp sch_vector_ref(Lisp args, LispError* e, LispContext ctx)
     return lisp_vector_ref(v, lisp_int(i));
 }
 
-static Lisp sch_vector_set(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_vector_set(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    Lisp v = lisp_list_ref(args, 0);
-    Lisp i = lisp_list_ref(args, 1);
-    Lisp x = lisp_list_ref(args, 2);
+    Lisp v = argv[0];
+    Lisp i = argv[1];
+    Lisp x = argv[2];
 
     if (lisp_type(v) != LISP_VECTOR || lisp_type(i) != LISP_INT)
     {
@@ -1099,197 +1182,1894 @@ static Lisp sch_vector_to_list(Lisp args, LispError* e, LispContext ctx)
     return lisp_list_reverse(tail);
 }
 
-static Lisp sch_pseudo_seed(Lisp args, LispError* e, LispContext ctx)
+// NUMERIC VECTORS
+// Each f64vector and s64vector procedure is a wrapper which passes the type it expects.
+// The loops over data are kept simple so the compiler can vectorize them.
+
+static int numvector_length_(Lisp v)
 {
-    Lisp seed = lisp_car(args);
-    srand((unsigned int)lisp_int(seed));
-    return lisp_null();
+    return lisp_type(v) == LISP_F64VECTOR ? lisp_f64vector_length(v) : lisp_s64vector_length(v);
 }
 
-static Lisp sch_pseudo_rand(Lisp args, LispError* e, LispContext ctx)
+static Lisp make_numvector_(LispType type, int n, LispContext ctx)
 {
-    Lisp n = lisp_car(args);
-    return lisp_make_int(rand() % lisp_int(n));
+    return type == LISP_F64VECTOR ? lisp_make_f64vector(n, ctx) : lisp_make_s64vector(n, ctx);
 }
 
-static Lisp sch_univeral_time(Lisp args, LispError* e, LispContext ctx)
+// reals only go in an f64vector. ints go in either.
+static int numvector_accepts_(LispType type, Lisp x)
 {
-    return lisp_make_int((LispInt)time(NULL));
+    return lisp_type(x) == LISP_INT || (type == LISP_F64VECTOR && lisp_type(x) == LISP_REAL);
 }
 
-static Lisp sch_is_table(Lisp args, LispError* e, LispContext ctx)
+// elements are full 64 bit ints, but LISP_TAGGED ints are only 48 bits.
+// (arithmetic on s64vectors can make bigger ones.)
+// One which doesn't fit is an error instead of being truncated.
+static Lisp s64_to_int_(LispInt n, LispError* e)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_TABLE);
+    Lisp x = lisp_make_int(n);
+    if (lisp_int(x) != n) *e = LISP_ERROR_OUT_OF_BOUNDS;
+    return x;
 }
 
-static Lisp sch_table_make(Lisp args, LispError* e, LispContext ctx)
+static Lisp numvector_ref_(Lisp v, int i, LispError* e)
 {
-    return lisp_make_table(ctx);
+    if (lisp_type(v) == LISP_F64VECTOR) return lisp_make_real(lisp_f64vector(v)[i]);
+    return s64_to_int_(lisp_s64vector(v)[i], e);
 }
 
-static Lisp sch_table_get(Lisp args, LispError* e, LispContext ctx)
+static void numvector_set_(Lisp v, int i, Lisp x)
 {
-    ARITY_CHECK(2, 3);
-    Lisp table = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp key = lisp_car(args);
-    args = lisp_cdr(args);
-
-    Lisp def;
-    if (lisp_is_pair(args))
-    {
-        def = lisp_car(args);
-    }
+    if (lisp_type(v) == LISP_F64VECTOR)
+        lisp_f64vector(v)[i] = lisp_number_to_real(x);
     else
-    {
-        def = lisp_null();
-    }
-
-    int present;
-    Lisp result = lisp_table_get(table, key, &present);
-    return present ? result : def;
+        lisp_s64vector(v)[i] = lisp_int(x);
 }
 
-static Lisp sch_table_set(Lisp args, LispError* e, LispContext ctx)
+// the first n arguments must be vectors of the type and the same length.
+static int numvector_check_(int n, Lisp* argv, LispType type, LispError* e)
 {
-    ARITY_CHECK(3, 3);
-    Lisp table = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp key = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp x = lisp_car(args);
-    lisp_table_set(table, key, x, ctx);
-    return lisp_null();
+    for (int i = 0; i < n; ++i)
+    {
+        if (lisp_type(argv[i]) != type)
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return 0;
+        }
+        if (numvector_length_(argv[i]) != numvector_length_(argv[0]))
+        {
+            *e = LISP_ERROR_OUT_OF_BOUNDS;
+            return 0;
+        }
+    }
+    return 1;
 }
 
-static Lisp sch_table_size(Lisp args, LispError* e, LispContext ctx)
+// (index start end) arguments, from argv[first] onwards.
+static int numvector_range_(int argc, Lisp* argv, int first, int length, int* start, int* end, LispError* e)
 {
-    Lisp table = lisp_car(args);
-    return lisp_make_int(lisp_table_size(table));
+    *start = 0;
+    *end = length;
+    if (argc > first)
+    {
+        if (lisp_type(argv[first]) != LISP_INT) { *e = LISP_ERROR_ARG_TYPE; return 0; }
+        *start = (int)lisp_int(argv[first]);
+    }
+    if (argc > first + 1)
+    {
+        if (lisp_type(argv[first + 1]) != LISP_INT) { *e = LISP_ERROR_ARG_TYPE; return 0; }
+        *end = (int)lisp_int(argv[first + 1]);
+    }
+    if (*start < 0 || *start > *end || *end > length)
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return 0;
+    }
+    return 1;
 }
 
-static Lisp sch_table_to_alist(Lisp args, LispError* e, LispContext ctx)
+// Kernels.
+// s64 arithmetic wraps around instead of overflowing.
+// Sums keep several partial results, so they vectorize without -ffast-math.
+static void f64_add_(LispReal* out, const LispReal* a, const LispReal* b, int n)
 {
-    Lisp table = lisp_car(args);
-    return lisp_table_to_alist(table, ctx);
+    for (int i = 0; i < n; ++i) out[i] = a[i] + b[i];
 }
 
-static Lisp sch_is_promise(Lisp args, LispError* e, LispContext ctx)
+static void s64_add_(LispInt* out, const LispInt* a, const LispInt* b, int n)
 {
-  return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_PROMISE);
+    for (int i = 0; i < n; ++i) out[i] = (LispInt)((uint64_t)a[i] + (uint64_t)b[i]);
 }
 
-static Lisp sch_make_promise(Lisp args, LispError* e, LispContext ctx)
+static void f64_mul_(LispReal* out, const LispReal* a, const LispReal* b, int n)
 {
-    Lisp proc = lisp_car(args);
-    return lisp_make_promise(proc, ctx);
+    for (int i = 0; i < n; ++i) out[i] = a[i] * b[i];
 }
 
-static Lisp sch_promise_store(Lisp args, LispError* e, LispContext ctx)
+static void s64_mul_(LispInt* out, const LispInt* a, const LispInt* b, int n)
 {
-    Lisp promise = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp val = lisp_car(args);
-    lisp_promise_store(promise, val);
-    return lisp_null();
+    for (int i = 0; i < n; ++i) out[i] = (LispInt)((uint64_t)a[i] * (uint64_t)b[i]);
 }
 
-static Lisp sch_promise_proc(Lisp args, LispError* e, LispContext ctx)
+static void f64_scale_(LispReal* out, const LispReal* a, LispReal k, int n)
 {
-    return lisp_promise_proc(lisp_car(args));
+    for (int i = 0; i < n; ++i) out[i] = a[i] * k;
 }
 
-static Lisp sch_promise_val(Lisp args, LispError* e, LispContext ctx)
+static void s64_scale_(LispInt* out, const LispInt* a, LispInt k, int n)
 {
-    return lisp_promise_val(lisp_car(args));
+    for (int i = 0; i < n; ++i) out[i] = (LispInt)((uint64_t)a[i] * (uint64_t)k);
 }
 
-static Lisp sch_promise_forced(Lisp args, LispError* e, LispContext ctx)
+static LispReal f64_dot_(const LispReal* a, const LispReal* b, int n)
 {
-    return lisp_make_bool(lisp_promise_forced(lisp_car(args)));
+    LispReal s[4] = { 0.0, 0.0, 0.0, 0.0 };
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s[0] += a[i] * b[i];
+        s[1] += a[i + 1] * b[i + 1];
+        s[2] += a[i + 2] * b[i + 2];
+        s[3] += a[i + 3] * b[i + 3];
+    }
+    LispReal total = (s[0] + s[1]) + (s[2] + s[3]);
+    for (; i < n; ++i) total += a[i] * b[i];
+    return total;
 }
 
-static Lisp sch_apply(Lisp args, LispError* e, LispContext ctx)
+static LispInt s64_dot_(const LispInt* a, const LispInt* b, int n)
 {
-    Lisp operator = lisp_car(args);
-    args = lisp_cdr(args);
-    Lisp op_args = lisp_car(args);
-    return lisp_apply(operator, op_args, e, ctx);
+    uint64_t total = 0;
+    for (int i = 0; i < n; ++i) total += (uint64_t)a[i] * (uint64_t)b[i];
+    return (LispInt)total;
 }
 
-static Lisp sch_is_lambda(Lisp args, LispError* e, LispContext ctx)
+static LispReal f64_sum_(const LispReal* a, int n)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_LAMBDA);
+    LispReal s[4] = { 0.0, 0.0, 0.0, 0.0 };
+    int i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        s[0] += a[i];
+        s[1] += a[i + 1];
+        s[2] += a[i + 2];
+        s[3] += a[i + 3];
+    }
+    LispReal total = (s[0] + s[1]) + (s[2] + s[3]);
+    for (; i < n; ++i) total += a[i];
+    return total;
 }
 
-static Lisp sch_lambda_env(Lisp args, LispError* e, LispContext ctx)
+static LispInt s64_sum_(const LispInt* a, int n)
 {
-    return lisp_lambda_env(lisp_car(args));
+    uint64_t total = 0;
+    for (int i = 0; i < n; ++i) total += (uint64_t)a[i];
+    return (LispInt)total;
 }
 
-static Lisp sch_is_func(Lisp args, LispError* e, LispContext ctx)
+// n > 0. the maximum instead if max is set.
+static LispReal f64_min_(const LispReal* a, int n, int max)
 {
-    ARITY_CHECK(1, 1);
-    int type = lisp_type(lisp_car(args));
-    return lisp_make_bool(type == LISP_FUNC);
+    LispReal m = a[0];
+    if (max)
+    {
+        for (int i = 1; i < n; ++i) m = a[i] > m ? a[i] : m;
+    }
+    else
+    {
+        for (int i = 1; i < n; ++i) m = a[i] < m ? a[i] : m;
+    }
+    return m;
 }
 
-static Lisp sch_lambda_body(Lisp args, LispError* e, LispContext ctx)
+static LispInt s64_min_(const LispInt* a, int n, int max)
 {
-    return lisp_lambda_body(lisp_car(args));
+    LispInt m = a[0];
+    if (max)
+    {
+        for (int i = 1; i < n; ++i) m = a[i] > m ? a[i] : m;
+    }
+    else
+    {
+        for (int i = 1; i < n; ++i) m = a[i] < m ? a[i] : m;
+    }
+    return m;
 }
 
-static Lisp sch_macroexpand(Lisp args, LispError* e, LispContext ctx)
+static int f64_compare_(const void* a, const void* b)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_macroexpand(lisp_car(args), e, ctx);
+    LispReal x = *(const LispReal*)a;
+    LispReal y = *(const LispReal*)b;
+    return (x > y) - (x < y);
 }
 
-static Lisp sch_eval(Lisp args, LispError* e, LispContext ctx)
+static int s64_compare_(const void* a, const void* b)
 {
-    ARITY_CHECK(2, 2);
-    return lisp_eval2(lisp_car(args), lisp_car(lisp_cdr(args)), e, ctx);
+    LispInt x = *(const LispInt*)a;
+    LispInt y = *(const LispInt*)b;
+    return (x > y) - (x < y);
 }
 
-static Lisp sch_system_env(Lisp args, LispError* e, LispContext ctx)
+static Lisp numvector_make(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
 {
-    return lisp_cdr(lisp_env(ctx));
-}
+    if (lisp_type(argv[0]) != LISP_INT || (argc > 1 && !numvector_accepts_(type, argv[1])))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispInt n = lisp_int(argv[0]);
+    if (n < 0 || n > INT32_MAX)
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+
+    Lisp v = make_numvector_(type, (int)n, ctx);
+    if (type == LISP_F64VECTOR)
+    {
+        LispReal x = argc > 1 ? lisp_number_to_real(argv[1]) : 0.0;
+        LispReal* data = lisp_f64vector(v);
+        for (int i = 0; i < n; ++i) data[i] = x;
+    }
+    else
+    {
+        LispInt x = argc > 1 ? lisp_int(argv[1]) : 0;
+        LispInt* data = lisp_s64vector(v);
+        for (int i = 0; i < n; ++i) data[i] = x;
+    }
+    return v;
+}
+
+static Lisp numvector_new(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    for (int i = 0; i < argc; ++i)
+    {
+        if (!numvector_accepts_(type, argv[i]))
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+        }
+    }
+    Lisp v = make_numvector_(type, argc, ctx);
+    for (int i = 0; i < argc; ++i) numvector_set_(v, i, argv[i]);
+    return v;
+}
+
+static Lisp numvector_is(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    return lisp_make_bool(lisp_type(argv[0]) == type);
+}
+
+static Lisp numvector_length(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    return lisp_make_int(numvector_length_(argv[0]));
+}
+
+static Lisp numvector_ref(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (lisp_type(argv[1]) != LISP_INT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispInt i = lisp_int(argv[1]);
+    if (i < 0 || i >= numvector_length_(argv[0]))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+    Lisp x = numvector_ref_(argv[0], (int)i, e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_set(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (lisp_type(argv[1]) != LISP_INT || !numvector_accepts_(type, argv[2]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispInt i = lisp_int(argv[1]);
+    if (i < 0 || i >= numvector_length_(argv[0]))
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+    numvector_set_(argv[0], (int)i, argv[2]);
+    return lisp_null();
+}
+
+static Lisp numvector_to_list(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    Lisp tail = lisp_null();
+    for (int i = numvector_length_(argv[0]) - 1; i >= 0; --i)
+    {
+        tail = lisp_cons(numvector_ref_(argv[0], i, e), tail, ctx);
+        if (*e != LISP_ERROR_NONE) return lisp_null();
+    }
+    return tail;
+}
+
+static Lisp numvector_from_list(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    int n = 0;
+    for (Lisp l = argv[0]; !lisp_is_null(l); l = lisp_cdr(l), ++n)
+    {
+        if (!lisp_is_pair(l) || !numvector_accepts_(type, lisp_car(l)))
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+        }
+    }
+
+    Lisp v = make_numvector_(type, n, ctx);
+    Lisp l = argv[0];
+    for (int i = 0; i < n; ++i, l = lisp_cdr(l))
+        numvector_set_(v, i, lisp_car(l));
+    return v;
+}
+
+static Lisp numvector_to_vector(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    Lisp v = lisp_make_vector(n, ctx);
+    for (int i = 0; i < n; ++i)
+    {
+        lisp_vector_set(v, i, numvector_ref_(argv[0], i, e));
+        if (*e != LISP_ERROR_NONE) return lisp_null();
+    }
+    return v;
+}
+
+static Lisp numvector_from_vector(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int n = lisp_vector_length(argv[0]);
+    for (int i = 0; i < n; ++i)
+    {
+        if (!numvector_accepts_(type, lisp_vector_ref(argv[0], i)))
+        {
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+        }
+    }
+
+    Lisp v = make_numvector_(type, n, ctx);
+    for (int i = 0; i < n; ++i) numvector_set_(v, i, lisp_vector_ref(argv[0], i));
+    return v;
+}
+
+static Lisp numvector_copy(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int start, end;
+    if (!numvector_range_(argc, argv, 1, numvector_length_(argv[0]), &start, &end, e)) return lisp_null();
+
+    Lisp v = make_numvector_(type, end - start, ctx);
+    // both element types are 8 bytes.
+    if (type == LISP_F64VECTOR)
+        memcpy(lisp_f64vector(v), lisp_f64vector(argv[0]) + start, sizeof(LispReal) * (end - start));
+    else
+        memcpy(lisp_s64vector(v), lisp_s64vector(argv[0]) + start, sizeof(LispInt) * (end - start));
+    return v;
+}
+
+static Lisp numvector_fill(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (!numvector_accepts_(type, argv[1]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int start, end;
+    if (!numvector_range_(argc, argv, 2, numvector_length_(argv[0]), &start, &end, e)) return lisp_null();
+
+    if (type == LISP_F64VECTOR)
+    {
+        LispReal x = lisp_number_to_real(argv[1]);
+        LispReal* data = lisp_f64vector(argv[0]);
+        for (int i = start; i < end; ++i) data[i] = x;
+    }
+    else
+    {
+        LispInt x = lisp_int(argv[1]);
+        LispInt* data = lisp_s64vector(argv[0]);
+        for (int i = start; i < end; ++i) data[i] = x;
+    }
+    return lisp_null();
+}
+
+static Lisp numvector_add(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(2, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    Lisp v = make_numvector_(type, n, ctx);
+    if (type == LISP_F64VECTOR)
+        f64_add_(lisp_f64vector(v), lisp_f64vector(argv[0]), lisp_f64vector(argv[1]), n);
+    else
+        s64_add_(lisp_s64vector(v), lisp_s64vector(argv[0]), lisp_s64vector(argv[1]), n);
+    return v;
+}
+
+static Lisp numvector_mul(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(2, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    Lisp v = make_numvector_(type, n, ctx);
+    if (type == LISP_F64VECTOR)
+        f64_mul_(lisp_f64vector(v), lisp_f64vector(argv[0]), lisp_f64vector(argv[1]), n);
+    else
+        s64_mul_(lisp_s64vector(v), lisp_s64vector(argv[0]), lisp_s64vector(argv[1]), n);
+    return v;
+}
+
+static Lisp numvector_scale(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    if (!numvector_accepts_(type, argv[1]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int n = numvector_length_(argv[0]);
+    Lisp v = make_numvector_(type, n, ctx);
+    if (type == LISP_F64VECTOR)
+        f64_scale_(lisp_f64vector(v), lisp_f64vector(argv[0]), lisp_number_to_real(argv[1]), n);
+    else
+        s64_scale_(lisp_s64vector(v), lisp_s64vector(argv[0]), lisp_int(argv[1]), n);
+    return v;
+}
+
+static Lisp numvector_sum(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (type == LISP_F64VECTOR) return lisp_make_real(f64_sum_(lisp_f64vector(argv[0]), n));
+    Lisp x = s64_to_int_(s64_sum_(lisp_s64vector(argv[0]), n), e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_dot(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(2, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (type == LISP_F64VECTOR) return lisp_make_real(f64_dot_(lisp_f64vector(argv[0]), lisp_f64vector(argv[1]), n));
+    Lisp x = s64_to_int_(s64_dot_(lisp_s64vector(argv[0]), lisp_s64vector(argv[1]), n), e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_extreme_(int argc, Lisp* argv, LispType type, int max, LispError* e)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (n == 0)
+    {
+        *e = LISP_ERROR_OUT_OF_BOUNDS;
+        return lisp_null();
+    }
+    if (type == LISP_F64VECTOR) return lisp_make_real(f64_min_(lisp_f64vector(argv[0]), n, max));
+    Lisp x = s64_to_int_(s64_min_(lisp_s64vector(argv[0]), n, max), e);
+    return *e == LISP_ERROR_NONE ? x : lisp_null();
+}
+
+static Lisp numvector_min(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    return numvector_extreme_(argc, argv, type, 0, e);
+}
+
+static Lisp numvector_max(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    return numvector_extreme_(argc, argv, type, 1, e);
+}
+
+static Lisp numvector_sort(int argc, Lisp* argv, LispType type, LispError* e, LispContext ctx)
+{
+    if (!numvector_check_(1, argv, type, e)) return lisp_null();
+    int n = numvector_length_(argv[0]);
+    if (type == LISP_F64VECTOR)
+        qsort(lisp_f64vector(argv[0]), n, sizeof(LispReal), f64_compare_);
+    else
+        qsort(lisp_s64vector(argv[0]), n, sizeof(LispInt), s64_compare_);
+    return argv[0];
+}
+
+#define NUMVECTOR_FUNC_(name) \
+static Lisp sch_f64vector_##name(int argc, Lisp* argv, LispError* e, LispContext ctx) { return numvector_##name(argc, argv, LISP_F64VECTOR, e, ctx); } \
+static Lisp sch_s64vector_##name(int argc, Lisp* argv, LispError* e, LispContext ctx) { return numvector_##name(argc, argv, LISP_S64VECTOR, e, ctx); }
+
+NUMVECTOR_FUNC_(make)
+NUMVECTOR_FUNC_(new)
+NUMVECTOR_FUNC_(is)
+NUMVECTOR_FUNC_(length)
+NUMVECTOR_FUNC_(ref)
+NUMVECTOR_FUNC_(set)
+NUMVECTOR_FUNC_(to_list)
+NUMVECTOR_FUNC_(from_list)
+NUMVECTOR_FUNC_(to_vector)
+NUMVECTOR_FUNC_(from_vector)
+NUMVECTOR_FUNC_(copy)
+NUMVECTOR_FUNC_(fill)
+NUMVECTOR_FUNC_(add)
+NUMVECTOR_FUNC_(mul)
+NUMVECTOR_FUNC_(scale)
+NUMVECTOR_FUNC_(sum)
+NUMVECTOR_FUNC_(dot)
+NUMVECTOR_FUNC_(min)
+NUMVECTOR_FUNC_(max)
+NUMVECTOR_FUNC_(sort)
+
+#undef NUMVECTOR_FUNC_
+
+static Lisp sch_pseudo_seed(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp seed = lisp_car(args);
+    lisp_seed_random((uint64_t)lisp_int(seed), ctx);
+    return lisp_null();
+}
+
+static Lisp sch_pseudo_rand(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp n = lisp_car(args);
+    return lisp_make_int((LispInt)(lisp_random(ctx) % (uint64_t)lisp_int(n)));
+}
+
+static Lisp sch_univeral_time(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_int((LispInt)time(NULL));
+}
+
+// milliseconds from an arbitrary point (a monotonic clock where there is one).
+static Lisp sch_real_time(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+#if defined(__unix__) || defined(__APPLE__)
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return lisp_make_real((LispReal)t.tv_sec * 1000.0 + (LispReal)t.tv_nsec / 1000000.0);
+#else
+    return lisp_make_real(1000.0 * (LispReal)clock() / CLOCKS_PER_SEC);
+#endif
+}
+
+// processor time in seconds
+static Lisp sch_runtime(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    return lisp_make_real((LispReal)clock() / CLOCKS_PER_SEC);
+}
+
+static Lisp sch_is_table(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_TABLE);
+}
+
+static Lisp sch_table_make(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_table(ctx);
+}
+
+static Lisp sch_equal_table_make(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_equal_table(ctx);
+}
+
+static Lisp sch_table_get(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(2, 3);
+    Lisp table = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp key = lisp_car(args);
+    args = lisp_cdr(args);
+
+    Lisp def;
+    if (lisp_is_pair(args))
+    {
+        def = lisp_car(args);
+    }
+    else
+    {
+        def = lisp_null();
+    }
+
+    int present;
+    Lisp result = lisp_table_get(table, key, &present);
+    return present ? result : def;
+}
+
+static Lisp sch_table_set(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(3, 3);
+    Lisp table = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp key = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp x = lisp_car(args);
+    lisp_table_set(table, key, x, ctx);
+    return lisp_null();
+}
+
+static Lisp sch_table_size(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp table = lisp_car(args);
+    return lisp_make_int(lisp_table_size(table));
+}
+
+static Lisp sch_table_to_alist(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp table = lisp_car(args);
+    return lisp_table_to_alist(table, ctx);
+}
+
+static Lisp sch_is_promise(Lisp args, LispError* e, LispContext ctx)
+{
+  return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_PROMISE);
+}
+
+static Lisp sch_make_promise(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp proc = lisp_car(args);
+    return lisp_make_promise(proc, ctx);
+}
+
+static Lisp sch_promise_store(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp promise = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp val = lisp_car(args);
+    lisp_promise_store(promise, val);
+    return lisp_null();
+}
+
+static Lisp sch_promise_proc(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_promise_proc(lisp_car(args));
+}
+
+static Lisp sch_promise_val(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_promise_val(lisp_car(args));
+}
+
+static Lisp sch_promise_forced(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_make_bool(lisp_promise_forced(lisp_car(args)));
+}
+
+static Lisp sch_apply(Lisp args, LispError* e, LispContext ctx)
+{
+    Lisp operator = lisp_car(args);
+    args = lisp_cdr(args);
+    Lisp op_args = lisp_car(args);
+    return lisp_apply(operator, op_args, e, ctx);
+}
+
+static Lisp sch_is_lambda(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_LAMBDA);
+}
+
+static Lisp sch_lambda_env(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_lambda_env(lisp_car(args));
+}
+
+static Lisp sch_is_func(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    int type = lisp_type(lisp_car(args));
+    return lisp_make_bool(type == LISP_FUNC || type == LISP_FUNC_N);
+}
+
+static Lisp sch_lambda_body(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_lambda_body(lisp_car(args));
+}
+
+static Lisp sch_macroexpand(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_macroexpand(lisp_car(args), e, ctx);
+}
+
+static Lisp sch_compile(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_compile(lisp_car(args), e, ctx);
+}
+
+static Lisp sch_eval(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(2, 2);
+    return lisp_eval_cached(lisp_car(args), lisp_car(lisp_cdr(args)), e, ctx);
+}
+
+static Lisp sch_system_env(Lisp args, LispError* e, LispContext ctx)
+{
+    return lisp_cdr(lisp_env(ctx));
+}
 
 static Lisp sch_user_env(Lisp args, LispError* e, LispContext ctx)
 {
-    return lisp_env(ctx);
+    return lisp_env(ctx);
+}
+
+// (gc-flip [full])
+static Lisp sch_gc_flip(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(0, 1);
+    if (lisp_is_pair(args) && lisp_is_true(lisp_car(args))) lisp_collect_full(lisp_null(), ctx);
+    else lisp_collect(lisp_null(), ctx);
+    return lisp_false();
+}
+
+// (name . n) for each type with a nonzero count
+static Lisp gc_type_alist_(const size_t* counts, LispContext ctx)
+{
+    Lisp result = lisp_null();
+    for (int i = LISP_TYPE_COUNT - 1; i >= 0; --i)
+    {
+        if (counts[i] == 0) continue;
+        Lisp name = lisp_make_symbol(lisp_type_name((LispType)i), ctx);
+        result = lisp_cons(lisp_cons(name, lisp_make_int((LispInt)counts[i]), ctx), result, ctx);
+    }
+    return result;
+}
+
+static Lisp gc_stat_(const char* name, Lisp x, Lisp rest, LispContext ctx)
+{
+    return lisp_cons(lisp_cons(lisp_make_symbol(name, ctx), x, ctx), rest, ctx);
+}
+
+static Lisp sch_gc_statistics(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    LispGCStats stats = lisp_gc_stats(ctx);
+
+    Lisp histogram = lisp_make_vector(LISP_GC_PAUSE_BUCKETS, ctx);
+    for (int i = 0; i < LISP_GC_PAUSE_BUCKETS; ++i)
+        lisp_vector_set(histogram, i, lisp_make_int((LispInt)stats.pause_histogram[i]));
+
+    Lisp result = lisp_null();
+    result = gc_stat_("PAGES-POOLED", lisp_make_int((LispInt)stats.pages_pooled), result, ctx);
+    result = gc_stat_("PAGES-REUSED", lisp_make_int((LispInt)stats.pages_reused), result, ctx);
+    result = gc_stat_("LIVE-BYTES", gc_type_alist_(stats.live_bytes, ctx), result, ctx);
+    result = gc_stat_("LIVE-COUNTS", gc_type_alist_(stats.live_count, ctx), result, ctx);
+    result = gc_stat_("BYTES-ALLOCATED", gc_type_alist_(stats.bytes_allocated, ctx), result, ctx);
+    result = gc_stat_("ALLOCATIONS", gc_type_alist_(stats.allocations, ctx), result, ctx);
+    result = gc_stat_("BYTES-COPIED", lisp_make_int((LispInt)stats.bytes_copied), result, ctx);
+    result = gc_stat_("PAUSE-HISTOGRAM", histogram, result, ctx);
+    result = gc_stat_("PAUSE-MAX-US", lisp_make_int((LispInt)stats.pause_max_us), result, ctx);
+    result = gc_stat_("PAUSE-TOTAL-US", lisp_make_int((LispInt)stats.pause_total_us), result, ctx);
+    result = gc_stat_("FULL-COLLECTIONS", lisp_make_int((LispInt)stats.full_collections), result, ctx);
+    result = gc_stat_("COLLECTIONS", lisp_make_int((LispInt)stats.collections), result, ctx);
+    return result;
+}
+
+static Lisp sch_print_gc_stats(Lisp args, LispError* e, LispContext ctx)
+{
+    lisp_print_collect_stats(ctx);
+    return lisp_false();
+}
+
+static Lisp sch_call_cc(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_call_cc(lisp_car(args), e, ctx);
+}
+
+static Lisp sch_is_cont(Lisp args, LispError* e, LispContext ctx)
+{
+    ARITY_CHECK(1, 1);
+    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_JUMP);
+}
+
+// SEQUENCES
+// Native versions of the procedures programs call most.
+// Anything which calls a procedure keeps its values in roots (see lisp_push_root),
+// and reads them again after each call, since the collector may move them.
+
+// Builtin predicates which never evaluate or allocate are called directly.
+static LispCFuncN builtin_predicate_(Lisp proc)
+{
+    if (lisp_type(proc) != LISP_FUNC_N) return NULL;
+    LispCFuncN f = lisp_func_n(proc);
+    if (f == sch_less || f == sch_equals || f == sch_exact_eq || f == sch_equal || f == sch_equal_r) return f;
+    return NULL;
+}
+
+// argv must be roots, unless direct is set.
+static Lisp seq_call_(Lisp proc, LispCFuncN direct, int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (direct) return direct(argc, argv, e, ctx);
+    return lisp_apply_argv(proc, argc, argv, e, ctx);
+}
+
+// (map proc list ...) and (for-each proc list ...) stop at the end of the shortest list.
+static Lisp seq_map_(int argc, Lisp* argv, int keep, LispError* e, LispContext ctx)
+{
+    int n = argc - 1;
+    // proc, results (reversed), the lists left, then the arguments of a call.
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(lisp_null(), ctx);
+    for (int i = 0; i < n; ++i) lisp_push_root(argv[i + 1], ctx);
+    for (int i = 0; i < n; ++i) lisp_push_root(lisp_null(), ctx);
+    Lisp* lists = roots + 2;
+    Lisp* args = lists + n;
+
+    while (*e == LISP_ERROR_NONE)
+    {
+        int i;
+        for (i = 0; i < n && lisp_is_pair(lists[i]); ++i)
+        {
+            args[i] = lisp_car(lists[i]);
+            lists[i] = lisp_cdr(lists[i]);
+        }
+        if (i < n) break;
+
+        Lisp x = lisp_apply_argv(roots[0], n, args, e, ctx);
+        if (keep) roots[1] = lisp_cons(x, roots[1], ctx);
+    }
+
+    Lisp result = roots[1];
+    lisp_pop_roots(2 + 2 * n, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    return lisp_list_reverse(result);
+}
+
+static Lisp sch_map(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    return seq_map_(argc, argv, 1, e, ctx);
+}
+
+static Lisp sch_for_each(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    seq_map_(argc, argv, 0, e, ctx);
+    return lisp_null();
+}
+
+// (filter pred list) keeps the order.
+static Lisp sch_filter(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    LispCFuncN direct = builtin_predicate_(argv[0]);
+    // pred, list left, results (reversed), argument
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(lisp_null(), ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    while (lisp_is_pair(roots[1]) && *e == LISP_ERROR_NONE)
+    {
+        roots[3] = lisp_car(roots[1]);
+        roots[1] = lisp_cdr(roots[1]);
+        if (lisp_is_true(seq_call_(roots[0], direct, 1, roots + 3, e, ctx)))
+        {
+            roots[2] = lisp_cons(roots[3], roots[2], ctx);
+        }
+    }
+
+    Lisp result = roots[2];
+    lisp_pop_roots(4, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    return lisp_list_reverse(result);
+}
+
+// (reduce op acc list) calls (op acc x) from the left.
+static Lisp sch_reduce(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    // op, list left, then acc and x, the arguments of a call.
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[2], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    while (lisp_is_pair(roots[1]) && *e == LISP_ERROR_NONE)
+    {
+        roots[3] = lisp_car(roots[1]);
+        roots[1] = lisp_cdr(roots[1]);
+        Lisp acc = lisp_apply_argv(roots[0], 2, roots + 2, e, ctx);
+        roots[2] = acc;
+    }
+
+    Lisp result = roots[2];
+    lisp_pop_roots(4, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// equality of assq, assv, assoc etc.
+enum { SEQ_EQ = 0, SEQ_EQV, SEQ_EQUAL };
+
+static int seq_same_(Lisp a, Lisp b, int kind)
+{
+    switch (kind)
+    {
+        case SEQ_EQ: return lisp_eq(a, b);
+        case SEQ_EQV: return lisp_equal(a, b);
+        default: return lisp_equal_r(a, b);
+    }
+}
+
+// the first pair in an alist whose car is key, skipping entries which aren't pairs.
+static Lisp seq_assoc_(Lisp key, Lisp l, int kind)
+{
+    for (; lisp_is_pair(l); l = lisp_cdr(l))
+    {
+        Lisp entry = lisp_car(l);
+        if (lisp_is_pair(entry) && seq_same_(key, lisp_car(entry), kind)) return entry;
+    }
+    return lisp_false();
+}
+
+// the tail of the list starting with x.
+static Lisp seq_member_(Lisp x, Lisp l, int kind)
+{
+    for (; lisp_is_pair(l); l = lisp_cdr(l))
+    {
+        if (seq_same_(x, lisp_car(l), kind)) return l;
+    }
+    return lisp_false();
+}
+
+static Lisp sch_assq(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_assoc_(argv[0], argv[1], SEQ_EQ); }
+static Lisp sch_assv(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_assoc_(argv[0], argv[1], SEQ_EQV); }
+static Lisp sch_assoc(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_assoc_(argv[0], argv[1], SEQ_EQUAL); }
+static Lisp sch_memq(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_member_(argv[0], argv[1], SEQ_EQ); }
+static Lisp sch_memv(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_member_(argv[0], argv[1], SEQ_EQV); }
+static Lisp sch_member(int argc, Lisp* argv, LispError* e, LispContext ctx) { return seq_member_(argv[0], argv[1], SEQ_EQUAL); }
+
+static Lisp sch_vector_map(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[1]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int n = lisp_vector_length(argv[1]);
+    Lisp result = lisp_make_vector(n, ctx);
+    lisp_vector_fill(result, lisp_null());
+
+    // fn, input, result, argument
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(result, ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    for (int i = 0; i < n && *e == LISP_ERROR_NONE; ++i)
+    {
+        roots[3] = lisp_vector_ref(roots[1], i);
+        Lisp x = lisp_apply_argv(roots[0], 1, roots + 3, e, ctx);
+        lisp_vector_set(roots[2], i, x);
+    }
+
+    result = roots[2];
+    lisp_pop_roots(4, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// (vector-binary-search v key< unwrap-key key) of a vector sorted by key<.
+// Returns the element whose key is neither less nor greater than key, or #f.
+static Lisp sch_vector_binary_search(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    LispCFuncN direct = builtin_predicate_(argv[1]);
+    // v, key<, unwrap-key, key, then the arguments of a comparison.
+    Lisp* roots = lisp_push_root(argv[0], ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(argv[2], ctx);
+    lisp_push_root(argv[3], ctx);
+    lisp_push_root(lisp_null(), ctx);
+    lisp_push_root(lisp_null(), ctx);
+    Lisp* args = roots + 4;
+
+    // the first index whose key isn't less than key.
+    int lo = 0;
+    int hi = lisp_vector_length(roots[0]);
+    while (lo < hi && *e == LISP_ERROR_NONE)
+    {
+        int mid = lo + (hi - lo) / 2;
+        args[1] = lisp_vector_ref(roots[0], mid);
+        Lisp k = lisp_apply_argv(roots[2], 1, args + 1, e, ctx);
+        args[0] = k;
+        args[1] = roots[3];
+        if (lisp_is_true(seq_call_(roots[1], direct, 2, args, e, ctx))) lo = mid + 1; else hi = mid;
+    }
+
+    Lisp result = lisp_false();
+    if (lo < lisp_vector_length(roots[0]) && *e == LISP_ERROR_NONE)
+    {
+        args[1] = lisp_vector_ref(roots[0], lo);
+        Lisp k = lisp_apply_argv(roots[2], 1, args + 1, e, ctx);
+        args[1] = k;
+        args[0] = roots[3];
+        if (!lisp_is_true(seq_call_(roots[1], direct, 2, args, e, ctx))) result = lisp_vector_ref(roots[0], lo);
+    }
+
+    lisp_pop_roots(6, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// Sorting is a stable bottom up merge sort, back and forth between two copies,
+// so the vector is left as it was if a comparison fails.
+enum
+{
+    SORT_LESS = 0,
+    SORT_VECTOR,
+    SORT_FROM,
+    SORT_TO,
+    SORT_A, // these two are the arguments to a comparison
+    SORT_B,
+    SORT_ROOT_COUNT
+};
+
+static int sort_less_(Lisp* roots, LispCFuncN direct, int i, int j, LispError* e, LispContext ctx)
+{
+    roots[SORT_A] = lisp_vector_ref(roots[SORT_FROM], i);
+    roots[SORT_B] = lisp_vector_ref(roots[SORT_FROM], j);
+    return lisp_is_true(seq_call_(roots[SORT_LESS], direct, 2, roots + SORT_A, e, ctx));
+}
+
+// sorts v in place with less.
+static void seq_sort_(Lisp v, Lisp less, LispError* e, LispContext ctx)
+{
+    int n = lisp_vector_length(v);
+    if (n < 2) return;
+
+    LispCFuncN direct = builtin_predicate_(less);
+    Lisp* roots = lisp_push_root(less, ctx);
+    lisp_push_root(v, ctx);
+    lisp_push_root(lisp_subvector(v, 0, n, ctx), ctx);
+    lisp_push_root(lisp_subvector(v, 0, n, ctx), ctx);
+    lisp_push_root(lisp_null(), ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    for (int width = 1; width < n && *e == LISP_ERROR_NONE; width *= 2)
+    {
+        for (int lo = 0; lo < n && *e == LISP_ERROR_NONE; lo += 2 * width)
+        {
+            int mid = lo + width < n ? lo + width : n;
+            int hi = lo + 2 * width < n ? lo + 2 * width : n;
+            int i = lo, j = mid, k = lo;
+            while (i < mid && j < hi)
+            {
+                // equal elements keep their order
+                int right = sort_less_(roots, direct, j, i, e, ctx);
+                if (*e != LISP_ERROR_NONE) break;
+                int from = right ? j++ : i++;
+                lisp_vector_set(roots[SORT_TO], k++, lisp_vector_ref(roots[SORT_FROM], from));
+            }
+            while (i < mid) lisp_vector_set(roots[SORT_TO], k++, lisp_vector_ref(roots[SORT_FROM], i++));
+            while (j < hi) lisp_vector_set(roots[SORT_TO], k++, lisp_vector_ref(roots[SORT_FROM], j++));
+        }
+        Lisp from = roots[SORT_FROM];
+        roots[SORT_FROM] = roots[SORT_TO];
+        roots[SORT_TO] = from;
+    }
+
+    if (*e == LISP_ERROR_NONE)
+    {
+        for (int i = 0; i < n; ++i) lisp_vector_set(roots[SORT_VECTOR], i, lisp_vector_ref(roots[SORT_FROM], i));
+    }
+    lisp_pop_roots(SORT_ROOT_COUNT, ctx);
+}
+
+static Lisp sch_sort_inplace(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp* v = lisp_push_root(argv[0], ctx);
+    seq_sort_(*v, argv[1], e, ctx);
+    Lisp result = *v;
+    lisp_pop_roots(1, ctx);
+    return *e != LISP_ERROR_NONE ? lisp_null() : result;
+}
+
+// (sort sequence less) of a list or vector returns a sorted copy.
+static Lisp sch_sort(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    int is_list = lisp_type(argv[0]) != LISP_VECTOR;
+    if (is_list && !lisp_is_list(argv[0]))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp v;
+    if (is_list)
+    {
+        v = lisp_make_vector(lisp_list_length(argv[0]), ctx);
+        int i = 0;
+        for (Lisp it = argv[0]; lisp_is_pair(it); it = lisp_cdr(it)) lisp_vector_set(v, i++, lisp_car(it));
+    }
+    else
+    {
+        v = lisp_subvector(argv[0], 0, lisp_vector_length(argv[0]), ctx);
+    }
+
+    Lisp* root = lisp_push_root(v, ctx);
+    seq_sort_(*root, argv[1], e, ctx);
+    v = *root;
+    lisp_pop_roots(1, ctx);
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    if (!is_list) return v;
+
+    Lisp result = lisp_null();
+    for (int i = lisp_vector_length(v) - 1; i >= 0; --i) result = lisp_cons(lisp_vector_ref(v, i), result, ctx);
+    return result;
+}
+
+// GENERATORS
+// A generator describes a lazy sequence: a source, and stages applied to each element.
+// Nothing runs until a sink (fold, for-each, ->list) pulls the elements through,
+// one at a time and every stage at once, so there are no intermediate sequences,
+// and elements aren't allocated unless the source or a stage makes them.
+// It is a vector #(_GENERATOR source a b c stages), where stages is a list of
+// (kind . procedure or count), newest first. Adding a stage copies the vector,
+// so a generator can be run or extended any number of times.
+
+enum
+{
+    GEN_RANGE = 0, // start end (or #f) step
+    GEN_VECTOR,    // vector start end
+    GEN_LIST,      // list
+    GEN_FILE,      // path. datums are read as they are needed.
+};
+
+enum
+{
+    GEN_MAP = 0,
+    GEN_FILTER,
+    GEN_TAKE,
+    GEN_TAKE_WHILE,
+};
+
+enum
+{
+    GEN_SINK_FOLD = 0,
+    GEN_SINK_FOR_EACH,
+    GEN_SINK_LIST,
+};
+
+#define GEN_LENGTH_ 6
+
+static int is_generator_(Lisp x, LispContext ctx)
+{
+    return lisp_type(x) == LISP_VECTOR &&
+        lisp_vector_length(x) == GEN_LENGTH_ &&
+        lisp_eq(lisp_vector_ref(x, 0), lisp_make_symbol("_GENERATOR", ctx));
+}
+
+static Lisp make_generator_(int source, Lisp a, Lisp b, Lisp c, Lisp stages, LispContext ctx)
+{
+    Lisp g = lisp_make_vector(GEN_LENGTH_, ctx);
+    lisp_vector_set(g, 0, lisp_make_symbol("_GENERATOR", ctx));
+    lisp_vector_set(g, 1, lisp_make_int(source));
+    lisp_vector_set(g, 2, a);
+    lisp_vector_set(g, 3, b);
+    lisp_vector_set(g, 4, c);
+    lisp_vector_set(g, 5, stages);
+    return g;
 }
 
-static Lisp sch_gc_flip(Lisp args, LispError* e, LispContext ctx)
+static int is_number_(Lisp x)
 {
-    ARITY_CHECK(0, 0);
-    lisp_collect(lisp_null(), ctx);
-    return lisp_false();
+    return lisp_type(x) == LISP_INT || lisp_type(x) == LISP_REAL;
 }
 
-static Lisp sch_print_gc_stats(Lisp args, LispError* e, LispContext ctx)
+// (range-generator start [end step]). No end counts forever.
+static Lisp sch_range_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    lisp_print_collect_stats(ctx);
-    return lisp_false();
+    Lisp end = argc > 1 ? argv[1] : lisp_false();
+    Lisp step = argc > 2 ? argv[2] : lisp_make_int(1);
+    if (!is_number_(argv[0]) || !(is_number_(end) || (lisp_type(end) == LISP_BOOL && !lisp_bool(end))) || !is_number_(step))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    return make_generator_(GEN_RANGE, argv[0], end, step, lisp_null(), ctx);
 }
 
-static Lisp sch_call_cc(Lisp args, LispError* e, LispContext ctx)
+// (vector-generator v [start end]) of a vector, f64vector or s64vector.
+static Lisp sch_vector_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_call_cc(lisp_car(args), e, ctx);
+    int length;
+    switch (lisp_type(argv[0]))
+    {
+        case LISP_VECTOR: length = lisp_vector_length(argv[0]); break;
+        case LISP_F64VECTOR: case LISP_S64VECTOR: length = numvector_length_(argv[0]); break;
+        default:
+            *e = LISP_ERROR_ARG_TYPE;
+            return lisp_null();
+    }
+    int start, end;
+    if (!numvector_range_(argc, argv, 1, length, &start, &end, e)) return lisp_null();
+    return make_generator_(GEN_VECTOR, argv[0], lisp_make_int(start), lisp_make_int(end), lisp_null(), ctx);
 }
 
-static Lisp sch_is_cont(Lisp args, LispError* e, LispContext ctx)
+static Lisp sch_list_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
 {
-    ARITY_CHECK(1, 1);
-    return lisp_make_bool(lisp_type(lisp_car(args)) == LISP_JUMP);
+    return make_generator_(GEN_LIST, argv[0], lisp_null(), lisp_null(), lisp_null(), ctx);
+}
+
+// every datum in a file. The file is opened by each run, and closed when it ends.
+static Lisp sch_file_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_STRING)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    return make_generator_(GEN_FILE, argv[0], lisp_null(), lisp_null(), lisp_null(), ctx);
+}
+
+static Lisp sch_is_generator(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    return lisp_make_bool(is_generator_(argv[0], ctx));
+}
+
+// (_generator-stage kind x generator)
+static Lisp sch_generator_stage(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    Lisp g = argv[2];
+    if (!is_generator_(g, ctx) || lisp_type(argv[0]) != LISP_INT ||
+        (lisp_int(argv[0]) == GEN_TAKE && lisp_type(argv[1]) != LISP_INT))
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    Lisp stages = lisp_cons(lisp_cons(argv[0], argv[1], ctx), lisp_vector_ref(g, 5), ctx);
+    return make_generator_(
+            (int)lisp_int(lisp_vector_ref(g, 1)),
+            lisp_vector_ref(g, 2),
+            lisp_vector_ref(g, 3),
+            lisp_vector_ref(g, 4),
+            stages,
+            ctx
+    );
+}
+
+// Where a run keeps its values. Procedures may collect, so they are roots (see lisp_push_root).
+enum
+{
+    GEN_ROOT_GENERATOR = 0,
+    GEN_ROOT_STAGES,  // vector of kind, procedure or count left, in order
+    GEN_ROOT_SINK,
+    GEN_ROOT_CURSOR,  // list left, or the vector
+    GEN_ROOT_ACC,     // these two are the arguments to a fold
+    GEN_ROOT_X,
+    GEN_ROOT_COUNT
+};
+
+static int generator_next_(int source, Lisp* roots, LispInt* i, LispReal* r, int is_real,
+                           LispReader* reader, LispError* e, LispContext ctx)
+{
+    Lisp g = roots[GEN_ROOT_GENERATOR];
+    switch (source)
+    {
+        case GEN_RANGE:
+        {
+            Lisp end = lisp_vector_ref(g, 3);
+            Lisp step = lisp_vector_ref(g, 4);
+            if (is_real)
+            {
+                LispReal s = lisp_number_to_real(step);
+                if (is_number_(end) && (s >= 0 ? *r >= lisp_number_to_real(end) : *r <= lisp_number_to_real(end))) return 0;
+                roots[GEN_ROOT_X] = lisp_make_real(*r);
+                *r += s;
+            }
+            else
+            {
+                LispInt s = lisp_int(step);
+                if (is_number_(end) && (s >= 0 ? *i >= lisp_int(end) : *i <= lisp_int(end))) return 0;
+                roots[GEN_ROOT_X] = lisp_make_int(*i);
+                *i += s;
+            }
+            return 1;
+        }
+        case GEN_VECTOR:
+        {
+            if (*i >= lisp_int(lisp_vector_ref(g, 4))) return 0;
+            Lisp v = roots[GEN_ROOT_CURSOR];
+            roots[GEN_ROOT_X] = lisp_type(v) == LISP_VECTOR ? lisp_vector_ref(v, (int)*i) : numvector_ref_(v, (int)*i, e);
+            ++*i;
+            return *e == LISP_ERROR_NONE;
+        }
+        case GEN_LIST:
+        {
+            Lisp l = roots[GEN_ROOT_CURSOR];
+            if (!lisp_is_pair(l)) return 0;
+            roots[GEN_ROOT_X] = lisp_car(l);
+            roots[GEN_ROOT_CURSOR] = lisp_cdr(l);
+            return 1;
+        }
+        case GEN_FILE:
+        {
+            Lisp x = lisp_reader_next(reader, e, ctx);
+            if (*e != LISP_ERROR_NONE || lisp_equal(x, lisp_eof())) return 0;
+            roots[GEN_ROOT_X] = x;
+            return 1;
+        }
+        default:
+            assert(0);
+            return 0;
+    }
+}
+
+// (_generator-run sink procedure acc generator)
+static Lisp sch_generator_run(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    Lisp g = argv[3];
+    if (!is_generator_(g, ctx) || lisp_type(argv[0]) != LISP_INT)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+    int sink = (int)lisp_int(argv[0]);
+    int source = (int)lisp_int(lisp_vector_ref(g, 1));
+
+    // stages in the order they apply, with counts which the run can use up.
+    int n = lisp_list_length(lisp_vector_ref(g, 5));
+    Lisp stages = lisp_make_vector(2 * n, ctx);
+    int done = 0;
+    int k = n;
+    for (Lisp it = lisp_vector_ref(g, 5); lisp_is_pair(it); it = lisp_cdr(it))
+    {
+        --k;
+        lisp_vector_set(stages, 2 * k, lisp_car(lisp_car(it)));
+        lisp_vector_set(stages, 2 * k + 1, lisp_cdr(lisp_car(it)));
+        if (lisp_int(lisp_car(lisp_car(it))) == GEN_TAKE && lisp_int(lisp_cdr(lisp_car(it))) <= 0) done = 1;
+    }
+
+    FILE* file = NULL;
+    LispReader* reader = NULL;
+    if (source == GEN_FILE)
+    {
+        file = fopen(lisp_string(lisp_vector_ref(g, 2)), "r");
+        if (!file)
+        {
+            *e = LISP_ERROR_FILE_OPEN;
+            return lisp_null();
+        }
+        reader = lisp_reader_open(file);
+    }
+
+    Lisp* roots = lisp_push_root(g, ctx);
+    lisp_push_root(stages, ctx);
+    lisp_push_root(argv[1], ctx);
+    lisp_push_root(source == GEN_LIST || source == GEN_VECTOR ? lisp_vector_ref(g, 2) : lisp_null(), ctx);
+    lisp_push_root(sink == GEN_SINK_LIST ? lisp_null() : argv[2], ctx);
+    lisp_push_root(lisp_null(), ctx);
+
+    // range and vector positions
+    Lisp start = lisp_vector_ref(g, source == GEN_VECTOR ? 3 : 2);
+    int is_real = source == GEN_RANGE &&
+        (lisp_type(start) == LISP_REAL || lisp_type(lisp_vector_ref(g, 3)) == LISP_REAL || lisp_type(lisp_vector_ref(g, 4)) == LISP_REAL);
+    LispInt i = lisp_type(start) == LISP_INT ? lisp_int(start) : 0;
+    LispReal r = is_number_(start) ? lisp_number_to_real(start) : 0.0;
+
+    while (!done && *e == LISP_ERROR_NONE)
+    {
+        // nothing is held outside of the roots.
+        lisp_safe_point(ctx);
+        if (!generator_next_(source, roots, &i, &r, is_real, reader, e, ctx)) break;
+
+        int keep = 1;
+        for (k = 0; k < n && keep; ++k)
+        {
+            switch (lisp_int(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k)))
+            {
+                case GEN_MAP:
+                {
+                    Lisp x = lisp_apply_argv(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1), 1, roots + GEN_ROOT_X, e, ctx);
+                    roots[GEN_ROOT_X] = x;
+                    break;
+                }
+                case GEN_FILTER:
+                    keep = lisp_is_true(lisp_apply_argv(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1), 1, roots + GEN_ROOT_X, e, ctx));
+                    break;
+                case GEN_TAKE_WHILE:
+                    keep = lisp_is_true(lisp_apply_argv(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1), 1, roots + GEN_ROOT_X, e, ctx));
+                    if (!keep) done = 1;
+                    break;
+                case GEN_TAKE:
+                {
+                    // stop after the last one, instead of pulling another
+                    LispInt left = lisp_int(lisp_vector_ref(roots[GEN_ROOT_STAGES], 2 * k + 1)) - 1;
+                    lisp_vector_set(roots[GEN_ROOT_STAGES], 2 * k + 1, lisp_make_int(left));
+                    if (left <= 0) done = 1;
+                    break;
+                }
+            }
+            if (*e != LISP_ERROR_NONE) keep = 0;
+        }
+        if (!keep) continue;
+
+        switch (sink)
+        {
+            case GEN_SINK_FOLD:
+            {
+                Lisp acc = lisp_apply_argv(roots[GEN_ROOT_SINK], 2, roots + GEN_ROOT_ACC, e, ctx);
+                roots[GEN_ROOT_ACC] = acc;
+                break;
+            }
+            case GEN_SINK_FOR_EACH:
+                lisp_apply_argv(roots[GEN_ROOT_SINK], 1, roots + GEN_ROOT_X, e, ctx);
+                break;
+            case GEN_SINK_LIST:
+                roots[GEN_ROOT_ACC] = lisp_cons(roots[GEN_ROOT_X], roots[GEN_ROOT_ACC], ctx);
+                break;
+        }
+    }
+
+    Lisp result = roots[GEN_ROOT_ACC];
+    lisp_pop_roots(GEN_ROOT_COUNT, ctx);
+    if (reader)
+    {
+        lisp_reader_close(reader);
+        fclose(file);
+    }
+    if (*e != LISP_ERROR_NONE) return lisp_null();
+    return sink == GEN_SINK_LIST ? lisp_list_reverse(result) : result;
 }
 
 #undef ARITY_CHECK
 
+// PARALLELISM
+// A fixed pool of threads, each running its own context.
+// Procedures and their data are copied in to a worker (see lisp_copy_closure_to)
+// while it waits, and results are copied back by the caller.
+#ifdef LISP_THREADS_
+
+#define WORKER_MAX_ 64
+
+enum
+{
+    WORKER_STARTING = 0,
+    WORKER_IDLE,
+    WORKER_RESERVED, // a caller is copying in to it
+    WORKER_MAP,
+    WORKER_FUTURE,
+    WORKER_DONE,     // holding a result for its caller
+    WORKER_RESET,    // clearing its user environment before becoming idle
+};
+
+struct MapJob;
+
+typedef struct
+{
+    pthread_t thread;
+    LispContext ctx;
+    int state;
+    unsigned generation;
+    LispContext caller;
+    LispError error;
+    // handle in the caller to the slot a future's result is kept in, or -1.
+    LispHandle slot;
+
+    struct MapJob* job;
+    // indices left to map. Thieves take the upper half.
+    pthread_mutex_t range_lock;
+    int lo;
+    int hi;
+} Worker;
+
+typedef struct MapJob
+{
+    // the caller's vector of inputs. The caller waits, so it doesn't move.
+    Lisp input;
+    LispContext caller;
+    Worker* workers[WORKER_MAX_];
+    int worker_count;
+    int active;
+    LispError error;
+} MapJob;
+
+static struct
+{
+    pthread_mutex_t lock;
+    pthread_cond_t wake;    // workers wait for a job
+    pthread_cond_t changed; // callers wait for workers
+    int count;
+    Worker workers[WORKER_MAX_];
+} pool_ = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, PTHREAD_COND_INITIALIZER };
+
+static pthread_once_t pool_once_ = PTHREAD_ONCE_INIT;
+
+// workers keep what they are working on in globals, so it is saved by collections.
+static Lisp worker_get_(const char* name, LispContext ctx)
+{
+    int present;
+    return lisp_env_lookup(lisp_env(ctx), lisp_make_symbol(name, ctx), &present);
+}
+
+static void worker_set_(const char* name, Lisp x, LispContext ctx)
+{
+    lisp_env_define(lisp_env(ctx), lisp_make_symbol(name, ctx), x, ctx);
+}
+
+// next index to map, or -1 when everything is taken.
+static int worker_next_(Worker* w)
+{
+    pthread_mutex_lock(&w->range_lock);
+    int k = w->lo < w->hi ? w->lo++ : -1;
+    pthread_mutex_unlock(&w->range_lock);
+    if (k != -1) return k;
+
+    MapJob* job = w->job;
+    for (int i = 0; i < job->worker_count; ++i)
+    {
+        Worker* victim = job->workers[i];
+        if (victim == w) continue;
+
+        pthread_mutex_lock(&victim->range_lock);
+        int lo = victim->lo;
+        int hi = victim->hi;
+        int mid = lo + (hi - lo) / 2;
+        if (lo < hi) victim->hi = mid;
+        pthread_mutex_unlock(&victim->range_lock);
+
+        if (lo < hi)
+        {
+            pthread_mutex_lock(&w->range_lock);
+            w->lo = mid + 1;
+            w->hi = hi;
+            pthread_mutex_unlock(&w->range_lock);
+            return mid;
+        }
+    }
+    return -1;
+}
+
+static LispError worker_map_(Worker* w)
+{
+    MapJob* job = w->job;
+    LispContext ctx = w->ctx;
+
+    int k;
+    while ((k = worker_next_(w)) != -1)
+    {
+        LispError error;
+        // other workers copy out of the caller too, which is fine while it waits
+        Lisp x = lisp_copy_to(lisp_vector_ref(job->input, k), job->caller, ctx, &error);
+        if (error != LISP_ERROR_NONE) return error;
+
+        Lisp result = lisp_apply(worker_get_("_WORKER-PROC", ctx), lisp_cons(x, lisp_null(), ctx), &error, ctx);
+        if (error != LISP_ERROR_NONE) return error;
+
+        Lisp results = worker_get_("_WORKER-RESULT", ctx);
+        worker_set_("_WORKER-RESULT", lisp_cons(lisp_cons(lisp_make_int(k), result, ctx), results, ctx), ctx);
+    }
+    return LISP_ERROR_NONE;
+}
+
+static void* worker_main_(void* arg)
+{
+    Worker* w = arg;
+    LispContext ctx = lisp_init_with_lib();
+    lisp_set_auto_collect(8 * LISP_PAGE_SIZE, ctx);
+
+    pthread_mutex_lock(&pool_.lock);
+    w->ctx = ctx;
+    w->state = WORKER_IDLE;
+    pthread_cond_broadcast(&pool_.changed);
+
+    while (1)
+    {
+        while (w->state != WORKER_MAP && w->state != WORKER_FUTURE && w->state != WORKER_RESET)
+            pthread_cond_wait(&pool_.wake, &pool_.lock);
+
+        int state = w->state;
+        pthread_mutex_unlock(&pool_.lock);
+
+        LispError error = LISP_ERROR_NONE;
+        if (state == WORKER_MAP)
+        {
+            error = worker_map_(w);
+            if (error != LISP_ERROR_NONE)
+            {
+                // stop the others
+                MapJob* job = w->job;
+                for (int i = 0; i < job->worker_count; ++i)
+                {
+                    pthread_mutex_lock(&job->workers[i]->range_lock);
+                    job->workers[i]->lo = job->workers[i]->hi;
+                    pthread_mutex_unlock(&job->workers[i]->range_lock);
+                }
+            }
+        }
+        else if (state == WORKER_FUTURE)
+        {
+            Lisp result = lisp_apply(worker_get_("_WORKER-PROC", ctx), lisp_null(), &error, ctx);
+            worker_set_("_WORKER-RESULT", result, ctx);
+        }
+        else
+        {
+            // a new frame, so defines in it are seen by cached global references
+            lisp_set_env(lisp_env_extend(lisp_cdr(lisp_env(ctx)), lisp_make_table(ctx), ctx), ctx);
+            lisp_collect(lisp_null(), ctx);
+        }
+
+        pthread_mutex_lock(&pool_.lock);
+        if (state == WORKER_MAP)
+        {
+            if (w->job->error == LISP_ERROR_NONE) w->job->error = error;
+            --w->job->active;
+            w->state = WORKER_DONE;
+        }
+        else if (state == WORKER_FUTURE)
+        {
+            w->error = error;
+            w->state = WORKER_DONE;
+        }
+        else
+        {
+            w->state = WORKER_IDLE;
+        }
+        pthread_cond_broadcast(&pool_.changed);
+    }
+    return NULL;
+}
+
+static void pool_start_(void)
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    if (n < 1) n = 1;
+    if (n > WORKER_MAX_) n = WORKER_MAX_;
+
+    pthread_mutex_lock(&pool_.lock);
+    for (int i = 0; i < n; ++i)
+    {
+        Worker* w = pool_.workers + pool_.count;
+        w->state = WORKER_STARTING;
+        w->generation = 0;
+        w->slot = -1;
+        pthread_mutex_init(&w->range_lock, NULL);
+        if (pthread_create(&w->thread, NULL, worker_main_, w) != 0) break;
+        pthread_detach(w->thread);
+        ++pool_.count;
+    }
+    pthread_mutex_unlock(&pool_.lock);
+}
+
+static void pool_release_(Worker** workers, int n);
+
+// copies a finished future's result (or error) in to its slot in the caller,
+// and lets the worker go.
+static void future_claim_(Worker* w, LispContext ctx)
+{
+    LispError error = w->error;
+    Lisp result = lisp_null();
+    if (error == LISP_ERROR_NONE)
+        result = lisp_copy_to(worker_get_("_WORKER-RESULT", w->ctx), w->ctx, ctx, &error);
+
+    Lisp slot = lisp_handle_get(w->slot, ctx);
+    lisp_vector_set(slot, 1, lisp_make_int(error));
+    lisp_vector_set(slot, 2, result);
+    lisp_handle_free(w->slot, ctx);
+
+    pthread_mutex_lock(&pool_.lock);
+    w->slot = -1;
+    pthread_mutex_unlock(&pool_.lock);
+    pool_release_(&w, 1);
+}
+
+// claims up to max idle workers for the caller.
+// The caller's finished futures give their workers back first,
+// so futures which are never touched don't keep them.
+static int pool_reserve_(Worker** out, int max, LispContext caller)
+{
+    pthread_once(&pool_once_, pool_start_);
+
+    Worker* done[WORKER_MAX_];
+    int done_count = 0;
+    pthread_mutex_lock(&pool_.lock);
+    for (int i = 0; i < pool_.count; ++i)
+    {
+        Worker* w = pool_.workers + i;
+        if (w->state == WORKER_DONE && w->slot != -1 && w->caller.p == caller.p) done[done_count++] = w;
+    }
+    pthread_mutex_unlock(&pool_.lock);
+    for (int i = 0; i < done_count; ++i) future_claim_(done[i], caller);
+
+    pthread_mutex_lock(&pool_.lock);
+    // workers which are starting or resetting will be idle soon.
+    int waiting = 1;
+    while (waiting)
+    {
+        waiting = 0;
+        for (int i = 0; i < pool_.count; ++i)
+        {
+            int state = pool_.workers[i].state;
+            if (state == WORKER_STARTING || state == WORKER_RESET) waiting = 1;
+        }
+        if (waiting) pthread_cond_wait(&pool_.changed, &pool_.lock);
+    }
+
+    int n = 0;
+    for (int i = 0; i < pool_.count && n < max; ++i)
+    {
+        Worker* w = pool_.workers + i;
+        if (w->state != WORKER_IDLE) continue;
+        w->state = WORKER_RESERVED;
+        w->caller = caller;
+        out[n++] = w;
+    }
+    pthread_mutex_unlock(&pool_.lock);
+    return n;
+}
+
+static void pool_release_(Worker** workers, int n)
+{
+    pthread_mutex_lock(&pool_.lock);
+    for (int i = 0; i < n; ++i) workers[i]->state = WORKER_RESET;
+    pthread_cond_broadcast(&pool_.wake);
+    pthread_mutex_unlock(&pool_.lock);
+}
+
+// copies a procedure in to reserved workers.
+static LispError pool_send_proc_(Worker** workers, int n, Lisp proc, LispContext ctx)
+{
+    for (int i = 0; i < n; ++i)
+    {
+        LispError error;
+        Lisp copy = lisp_copy_closure_to(proc, ctx, workers[i]->ctx, &error);
+        if (error != LISP_ERROR_NONE) return error;
+        worker_set_("_WORKER-PROC", copy, workers[i]->ctx);
+        worker_set_("_WORKER-RESULT", lisp_null(), workers[i]->ctx);
+    }
+    return LISP_ERROR_NONE;
+}
+
+static Lisp sch_parallel_vector_map(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[1]) != LISP_VECTOR)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+
+    MapJob job;
+    job.input = argv[1];
+    job.caller = ctx;
+    job.error = LISP_ERROR_NONE;
+
+    int n = lisp_vector_length(job.input);
+    job.worker_count = pool_reserve_(job.workers, n < WORKER_MAX_ ? n : WORKER_MAX_, ctx);
+    // the library maps sequentially instead
+    if (job.worker_count == 0) return lisp_false();
+
+    *e = pool_send_proc_(job.workers, job.worker_count, argv[0], ctx);
+    if (*e != LISP_ERROR_NONE)
+    {
+        pool_release_(job.workers, job.worker_count);
+        return lisp_null();
+    }
+
+    pthread_mutex_lock(&pool_.lock);
+    job.active = job.worker_count;
+    for (int i = 0; i < job.worker_count; ++i)
+    {
+        Worker* w = job.workers[i];
+        w->job = &job;
+        w->lo = (int)((long long)n * i / job.worker_count);
+        w->hi = (int)((long long)n * (i + 1) / job.worker_count);
+        w->state = WORKER_MAP;
+    }
+    pthread_cond_broadcast(&pool_.wake);
+    while (job.active > 0) pthread_cond_wait(&pool_.changed, &pool_.lock);
+    pthread_mutex_unlock(&pool_.lock);
+
+    Lisp result = lisp_null();
+    *e = job.error;
+    if (*e == LISP_ERROR_NONE)
+    {
+        result = lisp_make_vector(n, ctx);
+        for (int i = 0; i < job.worker_count && *e == LISP_ERROR_NONE; ++i)
+        {
+            LispContext w_ctx = job.workers[i]->ctx;
+            Lisp it = lisp_copy_to(worker_get_("_WORKER-RESULT", w_ctx), w_ctx, ctx, e);
+            while (lisp_is_pair(it))
+            {
+                Lisp entry = lisp_car(it);
+                lisp_vector_set(result, (int)lisp_int(lisp_car(entry)), lisp_cdr(entry));
+                it = lisp_cdr(it);
+            }
+        }
+    }
+    pool_release_(job.workers, job.worker_count);
+    return result;
+}
+
+// returns a slot for the result of a worker running thunk, or #f if none are free.
+// The slot is #(ticket error result), and error is #f until the result is copied in.
+static Lisp sch_future_start(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    Worker* w;
+    if (pool_reserve_(&w, 1, ctx) == 0) return lisp_false();
+
+    *e = pool_send_proc_(&w, 1, argv[0], ctx);
+    if (*e != LISP_ERROR_NONE)
+    {
+        pool_release_(&w, 1);
+        return lisp_null();
+    }
+
+    Lisp slot = lisp_make_vector(3, ctx);
+    lisp_vector_set(slot, 1, lisp_false());
+    lisp_vector_set(slot, 2, lisp_null());
+    LispHandle h = lisp_handle_new(slot, ctx);
+
+    pthread_mutex_lock(&pool_.lock);
+    unsigned generation = ++w->generation;
+    w->slot = h;
+    w->state = WORKER_FUTURE;
+    pthread_cond_broadcast(&pool_.wake);
+    pthread_mutex_unlock(&pool_.lock);
+
+    lisp_vector_set(slot, 0, lisp_make_int((LispInt)generation * WORKER_MAX_ + (w - pool_.workers)));
+    return slot;
+}
+
+static Lisp sch_future_wait(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    if (lisp_type(argv[0]) != LISP_VECTOR || lisp_vector_length(argv[0]) != 3 ||
+        lisp_type(lisp_vector_ref(argv[0], 0)) != LISP_INT || lisp_int(lisp_vector_ref(argv[0], 0)) < 0)
+    {
+        *e = LISP_ERROR_ARG_TYPE;
+        return lisp_null();
+    }
+
+    // still with its worker
+    if (lisp_type(lisp_vector_ref(argv[0], 1)) != LISP_INT)
+    {
+        LispInt ticket = lisp_int(lisp_vector_ref(argv[0], 0));
+        Worker* w = pool_.workers + ticket % WORKER_MAX_;
+
+        pthread_mutex_lock(&pool_.lock);
+        int valid = ticket % WORKER_MAX_ < pool_.count && w->generation == (unsigned)(ticket / WORKER_MAX_) &&
+            w->caller.p == ctx.p && (w->state == WORKER_FUTURE || w->state == WORKER_DONE);
+        while (valid && w->state != WORKER_DONE) pthread_cond_wait(&pool_.changed, &pool_.lock);
+        pthread_mutex_unlock(&pool_.lock);
+
+        if (!valid)
+        {
+            fprintf(lisp_stderr(ctx), "not a running future.\n");
+            *e = LISP_ERROR_RUNTIME;
+            return lisp_null();
+        }
+        future_claim_(w, ctx);
+    }
+
+    *e = (LispError)lisp_int(lisp_vector_ref(argv[0], 1));
+    return *e == LISP_ERROR_NONE ? lisp_vector_ref(argv[0], 2) : lisp_null();
+}
+
+#else
+
+// without threads the library runs everything sequentially.
+static Lisp sch_parallel_vector_map(int argc, Lisp* argv, LispError* e, LispContext ctx) { return lisp_false(); }
+static Lisp sch_future_start(int argc, Lisp* argv, LispError* e, LispContext ctx) { return lisp_false(); }
+static Lisp sch_future_wait(int argc, Lisp* argv, LispError* e, LispContext ctx)
+{
+    *e = LISP_ERROR_RUNTIME;
+    return lisp_null();
+}
+
+#endif
+
 static const LispFuncDef lib_cfunc_defs[] = {
     
     { "ERROR", sch_error },
@@ -1299,33 +3079,43 @@ static const LispFuncDef lib_cfunc_defs[] = {
     { "WRITE", sch_write },
     { "DISPLAY", sch_display },
     { "WRITE-CHAR", sch_write_char },
+    { "OPEN-OUTPUT-STRING", sch_open_output_string },
+    { "GET-OUTPUT-STRING", sch_get_output_string },
+    { "_SET-OUTPUT-PORT!", sch_set_output_port },
     { "FLUSH-OUTPUT-PORT", sch_flush },
     { "READ", sch_read },
+    { "READ-SHARED", sch_read_shared },
+    { "READ-FILE", NULL, sch_read_file, 1, 1 },
     { "EOF-OBJECT?", sch_is_eof },
+    { "WRITE-BINARY", sch_write_binary },
+    { "READ-BINARY", sch_read_binary },
     
     // Universal Time https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Universal-Time.html
     { "GET-UNIVERSAL-TIME", sch_univeral_time },
+    // Machine Time https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Machine-Time.html
+    { "REAL-TIME", NULL, sch_real_time, 0, 0 },
+    { "RUNTIME", NULL, sch_runtime, 0, 0 },
     { "PRINT-GC-STATISTICS", sch_print_gc_stats },
     
     { "MACROEXPAND", sch_macroexpand },
     
     // Equivalence Predicates https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Equivalence-Predicates.html
-    { "EQ?", sch_exact_eq },
-    { "EQV?", sch_equal },
-    { "EQUAL?", sch_equal_r },
+    { "EQ?", NULL, sch_exact_eq, 2, 2 },
+    { "EQV?", NULL, sch_equal, 2, 2 },
+    { "EQUAL?", NULL, sch_equal_r, 2, 2 },
     
     // Booleans https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Booleans.html
     { "BOOLEAN?", sch_is_boolean },
     { "NOT", sch_not },
 
     // PAIRS
-    { "CONS", sch_cons },
-    { "CAR", sch_car },
-    { "CDR", sch_cdr },
-    { "SET-CAR!", sch_set_car },
-    { "SET-CDR!", sch_set_cdr },
-    { "NULL?", sch_is_null },
-    { "PAIR?", sch_is_pair },
+    { "CONS", NULL, sch_cons, 2, 2 },
+    { "CAR", NULL, sch_car, 1, 1 },
+    { "CDR", NULL, sch_cdr, 1, 1 },
+    { "SET-CAR!", NULL, sch_set_car, 2, 2 },
+    { "SET-CDR!", NULL, sch_set_cdr, 2, 2 },
+    { "NULL?", NULL, sch_is_null, 1, 1 },
+    { "PAIR?", NULL, sch_is_pair, 1, 1 },
 
     // Lists https://groups.csail.mit.edu/mac/ftpdir/scheme-7.4/doc-html/scheme_8.html
     { "LIST", sch_list },
@@ -1342,20 +3132,63 @@ static const LispFuncDef lib_cfunc_defs[] = {
     { "VECTOR?", sch_is_vector },
     { "MAKE-VECTOR", sch_make_vector },
     { "VECTOR-GROW", sch_vector_grow },
-    { "VECTOR-LENGTH", sch_vector_length },
-    { "VECTOR-SET!", sch_vector_set },
+    { "VECTOR-LENGTH", NULL, sch_vector_length, 1, 1 },
+    { "VECTOR-SET!", NULL, sch_vector_set, 3, 3 },
     { "VECTOR-SWAP!", sch_vector_swap },
-    { "VECTOR-REF", sch_vector_ref },
+    { "VECTOR-REF", NULL, sch_vector_ref, 2, 2 },
     { "VECTOR-FILL!", sch_vector_fill },
     { "VECTOR-ASSQ", sch_vector_assq },
     { "SUBVECTOR", sch_subvector },
     { "LIST->VECTOR", sch_list_to_vector },
     { "VECTOR->LIST", sch_vector_to_list },
 
+    // Numeric vectors (SRFI 4 names) and bulk operations on them
+    { "MAKE-F64VECTOR", NULL, sch_f64vector_make, 1, 2 },
+    { "F64VECTOR", NULL, sch_f64vector_new, 0, -1 },
+    { "F64VECTOR?", NULL, sch_f64vector_is, 1, 1 },
+    { "F64VECTOR-LENGTH", NULL, sch_f64vector_length, 1, 1 },
+    { "F64VECTOR-REF", NULL, sch_f64vector_ref, 2, 2 },
+    { "F64VECTOR-SET!", NULL, sch_f64vector_set, 3, 3 },
+    { "F64VECTOR->LIST", NULL, sch_f64vector_to_list, 1, 1 },
+    { "LIST->F64VECTOR", NULL, sch_f64vector_from_list, 1, 1 },
+    { "F64VECTOR->VECTOR", NULL, sch_f64vector_to_vector, 1, 1 },
+    { "VECTOR->F64VECTOR", NULL, sch_f64vector_from_vector, 1, 1 },
+    { "F64VECTOR-COPY", NULL, sch_f64vector_copy, 1, 3 },
+    { "F64VECTOR-FILL!", NULL, sch_f64vector_fill, 2, 4 },
+    { "F64VECTOR-ADD", NULL, sch_f64vector_add, 2, 2 },
+    { "F64VECTOR-MUL", NULL, sch_f64vector_mul, 2, 2 },
+    { "F64VECTOR-SCALE", NULL, sch_f64vector_scale, 2, 2 },
+    { "F64VECTOR-SUM", NULL, sch_f64vector_sum, 1, 1 },
+    { "F64VECTOR-DOT", NULL, sch_f64vector_dot, 2, 2 },
+    { "F64VECTOR-MIN", NULL, sch_f64vector_min, 1, 1 },
+    { "F64VECTOR-MAX", NULL, sch_f64vector_max, 1, 1 },
+    { "F64VECTOR-SORT!", NULL, sch_f64vector_sort, 1, 1 },
+
+    { "MAKE-S64VECTOR", NULL, sch_s64vector_make, 1, 2 },
+    { "S64VECTOR", NULL, sch_s64vector_new, 0, -1 },
+    { "S64VECTOR?", NULL, sch_s64vector_is, 1, 1 },
+    { "S64VECTOR-LENGTH", NULL, sch_s64vector_length, 1, 1 },
+    { "S64VECTOR-REF", NULL, sch_s64vector_ref, 2, 2 },
+    { "S64VECTOR-SET!", NULL, sch_s64vector_set, 3, 3 },
+    { "S64VECTOR->LIST", NULL, sch_s64vector_to_list, 1, 1 },
+    { "LIST->S64VECTOR", NULL, sch_s64vector_from_list, 1, 1 },
+    { "S64VECTOR->VECTOR", NULL, sch_s64vector_to_vector, 1, 1 },
+    { "VECTOR->S64VECTOR", NULL, sch_s64vector_from_vector, 1, 1 },
+    { "S64VECTOR-COPY", NULL, sch_s64vector_copy, 1, 3 },
+    { "S64VECTOR-FILL!", NULL, sch_s64vector_fill, 2, 4 },
+    { "S64VECTOR-ADD", NULL, sch_s64vector_add, 2, 2 },
+    { "S64VECTOR-MUL", NULL, sch_s64vector_mul, 2, 2 },
+    { "S64VECTOR-SCALE", NULL, sch_s64vector_scale, 2, 2 },
+    { "S64VECTOR-SUM", NULL, sch_s64vector_sum, 1, 1 },
+    { "S64VECTOR-DOT", NULL, sch_s64vector_dot, 2, 2 },
+    { "S64VECTOR-MIN", NULL, sch_s64vector_min, 1, 1 },
+    { "S64VECTOR-MAX", NULL, sch_s64vector_max, 1, 1 },
+    { "S64VECTOR-SORT!", NULL, sch_s64vector_sort, 1, 1 },
+
     // Strings https://groups.csail.mit.edu/mac/ftpdir/scheme-7.4/doc-html/scheme_7.html#SEC61
     { "STRING?", sch_is_string },
     { "MAKE-STRING", sch_make_string },
-    { "STRING=?", sch_equal_r },
+    { "STRING=?", NULL, sch_equal_r, 2, 2 },
     { "STRING<?", sch_string_less },
     { "SUBSTRING", sch_substring },
     { "STRING-NULL?", sch_string_is_null },
@@ -1372,7 +3205,7 @@ static const LispFuncDef lib_cfunc_defs[] = {
 
     // Characters https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Characters.html#Characters
     { "CHAR?", sch_is_char },
-    { "CHAR=?", sch_equals },
+    { "CHAR=?", NULL, sch_equals, 0, -1 },
     { "CHAR<?", sch_char_less },
     { "CHAR-UPCASE", sch_char_upcase },
     { "CHAR-DOWNCASE", sch_char_downcase },
@@ -1384,12 +3217,12 @@ static const LispFuncDef lib_cfunc_defs[] = {
 
     // Association Lists https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Association-Lists.html
     // Numerical operations https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Numerical-operations.html
-    { "=", sch_equals },
-    { "+", sch_add },
-    { "-", sch_sub },
-    { "*", sch_mult },
-    { "/", sch_divide },
-    { "<", sch_less },
+    { "=", NULL, sch_equals, 0, -1 },
+    { "+", NULL, sch_add, 0, -1 },
+    { "-", NULL, sch_sub, 1, 2 },
+    { "*", NULL, sch_mult, 0, -1 },
+    { "/", NULL, sch_divide, 2, 2 },
+    { "<", NULL, sch_less, 2, 2 },
     { "INTEGER?", sch_is_int },
     { "EVEN?", sch_is_even },
     { "REAL?", sch_is_real },
@@ -1425,6 +3258,7 @@ static const LispFuncDef lib_cfunc_defs[] = {
 
     // Environments https://groups.csail.mit.edu/mac/ftpdir/scheme-7.4/doc-html/scheme_14.html
     { "EVAL", sch_eval },
+    { "COMPILE", sch_compile },
     { "SYSTEM-GLOBAL-ENVIRONMENT", sch_system_env },
     { "USER-INITIAL-ENVIRONMENT", sch_user_env },
     // { "THE-ENVIRONMENT", sch_current_env },
@@ -1432,17 +3266,46 @@ static const LispFuncDef lib_cfunc_defs[] = {
     // Hash Tables https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Basic-Hash-Table-Operations.html#Basic-Hash-Table-Operations
     { "HASH-TABLE?", sch_is_table },
     { "MAKE-HASH-TABLE", sch_table_make },
+    { "MAKE-EQUAL-HASH-TABLE", sch_equal_table_make },
+    { "MAKE-STRING-HASH-TABLE", sch_equal_table_make },
     { "HASH-TABLE-SET!", sch_table_set },
     { "HASH-TABLE-REF", sch_table_get },
     { "HASH-TABLE-SIZE", sch_table_size },
     { "HASH-TABLE->ALIST", sch_table_to_alist },
 
+    { "MAP", NULL, sch_map, 2, -1 },
+    { "FOR-EACH", NULL, sch_for_each, 2, -1 },
+    { "FILTER", NULL, sch_filter, 2, 2 },
+    { "REDUCE", NULL, sch_reduce, 3, 3 },
+    { "ASSQ", NULL, sch_assq, 2, 2 },
+    { "ASSV", NULL, sch_assv, 2, 2 },
+    { "ASSOC", NULL, sch_assoc, 2, 2 },
+    { "MEMQ", NULL, sch_memq, 2, 2 },
+    { "MEMV", NULL, sch_memv, 2, 2 },
+    { "MEMBER", NULL, sch_member, 2, 2 },
+    { "VECTOR-MAP", NULL, sch_vector_map, 2, 2 },
+    { "VECTOR-BINARY-SEARCH", NULL, sch_vector_binary_search, 4, 4 },
+    { "SORT", NULL, sch_sort, 2, 2 },
+    { "SORT!", NULL, sch_sort_inplace, 2, 2 },
+
     { "PROMISE?", sch_is_promise },
     { "MAKE-PROMISE", sch_make_promise },
     { "_PROMISE-PROCEDURE", sch_promise_proc },
     { "_PROMISE-STORE!", sch_promise_store },
     { "PROMISE-VALUE", sch_promise_val },
     { "PROMISE-FORCED?", sch_promise_forced },
+
+    { "GENERATOR?", NULL, sch_is_generator, 1, 1 },
+    { "RANGE-GENERATOR", NULL, sch_range_generator, 1, 3 },
+    { "VECTOR-GENERATOR", NULL, sch_vector_generator, 1, 3 },
+    { "LIST-GENERATOR", NULL, sch_list_generator, 1, 1 },
+    { "FILE-GENERATOR", NULL, sch_file_generator, 1, 1 },
+    { "_GENERATOR-STAGE", NULL, sch_generator_stage, 3, 3 },
+    { "_GENERATOR-RUN", NULL, sch_generator_run, 4, 4 },
+
+    { "_PARALLEL-VECTOR-MAP", NULL, sch_parallel_vector_map, 2, 2 },
+    { "_FUTURE-START", NULL, sch_future_start, 1, 1 },
+    { "_FUTURE-WAIT", NULL, sch_future_wait, 1, 1 },
     
     // Procedures https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-ref/Procedure-Operations.html#Procedure-Operations
     { "APPLY", sch_apply },
@@ -1460,6 +3323,7 @@ static const LispFuncDef lib_cfunc_defs[] = {
    
     // Garbage Collection https://www.gnu.org/software/mit-scheme/documentation/mit-scheme-user/Garbage-Collection.html
     { "GC-FLIP", sch_gc_flip },
+    { "GC-STATISTICS", NULL, sch_gc_statistics, 0, 0 },
     
     { NULL, NULL }
     
@@ -1484,6 +3348,9 @@ void lisp_lib_load(LispContext ctx)
 
     for (int i = 0; i < n; ++i)
     {
+        // eval may collect
+        system_env = lisp_cdr(lisp_env(ctx));
+
         LispError error;
         Lisp src = lisp_read(to_load[i], &error, ctx);
 
@@ -1508,9 +3375,17 @@ void lisp_lib_load(LispContext ctx)
 #endif
 }
 
+const LispFuncDef* lisp_lib_funcs(void) { return lib_cfunc_defs; }
+
 LispContext lisp_init_with_lib(void)
 {
-    LispContext ctx = lisp_init();
+    LispContext ctx;
+#ifdef LISP_LIB_IMAGE_
+    // start from the baked image, unless it was made with different build options.
+    ctx = lisp_init_image(lib_image_, sizeof(lib_image_), lib_cfunc_defs);
+    if (ctx.p) return ctx;
+#endif
+    ctx = lisp_init();
     lisp_lib_load(ctx);
     return ctx;
 }
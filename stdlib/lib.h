@@ -19,9 +19,14 @@ extern "C" {
 
 void lisp_lib_load(LispContext ctx);
 
-// convenience for init and load
+// convenience for init and load.
+// Starts from the baked library image when the build options match it (see lisp_image_save).
 LispContext lisp_init_with_lib(void);
 
+// The C functions defined by the library.
+// Images with the library in them need these (see lisp_image_save).
+const LispFuncDef* lisp_lib_funcs(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,44 @@
+// calls into the library the way a C host does.
+#include <stdio.h>
+
+#define LISP_IMPLEMENTATION
+#include "lisp.h"
+#include "lisp_lib.h"
+
+static int failures = 0;
+
+static void check(int ok, const char* what)
+{
+    if (!ok)
+    {
+        fprintf(stderr, "failed: %s\n", what);
+        ++failures;
+    }
+}
+
+int main(void)
+{
+    LispContext ctx = lisp_init();
+    lisp_lib_load(ctx);
+
+    // a lambda built from unexpanded code
+    LispError e;
+    Lisp args = lisp_read("(x)", &e, ctx);
+    Lisp body = lisp_read("(cond (x 1) (else 2))", &e, ctx);
+    Lisp l = lisp_make_lambda(args, body, lisp_env(ctx), ctx);
+
+    Lisp result = lisp_apply(l, lisp_cons(lisp_true(), lisp_null(), ctx), &e, ctx);
+    check(e == LISP_ERROR_NONE && lisp_int(result) == 1, "host lambda with lisp_apply");
+
+    Lisp x = lisp_false();
+    result = lisp_apply_argv(l, 1, &x, &e, ctx);
+    check(e == LISP_ERROR_NONE && lisp_int(result) == 2, "host lambda with lisp_apply_argv");
+
+    // and called from lisp
+    lisp_env_define(lisp_env(ctx), lisp_make_symbol("HOST-LAMBDA", ctx), l, ctx);
+    result = lisp_eval(lisp_read("(list (host-lambda #t) (host-lambda #f))", &e, ctx), &e, ctx);
+    check(e == LISP_ERROR_NONE && lisp_equal_r(result, lisp_read("(1 2)", &e, ctx)), "host lambda called from lisp");
+
+    lisp_shutdown(ctx);
+    return failures == 0 ? 0 : 1;
+}
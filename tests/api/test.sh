@@ -0,0 +1,8 @@
+#!/bin/sh
+
+# build and run the C test of the embedding API.
+${CC:-cc} test.c -o test -I../../dist -Wall -pedantic -Wstrict-prototypes -lm -lpthread || exit 1
+./test
+RESULT=$?
+rm -f test
+exit $RESULT
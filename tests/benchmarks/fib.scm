@@ -0,0 +1,22 @@
+; call heavy recursion
+(load "harness.scm")
+
+(define (fib n)
+  (if (< n 2)
+      n
+      (+ (fib (- n 1)) (fib (- n 2)))))
+
+(define (tak x y z)
+  (if (not (< y x))
+      z
+      (tak (tak (- x 1) y z)
+           (tak (- y 1) z x)
+           (tak (- z 1) x y))))
+
+(bench "fib" (lambda () (fib 25)))
+(bench "tak" (lambda () (tak 18 12 6)))
+
+(define (count-down n)
+  (if (= n 0) 'done (count-down (- n 1))))
+
+(bench "count-down" (lambda () (count-down 1000000)))
@@ -0,0 +1,19 @@
+; collection pauses under a large live set
+(load "harness.scm")
+
+(define (make-tree depth)
+  (if (= depth 0)
+      (make-vector 4 depth)
+      (cons (make-tree (- depth 1)) (make-tree (- depth 1)))))
+
+; long lived. minor collections shouldn't copy it again.
+(define live (make-tree 16))
+(gc-flip)
+
+(define (garbage n) (if (> n 0) (begin (make-vector 10 n) (garbage (- n 1)))))
+
+(bench "gc-young" (lambda () (garbage 20000) (gc-flip)))
+; every run copies a new tree, which survives the collection
+(bench "gc-promote" (lambda () (let ((tree (make-tree 14))) (gc-flip) (car tree))))
+; every run promotes a large vector, which stays in place
+(bench "gc-large" (lambda () (let ((v (make-vector 300000 0))) (gc-flip) (vector-length v))))
@@ -0,0 +1,47 @@
+; Benchmark harness. Each case file loads this and calls bench,
+; which prints one JSON object with its timings and the collector's counters.
+
+(define bench-warmup 1)
+(define bench-runs 5)
+
+(define (bench-stat name) (cdr (assq name (gc-statistics))))
+
+(define (bench-sum alist)
+  (if (null? alist) 0 (+ (cdr (car alist)) (bench-sum (cdr alist)))))
+
+(define (bench-us ms) (inexact->exact (round (* ms 1000))))
+
+(define (bench-field name value last)
+  (write name)
+  (display ": ")
+  (if (string? value) (write value) (display value))
+  (if (not last) (display ", ")))
+
+; runs thunk bench-warmup times, then bench-runs times measuring each.
+(define (bench name thunk)
+  (do ((i 0 (+ i 1))) ((= i bench-warmup)) (thunk))
+  (let ((collections (bench-stat 'collections))
+        (pause (bench-stat 'pause-total-us))
+        (copied (bench-stat 'bytes-copied))
+        (allocated (bench-sum (bench-stat 'bytes-allocated))))
+    (define (measure i times)
+      (if (= i bench-runs)
+          times
+          (let ((start (real-time)))
+            (thunk)
+            (measure (+ i 1) (cons (- (real-time) start) times)))))
+    (let ((times (measure 0 '())))
+      (display "{")
+      (bench-field "name" name #f)
+      (bench-field "runs" bench-runs #f)
+      (bench-field "min_us" (bench-us (reduce min (car times) times)) #f)
+      (bench-field "mean_us" (bench-us (/ (reduce + 0 times) bench-runs)) #f)
+      (bench-field "max_us" (bench-us (reduce max 0 times)) #f)
+      (bench-field "gc_collections" (- (bench-stat 'collections) collections) #f)
+      (bench-field "gc_pause_total_us" (- (bench-stat 'pause-total-us) pause) #f)
+      ; the longest pause since the process started
+      (bench-field "gc_pause_max_us" (bench-stat 'pause-max-us) #f)
+      (bench-field "gc_bytes_copied" (- (bench-stat 'bytes-copied) copied) #f)
+      (bench-field "bytes_allocated" (- (bench-sum (bench-stat 'bytes-allocated)) allocated) #t)
+      (display "}")
+      (newline))))
@@ -0,0 +1,18 @@
+; hash table inserts and lookups
+(load "harness.scm")
+
+(define (fill table n key)
+  (do ((i 0 (+ i 1))) ((= i n) table)
+    (hash-table-set! table (key i) i)))
+
+(define (lookup table n key)
+  (do ((i 0 (+ i 1)) (sum 0 (+ sum (hash-table-ref table (key i) 0)))) ((= i n) sum)))
+
+(define string-keys (make-initialized-vector 10000 number->string))
+
+(bench "hash-table-int" (lambda ()
+  (lookup (fill (make-hash-table) 20000 (lambda (i) i)) 20000 (lambda (i) i))))
+
+(bench "hash-table-string" (lambda ()
+  (let ((key (lambda (i) (vector-ref string-keys i))))
+    (lookup (fill (make-equal-hash-table) 10000 key) 10000 key))))
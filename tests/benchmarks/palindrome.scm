@@ -7,6 +7,8 @@
 
 ; 2,000 total
 
+(load "harness.scm")
+
 (define (palindrome? n)
   (define (check i str)
     (if (> (* i 2) (string-length str))
@@ -17,18 +19,19 @@
         #f)))
   (check 0 (number->string n)))
 
-(define nums '())
-  
+(define (largest-palindrome)
+  (define nums '())
+  (do ((i 100 (+ i 1)))
+    ((> i 999) 'done)
+    (do ((j 100 (+ j 1)))
+      ((> j 999) 'done)
+      (let ((n (* i j)))
+        (if (>= n 100000)
+          (if (palindrome? n)
+               (push n nums)
+            )))))
+  (reduce max 0 nums))
 
-(do ((i 100 (+ i 1)))
-  ((> i 999) 'done)
-  (do ((j 100 (+ j 1)))
-    ((> j 999) 'done)
-    (let ((n (* i j)))
-      (if (>= n 100000)
-        (if (palindrome? n)
-             (push n nums)
-          )))))
-                            
-(display (reduce max 0 nums))
+(assert (= (largest-palindrome) 906609))
+(bench "palindrome" largest-palindrome)
 
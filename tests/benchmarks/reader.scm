@@ -0,0 +1,4 @@
+; reader throughput
+(load "harness.scm")
+
+(bench "read-file" (lambda () (read-file "../data/big_data_gen.sexpr")))
@@ -0,0 +1,39 @@
+#!/bin/sh
+# Runs every benchmark, interpreted and compiled, and prints a JSON array of results.
+
+LISP=../../lisp
+RESULTS=$(mktemp)
+FIRST=1
+
+echo "["
+for MODE in interpreted compiled
+do
+    FLAGS="--auto-gc"
+    if [ $MODE = "compiled" ]
+    then
+        FLAGS="--compile --auto-gc"
+    fi
+
+    for FILE in *.scm
+    do
+        if [ "$FILE" = "harness.scm" ]
+        then
+            continue
+        fi
+
+        $LISP $FLAGS --script "$FILE" > "$RESULTS" || { echo "*FAILED* $FILE ($MODE)" >&2; rm -f "$RESULTS"; exit 1; }
+
+        while read -r LINE
+        do
+            if [ $FIRST = "0" ]
+            then
+                echo ","
+            fi
+            FIRST=0
+            printf '  {"mode": "%s", "file": "%s", %s' "$MODE" "$FILE" "${LINE#\{}"
+        done < "$RESULTS"
+    done
+done
+rm -f "$RESULTS"
+echo ""
+echo "]"
@@ -0,0 +1,24 @@
+; list and vector processing
+(load "harness.scm")
+
+(random-seed! 7)
+(define numbers (vector->list (make-initialized-vector 20000 (lambda (i) (random 100000)))))
+
+(bench "sort" (lambda () (sort! (list->vector numbers) <)))
+(bench "sort-lambda" (lambda () (sort numbers (lambda (a b) (< a b)))))
+(bench "reduce" (lambda () (reduce + 0 numbers)))
+(bench "map" (lambda () (map (lambda (x) (* x x)) numbers)))
+(bench "filter" (lambda () (filter even? numbers)))
+(bench "vector-map" (lambda () (vector-map (lambda (x) (+ x 1)) (list->vector numbers))))
+
+(define column (list->f64vector numbers))
+(bench "f64vector-dot" (lambda () (f64vector-dot column (f64vector-scale column 0.5))))
+(bench "f64vector-sort" (lambda () (f64vector-sort! (f64vector-copy column))))
+
+(define (integers-from n) (cons-stream n (integers-from (+ n 1))))
+(define (square x) (* x x))
+(define (even-int? x) (= (remainder x 2) 0))
+(bench "promise-stream"
+       (lambda () (stream-fold + 0 (stream-take (stream-filter even-int? (stream-map square (integers-from 0))) 20000))))
+(bench "generator"
+       (lambda () (stream-fold + 0 (stream-take (stream-filter even-int? (stream-map square (range-generator 0))) 20000))))
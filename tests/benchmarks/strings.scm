@@ -0,0 +1,18 @@
+; building strings
+(load "harness.scm")
+
+(define (append-loop n acc)
+  (if (= n 0)
+      acc
+      (append-loop (- n 1) (string-append acc "x"))))
+
+(define (port-loop n)
+  (let ((port (open-output-string)))
+    (do ((i 0 (+ i 1))) ((= i n) (get-output-string port))
+      (display i port)
+      (write-char #\space port))))
+
+(bench "string-append" (lambda () (append-loop 2000 "")))
+(bench "string-port" (lambda () (port-loop 20000)))
+(bench "number->string" (lambda ()
+  (do ((i 0 (+ i 1))) ((= i 20000)) (number->string (* i 1.5)))))
@@ -0,0 +1,50 @@
+; Bytecode compiler
+
+(define (compile-and-run expr) (eval (compile expr) (user-initial-environment)))
+
+(==> (compile-and-run '(+ 1 2)) 3)
+(==> (compile-and-run '(if #f 1)) ())
+(==> (compile-and-run '(begin)) ())
+(==> (compile-and-run ''(a b)) (a b))
+
+(compile-and-run
+  '(define (cfib n)
+     (if (< n 2) n (+ (cfib (- n 1)) (cfib (- n 2))))))
+
+(assert (compound-procedure? cfib))
+(==> (cfib 15) 610)
+
+; tail calls run in constant space
+(compile-and-run
+  '(define (count-down n) (if (= n 0) 'done (count-down (- n 1)))))
+(==> (count-down 100000) done)
+
+; closures, internal definitions and set!
+(compile-and-run
+  '(define (make-acc total)
+     (define (add! x) (set! total (+ total x)) total)
+     add!))
+
+(let ((acc (make-acc 10)))
+  (acc 5)
+  (==> (acc 5) 20))
+
+(compile-and-run '(define (c-rest a . rest) (list a rest)))
+(==> (c-rest 1 2 3) (1 (2 3)))
+(==> (c-rest 1) (1 ()))
+
+; compiled and interpreted procedures call each other
+(==> (map cfib '(1 2 3 4 5)) (1 1 2 3 5))
+(==> (compile-and-run '(map (lambda (x) (* x x)) '(1 2 3))) (1 4 9))
+
+; macros are expanded before compiling
+(==> (compile-and-run '(let loop ((i 0) (acc '())) (if (= i 3) acc (loop (+ i 1) (cons i acc))))) (2 1 0))
+
+; escaping with call/cc
+(==> (compile-and-run
+       '(call/cc (lambda (k) (for-each (lambda (x) (if (> x 2) (k x))) '(1 2 3 4)) 'none)))
+     3)
+
+; survives a collection
+(compile-and-run '(define (gc-then x) (gc-flip) (list x (cfib 10))))
+(==> (gc-then 'a) (a 55))
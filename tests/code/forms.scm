@@ -89,3 +89,68 @@
   (==> x B)
   (==> y A))
 
+
+; Lexical scope
+(define (make-counter)
+  (define count 0)
+  (lambda () (set! count (+ count 1)) count))
+
+(let ((c1 (make-counter))
+      (c2 (make-counter)))
+  (c1)
+  (c1)
+  (==> (c1) 3)
+  (==> (c2) 1))
+
+(define (shadow x)
+  (let ((y (* x 2)))
+    (let ((x (+ y 1)))
+      (list x y))))
+(==> (shadow 3) (7 6))
+
+(define (rest-args a . rest) (cons a rest))
+(==> (rest-args 1 2 3) (1 2 3))
+(==> (rest-args 1) (1))
+
+(define (env-test x) (define y 2) (lambda () (+ x y)))
+(==> (eval '(+ x y) (procedure-environment (env-test 1))) 3)
+
+; eval caches the expansion of each form
+(define-macro twice (lambda (x) `(* 2 ,x)))
+(define cached-form '(twice ((lambda (a) (+ a 1)) x)))
+(define x 1)
+(==> (eval cached-form (user-initial-environment)) 4)
+(==> (eval cached-form (user-initial-environment)) 4)
+(==> (eval cached-form (procedure-environment (env-test 5))) 12)
+(gc-flip)
+(==> (eval cached-form (user-initial-environment)) 4)
+; and notices when the form is changed
+(define changed-form (list '+ 1 2))
+(==> (eval changed-form (user-initial-environment)) 3)
+(set-car! (cdr changed-form) 10)
+(==> (eval changed-form (user-initial-environment)) 12)
+(define nested-form (list 'string-append "a" (list 'string #\b)))
+(==> (eval nested-form (user-initial-environment)) "ab")
+(set-car! (cdr (list-ref nested-form 2)) #\c)
+(==> (eval nested-form (user-initial-environment)) "ac")
+; defining a macro drops cached expansions
+(define-macro twice (lambda (x) `(* 3 ,x)))
+(==> (eval '(twice 1) (user-initial-environment)) 3)
+
+; global references see assignments and new definitions which shadow them
+(define counter 0)
+(define (get-counter) counter)
+(define (bump!) (set! counter (+ counter 1)))
+(==> (get-counter) 0)
+(bump!)
+(bump!)
+(==> (get-counter) 2)
+(define counter 10)
+(==> (get-counter) 10)
+(define (absolute x) (abs x))
+(==> (absolute -3) 3)
+(define (abs x) 'shadowed)
+(==> (absolute -3) shadowed)
+(define (call-undefined) (not-defined-yet 1))
+(define (not-defined-yet x) (+ x 1))
+(==> (call-undefined) 2)
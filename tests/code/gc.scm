@@ -32,6 +32,104 @@
 
 (==> (call/cc (lambda (throw) (define x '(1 2 3)) (gc-flip) (throw x))) (1 2 3))
 
+
+; old objects which are modified to point at young ones
+(define old-vector (make-vector 3 0))
+(define old-list (list 1 2 3))
+(define old-table (make-hash-table))
+(define old-promise (delay (list 'forced (string-append "x" "y"))))
+(gc-flip)
+
+(vector-set! old-vector 0 (list 'young "data"))
+(set-car! old-list (string-append "a" "b"))
+(hash-table-set! old-table (string->symbol "fresh-key") (list 1 2))
+(force old-promise)
+(define (garbage n) (if (> n 0) (begin (make-vector 10 n) (garbage (- n 1)))))
+(garbage 1000)
+(gc-flip)
+(garbage 1000)
+
+(==> (vector-ref old-vector 0) (young "data"))
+(assert (string=? (car old-list) "ab"))
+(==> (hash-table-ref old-table (string->symbol "fresh-key") #f) (1 2))
+(==> (force old-promise) (forced "xy"))
+
+; keys which move. Equal tables hash contents, eq tables rehash the address.
+(define moved-key (list 'k))
+(define eq-table (make-hash-table))
+(define equal-table (make-equal-hash-table))
+(hash-table-set! eq-table moved-key 1)
+(hash-table-set! equal-table (string-append "str" "ing") 2)
+(hash-table-set! equal-table (gensym) 3)
+(gc-flip)
+(garbage 1000)
+(gc-flip)
+(==> (hash-table-ref eq-table moved-key #f) 1)
+(==> (hash-table-ref equal-table "string" #f) 2)
+
+; cumulative statistics
+(define (gc-stat name) (cdr (assq name (gc-statistics))))
+(define collections (gc-stat 'collections))
+(define vector-bytes (cdr (assq 'vector (gc-stat 'bytes-allocated))))
+(garbage 100)
+(gc-flip)
+(assert (> (gc-stat 'collections) collections))
+(assert (>= (- (cdr (assq 'vector (gc-stat 'bytes-allocated))) vector-bytes) (* 100 10 8)))
+(assert (> (cdr (assq 'pair (gc-stat 'live-counts))) 0))
+(assert (= (vector-length (gc-stat 'pause-histogram)) 20))
+
 (print-gc-statistics)
 
+; large objects are marked in place instead of copied
+(define large (make-vector 100000 0))
+(define large-table (make-hash-table))
+(let loop ((i 0))
+  (if (< i 40000) (begin (hash-table-set! large-table i (* i i)) (loop (+ i 1)))))
+(vector-set! large 99999 (list 'end))
+(gc-flip)
+(vector-set! large 0 (string-append "young" "!"))
+(hash-table-set! large-table 'young (list 1 2))
+(garbage 1000)
+(gc-flip)
+(assert (string=? (vector-ref large 0) "young!"))
+(==> (vector-ref large 99999) (end))
+(==> (hash-table-ref large-table 'young #f) (1 2))
+(assert (= (hash-table-ref large-table 39999 #f) (* 39999 39999)))
+(define copied (gc-stat 'bytes-copied))
+(make-vector 100000 1)
+(gc-flip)
+(gc-flip)
+(assert (< (- (gc-stat 'bytes-copied) copied) 100000))
+(assert (= (vector-length large) 100000))
+
+; collections reuse the pages they free
+(define reused (gc-stat 'pages-reused))
+(define (grow n acc) (if (= n 0) acc (grow (- n 1) (cons n acc))))
+(do ((i 0 (+ i 1))) ((= i 4)) (grow 100000 '()) (gc-flip))
+(assert (> (gc-stat 'pages-reused) reused))
+(assert (> (gc-stat 'pages-pooled) 0))
+
+; and free them once the live set shrinks
+(define big (grow 1000000 '()))
+(gc-flip #t)
+(gc-flip #t)
+(define pooled (gc-stat 'pages-pooled))
+(set! big #f)
+(gc-flip #t)
+(gc-flip #t)
+(assert (< (* 2 (gc-stat 'pages-pooled)) pooled))
 
+; lambdas which can't capture their frames reuse them
+(define (count-down n) (if (= n 0) 'done (count-down (- n 1))))
+(define (tree-sum n) (if (= n 0) 1 (+ (tree-sum (- n 1)) (tree-sum (- n 1)))))
+(define vector-bytes (cdr (assq 'vector (gc-stat 'bytes-allocated))))
+(==> (count-down 100000) done)
+(assert (< (- (cdr (assq 'vector (gc-stat 'bytes-allocated))) vector-bytes) 10000))
+(assert (= (tree-sum 12) 4096))
+(define (keep-frame n) (if (= n 0) (gc-flip) (begin (keep-frame (- n 1)) n)))
+(assert (= (keep-frame 50) 50))
+(define (make-adder n) (lambda (x) (+ x n)))
+(define add3 (make-adder 3))
+(define add4 (make-adder 4))
+(==> (map add3 (list (add4 1) (add4 2))) (8 9))
+(assert (= (call/cc (lambda (k) (count-down 10) (tree-sum 3) (k 7))) 7))
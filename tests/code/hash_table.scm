@@ -27,3 +27,31 @@
 (assert (equal? '() (hash-table-ref h3 'HASH)))
 
 
+; keys compared with equal?
+(define e (make-equal-hash-table))
+(hash-table-set! e "apple" 1)
+(hash-table-set! e (string-append "pe" "ar") 2)
+(hash-table-set! e '(1 2 (3)) 3)
+(hash-table-set! e #(a "b") 4)
+(hash-table-set! e 5 5)
+(hash-table-set! e 'sym 6)
+
+(==> (hash-table-ref e (string-append "app" "le") #f) 1)
+(==> (hash-table-ref e "pear" #f) 2)
+(==> (hash-table-ref e (list 1 2 (list 3)) #f) 3)
+(==> (hash-table-ref e (vector 'a "b") #f) 4)
+(==> (hash-table-ref e 5.0 #f) 5)
+(==> (hash-table-ref e 'sym #f) 6)
+(==> (hash-table-ref e "plum" #f) #f)
+(==> (hash-table-size e) 6)
+
+(hash-table-set! e "apple" 10)
+(==> (hash-table-ref e "apple" #f) 10)
+(==> (hash-table-size e) 6)
+
+(define s (make-string-hash-table))
+(do ((i 0 (+ i 1))) ((= i 200))
+  (hash-table-set! s (number->string i) i))
+(==> (hash-table-size s) 200)
+(==> (hash-table-ref s "123" #f) 123)
+(==> (hash-table-ref (make-hash-table) "123" #f) #f)
@@ -30,6 +30,20 @@
 
 (==> (append '(a) '(b c d))  (a b c d))   
 (==> (sort '(1 4 2 6 3) <) (1 2 3 4 6))
+(==> (sort '() <) ())
+; sorting is stable
+(==> (sort '((b . 2) (a . 1) (c . 2) (d . 1)) (lambda (x y) (< (cdr x) (cdr y))))
+     ((a . 1) (d . 1) (b . 2) (c . 2)))
+(==> (map + '(1 2 3) '(10 20)) (11 22))
+(==> (map (lambda (x) (gc-flip) (list x)) '(1 2)) ((1) (2)))
+(==> (filter even? '(1 2 3 4)) (2 4))
+(==> (filter (lambda (x) (> x 2)) '(1 2 3 4)) (3 4))
+(==> (reduce - 10 '(1 2 3)) 4)
+(define visited '())
+(for-each (lambda (x y) (set! visited (cons (+ x y) visited))) '(1 2) '(3 4))
+(==> visited (6 4))
+(==> (assv 2 '((1 . a) 3 (2 . b))) (2 . b))
+(==> (memv 2.0 '(1 2.0 3)) (2.0 3))
 (==> (make-list 4 1) (1 1 1 1))
 
 (==> (memq 'a '(a b c)) (a b c))
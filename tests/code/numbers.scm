@@ -80,3 +80,14 @@
 
 
  
+
+; argument vector functions
+(==> (+) 0)
+(==> (*) 1)
+(==> (- 5) -5)
+(==> (+ 1 2 3 4 5 6 7 8 9 10) 55)
+(==> (apply + '(1 2 3 4)) 10)
+(==> (apply < '(1 2)) #t)
+(assert (compiled-procedure? +))
+(assert (procedure? car))
+(==> (map car '((1 2) (3 4))) (1 3))
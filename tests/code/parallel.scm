@@ -0,0 +1,65 @@
+; parallel-map and futures run on worker contexts
+
+(define (square x) (* x x))
+(define offset 10)
+(define (f x) (+ (square x) offset))
+
+(==> (parallel-map f '(1 2 3 4 5)) (11 14 19 26 35))
+(==> (parallel-map f '()) ())
+(==> (parallel-map + '(1 2) '(3 4)) (4 6))
+(==> (parallel-vector-map f #()) #())
+
+(define v (make-initialized-vector 5000 (lambda (i) i)))
+(define r (parallel-vector-map (lambda (x) (list x (f x) "s" 'sym (make-vector 2 x))) v))
+(assert (= (vector-length r) 5000))
+(assert (equal? (vector-ref r 4999) (list 4999 (f 4999) "s" 'SYM (make-vector 2 4999))))
+(do ((i 0 (+ i 1)))
+  ((= i 5000))
+  (assert (= (car (vector-ref r i)) i)))
+
+; closures bring their frames
+(define (adder n) (lambda (x) (+ x n)))
+(==> (parallel-map (adder 100) '(1 2 3)) (101 102 103))
+
+; shared structure and tables survive the copy
+(define shared (list 1 2))
+(define h (make-equal-hash-table))
+(hash-table-set! h "key" shared)
+(define copied (parallel-map (lambda (x) (list x x)) (list h shared)))
+(define h2 (car (car copied)))
+(assert (eq? (car (car copied)) (car (cdr (car copied)))))
+(==> (hash-table-ref h2 "key" (lambda () #f)) (1 2))
+
+; nested
+(==> (parallel-map (lambda (x) (apply + (parallel-map square (list x x)))) '(1 2 3)) (2 8 18))
+
+(define futures (map (lambda (i) (future (lambda () (f i)))) '(1 2 3 4 5 6 7 8)))
+(==> (map touch futures) (11 14 19 26 35 46 59 74))
+
+(define fut (future (lambda () (vector-length v))))
+(==> (touch fut) 5000)
+(==> (touch fut) 5000)
+
+; a worker reset by an earlier job still sees new definitions which shadow a global
+(define (f0 x) (abs x))
+(define (shadow-job x)
+  (let ((b (f0 x)))
+    (eval '(define (abs y) 'shadow) (user-initial-environment))
+    (list b (f0 x))))
+(==> (parallel-map shadow-job '(-1)) ((1 shadow)))
+
+; futures which are never touched give their workers back once they finish
+(do ((i 0 (+ i 1)))
+  ((= i 100))
+  (future (lambda () i)))
+(define probe #f)
+(define (in-worker?)
+  (set! probe #f)
+  (parallel-map (lambda (x) (set! probe #t)) '(1))
+  (not probe))
+; they may still be running
+(define (retry n)
+  (cond ((in-worker?) #t)
+        ((= n 0) #f)
+        (else (do ((i 0 (+ i 1))) ((= i 1000))) (retry (- n 1)))))
+(assert (retry 10000))
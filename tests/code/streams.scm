@@ -30,3 +30,37 @@
   (cons-stream n (integers-starting-from (+ n 1))))
 
 (assert (equal? (stream-head (integers-starting-from 0) 5) '(0 1 2 3 4)))
+
+(==> (stream->list (stream-map (lambda (x) (* x x)) (stream 1 2 3))) (1 4 9))
+(==> (stream-head (stream-filter even? (integers-starting-from 0)) 3) (0 2 4))
+(==> (stream->list (stream-take (integers-starting-from 0) 3)) (0 1 2))
+(==> (stream-fold + 0 (stream 1 2 3)) 6)
+
+; generators run their stages together when they are folded
+(define squares (stream-map (lambda (x) (* x x)) (range-generator 0)))
+(assert (generator? squares))
+(assert (not (generator? (stream 1 2))))
+(==> (stream->list (stream-take (stream-filter even? squares) 4)) (0 4 16 36))
+(==> (stream->list (stream-take squares 3)) (0 1 4))
+(==> (stream-fold + 0 (range-generator 0 101)) 5050)
+(==> (stream->list (range-generator 10 0 -4)) (10 6 2))
+(==> (stream->list (range-generator 0 1 0.5)) (0.0 0.5))
+(==> (stream->list (vector-generator #(a b c d) 1)) (b c d))
+(==> (stream->list (vector-generator (f64vector 1.5 2.5))) (1.5 2.5))
+(==> (stream->list (stream-take-while (lambda (x) (< x 3)) (list-generator '(1 2 3 1)))) (1 2))
+(==> (stream->list (stream-take (range-generator 0) 0)) ())
+
+(define pulled 0)
+(stream->list (stream-take (stream-map (lambda (x) (set! pulled (+ pulled 1)) x) (range-generator 0)) 5))
+(==> pulled 5)
+
+(define seen '())
+(stream-for-each (lambda (x) (set! seen (cons x seen))) (list-generator '(1 2 3)))
+(==> seen (3 2 1))
+
+; values stay live when collections run in the middle
+(==> (stream->list (stream-map (lambda (x) (gc-flip) (list x)) (list-generator (list "a" "b"))))
+     (("a") ("b")))
+
+(assert (= (stream-fold (lambda (acc x) (+ acc 1)) 0 (file-generator "streams.scm"))
+           (length (read-file "streams.scm"))))
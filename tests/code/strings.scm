@@ -38,6 +38,23 @@
 
 (==> (string->number (number->string 0.5)) 0.5)
 
+; reals print with the fewest digits which read back the same
+(==> (number->string 0.5) "0.5")
+(==> (number->string 100.0) "100.0")
+(==> (number->string -0.001) "-0.001")
+(==> (number->string (+ 0.1 0.2)) "0.30000000000000004")
+(==> (number->string 1e300) "1e+300")
+(==> (number->string 1.5e-20) "1.5e-20")
+(==> (string->number "2.5e3") 2500.0)
+(==> 2e-3 0.002)
+(define third (/ 1.0 3.0))
+(assert (= (string->number (number->string third)) third))
+(==> (with-output-to-string (lambda () (write '(1 (2.5 . "x") #(a #t) . 3)))) "(1 (2.5 . \"x\") #(A #t) . 3)")
+
+; nesting deeper than the C stack would allow
+(define (nest n x) (if (= n 0) x (nest (- n 1) (list x))))
+(==> (string-length (with-output-to-string (lambda () (write (nest 200000 'a))))) 400001)
+
 
 (assert (symbol<? 'A 'B))
 (assert (not (symbol<? 'WALK 'DOG)))
@@ -49,3 +66,29 @@
 
 (==> (string #\a #\b) "ab")
 (==> (string) "")
+
+(==> (substring "hello world" 6 11) "world")
+(==> (substring "hello" 2 100) "llo")
+(==> (string-head "hello" 2) "he")
+(==> (string-tail "hello" 3) "lo")
+(==> (string-copy "abc") "abc")
+(==> (string-length (string-append "ab" "" "cde")) 5)
+(==> (string-length (make-string 1000 #\z)) 1000)
+(assert (not (string=? "ab" "abc")))
+
+; string ports
+(define port (open-output-string))
+(write 'abc port)
+(write-char #\space port)
+(write "q\"s" port)
+(display " " port)
+(display 12 port)
+(newline port)
+(==> (get-output-string port) "ABC \"q\\\"s\" 12\n")
+
+(define (count-to n)
+  (do ((i 0 (+ i 1))) ((= i n)) (display i)))
+(define digits (with-output-to-string (lambda () (count-to 1000))))
+(==> (string-length digits) 2890)
+(==> (substring digits 0 5) "01234")
+(==> (with-output-to-string (lambda () (write '(1 "two" #\3)))) "(1 \"two\" #\\3)")
@@ -46,6 +46,15 @@
 ; Binary serach
 (assert (= (vector-binary-search #(1 2 3 4 5) < (lambda (x) x) 3) 3))
 (assert (not (vector-binary-search #(1 2 2 4 5) < (lambda (x) x) 3)))
+(assert (not (vector-binary-search #(2 4) < (lambda (x) x) 1)))
+(assert (not (vector-binary-search #() < (lambda (x) x) 1)))
+(==> (vector-binary-search #((1 . a) (3 . b) (7 . c)) < car 7) (7 . c))
+
+(==> (vector-map (lambda (x) (* x x)) #(1 2 3)) #(1 4 9))
+(==> (sort #(3 1 2) <) #(1 2 3))
+(define unsorted (vector 3 1 2))
+(==> (sort! unsorted (lambda (a b) (gc-flip) (> a b))) #(3 2 1))
+(==> unsorted #(3 2 1))
 
 (define v (vector 1 1 2))
 (vector-fill! v 3)
@@ -73,3 +82,60 @@
 (assert (not (vector-assq 'bad-key avector)))
 
 
+
+; Numeric vectors
+(define fv (f64vector 1 2.5 -3))
+(assert (f64vector? fv))
+(assert (not (f64vector? #(1 2))))
+(assert (not (s64vector? fv)))
+(==> (f64vector-length fv) 3)
+(==> (f64vector-ref fv 0) 1.0)
+(f64vector-set! fv 0 4.5)
+(==> (f64vector->list fv) (4.5 2.5 -3.0))
+(==> fv #f64(4.5 2.5 -3))
+(assert (not (equal? fv #f64(4.5 2.5))))
+(==> (list->f64vector '(1 2)) #f64(1.0 2.0))
+(==> (f64vector->vector #f64(1 2)) #(1.0 2.0))
+(==> (vector->s64vector #(1 2 3)) #s64(1 2 3))
+(==> (make-s64vector 3 7) #s64(7 7 7))
+(==> (make-f64vector 2) #f64(0 0))
+(==> (s64vector-copy #s64(1 2 3 4) 1 3) #s64(2 3))
+
+(define a (list->f64vector '(1 2 3 4 5 6 7 8 9)))
+(define b (make-f64vector 9 2))
+(==> (f64vector-add a b) #f64(3 4 5 6 7 8 9 10 11))
+(==> (f64vector-mul a b) #f64(2 4 6 8 10 12 14 16 18))
+(==> (f64vector-scale a 0.5) #f64(0.5 1 1.5 2 2.5 3 3.5 4 4.5))
+(==> (f64vector-sum a) 45.0)
+(==> (f64vector-dot a b) 90.0)
+(==> (f64vector-min #f64(3 -1 2)) -1.0)
+(==> (f64vector-max #f64(3 -1 2)) 3.0)
+(==> (s64vector-sum #s64(1 2 3 4 5)) 15)
+(==> (s64vector-dot #s64(1 2 3) #s64(4 5 6)) 32)
+(==> (s64vector-max #s64(4 9 -2)) 9)
+(==> (f64vector-sort! (f64vector 3 1 2 -5)) #f64(-5 1 2 3))
+(==> (s64vector-sort! (s64vector 3 1 2 -5)) #s64(-5 1 2 3))
+(define c (make-s64vector 5 0))
+(s64vector-fill! c 9 1 3)
+(==> c #s64(0 9 9 0 0))
+
+; the limits of a LISP_TAGGED int come back out of an s64vector unchanged
+(define int-max 140737488355327)
+(define int-min (- -1 int-max))
+(define limits (s64vector int-max int-min))
+(assert (= (s64vector-ref limits 0) int-max))
+(assert (= (s64vector-ref limits 1) int-min))
+(assert (equal? (s64vector->list limits) (list int-max int-min)))
+(assert (= (s64vector-sum (s64vector int-max -1 1)) int-max))
+(assert (= (s64vector-min limits) int-min))
+
+; equal numeric vectors are the same key in an equal table
+(define t (make-equal-hash-table))
+(hash-table-set! t #f64(1 2) 'found)
+(==> (hash-table-ref t (f64vector 1 2) #f) found)
+
+; they survive collection
+(define big (make-f64vector 100000 1))
+(gc-flip)
+(==> (f64vector-sum big) 100000.0)
+(assert (assq 'F64VECTOR (cdr (assq 'ALLOCATIONS (gc-statistics)))))
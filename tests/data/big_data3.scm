@@ -0,0 +1,13 @@
+; gen, from the binary format
+(let ((data (read-binary)))
+    (display "records: ")
+    (display (length data))
+    (newline)
+    (let ((record (car data)))
+        (assert (= (cdr (vector-assq 'index record)) 0))
+        (assert (eq? (cdr (vector-assq 'isActive record)) 'False))
+        (assert (= (cdr (vector-assq 'age record)) 21)))
+    (assert (eof-object? (read-binary))))
+
+(display "done")
+(newline)
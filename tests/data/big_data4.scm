@@ -0,0 +1,15 @@
+; gen, with equal parts read as one object
+(let ((data (read-shared)))
+    (display "records: ")
+    (display (length data))
+    (newline)
+    (let ((record (car data))
+          (third (list-ref data 2)))
+        (assert (= (cdr (vector-assq 'index record)) 0))
+        (assert (= (cdr (vector-assq 'age record)) 21))
+        (assert (equal? (vector-assq 'eyeColor record) '(eyeColor . "blue")))
+        (assert (eq? (vector-assq 'eyeColor record) (vector-assq 'eyeColor third)))
+        (assert (not (eq? (vector-assq 'index record) (vector-assq 'index third))))))
+
+(display "done")
+(newline)
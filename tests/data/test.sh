@@ -2,3 +2,6 @@
 
 cat big_data_gen.sexpr |  ../../lisp --script big_data1.scm
 cat big_data_canada.sexpr |  ../../lisp --script big_data2.scm
+cat big_data_canada.sexpr |  ../../lisp --gc-threads 4 --script big_data2.scm
+cat big_data_gen.sexpr |  ../../printer --to-binary | ../../lisp --script big_data3.scm
+cat big_data_gen.sexpr |  ../../lisp --script big_data4.scm
@@ -12,3 +12,7 @@ cat temp1.scm | ../../printer > temp2.scm
 cmp temp1.scm temp2.scm
 
 
+
+# 4. the binary format should round trip to the same output
+cat sample.scm | ../../printer --to-binary | ../../printer --from-binary > temp3.scm
+cmp temp1.scm temp3.scm